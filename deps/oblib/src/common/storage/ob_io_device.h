@@ -389,6 +389,19 @@ public:
     const int64_t size,
     int64_t &write_size) = 0;
 
+  //mmap interfaces, only for sealed blocks, the returned buf is read only and valid until the
+  //block is freed
+  virtual int mmap_block(
+    const ObIOFd &block_id,
+    const int64_t offset,
+    const int64_t size,
+    const char *&buf) = 0;
+  virtual int madvise_block(
+    const ObIOFd &block_id,
+    const int64_t offset,
+    const int64_t size,
+    const int advice) = 0;
+
   //async io interfaces
   virtual int io_setup(
     uint32_t max_events,
@@ -163,6 +163,9 @@ struct AChunk {
     struct {
       struct {
         uint8_t is_hugetlb_ : 1;
+        uint8_t is_thp_ : 1; // advised with MADV_HUGEPAGE
+        uint8_t hp_ctx_ : 2; // ObHugePageHelper::HugePageCtx
+        uint8_t numa_node_ : 4; // numa node + 1, 0 if not bound
       };
     };
   };
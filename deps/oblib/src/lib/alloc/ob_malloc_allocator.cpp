@@ -161,7 +161,12 @@ void ObMallocAllocator::free(void *ptr)
     abort_unless(block->obj_set_ != NULL);
 
     ObjectSet *set = block->obj_set_;
-    set->free_object(obj);
+    ObjectMgr *obj_mgr = set->get_obj_mgr();
+    if (OB_NOT_NULL(obj_mgr)) {
+      obj_mgr->free_object(obj);
+    } else {
+      set->free_object(obj);
+    }
   }
 #endif // PERF_MODE
 }
@@ -347,6 +352,25 @@ void ObMallocAllocator::get_tenant_label_usage(
   }
 }
 
+void ObMallocAllocator::get_tenant_thread_cache_stat(
+  uint64_t tenant_id, int64_t &hit_cnt, int64_t &miss_cnt) const
+{
+  hit_cnt = 0;
+  miss_cnt = 0;
+  ObTenantCtxAllocator *allocator = nullptr;
+  for (int64_t i = 0; i < ObCtxIds::MAX_CTX_ID; i++) {
+    if (OB_ISNULL(allocator = get_tenant_ctx_allocator(tenant_id, i))) {
+      // do nothing
+    } else {
+      int64_t ctx_hit_cnt = 0;
+      int64_t ctx_miss_cnt = 0;
+      allocator->get_thread_cache_stat(ctx_hit_cnt, ctx_miss_cnt);
+      hit_cnt += ctx_hit_cnt;
+      miss_cnt += ctx_miss_cnt;
+    }
+  }
+}
+
 void ObMallocAllocator::print_tenant_ctx_memory_usage(uint64_t tenant_id) const
 {
   ObTenantCtxAllocator *allocator = NULL;
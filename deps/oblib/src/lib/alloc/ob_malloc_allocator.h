@@ -60,6 +60,8 @@ public:
   static int64_t get_tenant_remain(uint64_t tenant_id);
   int64_t get_tenant_ctx_hold(const uint64_t tenant_id, const uint64_t ctx_id) const;
   void get_tenant_label_usage(uint64_t tenant_id, ObLabel &label, common::ObLabelItem &item) const;
+  // hits and misses of the thread caches (ObjectThreadCache) on all ctxs of the tenant
+  void get_tenant_thread_cache_stat(uint64_t tenant_id, int64_t &hit_cnt, int64_t &miss_cnt) const;
 
   void print_tenant_ctx_memory_usage(uint64_t tenant_id) const;
   void print_tenant_memory_usage(uint64_t tenant_id) const;
@@ -220,7 +220,8 @@ void ObTenantCtxAllocator::print_usage() const
     if (ctx_hold_bytes > 0 || sum_item.used_ > 0) {
       _LOG_INFO("\n[MEMORY] tenant_id=%5ld ctx_id=%25s hold=% '15ld used=% '15ld limit=% '15ld"
                 "\n[MEMORY] idle_size=% '10ld free_size=% '10ld"
-                "\n[MEMORY] wash_related_chunks=% '10ld washed_blocks=% '10ld washed_size=% '10ld\n%s",
+                "\n[MEMORY] wash_related_chunks=% '10ld washed_blocks=% '10ld washed_size=% '10ld"
+                "\n[MEMORY] thread_cache_hit=% '10ld thread_cache_miss=% '10ld\n%s",
           tenant_id_,
           get_global_ctx_info().get_ctx_name(ctx_id_),
           ctx_hold_bytes,
@@ -231,6 +232,8 @@ void ObTenantCtxAllocator::print_usage() const
           ATOMIC_LOAD(&wash_related_chunks_),
           ATOMIC_LOAD(&washed_blocks_),
           ATOMIC_LOAD(&washed_size_),
+          ATOMIC_LOAD(&obj_mgr_.tc_hit_cnt_),
+          ATOMIC_LOAD(&obj_mgr_.tc_miss_cnt_),
           buf);
     }
   }
@@ -163,6 +163,11 @@ public:
   bool update_hold(const int64_t size);
   int set_idle(const int64_t size, const bool reserve = false);
   IBlockMgr &get_block_mgr() { return obj_mgr_; }
+  void get_thread_cache_stat(int64_t &hit_cnt, int64_t &miss_cnt) const
+  {
+    hit_cnt = ATOMIC_LOAD(&obj_mgr_.tc_hit_cnt_);
+    miss_cnt = ATOMIC_LOAD(&obj_mgr_.tc_miss_cnt_);
+  }
   void get_chunks(AChunk **chunks, int cap, int &cnt);
   using VisitFunc = std::function<int(ObLabel &label,
                                       common::LabelItem *l_item)>;
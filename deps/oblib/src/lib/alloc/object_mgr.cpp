@@ -17,6 +17,244 @@
 using namespace oceanbase;
 using namespace lib;
 
+bool ObjectThreadCache::enable_ = false;
+int64_t ObjectThreadCache::global_version_ = 0;
+uint8_t ObjectThreadCache::registry_lock_ = 0;
+ObjectThreadCache *ObjectThreadCache::registry_head_ = NULL;
+
+ObjectThreadCache &ObjectThreadCache::get_instance()
+{
+  // zero initialized, see the comment of on_thread_exit
+  static thread_local ObjectThreadCache cache;
+  return cache;
+}
+
+void ObjectThreadCache::set_enable(const bool enable)
+{
+  if (enable != ATOMIC_LOAD(&enable_)) {
+    ATOMIC_STORE(&enable_, enable);
+    // the caches being used are drained by their threads at next alloc or free
+    expire_all();
+    if (!enable) {
+      // the owner holds its cache lock only within a single pop or push, wait for it so that
+      // nothing is left cached after disabled
+      Lock::Guard guard(get_registry_lock());
+      for (ObjectThreadCache *cache = registry_head_; NULL != cache; cache = cache->next_) {
+        Lock::Guard cache_guard(cache->get_lock());
+        cache->drain();
+      }
+    }
+  }
+}
+
+int64_t ObjectThreadCache::wash(const ObjectMgr &mgr)
+{
+  int64_t washed_size = 0;
+  Lock::Guard guard(get_registry_lock());
+  for (ObjectThreadCache *cache = registry_head_; NULL != cache; cache = cache->next_) {
+    Lock::Guard cache_guard(cache->get_lock());
+    washed_size += cache->drain(mgr);
+  }
+  return washed_size;
+}
+
+int64_t ObjectThreadCache::try_wash(const ObjectMgr &mgr)
+{
+  int64_t washed_size = 0;
+  Lock::Guard guard(get_registry_lock());
+  for (ObjectThreadCache *cache = registry_head_; NULL != cache; cache = cache->next_) {
+    if (cache->get_lock().try_lock()) {
+      washed_size += cache->drain(mgr);
+      cache->get_lock().unlock();
+    }
+  }
+  return washed_size;
+}
+
+int64_t ObjectThreadCache::get_cached_bytes()
+{
+  int64_t cached_bytes = 0;
+  Lock::Guard guard(get_registry_lock());
+  for (ObjectThreadCache *cache = registry_head_; NULL != cache; cache = cache->next_) {
+    cached_bytes += ATOMIC_LOAD(&cache->cached_bytes_);
+  }
+  return cached_bytes;
+}
+
+pthread_key_t &ObjectThreadCache::get_exit_key()
+{
+  struct ExitKey
+  {
+    ExitKey() : ret_(pthread_key_create(&key_, on_thread_exit)) {}
+    pthread_key_t key_;
+    int ret_;
+  };
+  static ExitKey exit_key;
+  abort_unless(0 == exit_key.ret_);
+  return exit_key.key_;
+}
+
+void ObjectThreadCache::on_thread_exit(void *ptr)
+{
+  ObjectThreadCache *cache = static_cast<ObjectThreadCache *>(ptr);
+  if (OB_NOT_NULL(cache)) {
+    {
+      Lock::Guard guard(cache->get_lock());
+      cache->drain();
+      // objects freed by the later thread exit procedures are not cached any more,
+      // the thread local cache is gone after them
+      cache->exited_ = true;
+    }
+    cache->unregister_cache();
+  }
+}
+
+void ObjectThreadCache::register_cache()
+{
+  Lock::Guard guard(get_registry_lock());
+  prev_ = NULL;
+  next_ = registry_head_;
+  if (NULL != registry_head_) {
+    registry_head_->prev_ = this;
+  }
+  registry_head_ = this;
+  registered_ = true;
+  pthread_setspecific(get_exit_key(), this);
+}
+
+void ObjectThreadCache::unregister_cache()
+{
+  Lock::Guard guard(get_registry_lock());
+  if (registered_) {
+    if (NULL != prev_) {
+      prev_->next_ = next_;
+    } else {
+      registry_head_ = next_;
+    }
+    if (NULL != next_) {
+      next_->prev_ = prev_;
+    }
+    prev_ = NULL;
+    next_ = NULL;
+    registered_ = false;
+  }
+}
+
+OB_INLINE void ObjectThreadCache::check_version()
+{
+  const int64_t global_version = ATOMIC_LOAD(&global_version_);
+  if (OB_UNLIKELY(version_ != global_version)) {
+    drain();
+    version_ = global_version;
+  }
+}
+
+AObject *ObjectThreadCache::pop(ObjectMgr &mgr, const uint32_t cls, const uint64_t size)
+{
+  AObject *obj = NULL;
+  if (ATOMIC_LOAD(&enable_) && get_lock().try_lock()) {
+    check_version();
+    Magazine &mag = get_magazine(&mgr, cls);
+    if (&mgr != mag.mgr_ || cls != mag.cls_) {
+      if (0 == mag.cnt_) {
+        flush_stat(mag);
+        mag.mgr_ = &mgr;
+        mag.cls_ = cls;
+        mag.miss_cnt_++;
+      } else {
+        ATOMIC_INC(&mgr.tc_miss_cnt_);
+      }
+    } else if (mag.cnt_ > 0 && mag.objs_[mag.cnt_ - 1]->alloc_bytes_ >= size) {
+      // alloc_bytes_ is accounted in ObjectSet and the tail magic is checked by it,
+      // so the object is only reused for allocations no larger than it
+      obj = mag.objs_[--mag.cnt_];
+      ATOMIC_SAF(&cached_bytes_, obj->nobjs_ * AOBJECT_CELL_BYTES);
+      mag.hit_cnt_++;
+    } else {
+      mag.miss_cnt_++;
+    }
+    if (mag.hit_cnt_ + mag.miss_cnt_ >= STAT_FLUSH_CNT) {
+      flush_stat(mag);
+    }
+    get_lock().unlock();
+  }
+  return obj;
+}
+
+bool ObjectThreadCache::push(ObjectMgr &mgr, AObject *obj)
+{
+  bool cached = false;
+  if (ATOMIC_LOAD(&enable_)
+      && !exited_
+      && !obj->is_large_
+      && obj->nobjs_ <= MAX_CACHE_CELLS
+      && cached_bytes_ + obj->nobjs_ * AOBJECT_CELL_BYTES <= MAX_CACHE_BYTES) {
+    if (OB_UNLIKELY(!registered_)) {
+      register_cache();
+    }
+    if (get_lock().try_lock()) {
+      check_version();
+      abort_unless(obj->MAGIC_CODE_ == AOBJECT_MAGIC_CODE);
+      abort_unless(AOBJECT_TAIL_MAGIC_CODE == reinterpret_cast<uint64_t&>(obj->data_[obj->alloc_bytes_]));
+      Magazine &mag = get_magazine(&mgr, obj->nobjs_);
+      if (&mgr != mag.mgr_ || obj->nobjs_ != mag.cls_) {
+        drain(mag);
+        mag.mgr_ = &mgr;
+        mag.cls_ = obj->nobjs_;
+      }
+      if (mag.cnt_ < MAGAZINE_SIZE) {
+        mag.objs_[mag.cnt_++] = obj;
+        ATOMIC_AAF(&cached_bytes_, obj->nobjs_ * AOBJECT_CELL_BYTES);
+        cached = true;
+      }
+      get_lock().unlock();
+    }
+  }
+  return cached;
+}
+
+void ObjectThreadCache::drain()
+{
+  for (int i = 0; i < SLOT_CNT; i++) {
+    drain(mags_[i]);
+  }
+}
+
+int64_t ObjectThreadCache::drain(const ObjectMgr &mgr)
+{
+  const int64_t cached_bytes = cached_bytes_;
+  for (int i = 0; i < SLOT_CNT; i++) {
+    if (&mgr == mags_[i].mgr_) {
+      drain(mags_[i]);
+    }
+  }
+  return cached_bytes - cached_bytes_;
+}
+
+void ObjectThreadCache::drain(Magazine &mag)
+{
+  while (mag.cnt_ > 0) {
+    AObject *obj = mag.objs_[--mag.cnt_];
+    ATOMIC_SAF(&cached_bytes_, obj->nobjs_ * AOBJECT_CELL_BYTES);
+    mag.mgr_->do_free_object(obj);
+  }
+  flush_stat(mag);
+}
+
+void ObjectThreadCache::flush_stat(Magazine &mag)
+{
+  if (OB_NOT_NULL(mag.mgr_)) {
+    if (mag.hit_cnt_ > 0) {
+      ATOMIC_AAF(&mag.mgr_->tc_hit_cnt_, mag.hit_cnt_);
+    }
+    if (mag.miss_cnt_ > 0) {
+      ATOMIC_AAF(&mag.mgr_->tc_miss_cnt_, mag.miss_cnt_);
+    }
+  }
+  mag.hit_cnt_ = 0;
+  mag.miss_cnt_ = 0;
+}
+
 SubObjectMgr::SubObjectMgr(const bool for_logger)
   : mutex_(common::ObLatchIds::ALLOC_OBJECT_LOCK),
     normal_locker_(mutex_), logger_locker_(mutex_),
@@ -63,9 +301,11 @@ ObjectMgr::ObjectMgr(ObTenantCtxAllocator &allocator, uint64_t tenant_id, uint64
   : ta_(allocator), attr_(tenant_id, nullptr, ctx_id),
     sub_cnt_(1),
     root_mgr_(common::ObCtxIds::LOGGER_CTX_ID == attr_.ctx_id_),
-    last_wash_ts_(0), last_washed_size_(0)
+    last_wash_ts_(0), last_washed_size_(0),
+    tc_hit_cnt_(0), tc_miss_cnt_(0)
 {
   root_mgr_.set_tenant_ctx_allocator(allocator, attr_);
+  root_mgr_.set_obj_mgr(this);
   MEMSET(sub_mgrs_, 0, sizeof(sub_mgrs_));
   sub_mgrs_[0] = &root_mgr_;
 }
@@ -76,6 +316,7 @@ ObjectMgr::~ObjectMgr()
 }
 
 void ObjectMgr::reset() {
+  (void)ObjectThreadCache::wash(*this);
   for (int i = 1; i < ATOMIC_LOAD(&sub_cnt_); i++) {
     if (sub_mgrs_[i] != nullptr) {
       destroy_sub_mgr(sub_mgrs_[i]);
@@ -86,6 +327,29 @@ void ObjectMgr::reset() {
 }
 
 AObject *ObjectMgr::alloc_object(uint64_t size, const ObMemAttr &attr)
+{
+  AObject *obj = NULL;
+  if (enable_thread_cache() && size > 0 && size < UINT32_MAX) {
+    // same size class as ObjectSet::alloc_object
+    const uint64_t all_size = align_up2(MAX(size, MIN_AOBJECT_SIZE) + AOBJECT_META_SIZE, 16);
+    const uint32_t cls = (uint32_t)(1 + ((all_size - 1) / AOBJECT_CELL_BYTES));
+    if (cls <= ObjectThreadCache::MAX_CACHE_CELLS
+        && OB_NOT_NULL(obj = ObjectThreadCache::get_instance().pop(*this, cls, size))) {
+      if (attr.label_.str_ != nullptr) {
+        STRNCPY(&obj->label_[0], attr.label_.str_, sizeof(obj->label_));
+        obj->label_[sizeof(obj->label_) - 1] = '\0';
+      } else {
+        obj->label_[0] = '\0';
+      }
+    }
+  }
+  if (OB_ISNULL(obj)) {
+    obj = do_alloc_object(size, attr);
+  }
+  return obj;
+}
+
+AObject *ObjectMgr::do_alloc_object(uint64_t size, const ObMemAttr &attr)
 {
   AObject *obj = NULL;
   const uint64_t start = common::get_itid();
@@ -152,6 +416,13 @@ AObject *ObjectMgr::realloc_object(
 }
 
 void ObjectMgr::free_object(AObject *obj)
+{
+  if (!enable_thread_cache() || !ObjectThreadCache::get_instance().push(*this, obj)) {
+    do_free_object(obj);
+  }
+}
+
+void ObjectMgr::do_free_object(AObject *obj)
 {
   ABlock *block = obj->block();
   abort_unless(block->is_valid());
@@ -230,6 +501,7 @@ SubObjectMgr *ObjectMgr::create_sub_mgr()
     SANITY_UNPOISON(obj->data_, obj->alloc_bytes_);
     sub_mgr = new (obj->data_) SubObjectMgr(common::ObCtxIds::LOGGER_CTX_ID == attr_.ctx_id_);
     sub_mgr->set_tenant_ctx_allocator(ta_, attr_);
+    sub_mgr->set_obj_mgr(this);
   }
   return sub_mgr;
 }
@@ -251,6 +523,8 @@ void ObjectMgr::destroy_sub_mgr(SubObjectMgr *sub_mgr)
 int64_t ObjectMgr::sync_wash(int64_t wash_size)
 {
   int64_t washed_size = 0;
+  // return the objects cached by threads to ObjectSet first, so that their blocks can be washed
+  (void)ObjectThreadCache::try_wash(*this);
   const uint64_t start = common::get_itid();
   for (uint64_t i = 0; washed_size < wash_size && i < ATOMIC_LOAD(&sub_cnt_); i++) {
     uint64_t idx = (start + i) % sub_cnt_;
@@ -289,6 +563,8 @@ ObjectMgr::Stat ObjectMgr::get_stat()
       .payload_ = payload,
       .used_ = used,
       .last_washed_size_ = ATOMIC_LOAD(&last_washed_size_),
-      .last_wash_ts_ = ATOMIC_LOAD(&last_wash_ts_)
+      .last_wash_ts_ = ATOMIC_LOAD(&last_wash_ts_),
+      .tc_hit_cnt_ = ATOMIC_LOAD(&tc_hit_cnt_),
+      .tc_miss_cnt_ = ATOMIC_LOAD(&tc_miss_cnt_)
       };
 }
@@ -13,12 +13,14 @@
 #ifndef _OCEABASE_LIB_ALLOC_OBJECT_MGR_H_
 #define _OCEABASE_LIB_ALLOC_OBJECT_MGR_H_
 
+#include <pthread.h>
 #include "lib/allocator/ob_ctx_parallel_define.h"
 #include "lib/thread_local/ob_tsi_utils.h"
 #include "lib/random/ob_random.h"
 #include "lib/ob_abort.h"
 #include "lib/ob_define.h"
 #include "lib/alloc/alloc_interface.h"
+#include "lib/lock/ob_small_spin_lock.h"
 #ifndef ENABLE_SANITY
 #include "lib/lock/ob_latch.h"
 #else
@@ -42,6 +44,7 @@ public:
   {
     bs_.set_tenant_ctx_allocator(allocator, attr);
   }
+  OB_INLINE void set_obj_mgr(ObjectMgr *obj_mgr) { os_.set_obj_mgr(obj_mgr); }
   OB_INLINE void lock() { locker_.lock(); }
   OB_INLINE void unlock() { locker_.unlock(); }
   OB_INLINE bool trylock() { return locker_.trylock(); }
@@ -76,8 +79,83 @@ private:
   ObjectSet os_;
 };
 
+class ObjectMgr;
+// tcmalloc style per-thread cache of small objects. Objects freed by a thread are kept in
+// magazines of the thread, and reused by the following allocations of the same ObjectMgr
+// and size class on the thread without locking ObjectSet.
+// Cached objects are still in use for ObjectSet, so they are accounted in the tenant ctx
+// they belong to. They are returned to ObjectSet when the thread exits, the magazine is
+// taken by another size class, or memory is washed. All the caches are linked in a global
+// registry, so that wash and disable reclaim the caches of idle threads too.
+class ObjectThreadCache
+{
+  typedef common::ObByteLock Lock;
+public:
+  static const int SLOT_CNT = 32;
+  static const int MAGAZINE_SIZE = 16;
+  static const uint32_t MAX_CACHE_CELLS = (1L << 10) / AOBJECT_CELL_BYTES; // objects hold no more than 1K
+  static const int64_t MAX_CACHE_BYTES = 64L << 10;
+  static const int64_t STAT_FLUSH_CNT = 256;
+  static ObjectThreadCache &get_instance();
+  static void set_enable(const bool enable);
+  static bool is_enabled() { return ATOMIC_LOAD(&enable_); }
+  // make all threads drain their caches at next alloc or free
+  static void expire_all() { ATOMIC_INC(&global_version_); }
+  // return the objects of mgr cached by all threads to ObjectSet and the bytes reclaimed,
+  // waits for caches being used by their threads, so nothing of mgr is left when it returns
+  static int64_t wash(const ObjectMgr &mgr);
+  // same as wash, but caches being used by their threads are skipped, for memory wash
+  static int64_t try_wash(const ObjectMgr &mgr);
+  // bytes cached by all threads
+  static int64_t get_cached_bytes();
+  AObject *pop(ObjectMgr &mgr, const uint32_t cls, const uint64_t size);
+  bool push(ObjectMgr &mgr, AObject *obj);
+  void drain();
+private:
+  struct Magazine
+  {
+    ObjectMgr *mgr_;
+    uint32_t cls_;
+    int32_t cnt_;
+    int64_t hit_cnt_;
+    int64_t miss_cnt_;
+    AObject *objs_[MAGAZINE_SIZE];
+  };
+  // ObjectThreadCache is a POD thread local variable, constructing or destructing it may
+  // go into malloc again, drain at thread exit is done by the destructor of pthread key.
+  static void on_thread_exit(void *ptr);
+  static pthread_key_t &get_exit_key();
+  static Lock &get_registry_lock() { return Lock::AsLock(registry_lock_); }
+  Lock &get_lock() { return Lock::AsLock(lock_); }
+  void register_cache();
+  void unregister_cache();
+  void check_version();
+  void drain(Magazine &mag);
+  int64_t drain(const ObjectMgr &mgr);
+  void flush_stat(Magazine &mag);
+  OB_INLINE Magazine &get_magazine(const ObjectMgr *mgr, const uint32_t cls)
+  {
+    return mags_[(reinterpret_cast<uint64_t>(mgr) / sizeof(void*) + cls) % SLOT_CNT];
+  }
+private:
+  static bool enable_;
+  static int64_t global_version_;
+  static uint8_t registry_lock_;
+  static ObjectThreadCache *registry_head_;
+  int64_t version_;
+  int64_t cached_bytes_;
+  // protects the magazines from being washed by other threads
+  uint8_t lock_;
+  bool registered_;
+  bool exited_;
+  ObjectThreadCache *prev_;
+  ObjectThreadCache *next_;
+  Magazine mags_[SLOT_CNT];
+};
+
 class ObjectMgr : public IBlockMgr
 {
+  friend class ObjectThreadCache;
   static const int N = 32;
 public:
   struct Stat
@@ -87,6 +165,8 @@ public:
     int64_t used_;
     int64_t last_washed_size_;
     int64_t last_wash_ts_;
+    int64_t tc_hit_cnt_;
+    int64_t tc_miss_cnt_;
   };
 public:
   ObjectMgr(ObTenantCtxAllocator &allocator, uint64_t tenant_id, uint64_t ctx_id);
@@ -111,6 +191,16 @@ public:
 private:
   SubObjectMgr *create_sub_mgr();
   void destroy_sub_mgr(SubObjectMgr *sub_mgr);
+  AObject *do_alloc_object(uint64_t size, const ObMemAttr &attr);
+  void do_free_object(AObject *obj);
+  OB_INLINE bool enable_thread_cache() const
+  {
+#ifndef ENABLE_SANITY
+    return common::ObCtxIds::LOGGER_CTX_ID != attr_.ctx_id_;
+#else
+    return false;
+#endif
+  }
 
 public:
   ObTenantCtxAllocator &ta_;
@@ -120,6 +210,8 @@ public:
   SubObjectMgr *sub_mgrs_[N];
   int64_t last_wash_ts_;
   int64_t last_washed_size_;
+  int64_t tc_hit_cnt_;
+  int64_t tc_miss_cnt_;
 }; // end of class ObjectMgr
 
 } // end of namespace lib
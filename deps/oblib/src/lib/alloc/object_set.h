@@ -32,6 +32,7 @@ class __MemoryContext__;
 class ObTenantCtxAllocator;
 class IBlockMgr;
 class ISetLocker;
+class ObjectMgr;
 class ObjectSet
 {
   friend class common::ObAllocator;
@@ -65,6 +66,9 @@ public:
   // statistics
   void set_block_mgr(IBlockMgr *blk_mgr) { blk_mgr_ = blk_mgr; }
   IBlockMgr *get_block_mgr() { return blk_mgr_; }
+  // the ObjectMgr which owns the set, objects freed directly to the set go through its thread cache
+  void set_obj_mgr(ObjectMgr *obj_mgr) { obj_mgr_ = obj_mgr; }
+  ObjectMgr *get_obj_mgr() { return obj_mgr_; }
   void set_locker(ISetLocker *locker) { locker_ = locker; }
   inline int64_t get_normal_hold() const;
   inline int64_t get_normal_used() const;
@@ -98,6 +102,7 @@ private:
   __MemoryContext__ *mem_context_;
   ISetLocker *locker_;
   IBlockMgr *blk_mgr_;
+  ObjectMgr *obj_mgr_;
 
   ABlock *blist_;
 
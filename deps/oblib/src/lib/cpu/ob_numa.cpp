@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "lib/cpu/ob_numa.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "lib/ob_define.h"
+#include "lib/oblog/ob_log.h"
+
+namespace oceanbase {
+namespace common {
+
+// memory policy of mbind, see linux/mempolicy.h
+static const int OB_MPOL_DEFAULT = 0;
+static const int OB_MPOL_PREFERRED = 1;
+
+ObNumaHelper::Topology::Topology()
+  : node_cnt_(0)
+{
+  CPU_ZERO(&all_cpus_);
+  for (int64_t i = 0; i < MAX_NODE_CNT; ++i) {
+    CPU_ZERO(&node_cpus_[i]);
+  }
+  // cpus which the process is allowed to run on, used to unbind threads
+  if (0 != sched_getaffinity(0, sizeof(all_cpus_), &all_cpus_)) {
+    LIB_LOG(WARN, "sched_getaffinity failed", K(errno));
+  }
+  char path[64];
+  char cpu_list[1024];
+  bool exist = true;
+  for (int64_t node = 0; exist && node < MAX_NODE_CNT; ++node) {
+    FILE *file = NULL;
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%ld/cpulist", node);
+    if (NULL == (file = fopen(path, "r"))) {
+      exist = false;
+    } else {
+      if (NULL == fgets(cpu_list, sizeof(cpu_list), file)
+          || OB_SUCCESS != parse_cpu_list(cpu_list, node_cpus_[node])) {
+        exist = false;
+      } else {
+        CPU_AND(&node_cpus_[node], &node_cpus_[node], &all_cpus_);
+        node_cnt_ = node + 1;
+      }
+      fclose(file);
+    }
+  }
+  if (0 == node_cnt_) {
+    node_cnt_ = 1;
+    node_cpus_[0] = all_cpus_;
+  }
+  LIB_LOG(INFO, "numa topology", K_(node_cnt));
+}
+
+ObNumaHelper::Topology &ObNumaHelper::get_topology()
+{
+  static Topology topology;
+  return topology;
+}
+
+// cpu list is like "0-15,32-47"
+int ObNumaHelper::parse_cpu_list(const char *cpu_list, cpu_set_t &cpus)
+{
+  int ret = OB_SUCCESS;
+  const char *p = cpu_list;
+  CPU_ZERO(&cpus);
+  while (OB_SUCC(ret) && NULL != p && '\0' != *p && '\n' != *p) {
+    char *end = NULL;
+    const int64_t begin_cpu = strtol(p, &end, 10);
+    int64_t end_cpu = begin_cpu;
+    if (end == p) {
+      ret = OB_INVALID_ARGUMENT;
+    } else if ('-' == *end) {
+      p = end + 1;
+      end_cpu = strtol(p, &end, 10);
+      if (end == p) {
+        ret = OB_INVALID_ARGUMENT;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      for (int64_t cpu = begin_cpu; cpu <= end_cpu && cpu < CPU_SETSIZE; ++cpu) {
+        CPU_SET(cpu, &cpus);
+      }
+      p = (',' == *end) ? end + 1 : end;
+    }
+  }
+  return ret;
+}
+
+int64_t ObNumaHelper::get_node_cnt()
+{
+  return get_topology().node_cnt_;
+}
+
+int ObNumaHelper::bind_thread_to_node(const int64_t node)
+{
+  int ret = OB_SUCCESS;
+  Topology &topology = get_topology();
+  if (OB_UNLIKELY(node < -1 || node >= topology.node_cnt_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LIB_LOG(WARN, "invalid numa node", K(ret), K(node), K(topology.node_cnt_));
+  } else {
+    const cpu_set_t &cpus = (-1 == node) ? topology.all_cpus_ : topology.node_cpus_[node];
+    if (0 != pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus)) {
+      ret = OB_ERR_SYS;
+      LIB_LOG(WARN, "pthread_setaffinity_np failed", K(ret), K(node), K(errno));
+    }
+  }
+  return ret;
+}
+
+int ObNumaHelper::bind_memory_to_node(void *ptr, const int64_t size, const int64_t node)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(ptr) || OB_UNLIKELY(size <= 0)
+      || OB_UNLIKELY(node < -1 || node >= get_node_cnt())) {
+    ret = OB_INVALID_ARGUMENT;
+    LIB_LOG(WARN, "invalid argument", K(ret), KP(ptr), K(size), K(node));
+  } else {
+#ifdef __NR_mbind
+    unsigned long node_mask = (-1 == node) ? 0 : (1UL << node);
+    const int mode = (-1 == node) ? OB_MPOL_DEFAULT : OB_MPOL_PREFERRED;
+    if (0 != syscall(__NR_mbind, ptr, size, mode, (-1 == node) ? NULL : &node_mask,
+                     (-1 == node) ? 0 : MAX_NODE_CNT + 1, 0)) {
+      ret = OB_ERR_SYS;
+      LIB_LOG(WARN, "mbind failed", K(ret), KP(ptr), K(size), K(node), K(errno));
+    }
+#else
+    ret = OB_NOT_SUPPORTED;
+#endif
+  }
+  return ret;
+}
+
+} // common
+} // oceanbase
@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LIB_OB_NUMA_
+#define OCEANBASE_LIB_OB_NUMA_
+
+#include <stdint.h>
+#include <sched.h>
+
+namespace oceanbase
+{
+namespace common
+{
+
+// NUMA topology read from /sys/devices/system/node, without dependency on libnuma.
+class ObNumaHelper
+{
+public:
+  static const int64_t MAX_NODE_CNT = 8;
+  // number of numa nodes, 1 if numa is not available
+  static int64_t get_node_cnt();
+  // bind current thread to the cpus of numa node, unbind if node is -1
+  static int bind_thread_to_node(const int64_t node);
+  // pages of [ptr, ptr + size) not faulted yet are preferred to be allocated from
+  // numa node, reset to default policy if node is -1
+  static int bind_memory_to_node(void *ptr, const int64_t size, const int64_t node);
+private:
+  struct Topology
+  {
+    Topology();
+    int64_t node_cnt_;
+    cpu_set_t all_cpus_;
+    cpu_set_t node_cpus_[MAX_NODE_CNT];
+  };
+  static Topology &get_topology();
+  static int parse_cpu_list(const char *cpu_list, cpu_set_t &cpus);
+};
+
+} // namespace common
+} // namespace oceanbase
+
+#endif // OCEANBASE_LIB_OB_NUMA_
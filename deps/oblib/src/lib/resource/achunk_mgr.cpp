@@ -52,6 +52,65 @@ int ObLargePageHelper::get_type()
 #endif
 }
 
+int ObHugePageHelper::policies_[MAX_CTX] = {NO_HUGE_PAGE};
+
+void ObHugePageHelper::set_policy(const int hp_ctx, const char *param)
+{
+  if (OB_NOT_NULL(param) && hp_ctx > OTHER_CTX && hp_ctx < MAX_CTX) {
+    int policy = -1;
+    if (0 == strcasecmp(param, "none")) {
+      policy = NO_HUGE_PAGE;
+    } else if (0 == strcasecmp(param, "madvise")) {
+      policy = MADVISE_HUGE_PAGE;
+    } else if (0 == strcasecmp(param, "hugetlb")) {
+      policy = HUGETLB_HUGE_PAGE;
+    }
+    if (policy >= 0 && policy != ATOMIC_LOAD(&policies_[hp_ctx])) {
+      ATOMIC_STORE(&policies_[hp_ctx], policy);
+      LOG_INFO("set huge page policy", "ctx", get_ctx_name(hp_ctx), K(policy));
+    }
+  }
+}
+
+int ObHugePageHelper::get_policy(const int hp_ctx)
+{
+#ifndef ENABLE_SANITY
+  return ATOMIC_LOAD(&policies_[hp_ctx]);
+#else
+  UNUSED(hp_ctx);
+  return NO_HUGE_PAGE;
+#endif
+}
+
+const char *ObHugePageHelper::get_ctx_name(const int hp_ctx)
+{
+  static const char *names[MAX_CTX] = {"other", "memstore", "kvcache", "work_area"};
+  return (hp_ctx >= 0 && hp_ctx < MAX_CTX) ? names[hp_ctx] : "unknown";
+}
+
+int64_t ObHugePageHelper::get_anon_huge_pages()
+{
+  int64_t anon_huge_pages = 0;
+  char buffer[1024] = "";
+  // smaps_rollup is much cheaper, smaps is summed up on the kernels without it
+  FILE *file = fopen("/proc/self/smaps_rollup", "r");
+  if (NULL == file) {
+    file = fopen("/proc/self/smaps", "r");
+  }
+  if (NULL != file) {
+    while (fscanf(file, " %1023s", buffer) == 1) {
+      if (strcmp(buffer, "AnonHugePages:") == 0) {
+        int64_t kbytes = 0;
+        if (fscanf(file, " %ld", &kbytes) == 1) {
+          anon_huge_pages += kbytes << 10;
+        }
+      }
+    }
+    fclose(file);
+  }
+  return anon_huge_pages;
+}
+
 AChunkMgr &AChunkMgr::instance()
 {
   static AChunkMgr mgr;
@@ -62,9 +121,14 @@ AChunkMgr::AChunkMgr()
   : free_list_(), chunk_bitmap_(nullptr), limit_(DEFAULT_LIMIT), urgent_(0), hold_(0),
     total_hold_(0), maps_(0), unmaps_(0), large_maps_(0), large_unmaps_(0), shadow_hold_(0)
 {
+  MEMSET(hp_ctx_hold_, 0, sizeof(hp_ctx_hold_));
+  MEMSET(hp_ctx_hugetlb_hold_, 0, sizeof(hp_ctx_hugetlb_hold_));
+  MEMSET(hp_ctx_thp_advised_hold_, 0, sizeof(hp_ctx_thp_advised_hold_));
+  MEMSET(numa_bound_hold_, 0, sizeof(numa_bound_hold_));
 }
 
-void *AChunkMgr::direct_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow)
+void *AChunkMgr::direct_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used,
+                              const bool alloc_shadow, const bool prefer_huge_page)
 {
   common::ObTimeGuard time_guard(__func__, 1000 * 1000);
   int orig_errno = errno;
@@ -72,14 +136,14 @@ void *AChunkMgr::direct_alloc(const uint64_t size, const bool can_use_huge_page,
   EVENT_ADD(MMAP_SIZE, size);
 
   void *ptr = nullptr;
-  ptr = low_alloc(size, can_use_huge_page, huge_page_used, alloc_shadow);
+  ptr = low_alloc(size, can_use_huge_page, huge_page_used, alloc_shadow, prefer_huge_page);
   if (nullptr != ptr) {
     if (((uint64_t)ptr & (INTACT_ACHUNK_SIZE - 1)) != 0) {
       // not aligned
       low_free(ptr, size);
 
       uint64_t new_size = size + INTACT_ACHUNK_SIZE;
-      ptr = low_alloc(new_size, can_use_huge_page, huge_page_used, alloc_shadow);
+      ptr = low_alloc(new_size, can_use_huge_page, huge_page_used, alloc_shadow, prefer_huge_page);
       if (nullptr != ptr) {
         const uint64_t addr = align_up2((uint64_t)ptr, INTACT_ACHUNK_SIZE);
         if (addr - (uint64_t)ptr > 0) {
@@ -125,7 +189,8 @@ void AChunkMgr::direct_free(const void *ptr, const uint64_t size)
 
 static int64_t global_canonical_addr = SANITY_MIN_CANONICAL_ADDR;
 
-void *AChunkMgr::low_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow)
+void *AChunkMgr::low_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used,
+                           const bool alloc_shadow, const bool prefer_huge_page)
 {
   void *ptr = nullptr;
   huge_page_used = false;
@@ -139,7 +204,10 @@ void *AChunkMgr::low_alloc(const uint64_t size, const bool can_use_huge_page, bo
 #endif
   const int fd = -1;
   const int offset = 0;
-  const int large_page_type = ObLargePageHelper::get_type();
+  int large_page_type = ObLargePageHelper::get_type();
+  if (prefer_huge_page && ObLargePageHelper::ONLY_LARGE_PAGE != large_page_type) {
+    large_page_type = ObLargePageHelper::PREFER_LARGE_PAGE;
+  }
   if (SANITY_BOOL_EXPR(alloc_shadow)) {
     int64_t new_addr = ATOMIC_FAA(&global_canonical_addr, size);
     if (!SANITY_ADDR_IN_RANGE((void*)new_addr)) {
@@ -196,11 +264,66 @@ void AChunkMgr::low_free(const void *ptr, const uint64_t size)
   ::munmap((void*)ptr, size);
 }
 
-AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
+void AChunkMgr::advise_huge_page(AChunk *chunk, const uint64_t all_size, const int hp_ctx)
+{
+  const int policy = ObHugePageHelper::get_policy(hp_ctx);
+#ifdef MADV_HUGEPAGE
+  // chunks from free list may be advised already, the advice is kept by the mapping
+  if (ObHugePageHelper::NO_HUGE_PAGE != policy && !chunk->is_hugetlb_ && !chunk->is_thp_) {
+    if (0 == ::madvise(chunk, all_size, MADV_HUGEPAGE)) {
+      chunk->is_thp_ = true;
+    } else if (REACH_TIME_INTERVAL(60 * 1000 * 1000)) {
+      LOG_WARN("madvise huge page failed", K(errno), K(all_size), K(hp_ctx));
+    }
+  }
+#else
+  UNUSED(policy);
+#endif
+  chunk->hp_ctx_ = hp_ctx;
+  IGNORE_RETURN ATOMIC_AAF(&hp_ctx_hold_[hp_ctx], all_size);
+  if (chunk->is_hugetlb_) {
+    IGNORE_RETURN ATOMIC_AAF(&hp_ctx_hugetlb_hold_[hp_ctx], all_size);
+  } else if (chunk->is_thp_) {
+    IGNORE_RETURN ATOMIC_AAF(&hp_ctx_thp_advised_hold_[hp_ctx], all_size);
+  }
+}
+
+void AChunkMgr::bind_numa_node(AChunk *chunk, const uint64_t all_size, const int64_t numa_node)
+{
+  // only pages faulted afterwards follow the binding, pages of the chunks from free list
+  // are not migrated since it costs more than remote access.
+  if (numa_node + 1 != chunk->numa_node_) {
+    if (OB_SUCCESS == common::ObNumaHelper::bind_memory_to_node(chunk, all_size, numa_node)) {
+      chunk->numa_node_ = numa_node + 1;
+    }
+  }
+  if (chunk->numa_node_ > 0) {
+    IGNORE_RETURN ATOMIC_AAF(&numa_bound_hold_[chunk->numa_node_ - 1], all_size);
+  }
+}
+
+void AChunkMgr::release_chunk_stat(AChunk *chunk, const uint64_t all_size)
+{
+  const int hp_ctx = chunk->hp_ctx_;
+  IGNORE_RETURN ATOMIC_AAF(&hp_ctx_hold_[hp_ctx], -all_size);
+  if (chunk->is_hugetlb_) {
+    IGNORE_RETURN ATOMIC_AAF(&hp_ctx_hugetlb_hold_[hp_ctx], -all_size);
+  } else if (chunk->is_thp_) {
+    IGNORE_RETURN ATOMIC_AAF(&hp_ctx_thp_advised_hold_[hp_ctx], -all_size);
+  }
+  if (chunk->numa_node_ > 0) {
+    IGNORE_RETURN ATOMIC_AAF(&numa_bound_hold_[chunk->numa_node_ - 1], -all_size);
+  }
+}
+
+AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio, const int hp_ctx,
+                               const int64_t numa_node)
 {
   const int64_t hold_size = hold(size);
   const int64_t all_size = aligned(size);
   const int64_t achunk_size = INTACT_ACHUNK_SIZE;
+  const bool prefer_huge_page =
+      ObHugePageHelper::HUGETLB_HUGE_PAGE == ObHugePageHelper::get_policy(hp_ctx);
   bool is_allocated = true;
 
   AChunk *chunk = nullptr;
@@ -213,7 +336,7 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
     if (OB_ISNULL(chunk)) {
       if (update_hold(hold_size, high_prio)) {
         bool hugetlb_used = false;
-        void *ptr = direct_alloc(all_size, true, hugetlb_used, SANITY_BOOL_EXPR(true));
+        void *ptr = direct_alloc(all_size, true, hugetlb_used, SANITY_BOOL_EXPR(true), prefer_huge_page);
         if (ptr != nullptr) {
           chunk = new (ptr) AChunk();
           chunk->is_hugetlb_ = hugetlb_used;
@@ -236,7 +359,7 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
     }
     if (updated) {
       bool hugetlb_used = false;
-      void *ptr = direct_alloc(all_size, true, hugetlb_used, SANITY_BOOL_EXPR(true));
+      void *ptr = direct_alloc(all_size, true, hugetlb_used, SANITY_BOOL_EXPR(true), prefer_huge_page);
       if (ptr != nullptr) {
         chunk = new (ptr) AChunk();
         chunk->is_hugetlb_ = hugetlb_used;
@@ -248,6 +371,8 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
 
   if (OB_NOT_NULL(chunk)) {
     chunk->alloc_bytes_ = size;
+    advise_huge_page(chunk, all_size, hp_ctx);
+    bind_numa_node(chunk, all_size, numa_node);
     if (is_allocated) {
       IGNORE_RETURN ATOMIC_FAA(&total_hold_, all_size);
     }
@@ -267,6 +392,7 @@ void AChunkMgr::free_chunk(AChunk *chunk)
     const uint64_t all_size = chunk->aligned();
     const int64_t achunk_size = INTACT_ACHUNK_SIZE;
     bool freed = true;
+    release_chunk_stat(chunk, all_size);
     if (achunk_size == hold_size) {
       if (hold_ + hold_size <= limit_) {
         freed = !free_list_.push(chunk);
@@ -22,6 +22,7 @@
 #include "lib/atomic/ob_atomic.h"
 #include "lib/ob_define.h"
 #include "lib/lock/ob_mutex.h"
+#include "lib/cpu/ob_numa.h"
 
 namespace oceanbase
 {
@@ -163,6 +164,41 @@ private:
   static int large_page_type_;
 };
 
+const char *const huge_page_policy_confs[] =
+{
+  "none",
+  "madvise",
+  "hugetlb"
+};
+
+// Huge page policy of the allocation contexts which hold most of the memory.
+// madvise: chunks are advised with MADV_HUGEPAGE to be backed by transparent huge pages.
+// hugetlb: chunks are mapped with MAP_HUGETLB first, and fall back to MADV_HUGEPAGE.
+class ObHugePageHelper
+{
+public:
+  static const int NO_HUGE_PAGE = 0;
+  static const int MADVISE_HUGE_PAGE = 1;
+  static const int HUGETLB_HUGE_PAGE = 2;
+  enum HugePageCtx
+  {
+    OTHER_CTX = 0,
+    MEMSTORE_CTX,
+    KVCACHE_CTX,
+    WORK_AREA_CTX,
+    MAX_CTX
+  };
+public:
+  static void set_policy(const int hp_ctx, const char *param);
+  static int get_policy(const int hp_ctx);
+  static const char *get_ctx_name(const int hp_ctx);
+  // bytes of the process actually backed by transparent huge pages (AnonHugePages of smaps),
+  // it is expensive and is only for the periodic memory printing.
+  static int64_t get_anon_huge_pages();
+private:
+  static int policies_[MAX_CTX];
+};
+
 class AChunkMgr
 {
   friend class ProtectedStackAllocator;
@@ -177,7 +213,9 @@ public:
 
   AChunk *alloc_chunk(
       const uint64_t size = ACHUNK_SIZE,
-      bool high_prio = false);
+      bool high_prio = false,
+      const int hp_ctx = ObHugePageHelper::OTHER_CTX,
+      const int64_t numa_node = -1);
   void free_chunk(AChunk *chunk);
   AChunk *alloc_co_chunk(const uint64_t size = ACHUNK_SIZE);
   void free_co_chunk(AChunk *chunk);
@@ -205,16 +243,28 @@ public:
   inline int64_t get_large_maps()  { return large_maps_; }
   inline int64_t get_large_unmaps()  { return large_unmaps_; }
   inline int64_t get_shadow_hold() const { return ATOMIC_LOAD(&shadow_hold_); }
+  // memory of the chunks in use by hp_ctx, the part mapped with MAP_HUGETLB, and the part
+  // advised with MADV_HUGEPAGE, which is not necessarily backed by huge pages.
+  inline int64_t get_hp_ctx_hold(const int hp_ctx) const { return ATOMIC_LOAD(&hp_ctx_hold_[hp_ctx]); }
+  inline int64_t get_hp_ctx_hugetlb_hold(const int hp_ctx) const { return ATOMIC_LOAD(&hp_ctx_hugetlb_hold_[hp_ctx]); }
+  inline int64_t get_hp_ctx_thp_advised_hold(const int hp_ctx) const { return ATOMIC_LOAD(&hp_ctx_thp_advised_hold_[hp_ctx]); }
+  // memory of the chunks in use which are bound to numa node, not the memory resident on it
+  inline int64_t get_numa_bound_hold(const int64_t node) const { return ATOMIC_LOAD(&numa_bound_hold_[node]); }
 
 private:
   typedef ABitSet ChunkBitMap;
 
 private:
-  void *direct_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow);
+  void *direct_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used,
+                     const bool alloc_shadow, const bool prefer_huge_page = false);
   void direct_free(const void *ptr, const uint64_t size);
   // wrap for mmap
-  void *low_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow);
+  void *low_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used,
+                  const bool alloc_shadow, const bool prefer_huge_page = false);
   void low_free(const void *ptr, const uint64_t size);
+  void advise_huge_page(AChunk *chunk, const uint64_t all_size, const int hp_ctx);
+  void bind_numa_node(AChunk *chunk, const uint64_t all_size, const int64_t numa_node);
+  void release_chunk_stat(AChunk *chunk, const uint64_t all_size);
 
 protected:
   AChunkList free_list_;
@@ -230,6 +280,10 @@ protected:
   int64_t large_maps_;
   int64_t large_unmaps_;
   int64_t shadow_hold_;
+  int64_t hp_ctx_hold_[ObHugePageHelper::MAX_CTX];
+  int64_t hp_ctx_hugetlb_hold_[ObHugePageHelper::MAX_CTX];
+  int64_t hp_ctx_thp_advised_hold_[ObHugePageHelper::MAX_CTX];
+  int64_t numa_bound_hold_[common::ObNumaHelper::MAX_NODE_CNT];
 }; // end of class AChunkMgr
 
 OB_INLINE AChunk *AChunkMgr::ptr2chunk(const void *ptr)
@@ -29,7 +29,7 @@ namespace lib
 ObTenantMemoryMgr::ObTenantMemoryMgr()
   : cache_washer_(NULL), tenant_id_(common::OB_INVALID_ID),
     limit_(INT64_MAX), sum_hold_(0), rpc_hold_(0), cache_hold_(0),
-    cache_item_count_(0)
+    cache_item_count_(0), numa_node_(-1), numa_bound_hold_(0)
 {
   for (uint64_t i = 0; i < common::ObCtxIds::MAX_CTX_ID; i++) {
     ATOMIC_STORE(&(hold_bytes_[i]), 0);
@@ -40,7 +40,7 @@ ObTenantMemoryMgr::ObTenantMemoryMgr()
 ObTenantMemoryMgr::ObTenantMemoryMgr(const uint64_t tenant_id)
   : cache_washer_(NULL), tenant_id_(tenant_id),
     limit_(INT64_MAX), sum_hold_(0), rpc_hold_(0), cache_hold_(0),
-    cache_item_count_(0)
+    cache_item_count_(0), numa_node_(-1), numa_bound_hold_(0)
 {
   for (uint64_t i = 0; i < common::ObCtxIds::MAX_CTX_ID; i++) {
     ATOMIC_STORE(&(hold_bytes_[i]), 0);
@@ -330,7 +330,20 @@ AChunk *ObTenantMemoryMgr::alloc_chunk_(const int64_t size, const ObMemAttr &att
   if (OB_UNLIKELY(attr.ctx_id_ == ObCtxIds::CO_STACK)) {
     chunk = CHUNK_MGR.alloc_co_chunk(static_cast<uint64_t>(size));
   } else {
-    chunk = CHUNK_MGR.alloc_chunk(static_cast<uint64_t>(size), OB_HIGH_ALLOC == attr.prio_);
+    int hp_ctx = ObHugePageHelper::OTHER_CTX;
+    if (attr.label_ == ObNewModIds::OB_KVSTORE_CACHE_MB) {
+      hp_ctx = ObHugePageHelper::KVCACHE_CTX;
+    } else if (ObCtxIds::MEMSTORE_CTX_ID == attr.ctx_id_) {
+      hp_ctx = ObHugePageHelper::MEMSTORE_CTX;
+    } else if (ObCtxIds::WORK_AREA == attr.ctx_id_) {
+      hp_ctx = ObHugePageHelper::WORK_AREA_CTX;
+    }
+    const int64_t numa_node = ObHugePageHelper::OTHER_CTX == hp_ctx ? -1 : get_numa_node();
+    chunk = CHUNK_MGR.alloc_chunk(static_cast<uint64_t>(size), OB_HIGH_ALLOC == attr.prio_,
+                                  hp_ctx, numa_node);
+    if (OB_NOT_NULL(chunk) && chunk->numa_node_ > 0) {
+      IGNORE_RETURN ATOMIC_AAF(&numa_bound_hold_, static_cast<int64_t>(chunk->aligned()));
+    }
   }
   return chunk;
 }
@@ -340,6 +353,9 @@ void ObTenantMemoryMgr::free_chunk_(AChunk *chunk, const ObMemAttr &attr)
   if (OB_UNLIKELY(attr.ctx_id_ == ObCtxIds::CO_STACK)) {
     CHUNK_MGR.free_co_chunk(chunk);
   } else {
+    if (chunk->numa_node_ > 0) {
+      IGNORE_RETURN ATOMIC_AAF(&numa_bound_hold_, -static_cast<int64_t>(chunk->aligned()));
+    }
     CHUNK_MGR.free_chunk(chunk);
   }
 }
@@ -55,6 +55,12 @@ public:
   int64_t get_rpc_hold() const { return rpc_hold_; }
 
   void update_rpc_hold(const int64_t size) { ATOMIC_AAF(&rpc_hold_, size); }
+  // memstore, kvcache and work area chunks are bound to the numa node, -1 if not bound
+  void set_numa_node(const int64_t numa_node) { ATOMIC_STORE(&numa_node_, numa_node); }
+  int64_t get_numa_node() const { return ATOMIC_LOAD(&numa_node_); }
+  // memory of the chunks bound to the numa node with MPOL_PREFERRED, the pages are
+  // not guaranteed to be resident on the node.
+  int64_t get_numa_bound_hold() const { return ATOMIC_LOAD(&numa_bound_hold_); }
   const volatile int64_t *get_ctx_hold_bytes() const { return hold_bytes_; }
   inline static int64_t align(const int64_t size)
   {
@@ -78,6 +84,8 @@ private:
   int64_t rpc_hold_;
   int64_t cache_hold_;
   int64_t cache_item_count_;
+  int64_t numa_node_;
+  int64_t numa_bound_hold_;
   volatile int64_t hold_bytes_[common::ObCtxIds::MAX_CTX_ID];
   volatile int64_t limit_bytes_[common::ObCtxIds::MAX_CTX_ID];
 };
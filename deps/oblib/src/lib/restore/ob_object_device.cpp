@@ -811,6 +811,34 @@ int ObObjectDevice::check_space_full(const int64_t required_size) const
   return OB_NOT_SUPPORTED;  
 }
 
+int ObObjectDevice::mmap_block(
+  const ObIOFd &block_id,
+  const int64_t offset,
+  const int64_t size,
+  const char *&buf)
+{
+  UNUSED(block_id);
+  UNUSED(offset);
+  UNUSED(size);
+  UNUSED(buf);
+  OB_LOG(WARN, "mmap_block is not support in object device !", K(device_type_));
+  return OB_NOT_SUPPORTED;
+}
+
+int ObObjectDevice::madvise_block(
+  const ObIOFd &block_id,
+  const int64_t offset,
+  const int64_t size,
+  const int advice)
+{
+  UNUSED(block_id);
+  UNUSED(offset);
+  UNUSED(size);
+  UNUSED(advice);
+  OB_LOG(WARN, "madvise_block is not support in object device !", K(device_type_));
+  return OB_NOT_SUPPORTED;
+}
+
 int ObObjectDevice::fdatasync(const ObIOFd &fd)
 {
   UNUSED(fd);
@@ -131,6 +131,17 @@ private:
     const void *buf,
     const int64_t size,
     int64_t &write_size) override;
+  //mmap interfaces
+  virtual int mmap_block(
+    const ObIOFd &block_id,
+    const int64_t offset,
+    const int64_t size,
+    const char *&buf) override;
+  virtual int madvise_block(
+    const ObIOFd &block_id,
+    const int64_t offset,
+    const int64_t size,
+    const int advice) override;
   //async io interfaces
   virtual int io_setup(
     uint32_t max_events,
@@ -121,6 +121,9 @@ STAT_EVENT_ADD_DEF(HA_GTS_CACHE_MISS_COUNT, "ha gts cache miss count", ObStatCla
 STAT_EVENT_ADD_DEF(TRANS_ELR_ENABLE_COUNT, "trans early lock release enable count", ObStatClassIds::TRANS, "trans early lock releaes enable count", 30077, true, true)
 STAT_EVENT_ADD_DEF(TRANS_ELR_UNABLE_COUNT, "trans early lock release unable count", ObStatClassIds::TRANS, "trans early lock releaes unable count", 30078, true, true)
 STAT_EVENT_ADD_DEF(READ_ELR_ROW_COUNT, "read elr row count", ObStatClassIds::TRANS, "read elr row count", 30079, true, true)
+STAT_EVENT_ADD_DEF(TRANS_REDO_COMPRESS_ORIGINAL_SIZE, "trans redo compress original size", ObStatClassIds::TRANS, "trans redo compress original size", 30080, true, true)
+STAT_EVENT_ADD_DEF(TRANS_REDO_COMPRESS_COMPRESSED_SIZE, "trans redo compress compressed size", ObStatClassIds::TRANS, "trans redo compress compressed size", 30081, true, true)
+STAT_EVENT_ADD_DEF(GTS_RPC_PIPELINED_COUNT, "gts rpc pipelined count", ObStatClassIds::TRANS, "gts rpc pipelined count", 30082, true, true)
 
 // SQL
 //STAT_EVENT_ADD_DEF(PLAN_CACHE_HIT, "PLAN_CACHE_HIT", SQL, "PLAN_CACHE_HIT")
@@ -332,6 +335,11 @@ STAT_EVENT_ADD_DEF(INDEX_BLOCK_CACHE_HIT, "index micro block cache hit", ObStatC
 STAT_EVENT_ADD_DEF(BLOCKSCAN_BLOCK_CNT, "blockscaned data micro block count", ObStatClassIds::STORAGE, "blockscaned data micro block count", 60088, true, true)
 STAT_EVENT_ADD_DEF(BLOCKSCAN_ROW_CNT, "blockscaned row count", ObStatClassIds::STORAGE, "blockscaned row count", 60089, true, true)
 STAT_EVENT_ADD_DEF(PUSHDOWN_STORAGE_FILTER_ROW_CNT, "storage filtered row count", ObStatClassIds::STORAGE, "storage filter row count", 60090, true, true)
+STAT_EVENT_ADD_DEF(TX_DATA_CACHE_HIT_COUNT, "tx data cache hit count", ObStatClassIds::STORAGE, "tx data cache hit count", 60091, true, true)
+STAT_EVENT_ADD_DEF(TX_DATA_CACHE_MISS_COUNT, "tx data cache miss count", ObStatClassIds::STORAGE, "tx data cache miss count", 60092, true, true)
+STAT_EVENT_ADD_DEF(MEMSTORE_READ_AMPLIFICATION_COMPACT_COUNT, "memstore read amplification compact count", ObStatClassIds::STORAGE, "memstore read amplification compact count", 60093, true, true)
+STAT_EVENT_ADD_DEF(IO_READ_MMAP_MICRO_COUNT, "mmap read micro block count", ObStatClassIds::STORAGE, "mmap read micro block count", 60094, true, true)
+STAT_EVENT_ADD_DEF(IO_READ_MMAP_MICRO_BYTES, "mmap read micro block bytes", ObStatClassIds::STORAGE, "mmap read micro block bytes", 60095, true, true)
 
 // backup & restore
 STAT_EVENT_ADD_DEF(BACKUP_IO_READ_COUNT, "backup io read count", ObStatClassIds::STORAGE, "backup io read count", 69000, true, true)
@@ -437,6 +445,10 @@ STAT_EVENT_ADD_DEF(CLOG_FILE_TOTAL_SIZE, "clog file total size", ObStatClassIds:
 STAT_EVENT_ADD_DEF(ILOG_FILE_TOTAL_SIZE, "ilog file total size", ObStatClassIds::CLOG, "ilog file total size", 80062, true, true)
 STAT_EVENT_ADD_DEF(CLOG_BATCH_SUBMITTED_COUNT, "clog batch submitted count", ObStatClassIds::CLOG, "clog batch submitted count", 80063, true, true)
 STAT_EVENT_ADD_DEF(CLOG_BATCH_COMMITTED_COUNT, "clog batch committed count", ObStatClassIds::CLOG, "clog batch committed count", 80064, true, true)
+STAT_EVENT_ADD_DEF(CLOG_PARALLEL_FLUSH_ROUND_COUNT, "clog parallel flush round count", ObStatClassIds::CLOG, "clog parallel flush round count", 80065, true, true)
+STAT_EVENT_ADD_DEF(CLOG_PARALLEL_FLUSH_ROUND_TIME, "clog parallel flush round time", ObStatClassIds::CLOG, "clog parallel flush round time", 80066, true, true)
+STAT_EVENT_ADD_DEF(CLOG_PARALLEL_FLUSH_WRITE_COUNT, "clog parallel flush write count", ObStatClassIds::CLOG, "clog parallel flush write count", 80067, true, true)
+STAT_EVENT_ADD_DEF(CLOG_PARALLEL_FLUSH_WRITE_TIME, "clog parallel flush write time", ObStatClassIds::CLOG, "clog parallel flush write time", 80068, true, true)
 
 // CLOG.EXTLOG 81001 ~ 90000
 STAT_EVENT_ADD_DEF(CLOG_EXTLOG_FETCH_LOG_SIZE, "external log service fetch log size", ObStatClassIds::CLOG, "external log service fetch log size", 81001, true, true)
@@ -704,6 +716,11 @@ STAT_EVENT_SET_DEF(IS_MINI_MODE, "is mini mode", ObStatClassIds::RESOURCE, "is m
 STAT_EVENT_SET_DEF(MEMORY_HOLD_SIZE, "observer memory hold size", ObStatClassIds::RESOURCE, "observer memory hold size", 140011, false, true)
 STAT_EVENT_SET_DEF(WORKER_TIME, "worker time", ObStatClassIds::RESOURCE, "worker time", 140012, false, true)
 STAT_EVENT_SET_DEF(CPU_TIME, "cpu time", ObStatClassIds::RESOURCE, "cpu time", 140013, false, true)
+STAT_EVENT_SET_DEF(MALLOC_THREAD_CACHE_HIT, "malloc thread cache hit", ObStatClassIds::RESOURCE, "malloc thread cache hit", 140014, false, true)
+STAT_EVENT_SET_DEF(MALLOC_THREAD_CACHE_MISS, "malloc thread cache miss", ObStatClassIds::RESOURCE, "malloc thread cache miss", 140015, false, true)
+STAT_EVENT_SET_DEF(MALLOC_THREAD_CACHE_SIZE, "malloc thread cache size", ObStatClassIds::RESOURCE, "malloc thread cache size", 140016, false, true)
+STAT_EVENT_SET_DEF(NUMA_NODE, "numa node", ObStatClassIds::RESOURCE, "numa node", 140017, false, true)
+STAT_EVENT_SET_DEF(NUMA_BOUND_MEMORY_SIZE, "numa bound memory size", ObStatClassIds::RESOURCE, "numa bound memory size", 140018, false, true)
 
 //CLOG
 STAT_EVENT_SET_DEF(CLOG_DISK_FREE_SIZE, "clog disk free size", ObStatClassIds::CLOG, "clog disk free size", 150001, false, true)
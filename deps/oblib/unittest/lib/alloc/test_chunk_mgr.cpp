@@ -82,3 +82,59 @@ TEST_F(TestChunkMgr, FreeListManyChunk)
   EXPECT_EQ(500*2, free_list_.get_pushes());
   EXPECT_EQ(500, free_list_.get_pops());
 }
+
+TEST_F(TestChunkMgr, HugePagePolicy)
+{
+  const int64_t all_size = aligned(OB_MALLOC_BIG_BLOCK_SIZE);
+  ObHugePageHelper::set_policy(ObHugePageHelper::MEMSTORE_CTX, "madvise");
+  EXPECT_EQ(ObHugePageHelper::MADVISE_HUGE_PAGE, ObHugePageHelper::get_policy(ObHugePageHelper::MEMSTORE_CTX));
+  ObHugePageHelper::set_policy(ObHugePageHelper::MEMSTORE_CTX, "invalid");
+  EXPECT_EQ(ObHugePageHelper::MADVISE_HUGE_PAGE, ObHugePageHelper::get_policy(ObHugePageHelper::MEMSTORE_CTX));
+
+  AChunk *chunk = alloc_chunk(OB_MALLOC_BIG_BLOCK_SIZE, false, ObHugePageHelper::MEMSTORE_CTX);
+  ASSERT_NE(nullptr, chunk);
+  EXPECT_EQ(ObHugePageHelper::MEMSTORE_CTX, chunk->hp_ctx_);
+  EXPECT_EQ(all_size, get_hp_ctx_hold(ObHugePageHelper::MEMSTORE_CTX));
+  // MADV_HUGEPAGE fails when the kernel is built without transparent huge page
+  EXPECT_EQ(chunk->is_hugetlb_ ? all_size : 0, get_hp_ctx_hugetlb_hold(ObHugePageHelper::MEMSTORE_CTX));
+  EXPECT_EQ(chunk->is_thp_ && !chunk->is_hugetlb_ ? all_size : 0,
+            get_hp_ctx_thp_advised_hold(ObHugePageHelper::MEMSTORE_CTX));
+  // backed bytes are read from smaps, they depend on the kernel and are not checked
+  EXPECT_GE(ObHugePageHelper::get_anon_huge_pages(), 0);
+  free_chunk(chunk);
+  EXPECT_EQ(0, get_hp_ctx_hold(ObHugePageHelper::MEMSTORE_CTX));
+  EXPECT_EQ(0, get_hp_ctx_hugetlb_hold(ObHugePageHelper::MEMSTORE_CTX));
+  EXPECT_EQ(0, get_hp_ctx_thp_advised_hold(ObHugePageHelper::MEMSTORE_CTX));
+
+  // large chunk is not from free list, and is not advised by default
+  const int64_t large_size = 4 * OB_MALLOC_BIG_BLOCK_SIZE;
+  chunk = alloc_chunk(large_size, false, ObHugePageHelper::WORK_AREA_CTX);
+  ASSERT_NE(nullptr, chunk);
+  EXPECT_FALSE(chunk->is_thp_);
+  EXPECT_EQ(aligned(large_size), get_hp_ctx_hold(ObHugePageHelper::WORK_AREA_CTX));
+  EXPECT_EQ(0, get_hp_ctx_thp_advised_hold(ObHugePageHelper::WORK_AREA_CTX));
+  free_chunk(chunk);
+  EXPECT_EQ(0, get_hp_ctx_hold(ObHugePageHelper::WORK_AREA_CTX));
+  ObHugePageHelper::set_policy(ObHugePageHelper::MEMSTORE_CTX, "none");
+}
+
+TEST_F(TestChunkMgr, NumaNode)
+{
+  cpu_set_t cpus;
+  EXPECT_EQ(OB_SUCCESS, ObNumaHelper::parse_cpu_list("0-3,8,10-11\n", cpus));
+  EXPECT_EQ(7, CPU_COUNT(&cpus));
+  EXPECT_TRUE(CPU_ISSET(8, &cpus));
+  EXPECT_FALSE(CPU_ISSET(9, &cpus));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, ObNumaHelper::parse_cpu_list("0-,1", cpus));
+  ASSERT_GE(ObNumaHelper::get_node_cnt(), 1);
+  EXPECT_EQ(OB_INVALID_ARGUMENT, ObNumaHelper::bind_thread_to_node(ObNumaHelper::get_node_cnt()));
+
+  // large chunk is not from free list
+  const int64_t large_size = 4 * OB_MALLOC_BIG_BLOCK_SIZE;
+  AChunk *chunk = alloc_chunk(large_size, false, ObHugePageHelper::MEMSTORE_CTX, 0);
+  ASSERT_NE(nullptr, chunk);
+  // mbind fails when the kernel is built without numa
+  EXPECT_EQ(chunk->numa_node_ > 0 ? aligned(large_size) : 0, get_numa_bound_hold(0));
+  free_chunk(chunk);
+  EXPECT_EQ(0, get_numa_bound_hold(0));
+}
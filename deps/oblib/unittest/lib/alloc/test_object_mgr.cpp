@@ -19,6 +19,7 @@
 #include "lib/utility/ob_test_util.h"
 #include "lib/coro/testing.h"
 #include <gtest/gtest.h>
+#include <thread>
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -235,6 +236,101 @@ TEST_F(TestObjectMgr, TestFragmentWash)
   }
 }
 
+TEST_F(TestObjectMgr, TestThreadCache)
+{
+  ObjectThreadCache::set_enable(true);
+  auto ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+  ObjectMgr &obj_mgr = static_cast<ObjectMgr&>(ta->get_block_mgr());
+  ObjectThreadCache &cache = ObjectThreadCache::get_instance();
+  cache.drain();
+  const int64_t hit_cnt = obj_mgr.tc_hit_cnt_;
+
+  void *p1 = ob_malloc(60, "TcTest");
+  ASSERT_NE(nullptr, p1);
+  ob_free(p1);
+  ASSERT_GT(cache.cached_bytes_, 0);
+  // reused by the following allocation of the same size class on this thread
+  void *p2 = ob_malloc(56, "TcTest");
+  ASSERT_EQ(p1, p2);
+  ASSERT_EQ(0, cache.cached_bytes_);
+  ob_free(p2);
+  // only reused by allocations no larger than the cached object
+  void *p3 = ob_malloc(64, "TcTest");
+  ASSERT_NE(p2, p3);
+  ob_free(p3);
+  // large objects are not cached
+  void *p4 = ob_malloc(4096, "TcTest");
+  const int64_t cached_bytes = cache.cached_bytes_;
+  ob_free(p4);
+  ASSERT_EQ(cached_bytes, cache.cached_bytes_);
+
+  // drained by memory wash
+  ta->sync_wash(0);
+  ASSERT_EQ(0, cache.cached_bytes_);
+  ASSERT_EQ(hit_cnt + 1, obj_mgr.tc_hit_cnt_);
+
+  // the cache of an idle thread is reclaimed by memory wash too
+  ObjectThreadCache *idle_cache = nullptr;
+  bool freed = false;
+  bool washed = false;
+  std::thread th([&]() {
+    void *ptr = ob_malloc(60, "TcTest");
+    ob_free(ptr);
+    ATOMIC_STORE(&idle_cache, &ObjectThreadCache::get_instance());
+    ATOMIC_STORE(&freed, true);
+    while (!ATOMIC_LOAD(&washed)) {
+      ::usleep(1000);
+    }
+  });
+  while (!ATOMIC_LOAD(&freed)) {
+    ::usleep(1000);
+  }
+  ASSERT_GT(idle_cache->cached_bytes_, 0);
+  ASSERT_GE(ObjectThreadCache::get_cached_bytes(), idle_cache->cached_bytes_);
+  ta->sync_wash(0);
+  ASSERT_EQ(0, idle_cache->cached_bytes_);
+  ATOMIC_STORE(&washed, true);
+  th.join();
+
+  // a cache being used is skipped by memory wash, but waited for by the wash of reset
+  ObjectThreadCache *busy_cache = nullptr;
+  bool locked = false;
+  bool done = false;
+  std::thread busy_th([&]() {
+    void *ptr = ob_malloc(60, "TcTest");
+    ob_free(ptr);
+    ObjectThreadCache &my_cache = ObjectThreadCache::get_instance();
+    my_cache.get_lock().lock();
+    ATOMIC_STORE(&busy_cache, &my_cache);
+    ATOMIC_STORE(&locked, true);
+    ::usleep(100 * 1000);
+    my_cache.get_lock().unlock();
+    while (!ATOMIC_LOAD(&done)) {
+      ::usleep(1000);
+    }
+  });
+  while (!ATOMIC_LOAD(&locked)) {
+    ::usleep(1000);
+  }
+  ASSERT_EQ(0, ObjectThreadCache::try_wash(obj_mgr));
+  ASSERT_GT(busy_cache->cached_bytes_, 0);
+  ASSERT_GT(ObjectThreadCache::wash(obj_mgr), 0);
+  ASSERT_EQ(0, busy_cache->cached_bytes_);
+  ATOMIC_STORE(&done, true);
+  busy_th.join();
+
+  // drained when disabled
+  p1 = ob_malloc(64, "TcTest");
+  ob_free(p1);
+  ASSERT_GT(cache.cached_bytes_, 0);
+  ObjectThreadCache::set_enable(false);
+  ASSERT_EQ(0, cache.cached_bytes_);
+  p1 = ob_malloc(64, "TcTest");
+  ob_free(p1);
+  ASSERT_EQ(0, cache.cached_bytes_);
+  ASSERT_EQ(0, ObjectThreadCache::get_cached_bytes());
+}
 
 TEST_F(TestObjectMgr, TestSubObjectMgr)
 {
@@ -194,9 +194,9 @@ void ObApplyServiceQueueTask::inc_total_submit_cb_cnt()
   ATOMIC_INC(&total_submit_cb_cnt_);
 }
 
-void ObApplyServiceQueueTask::inc_total_apply_cb_cnt()
+void ObApplyServiceQueueTask::inc_total_apply_cb_cnt(const int64_t cnt)
 {
-  ATOMIC_INC(&total_apply_cb_cnt_);
+  ATOMIC_AAF(&total_apply_cb_cnt_, cnt);
 }
 
 int64_t ObApplyServiceQueueTask::get_total_submit_cb_cnt() const
@@ -267,7 +267,8 @@ ObApplyStatus::ObApplyStatus()
       cb_append_stat_("[cb append statistic]", 5 * 1000 * 1000),
       cb_wait_thread_stat_("[cb wait thread statistic]", 5 * 1000 * 1000),
       cb_wait_commit_stat_("[cb wait commit statistic]", 5 * 1000 * 1000),
-      cb_execute_stat_("[cb execute statistic]", 5 * 1000 * 1000)
+      cb_execute_stat_("[cb execute statistic]", 5 * 1000 * 1000),
+      cb_batch_stat_("[cb batch statistic]", 5 * 1000 * 1000)
 {
 }
 
@@ -314,7 +315,8 @@ int ObApplyStatus::init(const share::ObLSID &id,
       } else {
         is_inited_ = true;
         CLOG_LOG(INFO, "apply status init success", K(ret), KPC(this), KP(&cb_append_stat_),
-                 KP(&cb_wait_thread_stat_), KP(&cb_wait_commit_stat_), KP(&cb_execute_stat_));
+                 KP(&cb_wait_thread_stat_), KP(&cb_wait_commit_stat_), KP(&cb_execute_stat_),
+                 KP(&cb_batch_stat_));
       }
     }
   }
@@ -459,6 +461,9 @@ int ObApplyStatus::try_handle_cb_queue(ObApplyServiceQueueTask *cb_queue,
     int64_t cb_first_handle_time = OB_INVALID_TIMESTAMP;
     int64_t cb_start_time = OB_INVALID_TIMESTAMP;
     int64_t idx = cb_queue->idx();
+    LSN committed_end_lsn;
+    AppendCb *cbs[MAX_BATCH_CB_CNT] = {NULL};
+    int64_t cb_cnt = 0;
     RLockGuard guard(lock_);
     do {
       ObLink *link = NULL;
@@ -470,23 +475,15 @@ int ObApplyStatus::try_handle_cb_queue(ObApplyServiceQueueTask *cb_queue,
       } else if (OB_ISNULL(cb = AppendCb::__get_class_address(link))) {
         ret = OB_ERR_UNEXPECTED;
         CLOG_LOG(ERROR, "cb is NULL", KPC(cb_queue), KPC(this), K(ret));
-      } else if ((lsn = cb->__get_lsn()) < ATOMIC_LOAD(&palf_committed_end_lsn_.val_)) {
-        // 小于确认日志位点的cb可以回调on_success
-        if (OB_FAIL(cb_queue->pop())) {
-          CLOG_LOG(ERROR, "cb_queue pop failed", KPC(cb_queue), KPC(this), K(ret));
-        } else {
-          log_ts = cb->__get_ts_ns();
-          get_cb_trace_(cb, append_start_time, append_finish_time, cb_first_handle_time, cb_start_time);
-          CLOG_LOG(TRACE, "cb on_success", K(lsn), K(log_ts), KP(link->next_), KPC(cb_queue), KPC(this));
-          if (OB_FAIL(cb->on_success())) {
-            // 不处理此类失败情况
-            CLOG_LOG(ERROR, "cb on_success failed", KP(cb), K(ret), KPC(this));
-            ret = OB_SUCCESS;
-          }
-          statistics_cb_cost_(lsn, log_ts, append_start_time, append_finish_time,
-                              cb_first_handle_time, cb_start_time, idx);
-          cb_queue->inc_total_apply_cb_cnt();
+      } else if ((lsn = cb->__get_lsn()) < (committed_end_lsn.val_ = ATOMIC_LOAD(&palf_committed_end_lsn_.val_))) {
+        // 小于确认日志位点的cb可以回调on_success, 以批为单位弹出并回调,
+        // 确认日志位点读取, 已回调计数和耗时检查均按批摊销
+        if (OB_FAIL(pop_committed_cbs_(*cb_queue, committed_end_lsn, cbs, cb_cnt))) {
+          CLOG_LOG(ERROR, "pop_committed_cbs_ failed", KPC(cb_queue), KPC(this), K(ret), K(cb_cnt));
         }
+        // 已经弹出的cb必须回调
+        handle_committed_cbs_(cbs, cb_cnt, idx);
+        cb_queue->inc_total_apply_cb_cnt(cb_cnt);
       } else if (FOLLOWER == role_) {
         // 大于确认日志位点的cb在applystatus切为follower应该回调on_failure
         if (OB_FAIL(cb_queue->pop())) {
@@ -835,6 +832,71 @@ int ObApplyStatus::update_last_check_log_ts_ns_()
   return ret;
 }
 
+int ObApplyStatus::pop_committed_cbs_(ObApplyServiceQueueTask &cb_queue,
+                                      const LSN &committed_end_lsn,
+                                      AppendCb **cbs,
+                                      int64_t &cb_cnt)
+{
+  int ret = OB_SUCCESS;
+  bool is_end = false;
+  cb_cnt = 0;
+  while (OB_SUCC(ret) && !is_end && cb_cnt < MAX_BATCH_CB_CNT) {
+    ObLink *link = NULL;
+    AppendCb *cb = NULL;
+    if (NULL == (link = cb_queue.top())) {
+      is_end = true;
+    } else if (OB_ISNULL(cb = AppendCb::__get_class_address(link))) {
+      ret = OB_ERR_UNEXPECTED;
+      CLOG_LOG(ERROR, "cb is NULL", K(cb_queue), KPC(this), K(ret));
+    } else if (cb->__get_lsn() >= committed_end_lsn) {
+      is_end = true;
+    } else if (OB_FAIL(cb_queue.pop())) {
+      CLOG_LOG(ERROR, "cb_queue pop failed", K(cb_queue), KPC(this), K(ret));
+    } else {
+      cbs[cb_cnt++] = cb;
+    }
+  }
+  return ret;
+}
+
+void ObApplyStatus::handle_committed_cbs_(AppendCb **cbs,
+                                          const int64_t cb_cnt,
+                                          const int64_t idx)
+{
+  int ret = OB_SUCCESS;
+  LSN lsn;
+  int64_t log_ts = OB_INVALID_TIMESTAMP;
+  int64_t append_start_time = OB_INVALID_TIMESTAMP;
+  int64_t append_finish_time = OB_INVALID_TIMESTAMP;
+  int64_t cb_first_handle_time = OB_INVALID_TIMESTAMP;
+  int64_t cb_start_time = OB_INVALID_TIMESTAMP;
+  // 每批只读取一次配置项, 关闭时跳过逐个cb的打点
+  const bool need_record_trace = GCONF.enable_record_trace_log;
+  for (int64_t i = 0; i < cb_cnt; ++i) {
+    AppendCb *cb = cbs[i];
+    // on_success之后cb可能已经被释放, 需要提前获取lsn和log_ts
+    lsn = cb->__get_lsn();
+    log_ts = cb->__get_ts_ns();
+    if (need_record_trace) {
+      get_cb_trace_(cb, append_start_time, append_finish_time, cb_first_handle_time, cb_start_time);
+    }
+    CLOG_LOG(TRACE, "cb on_success", K(lsn), K(log_ts), K(i), K(cb_cnt), K(idx), KPC(this));
+    if (OB_FAIL(cb->on_success())) {
+      // 不处理此类失败情况
+      CLOG_LOG(ERROR, "cb on_success failed", KP(cb), K(ret), KPC(this));
+      ret = OB_SUCCESS;
+    }
+    if (need_record_trace) {
+      statistics_cb_cost_(lsn, log_ts, append_start_time, append_finish_time,
+                          cb_first_handle_time, cb_start_time, idx);
+    }
+    cbs[i] = NULL;
+  }
+  if (cb_cnt > 0) {
+    cb_batch_stat_.stat(cb_cnt);
+  }
+}
+
 int ObApplyStatus::handle_drop_cb_queue_(ObApplyServiceQueueTask &cb_queue)
 {
   int ret = OB_SUCCESS;
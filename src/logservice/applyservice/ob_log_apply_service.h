@@ -119,7 +119,7 @@ public:
   int pop();
   int push(Link *p);
   void inc_total_submit_cb_cnt();
-  void inc_total_apply_cb_cnt();
+  void inc_total_apply_cb_cnt(const int64_t cnt = 1);
   int64_t get_total_submit_cb_cnt() const;
   int64_t get_total_apply_cb_cnt() const;
   void set_snapshot_check_submit_cb_cnt();
@@ -204,6 +204,14 @@ private:
   int check_and_update_max_applied_log_ts_(const int64_t log_ts);
   int update_last_check_log_ts_ns_();
   int handle_drop_cb_queue_(ObApplyServiceQueueTask &cb_queue);
+  //批量弹出committed_end_lsn之前的cb, 最多MAX_BATCH_CB_CNT个
+  int pop_committed_cbs_(ObApplyServiceQueueTask &cb_queue,
+                         const palf::LSN &committed_end_lsn,
+                         AppendCb **cbs,
+                         int64_t &cb_cnt);
+  void handle_committed_cbs_(AppendCb **cbs,
+                             const int64_t cb_cnt,
+                             const int64_t idx);
   int switch_to_follower_();
   //从cb中获取打点信息
   void get_cb_trace_(AppendCb *cb,
@@ -225,6 +233,7 @@ private:
   typedef RWLock::WLockGuardWithRetryInterval WLockGuardWithRetryInterval;
   const int64_t MAX_HANDLE_TIME_NS_PER_ROUND_NS = 100 * 1000 * 1000; //100ms
   const int64_t WRLOCK_RETRY_INTERVAL_US = 20 * 1000;  // 20ms
+  static const int64_t MAX_BATCH_CB_CNT = 128; //单批回调on_success的最大cb个数
 private:
   bool is_inited_;
   bool is_in_stop_state_; //stop后不能上任, 残留的cb会继续处理
@@ -251,6 +260,7 @@ private:
   ObMiniStat::ObStatItem cb_wait_thread_stat_; //等待首次线程调度的耗时, 此次处理不一定会回调
   ObMiniStat::ObStatItem cb_wait_commit_stat_; //从第一次被处理到真正回调之间的耗时
   ObMiniStat::ObStatItem cb_execute_stat_; //cb执行on_success/on_failure的耗时
+  ObMiniStat::ObStatItem cb_batch_stat_; //单批回调on_success的cb个数
 };
 
 class ObLogApplyService : public lib::TGTaskHandler
@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_archive_compressor.h"
+#include "lib/compress/ob_compressor_pool.h"       // ObCompressorPool
+#include "ob_archive_define.h"                      // ObArchiveCompressUnitHeader
+
+namespace oceanbase
+{
+using namespace common;
+namespace archive
+{
+int ObArchiveCompressor::get_max_compress_size(const ObCompressorType type,
+    const int64_t src_len,
+    int64_t &max_len)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = NULL;
+  int64_t max_overflow_size = 0;
+  if (OB_UNLIKELY(src_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", K(ret), K(type), K(src_len));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(type, compressor))) {
+    ARCHIVE_LOG(WARN, "get compressor failed", K(ret), K(type));
+  } else if (OB_ISNULL(compressor)) {
+    ret = OB_ERR_UNEXPECTED;
+    ARCHIVE_LOG(WARN, "compressor is NULL", K(ret), K(type));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(src_len, max_overflow_size))) {
+    ARCHIVE_LOG(WARN, "get max overflow size failed", K(ret), K(type), K(src_len));
+  } else {
+    max_len = ObArchiveCompressUnitHeader::HEADER_SIZE + src_len + max_overflow_size;
+  }
+  return ret;
+}
+
+int ObArchiveCompressor::compress(const ObCompressorType type,
+    const char *src,
+    const int64_t src_len,
+    char *dst,
+    const int64_t dst_len,
+    int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = NULL;
+  ObArchiveCompressUnitHeader header;
+  const int64_t header_size = ObArchiveCompressUnitHeader::HEADER_SIZE;
+  char *data = NULL;
+  const int64_t data_buf_len = dst_len - pos - header_size;
+  int64_t data_len = 0;
+  ObCompressorType real_type = type;
+  if (OB_ISNULL(src) || OB_ISNULL(dst) || OB_UNLIKELY(src_len <= 0 || pos < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", K(ret), K(type), KP(src), K(src_len), KP(dst), K(dst_len), K(pos));
+  } else if (OB_UNLIKELY(data_buf_len < src_len)) {
+    ret = OB_BUF_NOT_ENOUGH;
+    ARCHIVE_LOG(WARN, "buffer not enough", K(ret), K(src_len), K(dst_len), K(pos));
+  } else if (FALSE_IT(data = dst + pos + header_size)) {
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(type, compressor))) {
+    ARCHIVE_LOG(WARN, "get compressor failed", K(ret), K(type));
+  } else if (OB_ISNULL(compressor)) {
+    ret = OB_ERR_UNEXPECTED;
+    ARCHIVE_LOG(WARN, "compressor is NULL", K(ret), K(type));
+  } else if (OB_FAIL(compressor->compress(src, src_len, data, data_buf_len, data_len))) {
+    ARCHIVE_LOG(WARN, "compress failed", K(ret), K(type), K(src_len), K(data_buf_len));
+  } else {
+    if (data_len >= src_len) {
+      // 不可压缩数据原样存储, 避免恢复时无效解压
+      real_type = NONE_COMPRESSOR;
+      MEMCPY(data, src, src_len);
+      data_len = src_len;
+    }
+    if (OB_FAIL(header.generate_header(static_cast<int32_t>(real_type), src_len, data, data_len))) {
+      ARCHIVE_LOG(WARN, "generate compress unit header failed", K(ret), K(real_type), K(src_len), K(data_len));
+    } else if (OB_FAIL(header.serialize(dst, dst_len, pos))) {
+      ARCHIVE_LOG(WARN, "compress unit header serialize failed", K(ret), K(header));
+    } else {
+      pos += data_len;
+    }
+  }
+  return ret;
+}
+
+int ObArchiveCompressor::get_decompress_size(const char *buf,
+    const int64_t buf_len,
+    int64_t &orig_len,
+    int64_t &consumed_len)
+{
+  return scan_(buf, buf_len, NULL, 0, orig_len, consumed_len);
+}
+
+int ObArchiveCompressor::decompress(const char *buf,
+    const int64_t buf_len,
+    char *dst,
+    const int64_t dst_len,
+    int64_t &orig_len,
+    int64_t &consumed_len)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(dst) || OB_UNLIKELY(dst_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", K(ret), KP(dst), K(dst_len));
+  } else {
+    ret = scan_(buf, buf_len, dst, dst_len, orig_len, consumed_len);
+  }
+  return ret;
+}
+
+int ObArchiveCompressor::scan_(const char *buf,
+    const int64_t buf_len,
+    char *dst,
+    const int64_t dst_len,
+    int64_t &orig_len,
+    int64_t &consumed_len)
+{
+  int ret = OB_SUCCESS;
+  bool is_end = false;
+  orig_len = 0;
+  consumed_len = 0;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(buf_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", K(ret), KP(buf), K(buf_len));
+  }
+
+  while (OB_SUCC(ret) && ! is_end && consumed_len < buf_len) {
+    const char *cur_buf = buf + consumed_len;
+    const int64_t cur_buf_len = buf_len - consumed_len;
+    int64_t unit_len = 0;
+    int64_t unit_orig_len = 0;
+    // 压缩文件数据区仅由压缩单元组成
+    if (OB_FAIL(decompress_unit_(cur_buf, cur_buf_len,
+            NULL == dst ? NULL : dst + orig_len, dst_len - orig_len, unit_len, unit_orig_len))) {
+      ARCHIVE_LOG(WARN, "decompress unit failed", K(ret), K(consumed_len), K(buf_len));
+    }
+
+    if (OB_FAIL(ret)) {
+    } else if (0 == unit_len) {
+      // 末尾数据不完整
+      is_end = true;
+    } else {
+      consumed_len += unit_len;
+      orig_len += unit_orig_len;
+    }
+  }
+  return ret;
+}
+
+// unit_len为0表示压缩单元不完整
+int ObArchiveCompressor::decompress_unit_(const char *buf,
+    const int64_t buf_len,
+    char *dst,
+    const int64_t dst_len,
+    int64_t &unit_len,
+    int64_t &orig_len)
+{
+  int ret = OB_SUCCESS;
+  ObArchiveCompressUnitHeader header;
+  const int64_t header_size = ObArchiveCompressUnitHeader::HEADER_SIZE;
+  int64_t pos = 0;
+  unit_len = 0;
+  orig_len = 0;
+  if (buf_len < header_size) {
+    // incomplete header
+  } else if (OB_FAIL(header.deserialize(buf, buf_len, pos))) {
+    ARCHIVE_LOG(WARN, "compress unit header deserialize failed", K(ret), K(buf_len));
+  } else if (OB_UNLIKELY(! header.is_valid())) {
+    ret = OB_INVALID_DATA;
+    ARCHIVE_LOG(ERROR, "invalid compress unit header", K(ret), K(header));
+  } else if (buf_len - header_size < header.data_len_) {
+    // incomplete data
+  } else if (OB_UNLIKELY(! header.check_data_integrity(buf + header_size, header.data_len_))) {
+    ret = OB_INVALID_DATA;
+    ARCHIVE_LOG(ERROR, "compress unit data checksum not match", K(ret), K(header));
+  } else if (NULL == dst) {
+    unit_len = header_size + header.data_len_;
+    orig_len = header.orig_data_len_;
+  } else if (OB_UNLIKELY(header.orig_data_len_ > dst_len)) {
+    ret = OB_BUF_NOT_ENOUGH;
+    ARCHIVE_LOG(WARN, "buffer not enough", K(ret), K(header), K(dst_len));
+  } else if (NONE_COMPRESSOR == static_cast<ObCompressorType>(header.compressor_type_)) {
+    MEMCPY(dst, buf + header_size, header.data_len_);
+    unit_len = header_size + header.data_len_;
+    orig_len = header.orig_data_len_;
+  } else {
+    ObCompressor *compressor = NULL;
+    const ObCompressorType type = static_cast<ObCompressorType>(header.compressor_type_);
+    int64_t data_len = 0;
+    if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(type, compressor))) {
+      ARCHIVE_LOG(WARN, "get compressor failed", K(ret), K(header));
+    } else if (OB_ISNULL(compressor)) {
+      ret = OB_ERR_UNEXPECTED;
+      ARCHIVE_LOG(WARN, "compressor is NULL", K(ret), K(header));
+    } else if (OB_FAIL(compressor->decompress(buf + header_size, header.data_len_,
+            dst, header.orig_data_len_, data_len))) {
+      ARCHIVE_LOG(WARN, "decompress failed", K(ret), K(header));
+    } else if (OB_UNLIKELY(data_len != header.orig_data_len_)) {
+      ret = OB_INVALID_DATA;
+      ARCHIVE_LOG(ERROR, "decompress data len not match", K(ret), K(header), K(data_len));
+    } else {
+      unit_len = header_size + header.data_len_;
+      orig_len = header.orig_data_len_;
+    }
+  }
+  return ret;
+}
+
+} // namespace archive
+} // namespace oceanbase
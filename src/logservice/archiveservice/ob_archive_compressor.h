@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ARCHIVE_OB_ARCHIVE_COMPRESSOR_H_
+#define OCEANBASE_ARCHIVE_OB_ARCHIVE_COMPRESSOR_H_
+
+#include "lib/compress/ob_compress_util.h"     // ObCompressorType
+
+namespace oceanbase
+{
+namespace archive
+{
+// 归档数据压缩与解压
+//
+// fetcher以压缩加密单元为粒度将聚合的LogGroupEntry压缩为压缩单元, 压缩文件的file header
+// 标识ARCHIVE_FILE_FLAG_COMPRESS, 恢复读取压缩文件时顺序解压数据区的压缩单元, 输出连续的LogGroupEntry
+class ObArchiveCompressor
+{
+public:
+  // 压缩单元最大长度, 用于预留输出buffer
+  //
+  // @param [in], type          压缩算法
+  // @param [in], src_len       原始数据长度
+  // @param [out], max_len      压缩单元最大长度
+  static int get_max_compress_size(const common::ObCompressorType type,
+                                   const int64_t src_len,
+                                   int64_t &max_len);
+
+  // 将原始数据压缩为一个压缩单元, 写入dst + pos
+  // 压缩后数据不小于原始数据时以NONE_COMPRESSOR原样存储
+  //
+  // @param [in], type          压缩算法
+  // @param [in], src           原始数据
+  // @param [in], src_len       原始数据长度
+  // @param [in], dst           输出buffer
+  // @param [in], dst_len       输出buffer长度
+  // @param [in/out], pos       输出buffer写入位置
+  static int compress(const common::ObCompressorType type,
+                      const char *src,
+                      const int64_t src_len,
+                      char *dst,
+                      const int64_t dst_len,
+                      int64_t &pos);
+
+  // 计算压缩文件数据解压后长度, 末尾不完整的压缩单元不计入
+  //
+  // @param [in], buf                归档数据
+  // @param [in], buf_len            归档数据长度
+  // @param [out], orig_len          解压后数据长度
+  // @param [out], consumed_len      完整的压缩单元所占长度
+  static int get_decompress_size(const char *buf,
+                                 const int64_t buf_len,
+                                 int64_t &orig_len,
+                                 int64_t &consumed_len);
+
+  // 解压压缩文件数据, 末尾不完整的压缩单元留待下次读取
+  //
+  // @param [in], buf                归档数据
+  // @param [in], buf_len            归档数据长度
+  // @param [in], dst                输出buffer
+  // @param [in], dst_len            输出buffer长度
+  // @param [out], orig_len          解压后数据长度
+  // @param [out], consumed_len      完整的压缩单元所占长度
+  static int decompress(const char *buf,
+                        const int64_t buf_len,
+                        char *dst,
+                        const int64_t dst_len,
+                        int64_t &orig_len,
+                        int64_t &consumed_len);
+
+private:
+  // dst为NULL时仅计算长度
+  static int scan_(const char *buf,
+                   const int64_t buf_len,
+                   char *dst,
+                   const int64_t dst_len,
+                   int64_t &orig_len,
+                   int64_t &consumed_len);
+  static int decompress_unit_(const char *buf,
+                              const int64_t buf_len,
+                              char *dst,
+                              const int64_t dst_len,
+                              int64_t &unit_len,
+                              int64_t &orig_len);
+};
+
+} // namespace archive
+} // namespace oceanbase
+
+#endif /* OCEANBASE_ARCHIVE_OB_ARCHIVE_COMPRESSOR_H_ */
@@ -285,7 +285,7 @@ bool ObArchiveFileHeader::is_valid() const
     && checksum_ == ob_crc64(this, sizeof(*this) - sizeof(checksum_));
 }
 
-int ObArchiveFileHeader::generate_header(const LSN &lsn)
+int ObArchiveFileHeader::generate_header(const LSN &lsn, const int32_t flag)
 {
   int ret = OB_SUCCESS;
   if (OB_UNLIKELY(! lsn.is_valid())) {
@@ -293,7 +293,7 @@ int ObArchiveFileHeader::generate_header(const LSN &lsn)
   } else {
     magic_ = ARCHIVE_FILE_HEADER_MAGIC;
     version_ = 1;
-    flag_ = 0;
+    flag_ = flag;
     unit_size_ = DEFAULT_ARCHIVE_UNIT_SIZE;
     start_lsn_ = lsn.val_;
     checksum_ = static_cast<int64_t>(ob_crc64(this, sizeof(*this) - sizeof(checksum_)));
@@ -301,6 +301,103 @@ int ObArchiveFileHeader::generate_header(const LSN &lsn)
   return ret;
 }
 
+// ================================ ObArchiveCompressUnitHeader ========================== //
+DEFINE_SERIALIZE(ObArchiveCompressUnitHeader)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(0 >= buf_len)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid arguments", KP(buf), K(buf_len), K(ret));
+  } else if (OB_FAIL(serialization::encode_i16(buf, buf_len, pos, magic_))) {
+    ARCHIVE_LOG(WARN, "failed to encode magic_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i16(buf, buf_len, pos, version_))) {
+    ARCHIVE_LOG(WARN, "failed to encode version_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i32(buf, buf_len, pos, compressor_type_))) {
+    ARCHIVE_LOG(WARN, "failed to encode compressor_type_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, orig_data_len_))) {
+    ARCHIVE_LOG(WARN, "failed to encode orig_data_len_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, data_len_))) {
+    ARCHIVE_LOG(WARN, "failed to encode data_len_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, data_checksum_))) {
+    ARCHIVE_LOG(WARN, "failed to encode data_checksum_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, checksum_))) {
+    ARCHIVE_LOG(WARN, "failed to encode checksum_", KP(buf), K(buf_len), K(pos), K(ret));
+  }
+  return ret;
+}
+
+DEFINE_DESERIALIZE(ObArchiveCompressUnitHeader)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || 0 > data_len) {
+    ret = OB_INVALID_DATA;
+    ARCHIVE_LOG(WARN, "invalid arguments", KP(buf), K(data_len), K(ret));
+  } else if (OB_FAIL(serialization::decode_i16(buf, data_len, pos, &magic_))) {
+    ARCHIVE_LOG(WARN, "failed to decode magic_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i16(buf, data_len, pos, &version_))) {
+    ARCHIVE_LOG(WARN, "failed to decode version_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i32(buf, data_len, pos, &compressor_type_))) {
+    ARCHIVE_LOG(WARN, "failed to decode compressor_type_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &orig_data_len_))) {
+    ARCHIVE_LOG(WARN, "failed to decode orig_data_len_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &data_len_))) {
+    ARCHIVE_LOG(WARN, "failed to decode data_len_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &data_checksum_))) {
+    ARCHIVE_LOG(WARN, "failed to decode data_checksum_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &checksum_))) {
+    ARCHIVE_LOG(WARN, "failed to decode checksum_", KP(buf), K(data_len), K(pos), K(ret));
+  }
+  return ret;
+}
+
+DEFINE_GET_SERIALIZE_SIZE(ObArchiveCompressUnitHeader)
+{
+  int64_t size = 0;
+  size += serialization::encoded_length_i16(magic_);
+  size += serialization::encoded_length_i16(version_);
+  size += serialization::encoded_length_i32(compressor_type_);
+  size += serialization::encoded_length_i64(orig_data_len_);
+  size += serialization::encoded_length_i64(data_len_);
+  size += serialization::encoded_length_i64(data_checksum_);
+  size += serialization::encoded_length_i64(checksum_);
+  return size;
+}
+
+bool ObArchiveCompressUnitHeader::is_valid() const
+{
+  return ARCHIVE_COMPRESS_UNIT_MAGIC == magic_
+    && orig_data_len_ > 0
+    && data_len_ > 0
+    && checksum_ == static_cast<int64_t>(ob_crc64(this, sizeof(*this) - sizeof(checksum_)));
+}
+
+bool ObArchiveCompressUnitHeader::check_data_integrity(const char *buf, const int64_t buf_len) const
+{
+  return NULL != buf
+    && buf_len == data_len_
+    && data_checksum_ == static_cast<int64_t>(ob_crc64(buf, buf_len));
+}
+
+int ObArchiveCompressUnitHeader::generate_header(const int32_t compressor_type,
+    const int64_t orig_data_len,
+    const char *data,
+    const int64_t data_len)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(data) || OB_UNLIKELY(orig_data_len <= 0 || data_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+  } else {
+    magic_ = ARCHIVE_COMPRESS_UNIT_MAGIC;
+    version_ = 1;
+    compressor_type_ = compressor_type;
+    orig_data_len_ = orig_data_len;
+    data_len_ = data_len;
+    data_checksum_ = static_cast<int64_t>(ob_crc64(data, data_len));
+    checksum_ = static_cast<int64_t>(ob_crc64(this, sizeof(*this) - sizeof(checksum_)));
+  }
+  return ret;
+}
+
 const char *reason_str[] = {"UNKONWN", "SEND_ERROR", "LOG_RECYCLE", "NOT_CONTINUOUS", "GC", "MAX"};
 const char *ObArchiveInterruptReason::get_str() const
 {
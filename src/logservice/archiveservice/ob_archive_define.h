@@ -42,6 +42,7 @@ const int64_t OB_INVALID_ARCHIVE_FILE_ID = 0;
 const int64_t OB_INVALID_ARCHIVE_FILE_OFFSET = -1;
 const int64_t ARCHIVE_FILE_HEADER_SIZE = 4 * 1024L;  // 4k
 const int64_t DEFAULT_ARCHIVE_UNIT_SIZE = 16 * 1024L;   // 归档压缩加密单元大小
+const int32_t ARCHIVE_FILE_FLAG_COMPRESS = 1;          // 归档文件包含压缩单元
 
 const int64_t DEFAULT_MAX_LOG_SIZE = palf::MAX_LOG_BUFFER_SIZE;
 const int64_t MAX_FETCH_TASK_NUM = 4;
@@ -160,7 +161,8 @@ struct ObArchiveFileHeader
   int64_t checksum_;
 
   bool is_valid() const;
-  int generate_header(const LSN &lsn);
+  int generate_header(const LSN &lsn, const int32_t flag = 0);
+  bool is_compressed() const { return 0 != (flag_ & ARCHIVE_FILE_FLAG_COMPRESS); }
   NEED_SERIALIZE_AND_DESERIALIZE;
   TO_STRING_KV(K_(magic),
                K_(version),
@@ -173,6 +175,40 @@ private:
   static const int16_t ARCHIVE_FILE_HEADER_MAGIC = 0x4648; // FH means archive file header
 };
 
+// 归档压缩单元头, 压缩单元格式为[ObArchiveCompressUnitHeader][data_len_字节数据]
+//
+// 开启压缩的归档轮次中, 归档文件数据区全部由压缩单元顺序组成, file header标识ARCHIVE_FILE_FLAG_COMPRESS;
+// 未开启压缩的归档文件数据区为原始LogGroupEntry, 恢复以file header标识区分二者
+struct ObArchiveCompressUnitHeader
+{
+  int16_t magic_;                    // CU
+  int16_t version_;
+  int32_t compressor_type_;          // 压缩后数据不小于原始数据时为NONE_COMPRESSOR, 数据原样存储
+  int64_t orig_data_len_;            // 压缩前数据长度
+  int64_t data_len_;                 // 压缩后数据长度
+  int64_t data_checksum_;            // 压缩后数据crc64
+  int64_t checksum_;                 // header checksum
+
+  bool is_valid() const;
+  bool check_data_integrity(const char *buf, const int64_t buf_len) const;
+  int generate_header(const int32_t compressor_type,
+                      const int64_t orig_data_len,
+                      const char *data,
+                      const int64_t data_len);
+  NEED_SERIALIZE_AND_DESERIALIZE;
+  TO_STRING_KV(K_(magic),
+               K_(version),
+               K_(compressor_type),
+               K_(orig_data_len),
+               K_(data_len),
+               K_(data_checksum),
+               K_(checksum));
+
+  static const int64_t HEADER_SIZE = 40;
+private:
+  static const int16_t ARCHIVE_COMPRESS_UNIT_MAGIC = 0x4355; // CU means archive compress unit
+};
+
 class ObArchiveInterruptReason
 {
 public:
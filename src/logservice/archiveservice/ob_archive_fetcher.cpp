@@ -20,6 +20,7 @@
 #include "logservice/palf/log_group_entry.h"  // LogGroupEntry
 #include "logservice/palf_handle_guard.h"     // PalfHandleGuard
 #include "ob_archive_allocator.h"             // ObArchiveAllocator
+#include "ob_archive_compressor.h"            // ObArchiveCompressor
 #include "ob_archive_define.h"                // ArchiveWorkStation
 #include "ob_archive_sender.h"                // ObArchiveSender
 #include "ob_ls_mgr.h"                        // ObArchiveLSMgr
@@ -161,8 +162,8 @@ int ObArchiveFetcher::set_archive_info(
     ARCHIVE_LOG(WARN, "invalid argument", K(ret), K(interval), K(genesis_ts), K(base_piece_id), K(unit_size));
   } else {
     piece_interval_ = interval;
-    UNUSED(need_compress);
-    UNUSED(type);
+    need_compress_ = need_compress;
+    compress_type_ = need_compress ? type : INVALID_COMPRESSOR;
     UNUSED(need_encrypt);
     genesis_ts_ = genesis_ts;
     base_piece_id_ = base_piece_id;
@@ -176,6 +177,7 @@ void ObArchiveFetcher::clear_archive_info()
 {
   piece_interval_ = 0;
   need_compress_ = false;
+  compress_type_ = INVALID_COMPRESSOR;
   unit_size_ = 0;
   ARCHIVE_LOG(INFO, "fetcher clear info succ");
 }
@@ -445,7 +447,18 @@ int ObArchiveFetcher::init_helper_(ObArchiveLogFetchTask &task, TmpMemoryHelper
   if (OB_FAIL(helper.init(tenant_id_, id, orign_buf_size, start_offset, end_offset, piece))) {
     ARCHIVE_LOG(WARN, "helper init failed", K(ret), K(start_offset), K(end_offset));
   } else {
-    ARCHIVE_LOG(TRACE, "init helper succ", K(helper));
+    ObArchivePiece append_piece;
+    int64_t append_file_id = OB_INVALID_ARCHIVE_FILE_ID;
+    bool is_append_file_compressed = false;
+    GET_LS_TASK_CTX(ls_mgr_, id) {
+      if (OB_FAIL(ls_archive_task->get_append_file_info(task.get_station(), append_piece,
+              append_file_id, is_append_file_compressed))) {
+        ARCHIVE_LOG(WARN, "get append file info failed", K(ret), K(task));
+      } else {
+        helper.set_append_file(append_piece, append_file_id, is_append_file_compressed);
+        ARCHIVE_LOG(TRACE, "init helper succ", K(helper));
+      }
+    }
   }
   return ret;
 }
@@ -549,7 +562,7 @@ int ObArchiveFetcher::generate_send_buffer_(PalfGroupBufferIterator &iter, TmpMe
 
   if (OB_SUCC(ret)) {
     const int64_t used_ts = common::ObTimeUtility::fast_current_time() - start_ts;
-    statistic(helper.get_log_fetch_size(), used_ts);
+    statistic(helper.get_log_fetch_size(), helper.get_handled_buf_size(), used_ts);
   }
   return ret;
 }
@@ -590,8 +603,8 @@ int ObArchiveFetcher::handle_origin_buffer_(TmpMemoryHelper &helper)
   int ret = OB_SUCCESS;
   char *origin_buf = NULL;
   int64_t origin_buf_size = 0;
-  char *ec_buf = NULL;
-  int64_t ec_buf_size = 0;
+  bool need_compress = false;
+  ObCompressorType compress_type = INVALID_COMPRESSOR;
   if (OB_FAIL(helper.get_original_buf(origin_buf, origin_buf_size))) {
     ARCHIVE_LOG(WARN, "get original buf failed", K(ret), K(helper));
   } else if (OB_ISNULL(origin_buf) || OB_UNLIKELY(origin_buf_size < 0)) {
@@ -601,28 +614,47 @@ int ObArchiveFetcher::handle_origin_buffer_(TmpMemoryHelper &helper)
   } else if (0 == origin_buf_size) {
     // no data, just skip
     ARCHIVE_LOG(INFO, "no data exist, skip it", K(helper));
-  } else if (OB_FAIL(do_compress_(helper))) {
+  } else if (FALSE_IT(get_compress_info_(helper, need_compress, compress_type))) {
+  } else if (need_compress && OB_FAIL(do_compress_(compress_type, helper))) {
     ARCHIVE_LOG(WARN, "do compress failed", K(ret), K(helper));
   } else if (OB_FAIL(do_encrypt_(helper))) {
     ARCHIVE_LOG(WARN, "do encrypt failed", K(ret), K(helper));
+  } else if (! need_compress && OB_FAIL(helper.append_handled_buf(origin_buf, origin_buf_size))) {
+    ARCHIVE_LOG(WARN, "append handled buf failed", K(ret), K(helper));
   } else {
-    ec_buf = origin_buf;
-    ec_buf_size = origin_buf_size;
-    if (OB_FAIL(helper.append_handled_buf(ec_buf, ec_buf_size))) {
-      ARCHIVE_LOG(WARN, "append handled buf failed", K(ret), K(helper));
-    } else {
-      helper.inc_total_origin_buf_size(origin_buf_size);
-      helper.freeze_log_entry();
-      helper.reset_original_buffer();
-    }
+    helper.inc_total_origin_buf_size(origin_buf_size);
+    helper.freeze_log_entry();
+    helper.reset_original_buffer();
   }
   return ret;
 }
 
-int ObArchiveFetcher::do_compress_(TmpMemoryHelper &helper)
+void ObArchiveFetcher::get_compress_info_(const TmpMemoryHelper &helper,
+    bool &need_compress,
+    ObCompressorType &type) const
 {
-  UNUSED(helper);
-  return OB_SUCCESS;
+  need_compress = need_compress_;
+  type = compress_type_;
+  if (helper.in_append_file()) {
+    // 文件已按压缩写入而round未开启压缩时, 以NONE类型压缩单元原样存储数据
+    need_compress = helper.is_append_file_compressed();
+    type = need_compress_ ? compress_type_ : NONE_COMPRESSOR;
+  }
+}
+
+// 压缩在fetcher线程完成, 与sender线程写归档文件流水线执行;
+// 每个处理单元压缩为一个自描述的压缩单元, 恢复时可以逐个解压
+int ObArchiveFetcher::do_compress_(const ObCompressorType type, TmpMemoryHelper &helper)
+{
+  int ret = OB_SUCCESS;
+  char *origin_buf = NULL;
+  int64_t origin_buf_size = 0;
+  if (OB_FAIL(helper.get_original_buf(origin_buf, origin_buf_size))) {
+    ARCHIVE_LOG(WARN, "get original buf failed", K(ret), K(helper));
+  } else if (OB_FAIL(helper.append_compressed_buf(type, origin_buf, origin_buf_size))) {
+    ARCHIVE_LOG(WARN, "append compressed buf failed", K(ret), K(type), K(helper));
+  }
+  return ret;
 }
 
 int ObArchiveFetcher::do_encrypt_(TmpMemoryHelper &helper)
@@ -713,6 +745,8 @@ int ObArchiveFetcher::build_send_task_(const ObLSID &id,
   const int64_t max_log_ts = helper.get_unitized_log_ts();
   char *buf = NULL;
   int64_t buf_size = 0;
+  bool need_compress = false;
+  ObCompressorType compress_type = INVALID_COMPRESSOR;
   if (helper.is_empty()) {
     ARCHIVE_LOG(INFO, "helper is empty, just skip", K(helper));
   } else if (OB_UNLIKELY(! helper.is_data_valid())) {
@@ -726,8 +760,9 @@ int ObArchiveFetcher::build_send_task_(const ObLSID &id,
   } else if (OB_ISNULL(task = allocator_->alloc_send_task(buf_size))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     ARCHIVE_LOG(WARN, "alloc send task failed", K(ret), K(id), K(station));
+  } else if (FALSE_IT(get_compress_info_(helper, need_compress, compress_type))) {
   } else if (OB_FAIL(task->init(tenant_id_, id, station, piece, start_offset, end_offset,
-                                max_log_ts, buf, buf_size))) {
+                                max_log_ts, need_compress, buf, buf_size))) {
     ARCHIVE_LOG(WARN, "send task init failed", K(ret), K(id), K(station), K(helper));
   } else {
     helper.clear_handled_buf();
@@ -900,17 +935,21 @@ void ObArchiveFetcher::handle_log_fetch_ret_(
   }
 }
 
-void ObArchiveFetcher::statistic(const int64_t log_size, const int64_t ts)
+void ObArchiveFetcher::statistic(const int64_t log_size, const int64_t handled_size, const int64_t ts)
 {
   static __thread int64_t READ_LOG_SIZE;
+  static __thread int64_t HANDLED_BUF_SIZE;
   static __thread int64_t READ_COST_TS;
 
   READ_LOG_SIZE += log_size;
+  HANDLED_BUF_SIZE += handled_size;
   READ_COST_TS += ts;
   if (TC_REACH_TIME_INTERVAL(10 * 1000 * 1000L)) {
     ARCHIVE_LOG(INFO, "archive_fetcher statistic in 10s", "total_read_log_size", READ_LOG_SIZE,
-        "total_read_cost_ts", READ_COST_TS);
+        "total_handled_buf_size", HANDLED_BUF_SIZE, "total_read_cost_ts", READ_COST_TS,
+        K_(need_compress), K_(compress_type));
     READ_LOG_SIZE = 0;
+    HANDLED_BUF_SIZE = 0;
     READ_COST_TS = 0;
   }
 }
@@ -932,6 +971,9 @@ ObArchiveFetcher::TmpMemoryHelper::TmpMemoryHelper(ObArchiveAllocator *allocator
   unitized_log_ts_(0),
   cur_piece_(),
   next_piece_(),
+  append_piece_(),
+  append_file_id_(OB_INVALID_ARCHIVE_FILE_ID),
+  is_append_file_compressed_(false),
   allocator_(allocator)
 {
 }
@@ -948,6 +990,9 @@ ObArchiveFetcher::TmpMemoryHelper::~TmpMemoryHelper()
   unitized_log_ts_ = OB_INVALID_TIMESTAMP;
   cur_piece_.reset();
   next_piece_.reset();
+  append_piece_.reset();
+  append_file_id_ = OB_INVALID_ARCHIVE_FILE_ID;
+  is_append_file_compressed_ = false;
 
   if (NULL != origin_buf_) {
     allocator_->free_log_handle_buffer(origin_buf_);
@@ -1093,6 +1138,25 @@ int ObArchiveFetcher::TmpMemoryHelper::append_handled_buf(char *buf, const int64
   return ret;
 }
 
+int ObArchiveFetcher::TmpMemoryHelper::append_compressed_buf(const ObCompressorType type,
+    char *buf,
+    const int64_t buf_size)
+{
+  int ret = OB_SUCCESS;
+  int64_t max_size = 0;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(buf_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", K(ret), K(buf), K(buf_size));
+  } else if (OB_FAIL(ObArchiveCompressor::get_max_compress_size(type, buf_size, max_size))) {
+    ARCHIVE_LOG(WARN, "get max compress size failed", K(ret), K(type), K(buf_size));
+  } else if (OB_FAIL(reserve_handled_buf_(ec_buf_pos_ + max_size))) {
+    ARCHIVE_LOG(WARN, "reserve handled buf failed", K(ret), K(max_size), KPC(this));
+  } else if (OB_FAIL(ObArchiveCompressor::compress(type, buf, buf_size, ec_buf_, ec_buf_size_, ec_buf_pos_))) {
+    ARCHIVE_LOG(WARN, "compress failed", K(ret), K(type), K(buf_size), KPC(this));
+  }
+  return ret;
+}
+
 void ObArchiveFetcher::TmpMemoryHelper::inc_total_origin_buf_size(const int64_t size)
 {
   total_origin_buf_size_ += size;
@@ -1156,6 +1220,41 @@ int ObArchiveFetcher::TmpMemoryHelper::reserve_(const int64_t size)
   return ret;
 }
 
+// ec buf按日志范围申请, 不可压缩数据加上压缩单元头可能超过日志范围
+int ObArchiveFetcher::TmpMemoryHelper::reserve_handled_buf_(const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  char *tmp_buf = NULL;
+  if (size <= ec_buf_size_) {
+  } else if (OB_ISNULL(tmp_buf = (char *)allocator_->alloc_log_handle_buffer(size))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    ARCHIVE_LOG(WARN, "alloc memory failed", K(ret), K(size));
+  } else {
+    MEMCPY(tmp_buf, ec_buf_, ec_buf_pos_);
+    allocator_->free_log_handle_buffer(ec_buf_);
+    ec_buf_ = tmp_buf;
+    ec_buf_size_ = size;
+  }
+  return ret;
+}
+
+void ObArchiveFetcher::TmpMemoryHelper::set_append_file(const ObArchivePiece &piece,
+    const int64_t file_id,
+    const bool is_compressed)
+{
+  append_piece_ = piece;
+  append_file_id_ = file_id;
+  is_append_file_compressed_ = is_compressed;
+}
+
+// 一个fetch task不会跨越归档文件, 以起始offset计算所在文件即可
+bool ObArchiveFetcher::TmpMemoryHelper::in_append_file() const
+{
+  return OB_INVALID_ARCHIVE_FILE_ID != append_file_id_
+    && append_piece_ == cur_piece_
+    && cal_archive_file_id(start_offset_, MAX_ARCHIVE_FILE_SIZE) == append_file_id_;
+}
+
 bool ObArchiveFetcher::TmpMemoryHelper::is_log_enough(const palf::LSN &commit_lsn) const
 {
   return commit_lsn >= end_offset_ || (commit_lsn - cur_offset_) + origin_buf_pos_ >= DEFAULT_ARCHIVE_UNIT_SIZE;
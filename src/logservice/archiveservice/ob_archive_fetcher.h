@@ -162,7 +162,9 @@ private:
   int handle_origin_buffer_(TmpMemoryHelper &helper);
 
   // 1.5.1 压缩
-  int do_compress_(TmpMemoryHelper &helper);
+  // 续写开始归档时已存在的归档文件, 是否压缩与该文件头标记一致; 其他文件使用round确定的压缩算法
+  void get_compress_info_(const TmpMemoryHelper &helper, bool &need_compress, ObCompressorType &type) const;
+  int do_compress_(const ObCompressorType type, TmpMemoryHelper &helper);
 
   // 1.5.2 加密
   int do_encrypt_(TmpMemoryHelper &helper);
@@ -209,7 +211,7 @@ private:
 
   bool in_normal_status_(const ArchiveKey &key) const;
 
-  void statistic(const int64_t log_size, const int64_t ts);
+  void statistic(const int64_t log_size, const int64_t handled_size, const int64_t ts);
 private:
   class TmpMemoryHelper
   {
@@ -234,17 +236,24 @@ private:
     bool original_buffer_enough(const int64_t size);
     int get_original_buf(char *&buf, int64_t &buf_size);
     int append_handled_buf(char *buf, const int64_t buf_size);
+    // 将原始数据压缩为压缩单元追加到ec buf
+    int append_compressed_buf(const ObCompressorType type, char *buf, const int64_t buf_size);
     int get_handled_buf(char *&buf, int64_t &buf_size);
     void clear_handled_buf();
     int append_log_entry(LogGroupEntry &entry);
     void freeze_log_entry();
     void reset_original_buffer();
     int64_t get_log_fetch_size() const { return cur_offset_ - start_offset_; }
+    int64_t get_handled_buf_size() const { return ec_buf_pos_; }
     bool is_empty() const { return NULL == ec_buf_ || 0 == ec_buf_pos_; }
     bool is_data_valid() const { return cur_offset_ - start_offset_ == total_origin_buf_size_; }
     void inc_total_origin_buf_size(const int64_t size);
     bool reach_end() { return cur_offset_ == end_offset_; }
     bool is_log_enough(const palf::LSN &commit_lsn) const;
+    void set_append_file(const ObArchivePiece &piece, const int64_t file_id, const bool is_compressed);
+    // helper数据是否写入开始归档时续写的归档文件
+    bool in_append_file() const;
+    bool is_append_file_compressed() const { return is_append_file_compressed_; }
 
     TO_STRING_KV(K_(tenant_id),
                  K_(id),
@@ -261,9 +270,13 @@ private:
                  K_(unitized_offset),
                  K_(unitized_log_ts),
                  K_(cur_piece),
-                 K_(next_piece));
+                 K_(next_piece),
+                 K_(append_piece),
+                 K_(append_file_id),
+                 K_(is_append_file_compressed));
   private:
     int reserve_(const int64_t size);
+    int reserve_handled_buf_(const int64_t size);
   private:
     bool inited_;
     uint64_t tenant_id_;
@@ -292,6 +305,10 @@ private:
     // 读取日志过程中, 遇到更大piece说明当前piece已经结束
     // 设置next_piece, 方便下一次处理
     ObArchivePiece next_piece_;
+    // 开始归档时续写的归档文件
+    ObArchivePiece append_piece_;
+    int64_t append_file_id_;
+    bool is_append_file_compressed_;
     ObArchiveAllocator *allocator_;
   };
 
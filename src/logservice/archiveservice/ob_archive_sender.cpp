@@ -239,13 +239,13 @@ int ObArchiveSender::handle_task_list(void *data)
 {
   int ret = OB_SUCCESS;
   bool exist = false;
-  bool task_consume = false;
+  int64_t consume_num = 0;
   ObLink *link = NULL;
   ObArchiveSendTask *task = NULL;
   ObArchiveTaskStatus *task_status = static_cast<ObArchiveTaskStatus *>(data);
 
   for (int64_t i = 0; OB_SUCC(ret) && i < MAX_SEND_NUM && ! has_set_stop(); i++) {
-    task_consume = false;
+    consume_num = 0;
     exist = false;
     task = NULL;
     if (OB_FAIL(task_status->top(link, exist))) {
@@ -256,8 +256,8 @@ int ObArchiveSender::handle_task_list(void *data)
       ret = OB_ERR_UNEXPECTED;
       ARCHIVE_LOG(ERROR, "link is NULL", K(ret));
     } else if (FALSE_IT(task = static_cast<ObArchiveSendTask *>(link))) {
-    } else if (OB_SUCC(handle(*task, task_consume))) {
-      if (! task_consume) {
+    } else if (OB_SUCC(handle(*task, *task_status, consume_num))) {
+      if (0 == consume_num) {
         // 有任务无法被消费, 直接跳出循环
         ob_usleep(100 * 1000L);
         break;
@@ -267,11 +267,9 @@ int ObArchiveSender::handle_task_list(void *data)
     }
 
     // handle task
-    if (OB_SUCC(ret) && NULL != task && task_consume) {
-      if (OB_FAIL(task_status->pop_front(1))) {
-        ARCHIVE_LOG(ERROR, "pop front failed", K(ret), K(task_status));
-      } else {
-        release_send_task(task);
+    if (OB_SUCC(ret) && NULL != task && consume_num > 0) {
+      if (OB_FAIL(pop_and_release_tasks_(*task_status, consume_num))) {
+        ARCHIVE_LOG(ERROR, "pop and release tasks failed", K(ret), K(consume_num), KPC(task_status));
       }
     }
   }
@@ -290,14 +288,34 @@ bool ObArchiveSender::in_normal_status_(const ArchiveKey &key) const
   return round_mgr_->is_in_archive_status(key);
 }
 
+int ObArchiveSender::pop_and_release_tasks_(ObArchiveTaskStatus &task_status, const int64_t num)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < num; i++) {
+    ObLink *link = NULL;
+    bool exist = false;
+    if (OB_FAIL(task_status.pop(link, exist))) {
+      ARCHIVE_LOG(WARN, "pop failed", K(ret));
+    } else if (OB_UNLIKELY(! exist || NULL == link)) {
+      ret = OB_ERR_UNEXPECTED;
+      ARCHIVE_LOG(ERROR, "task not exist", K(ret), K(exist), K(link), K(i), K(num));
+    } else {
+      release_send_task(static_cast<ObArchiveSendTask *>(link));
+    }
+  }
+  return ret;
+}
+
 // 仅有需要重试的任务返回错误码
-int ObArchiveSender::handle(const ObArchiveSendTask &task, bool &task_consume)
+int ObArchiveSender::handle(const ObArchiveSendTask &task,
+    ObArchiveTaskStatus &task_status,
+    int64_t &consume_num)
 {
   int ret = OB_SUCCESS;
   const ObLSID &id = task.get_ls_id();
   const ArchiveWorkStation &station = task.get_station();
   share::ObBackupDest backup_dest;
-  task_consume = true;   // 默认task需要被消费掉, 只有补偿piece场景才不会消费
+  consume_num = 1;   // 默认task需要被消费掉, 只有补偿piece场景才不会消费
   if (OB_UNLIKELY(! task.is_valid())) {
     ret = OB_INVALID_ARGUMENT;
     ARCHIVE_LOG(WARN, "invalid argument", K(ret), K(task));
@@ -320,14 +338,14 @@ int ObArchiveSender::handle(const ObArchiveSendTask &task, bool &task_consume)
         ARCHIVE_LOG(WARN, "check piece continuous failed", K(ret));
       } else if (DestSendOperator::WAIT == operation) {
         // do nothing
-        task_consume = false;
+        consume_num = 0;
       } else if (DestSendOperator::COMPENSATE == operation) {
-        task_consume = false;
+        consume_num = 0;
         if (OB_FAIL(do_compensate_piece_(id, next_compensate_piece_id, station,
                                          backup_dest, *ls_archive_task))) {
           ARCHIVE_LOG(WARN, "do compensate piece failed", K(ret), K(task), KPC(ls_archive_task));
         }
-      } else if (OB_FAIL(archive_log_(backup_dest, arg, task, *ls_archive_task))) {
+      } else if (OB_FAIL(archive_log_(backup_dest, arg, task, task_status, *ls_archive_task, consume_num))) {
         ARCHIVE_LOG(WARN, "archive log failed", K(ret), K(task), KPC(ls_archive_task));
       }
 
@@ -422,10 +440,14 @@ int ObArchiveSender::check_can_send_task_(const ObArchiveSendTask &task,
   return ret;
 }
 
+// 同一日志流连续的send_task如果属于相同piece和归档文件, 聚合为一次顺序写入,
+// 减少归档追赶场景下大量小任务写归档介质的次数
 int ObArchiveSender::archive_log_(const ObBackupDest &backup_dest,
     const ObArchiveSendDestArg &arg,
     const ObArchiveSendTask &task,
-    ObLSArchiveTask &ls_archive_task)
+    ObArchiveTaskStatus &task_status,
+    ObLSArchiveTask &ls_archive_task,
+    int64_t &consume_num)
 {
   int ret = OB_SUCCESS;
   int64_t file_id = 0;
@@ -437,6 +459,9 @@ int ObArchiveSender::archive_log_(const ObBackupDest &backup_dest,
   const ObArchivePiece &piece = task.get_piece();
   const ArchiveWorkStation &station = task.get_station();
   bool new_file = false;
+  ObArchiveSendTask *tasks[MAX_BATCH_TASK_NUM] = {NULL};
+  int64_t task_num = 0;
+  int64_t buf_size = 0;
   char *origin_data = NULL;
   int64_t origin_data_len = 0;
   char *filled_data = NULL;
@@ -464,32 +489,78 @@ int ObArchiveSender::archive_log_(const ObBackupDest &backup_dest,
     ret = OB_ERR_UNEXPECTED;
     ARCHIVE_LOG(ERROR, "invalid data", K(ret), K(task), K(origin_data), K(origin_data_len));
   }
-  // 5. fill archive file header if needed
-  else if (new_file
-      && OB_FAIL(fill_file_header_if_needed_(task.get_start_lsn(), origin_data,
-          origin_data_len, filled_data, filled_data_len))) {
-    ARCHIVE_LOG(WARN, "fill file header if needed failed", K(ret));
+  // 5. 聚合后续连续任务
+  else if (OB_FAIL(get_batch_tasks_(task, file_id, task_status, tasks, task_num, buf_size))) {
+    ARCHIVE_LOG(WARN, "get batch tasks failed", K(ret), K(task));
   }
-  // 6. push log
+  // 6. fill archive file header and batch tasks data if needed
+  else if ((new_file || task_num > 1)
+      && OB_FAIL(fill_send_buffer_(new_file, tasks, task_num, buf_size, filled_data, filled_data_len))) {
+    ARCHIVE_LOG(WARN, "fill send buffer failed", K(ret), K(new_file), K(task_num));
+  }
+  // 7. push log
   else if (OB_FAIL(push_log_(id, path.get_obstr(), backup_dest.get_storage_info(), new_file ?
           file_offset : file_offset + ARCHIVE_FILE_HEADER_SIZE,
-          new_file ? filled_data : origin_data, new_file ? filled_data_len : origin_data_len))) {
-    ARCHIVE_LOG(WARN, "push log failed", K(ret), K(task));
+          NULL != filled_data ? filled_data : origin_data,
+          NULL != filled_data ? filled_data_len : origin_data_len))) {
+    ARCHIVE_LOG(WARN, "push log failed", K(ret), K(task), K(task_num));
   }
-  // 7. 更新日志流归档任务archive file info
-  else if (OB_FAIL(update_archive_progress_(file_id, file_offset, task, ls_archive_task))) {
+  // 8. 更新日志流归档任务archive file info
+  else if (OB_FAIL(update_archive_progress_(file_id, file_offset, *tasks[task_num - 1],
+          buf_size, ls_archive_task))) {
     ARCHIVE_LOG(WARN, "update archive file info failed", K(ret), K(file_id));
+  } else {
+    consume_num = task_num;
   }
 
-  // 8. 释放filled buffer
+  // 9. 释放filled buffer
   if (NULL != filled_data) {
     mtl_free(filled_data);
     filled_data = NULL;
   }
 
-  // 9. 统计
+  // 10. 统计
   if (OB_SUCC(ret)) {
-    statistic(task, common::ObTimeUtility::current_time() - start_ts);
+    statistic(task, *tasks[task_num - 1], buf_size, task_num,
+        common::ObTimeUtility::current_time() - start_ts);
+  }
+  return ret;
+}
+
+int ObArchiveSender::get_batch_tasks_(const ObArchiveSendTask &task,
+    const int64_t file_id,
+    ObArchiveTaskStatus &task_status,
+    ObArchiveSendTask **tasks,
+    int64_t &task_num,
+    int64_t &buf_size)
+{
+  int ret = OB_SUCCESS;
+  ObLink *links[MAX_BATCH_TASK_NUM] = {NULL};
+  int64_t link_num = 0;
+  bool batch_end = false;
+  task_num = 0;
+  buf_size = 0;
+  if (OB_FAIL(task_status.top_n(links, MAX_BATCH_TASK_NUM, link_num))) {
+    ARCHIVE_LOG(WARN, "top n failed", K(ret), K(task_status));
+  } else if (OB_UNLIKELY(0 == link_num || &task != static_cast<ObArchiveSendTask *>(links[0]))) {
+    ret = OB_ERR_UNEXPECTED;
+    ARCHIVE_LOG(ERROR, "task is not the top of task status", K(ret), K(task), K(link_num), K(task_status));
+  } else {
+    tasks[task_num++] = static_cast<ObArchiveSendTask *>(links[0]);
+    buf_size = task.get_buf_size();
+    for (int64_t i = 1; i < link_num && ! batch_end; i++) {
+      ObArchiveSendTask *next = static_cast<ObArchiveSendTask *>(links[i]);
+      if (NULL == next
+          || ! next->is_continuous_with(*tasks[task_num - 1])
+          || cal_archive_file_id(next->get_start_lsn(), MAX_ARCHIVE_FILE_SIZE) != file_id
+          || next->is_compressed() != task.is_compressed()
+          || buf_size + next->get_buf_size() > MAX_BATCH_BUF_SIZE) {
+        batch_end = true;
+      } else {
+        tasks[task_num++] = next;
+        buf_size += next->get_buf_size();
+      }
+    }
   }
   return ret;
 }
@@ -557,29 +628,63 @@ int ObArchiveSender::build_archive_path_(const ObLSID &id,
   return ret;
 }
 
-int ObArchiveSender::fill_file_header_if_needed_(const palf::LSN &lsn,
-    char *origin_data,
-    const int64_t origin_data_len,
+int ObArchiveSender::fill_send_buffer_(const bool new_file,
+    ObArchiveSendTask **tasks,
+    const int64_t task_num,
+    const int64_t buf_size,
     char *&filled_data,
     int64_t &filled_data_len)
 {
   int ret = OB_SUCCESS;
   int64_t pos = 0;
-  ObArchiveFileHeader file_header;
-  filled_data_len = origin_data_len + ARCHIVE_FILE_HEADER_SIZE;
+  filled_data_len = (new_file ? ARCHIVE_FILE_HEADER_SIZE : 0) + buf_size;
   if (OB_ISNULL(filled_data = (char*)mtl_malloc(filled_data_len, "ArcFile"))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     ARCHIVE_LOG(WARN, "alloc memory failed", K(ret));
-  } else if (OB_FAIL(file_header.generate_header(lsn))) {
-    ARCHIVE_LOG(WARN, "generate archive file header failed", K(ret), K(lsn));
-  } else if (OB_FAIL(file_header.serialize(filled_data, filled_data_len, pos))) {
+  } else if (new_file && OB_FAIL(fill_file_header_(*tasks[0], filled_data, filled_data_len, pos))) {
+    ARCHIVE_LOG(WARN, "fill file header failed", K(ret));
+  }
+
+  for (int64_t i = 0; OB_SUCC(ret) && i < task_num; i++) {
+    char *data = NULL;
+    int64_t data_len = 0;
+    if (OB_FAIL(tasks[i]->get_buffer(data, data_len))) {
+      ARCHIVE_LOG(WARN, "get buffer failed", K(ret), KPC(tasks[i]));
+    } else if (OB_UNLIKELY(NULL == data || data_len <= 0 || data_len > filled_data_len - pos)) {
+      ret = OB_ERR_UNEXPECTED;
+      ARCHIVE_LOG(ERROR, "invalid data", K(ret), KPC(tasks[i]), K(data_len), K(filled_data_len), K(pos));
+    } else {
+      MEMCPY(filled_data + pos, data, data_len);
+      pos += data_len;
+    }
+  }
+
+  if (OB_FAIL(ret) && NULL != filled_data) {
+    mtl_free(filled_data);
+    filled_data = NULL;
+  }
+  return ret;
+}
+
+int ObArchiveSender::fill_file_header_(const ObArchiveSendTask &task,
+    char *buf,
+    const int64_t buf_len,
+    int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  ObArchiveFileHeader file_header;
+  // 新文件的数据由fetcher按round的压缩算法生成, 文件头压缩标记与任务数据保持一致
+  const int32_t flag = task.is_compressed() ? ARCHIVE_FILE_FLAG_COMPRESS : 0;
+  if (OB_FAIL(file_header.generate_header(task.get_start_lsn(), flag))) {
+    ARCHIVE_LOG(WARN, "generate archive file header failed", K(ret), K(task));
+  } else if (OB_FAIL(file_header.serialize(buf, buf_len, pos))) {
     ARCHIVE_LOG(WARN, "archive file header serialize failed", K(ret));
   } else if (OB_UNLIKELY(pos > ARCHIVE_FILE_HEADER_SIZE)) {
     ret = OB_ERR_UNEXPECTED;
     ARCHIVE_LOG(ERROR, "pos exceed", K(ret), K(pos));
   } else {
-    MEMSET(filled_data + pos, 0, ARCHIVE_FILE_HEADER_SIZE - pos);
-    MEMCPY(filled_data + ARCHIVE_FILE_HEADER_SIZE, origin_data, origin_data_len);
+    MEMSET(buf + pos, 0, ARCHIVE_FILE_HEADER_SIZE - pos);
+    pos = ARCHIVE_FILE_HEADER_SIZE;
   }
   return ret;
 }
@@ -605,9 +710,10 @@ int ObArchiveSender::push_log_(const ObLSID &id,
 int ObArchiveSender::update_archive_progress_(const int64_t file_id,
     const int64_t file_offset,
     const ObArchiveSendTask &task,
+    const int64_t buf_size,
     ObLSArchiveTask &ls_archive_task)
 {
-  const int64_t end_offset = file_offset + task.get_buf_size();
+  const int64_t end_offset = file_offset + buf_size;
   const ArchiveWorkStation &station = task.get_station();
   const LSN &lsn = task.get_end_lsn();
   const int64_t log_ts = task.get_max_log_ts();
@@ -663,37 +769,48 @@ bool ObArchiveSender::is_ignore_ret_code_(const int ret_code) const
     || OB_LOG_ARCHIVE_LEADER_CHANGED == ret_code;
 }
 
-void ObArchiveSender::statistic(const ObArchiveSendTask &task, const int64_t cost_ts)
+void ObArchiveSender::statistic(const ObArchiveSendTask &first_task,
+    const ObArchiveSendTask &last_task,
+    const int64_t buf_size,
+    const int64_t task_num,
+    const int64_t cost_ts)
 {
   static __thread int64_t SEND_LOG_LSN_SIZE;
   static __thread int64_t SEND_BUF_SIZE;
   static __thread int64_t SEND_TASK_COUNT;
+  static __thread int64_t SEND_IO_COUNT;
   static __thread int64_t SEND_COST_TS;
 
-  SEND_LOG_LSN_SIZE += static_cast<int64_t>((task.get_end_lsn() - task.get_start_lsn()));
-  SEND_BUF_SIZE += task.get_buf_size();
-  SEND_TASK_COUNT++;
+  SEND_LOG_LSN_SIZE += static_cast<int64_t>((last_task.get_end_lsn() - first_task.get_start_lsn()));
+  SEND_BUF_SIZE += buf_size;
+  SEND_TASK_COUNT += task_num;
+  SEND_IO_COUNT++;
   SEND_COST_TS += cost_ts;
 
   if (TC_REACH_TIME_INTERVAL(10 * 1000 * 1000L)) {
     const int64_t total_send_log_size = SEND_LOG_LSN_SIZE;
     const int64_t total_send_buf_size = SEND_BUF_SIZE;
     const int64_t total_send_task_count = SEND_TASK_COUNT;
+    const int64_t total_send_io_count = SEND_IO_COUNT;
     const int64_t total_send_cost_ts = SEND_COST_TS;
     const int64_t avg_task_lsn_size = total_send_log_size / std::max(total_send_task_count, 1L);
     const int64_t avg_task_buf_size = total_send_buf_size / std::max(total_send_task_count, 1L);
-    const int64_t avg_task_cost_ts = total_send_cost_ts / std::max(total_send_task_count, 1L);
+    const int64_t avg_io_buf_size = total_send_buf_size / std::max(total_send_io_count, 1L);
+    const int64_t avg_io_cost_ts = total_send_cost_ts / std::max(total_send_io_count, 1L);
     ARCHIVE_LOG(INFO, "archive_sender statistic in 10s",
                 K(total_send_log_size),
                 K(total_send_buf_size),
                 K(total_send_task_count),
+                K(total_send_io_count),
                 K(total_send_cost_ts),
                 K(avg_task_lsn_size),
                 K(avg_task_buf_size),
-                K(avg_task_cost_ts));
+                K(avg_io_buf_size),
+                K(avg_io_cost_ts));
     SEND_LOG_LSN_SIZE = 0;
     SEND_BUF_SIZE = 0;
     SEND_TASK_COUNT = 0;
+    SEND_IO_COUNT = 0;
     SEND_COST_TS = 0;
   }
 }
@@ -51,6 +51,9 @@ using oceanbase::share::ObLSID;
 class ObArchiveSender : public share::ObThreadPool, public ObArchiveWorker
 {
   static const int64_t MAX_SEND_NUM = 10;
+  // 单次聚合写入的最大任务数和数据量
+  static const int64_t MAX_BATCH_TASK_NUM = 16;
+  static const int64_t MAX_BATCH_BUF_SIZE = 8 * 1024 * 1024L;
 public:
   ObArchiveSender();
   virtual ~ObArchiveSender();
@@ -85,7 +88,10 @@ private:
   // 消费task status, 为日志流级别send_task队列, 目前为单线程消费单个日志流
   int handle_task_list(void *data);
 
-  int handle(const ObArchiveSendTask &task, bool &task_consume);
+  // consume_num为处理完成需要出队的任务数, 为0表示任务暂时无法消费
+  int handle(const ObArchiveSendTask &task, ObArchiveTaskStatus &task_status, int64_t &consume_num);
+
+  int pop_and_release_tasks_(ObArchiveTaskStatus &task_status, const int64_t num);
 
   // 1. 检查server归档状态
   bool in_normal_status_(const ArchiveKey &key) const;
@@ -109,7 +115,9 @@ private:
   int archive_log_(const share::ObBackupDest &backup_dest,
       const ObArchiveSendDestArg &arg,
       const ObArchiveSendTask &task,
-      ObLSArchiveTask &ls_archive_task);
+      ObArchiveTaskStatus &task_status,
+      ObLSArchiveTask &ls_archive_task,
+      int64_t &consume_num);
 
   // 3.1 decide archive file
   int decide_archive_file_(const ObArchiveSendTask &task,
@@ -135,15 +143,28 @@ private:
       const share::ObBackupDest &backup_dest,
       share::ObBackupPath &path);
 
-  // 3.4 fill file header
+  // 3.4 聚合同一归档文件内连续的任务, 第一个任务为task
+  int get_batch_tasks_(const ObArchiveSendTask &task,
+      const int64_t file_id,
+      ObArchiveTaskStatus &task_status,
+      ObArchiveSendTask **tasks,
+      int64_t &task_num,
+      int64_t &buf_size);
+
+  // 3.5 fill file header and batch tasks data
   //
-  int fill_file_header_if_needed_(const palf::LSN &lsn,
-      char *origin_data,
-      const int64_t origin_data_len,
+  int fill_send_buffer_(const bool new_file,
+      ObArchiveSendTask **tasks,
+      const int64_t task_num,
+      const int64_t buf_size,
       char *&filled_data,
       int64_t &filled_data_len);
+  int fill_file_header_(const ObArchiveSendTask &task,
+      char *buf,
+      const int64_t buf_len,
+      int64_t &pos);
 
-  // 3.5 push log
+  // 3.6 push log
   int push_log_(const share::ObLSID &id,
       const ObString &uri,
       const share::ObBackupStorageInfo *storage_info,
@@ -151,10 +172,11 @@ private:
       char *data,
       const int64_t data_len);
 
-  // 3.6 执行归档callback
+  // 3.7 执行归档callback, task为聚合的最后一个任务
   int update_archive_progress_(const int64_t file_id,
       const int64_t file_offset,
       const ObArchiveSendTask &task,
+      const int64_t buf_size,
       ObLSArchiveTask &ls_archive_task);
 
   // retire task status
@@ -167,7 +189,11 @@ private:
   bool is_retry_ret_code_(const int ret_code) const;
   bool is_ignore_ret_code_(const int ret_code) const;
 
-  void statistic(const ObArchiveSendTask &task, const int64_t cost_ts);
+  void statistic(const ObArchiveSendTask &first_task,
+      const ObArchiveSendTask &last_task,
+      const int64_t buf_size,
+      const int64_t task_num,
+      const int64_t cost_ts);
 private:
   bool                  inited_;
   uint64_t              tenant_id_;
@@ -13,6 +13,7 @@
 #include "ob_archive_service.h"
 #include "lib/ob_define.h"                          // is_meta_tenant is_sys_tenant
 #include "lib/compress/ob_compress_util.h"          // ObCompressorType
+#include "lib/compress/ob_compressor_pool.h"        // ObCompressorPool
 #include "lib/ob_errno.h"
 #include "share/backup/ob_archive_struct.h"         // ObTenantArchiveRoundAttr
 #include "share/backup/ob_tenant_archive_round.h"   // ObArchiveRoundHandler
@@ -355,7 +356,7 @@ int ObArchiveService::set_log_archive_info_(const ObTenantArchiveRoundAttr &attr
   const int64_t genesis_ts = attr.start_scn_;
   const int64_t base_piece_id = attr.base_piece_id_;
   const int64_t unit_size = 100;
-  const bool need_compress = false;
+  bool need_compress = false;
   ObCompressorType type = INVALID_COMPRESSOR;
   const bool need_encrypt = false;
   const int64_t round_start_ts = attr.start_scn_;
@@ -364,6 +365,7 @@ int ObArchiveService::set_log_archive_info_(const ObTenantArchiveRoundAttr &attr
   if (OB_ISNULL(mysql_proxy)) {
     ret = OB_INVALID_ARGUMENT;
     ARCHIVE_LOG(WARN, "invalid argument", K(ret));
+  } else if (FALSE_IT(get_compress_info_(attr, need_compress, type))) {
   } else if (OB_FAIL(fetcher_.set_archive_info(piece_interval, genesis_ts, base_piece_id,
                                         unit_size, need_compress, type, need_encrypt))) {
     ARCHIVE_LOG(ERROR, "archive fetcher set archive info failed", K(ret));
@@ -381,6 +383,23 @@ int ObArchiveService::set_log_archive_info_(const ObTenantArchiveRoundAttr &attr
   return ret;
 }
 
+// 压缩算法在生成归档round时确定并持久化在round信息中, round内保持不变, 与当前配置无关
+void ObArchiveService::get_compress_info_(const ObTenantArchiveRoundAttr &attr,
+    bool &need_compress,
+    ObCompressorType &type)
+{
+  int ret = OB_SUCCESS;
+  need_compress = false;
+  type = NONE_COMPRESSOR;
+  if (OB_FAIL(ObCompressorPool::get_instance().get_compressor_type(attr.compression_.ptr(), type))) {
+    ARCHIVE_LOG(ERROR, "get compressor type failed, archive without compression", K(ret), K_(tenant_id), K(attr));
+    type = NONE_COMPRESSOR;
+  } else {
+    need_compress = NONE_COMPRESSOR != type;
+  }
+  ARCHIVE_LOG(INFO, "get archive compress info", K_(tenant_id), K(need_compress), K(type));
+}
+
 void ObArchiveService::notify_start_()
 {
   ls_mgr_.notify_start();
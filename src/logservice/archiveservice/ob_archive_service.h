@@ -128,6 +128,10 @@ private:
   int start_archive_(const ObTenantArchiveRoundAttr &attr);
   // 3.1 设置归档信息
   int set_log_archive_info_(const ObTenantArchiveRoundAttr &attr);
+  // 3.1.1 获取租户配置的归档压缩算法
+  void get_compress_info_(const ObTenantArchiveRoundAttr &attr,
+      bool &need_compress,
+      common::ObCompressorType &type);
   // 3.2 通知各模块开启归档
   void notify_start_();
 
@@ -157,6 +157,7 @@ ObArchiveSendTask::ObArchiveSendTask() :
   start_offset_(),
   end_offset_(),
   max_log_ts_(OB_INVALID_TIMESTAMP),
+  is_compressed_(false),
   data_(NULL),
   data_len_(0)
 {}
@@ -170,6 +171,7 @@ ObArchiveSendTask::~ObArchiveSendTask()
   start_offset_.reset();
   end_offset_.reset();
   max_log_ts_ = OB_INVALID_TIMESTAMP;
+  is_compressed_ = false;
   data_ = NULL;
   data_len_ = 0;
 }
@@ -181,6 +183,7 @@ int ObArchiveSendTask::init(const uint64_t tenant_id,
                             const LSN &start_offset,
                             const LSN &end_offset,
                             const int64_t max_log_ts,
+                            const bool is_compressed,
                             char *buf,
                             const int64_t buf_size)
 
@@ -206,6 +209,7 @@ int ObArchiveSendTask::init(const uint64_t tenant_id,
     start_offset_ = start_offset;
     end_offset_ = end_offset;
     max_log_ts_ = max_log_ts;
+    is_compressed_ = is_compressed;
     MEMCPY(data_, buf, buf_size);
     data_len_ = buf_size;
   }
@@ -159,6 +159,7 @@ public:
            const LSN &start_offset,
            const LSN &end_offset,
            const int64_t max_log_ts,
+           const bool is_compressed,
            char *data,
            const int64_t data_len);
   bool is_valid() const;
@@ -171,6 +172,7 @@ public:
   int get_buffer(char *&data, int64_t &data_len) const;
   int64_t get_buf_size() const { return data_len_;}
   int64_t get_max_log_ts() const { return max_log_ts_; }
+  bool is_compressed() const { return is_compressed_; }
   int set_buffer(char *buf, const int64_t buf_size);
   bool is_continuous_with(const ObArchiveSendTask &pre_task) const;
   TO_STRING_KV(K_(tenant_id),
@@ -180,6 +182,7 @@ public:
                K_(start_offset),
                K_(end_offset),
                K_(max_log_ts),
+               K_(is_compressed),
                K_(data),
                K_(data_len));
 private:
@@ -190,6 +193,7 @@ private:
   LSN start_offset_;       // 归档数据在文件起始offset
   LSN end_offset_;         // 归档数据在文件终止offset
   int64_t max_log_ts_;     // 该task包含数据最大log ts
+  bool is_compressed_;     // 发送数据是否由压缩单元组成, 决定新归档文件头的压缩标记
   char *data_;             // 发送数据
   int64_t data_len_;       // 发送数据长度
 };
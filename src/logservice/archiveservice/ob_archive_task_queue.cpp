@@ -120,6 +120,39 @@ int ObArchiveTaskStatus::top(ObLink *&link, bool &task_exist)
   return ret;
 }
 
+int ObArchiveTaskStatus::top_n(ObLink **links, const int64_t max_num, int64_t &num)
+{
+  int ret = OB_SUCCESS;
+  num = 0;
+  WLockGuard guard(rwlock_);
+
+  if (OB_ISNULL(links) || OB_UNLIKELY(max_num <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", KR(ret), K(links), K(max_num));
+  } else {
+    // 队列不支持遍历, 弹出任务后按相反顺序放回队首
+    while (OB_SUCC(ret) && num < max_num && ! queue_.is_empty()) {
+      ObLink *link = NULL;
+      if (OB_FAIL(queue_.pop(link))) {
+        ARCHIVE_LOG(WARN, "pop task fail", KR(ret));
+      } else {
+        links[num++] = link;
+      }
+    }
+    for (int64_t i = num - 1; i >= 0; i--) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = queue_.push_front(links[i]))) {
+        ARCHIVE_LOG(ERROR, "push front task fail", K(tmp_ret), K(i));
+      }
+    }
+    if (OB_FAIL(ret)) {
+      num = 0;
+    }
+  }
+
+  return ret;
+}
+
 int ObArchiveTaskStatus::pop_front(const int64_t num)
 {
   int ret = OB_SUCCESS;
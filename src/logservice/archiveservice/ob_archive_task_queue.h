@@ -33,6 +33,8 @@ public:
   int push(common::ObLink *task, ObArchiveWorker &worker);
   int pop(ObLink *&link, bool &task_exist);
   int top(ObLink *&link, bool &task_exist);
+  // 获取队首开始的至多max_num个任务, 任务仍然保留在队列中, 仅限消费线程调用
+  int top_n(ObLink **links, const int64_t max_num, int64_t &num);
   int pop_front(const int64_t num);
   int retire(bool &is_empty, bool &is_discarded);  // 从全局公共队列释放
   void free(bool &is_discarded);   // 释放该结构体指针
@@ -455,7 +455,7 @@ int ObArchiveLSMgr::add_task_(const ObLSID &id,
   ObArchiveLease lease(epoch, 0, 0);
   ArchiveWorkStation station(key, lease);
   StartArchiveHelper helper(id, tenant_id_, station, min_log_ts, piece_interval_,
-      genesis_ts_, base_piece_id_, persist_mgr_);
+      genesis_ts_, base_piece_id_, persist_mgr_, round_mgr_);
   if (OB_FAIL(helper.handle())) {
     ARCHIVE_LOG(WARN, "start archive helper handle failed", KR(ret), K(helper));
   } else if (OB_FAIL(insert_or_update_ls_(helper))) {
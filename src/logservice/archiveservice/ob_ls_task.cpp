@@ -338,6 +338,22 @@ int ObLSArchiveTask::get_archive_send_arg(const ArchiveWorkStation &station, ObA
   return ret;
 }
 
+int ObLSArchiveTask::get_append_file_info(const ArchiveWorkStation &station,
+    share::ObArchivePiece &piece,
+    int64_t &file_id,
+    bool &is_compressed)
+{
+  int ret = OB_SUCCESS;
+  RLockGuard guard(rwlock_);
+  if (OB_UNLIKELY(station != station_)) {
+    ret = OB_LOG_ARCHIVE_LEADER_CHANGED;
+    ARCHIVE_LOG(INFO, "stale task, just skip it", K(ret), K(station), K(station_), K(id_));
+  } else {
+    dest_.get_append_file_info(piece, file_id, is_compressed);
+  }
+  return ret;
+}
+
 int ObLSArchiveTask::update_archive_progress(const ArchiveWorkStation &station,
     const int64_t file_id,
     const int64_t file_offset,
@@ -379,6 +395,9 @@ int64_t ObLSArchiveTask::ArchiveDest::to_string(char *buf, const int64_t buf_len
       K_(archive_file_id),
       K_(archive_file_offset),
       K_(piece_dir_exist),
+      K_(append_piece),
+      K_(append_file_id),
+      K_(is_append_file_compressed),
       K_(wait_send_task_count));
   J_COMMA();
   J_NAME("tasks");
@@ -440,7 +459,7 @@ void ObLSArchiveTask::update_unlock_(const StartArchiveHelper &helper,
   dest_.init(helper.get_piece_min_lsn(), helper.get_offset(),
       helper.get_file_id(), helper.get_file_offset(),
       helper.get_piece(), helper.get_max_archived_ts(),
-      helper.is_log_gap_exist(), allocator);
+      helper.is_log_gap_exist(), helper.is_file_compressed(), allocator);
   ARCHIVE_LOG(INFO, "update_unlock_", KPC(this), K(helper));
 }
 
@@ -464,6 +483,9 @@ ObLSArchiveTask::ArchiveDest::ArchiveDest() :
   archive_file_id_(OB_INVALID_ARCHIVE_FILE_ID),
   archive_file_offset_(OB_INVALID_ARCHIVE_FILE_OFFSET),
   piece_dir_exist_(false),
+  append_piece_(),
+  append_file_id_(OB_INVALID_ARCHIVE_FILE_ID),
+  is_append_file_compressed_(false),
   max_seq_log_offset_(),
   max_fetch_info_(),
   wait_send_task_array_(),
@@ -487,6 +509,9 @@ void ObLSArchiveTask::ArchiveDest::destroy()
   archive_file_id_ = OB_INVALID_ARCHIVE_FILE_ID;
   archive_file_offset_ = OB_INVALID_ARCHIVE_FILE_OFFSET;
   piece_dir_exist_ = false;
+  append_piece_.reset();
+  append_file_id_ = OB_INVALID_ARCHIVE_FILE_ID;
+  is_append_file_compressed_ = false;
   max_seq_log_offset_.reset();
   max_fetch_info_.reset();
 
@@ -502,6 +527,7 @@ void ObLSArchiveTask::ArchiveDest::init(const LSN &piece_min_lsn,
     const share::ObArchivePiece &piece,
     const int64_t max_archived_ts,
     const bool is_log_gap_exist,
+    const bool is_file_compressed,
     ObArchiveAllocator *allocator)
 {
   const ObArchivePiece &cur_piece = max_archived_info_.get_piece();
@@ -519,6 +545,15 @@ void ObLSArchiveTask::ArchiveDest::init(const LSN &piece_min_lsn,
   max_archived_info_ = tuple;
   archive_file_id_ = file_id;
   archive_file_offset_ = file_offset;
+  if (file_offset > 0) {
+    append_piece_ = piece;
+    append_file_id_ = file_id;
+    is_append_file_compressed_ = is_file_compressed;
+  } else {
+    append_piece_.reset();
+    append_file_id_ = OB_INVALID_ARCHIVE_FILE_ID;
+    is_append_file_compressed_ = false;
+  }
   max_seq_log_offset_ = lsn;
   max_fetch_info_ = tuple;
   wait_send_task_count_ = 0;
@@ -742,6 +777,15 @@ void ObLSArchiveTask::ArchiveDest::get_archive_send_arg(ObArchiveSendDestArg &ar
   arg.piece_dir_exist_ = piece_dir_exist_;
 }
 
+void ObLSArchiveTask::ArchiveDest::get_append_file_info(ObArchivePiece &piece,
+    int64_t &file_id,
+    bool &is_compressed)
+{
+  piece = append_piece_;
+  file_id = append_file_id_;
+  is_compressed = is_append_file_compressed_;
+}
+
 void ObLSArchiveTask::ArchiveDest::mark_error()
 {
   has_encount_error_ = true;
@@ -116,6 +116,12 @@ public:
   int get_archive_send_arg(const ArchiveWorkStation &station,
                            ObArchiveSendDestArg &arg);
 
+  // 获取日志流开始归档时续写的归档文件, 不存在续写文件时file_id无效
+  int get_append_file_info(const ArchiveWorkStation &station,
+                           share::ObArchivePiece &piece,
+                           int64_t &file_id,
+                           bool &is_compressed);
+
   int get_max_archive_info(const ArchiveKey &key,
                            ObLSArchivePersistInfo &info);
 
@@ -147,7 +153,7 @@ private:
     void init(const LSN &piece_min_lsn, const LSN &lsn, const int64_t file_id,
         const int64_t file_offset, const share::ObArchivePiece &piece,
         const int64_t max_archived_ts, const bool is_log_gap_exist,
-        ObArchiveAllocator *allocator);
+        const bool is_file_compressed, ObArchiveAllocator *allocator);
     void destroy();
     void get_sequencer_progress(LSN &offset) const;
     int update_sequencer_progress(const int64_t size, const LSN &offset);
@@ -163,6 +169,7 @@ private:
     int update_archive_progress(const int64_t round_start_ts, const int64_t file_id, const int64_t file_offset, const LogFileTuple &tuple);
     void get_archive_progress(int64_t &file_id, int64_t &file_offset, LogFileTuple &tuple);
     void get_archive_send_arg(ObArchiveSendDestArg &arg);
+    void get_append_file_info(share::ObArchivePiece &piece, int64_t &file_id, bool &is_compressed);
     void mark_error();
     void print_tasks_();
     int64_t to_string(char *buf, const int64_t buf_len) const;
@@ -180,6 +187,10 @@ private:
     int64_t archive_file_id_;
     int64_t archive_file_offset_;
     bool piece_dir_exist_;
+    // 开始归档时已存在并需要续写的归档文件, 续写数据是否压缩以该文件头为准
+    share::ObArchivePiece append_piece_;
+    int64_t append_file_id_;
+    bool is_append_file_compressed_;
 
     LSN       max_seq_log_offset_;
     LogFileTuple       max_fetch_info_;
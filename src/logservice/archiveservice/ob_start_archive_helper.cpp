@@ -21,6 +21,9 @@
 #include "logservice/palf/palf_iterator.h"
 #include "logservice/palf_handle_guard.h"   // PalfHandleGuard
 #include "ob_archive_util.h"                // cal
+#include "ob_archive_round_mgr.h"           // ObArchiveRoundMgr
+#include "ob_archive_file_utils.h"          // ObArchiveFileUtils
+#include "share/backup/ob_archive_path.h"   // ObArchivePathUtil
 #include "storage/tx_storage/ob_ls_map.h"
 #include <cstdint>
 
@@ -37,7 +40,8 @@ StartArchiveHelper::StartArchiveHelper(const ObLSID &id,
     const int64_t piece_interval,
     const int64_t genesis_ts,
     const int64_t base_piece_id,
-    ObArchivePersistMgr *persist_mgr)
+    ObArchivePersistMgr *persist_mgr,
+    ObArchiveRoundMgr *round_mgr)
   : id_(id),
     tenant_id_(tenant_id),
     station_(station),
@@ -49,9 +53,11 @@ StartArchiveHelper::StartArchiveHelper(const ObLSID &id,
     start_offset_(),
     archive_file_id_(OB_INVALID_ARCHIVE_FILE_ID),
     archive_file_offset_(OB_INVALID_ARCHIVE_FILE_OFFSET),
+    is_file_compressed_(false),
     max_archived_ts_(OB_INVALID_TIMESTAMP),
     piece_(),
-    persist_mgr_(persist_mgr)
+    persist_mgr_(persist_mgr),
+    round_mgr_(round_mgr)
 {}
 
 StartArchiveHelper::~StartArchiveHelper()
@@ -67,9 +73,11 @@ StartArchiveHelper::~StartArchiveHelper()
   start_offset_.reset();
   archive_file_id_ = OB_INVALID_ARCHIVE_FILE_ID;
   archive_file_offset_ = OB_INVALID_ARCHIVE_FILE_OFFSET;
+  is_file_compressed_ = false;
   max_archived_ts_ = OB_INVALID_TIMESTAMP;
   piece_.reset();
   persist_mgr_ = NULL;
+  round_mgr_ = NULL;
 }
 
 bool StartArchiveHelper::is_valid() const
@@ -94,12 +102,16 @@ int StartArchiveHelper::handle()
   if (OB_UNLIKELY(! id_.is_valid()
         || ! station_.is_valid()
         || min_log_ts_ == OB_INVALID_TIMESTAMP
-        || NULL == persist_mgr_)) {
+        || NULL == persist_mgr_
+        || NULL == round_mgr_)) {
     ret = OB_INVALID_ARGUMENT;
-    ARCHIVE_LOG(WARN, "invalid argumetn", K(ret), K(id_), K(station_), K(persist_mgr_));
+    ARCHIVE_LOG(WARN, "invalid argumetn", K(ret), K(id_), K(station_), K(persist_mgr_), K(round_mgr_));
   } else if (OB_FAIL(fetch_exist_archive_progress_(archive_progress_exist))) {
     ARCHIVE_LOG(WARN, "fetch exist archive progress failed", K(ret), K(id_));
   } else if (archive_progress_exist) {
+    if (archive_file_offset_ > 0 && OB_FAIL(load_archive_file_flag_())) {
+      ARCHIVE_LOG(WARN, "load archive file flag failed", K(ret), K(id_));
+    }
   } else if (OB_FAIL(locate_round_start_archive_point_())) {
     ARCHIVE_LOG(WARN, "locate round start archive point failed", K(ret));
   }
@@ -245,6 +257,40 @@ int StartArchiveHelper::get_local_start_ts_(int64_t &timestamp)
 }
 
 // 由于归档独立压缩/加密, 归档数据offset无法与ob日志offset完全一致
+// 续写已存在的归档文件, 后续数据是否压缩需要与该文件头标记一致, 而不是当前round的压缩算法
+int StartArchiveHelper::load_archive_file_flag_()
+{
+  int ret = OB_SUCCESS;
+  const ArchiveKey &key = station_.get_round();
+  share::ObBackupDest backup_dest;
+  share::ObBackupPath path;
+  char buf[ARCHIVE_FILE_HEADER_SIZE] = {0};
+  int64_t read_size = 0;
+  int64_t pos = 0;
+  ObArchiveFileHeader file_header;
+  if (OB_FAIL(round_mgr_->get_backup_dest(key, backup_dest))) {
+    ARCHIVE_LOG(WARN, "get backup dest failed", K(ret), K(key));
+  } else if (OB_FAIL(share::ObArchivePathUtil::get_ls_archive_file_path(backup_dest, key.dest_id_,
+          key.round_, piece_.get_piece_id(), id_, archive_file_id_, path))) {
+    ARCHIVE_LOG(WARN, "get ls archive file path failed", K(ret), KPC(this));
+  } else if (OB_FAIL(ObArchiveFileUtils::range_read(path.get_obstr(), backup_dest.get_storage_info(),
+          buf, ARCHIVE_FILE_HEADER_SIZE, 0, read_size))) {
+    ARCHIVE_LOG(WARN, "read archive file header failed", K(ret), K(path), KPC(this));
+  } else if (OB_UNLIKELY(ARCHIVE_FILE_HEADER_SIZE != read_size)) {
+    ret = OB_INVALID_DATA;
+    ARCHIVE_LOG(ERROR, "archive file header incomplete", K(ret), K(path), K(read_size), KPC(this));
+  } else if (OB_FAIL(file_header.deserialize(buf, read_size, pos))) {
+    ARCHIVE_LOG(WARN, "archive file header deserialize failed", K(ret), K(path), KPC(this));
+  } else if (OB_UNLIKELY(! file_header.is_valid())) {
+    ret = OB_INVALID_DATA;
+    ARCHIVE_LOG(ERROR, "invalid archive file header", K(ret), K(path), K(file_header), KPC(this));
+  } else {
+    is_file_compressed_ = file_header.is_compressed();
+    ARCHIVE_LOG(INFO, "load archive file flag succ", K(path), K(file_header), KPC(this));
+  }
+  return ret;
+}
+
 // 仅保证归档file_id包含对应ob日志范围, 归档file_offset独自维护
 int StartArchiveHelper::cal_archive_file_id_offset_(const LSN &lsn,
     const int64_t archive_file_id,
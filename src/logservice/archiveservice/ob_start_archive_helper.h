@@ -38,6 +38,7 @@ struct LSN;
 }
 namespace archive
 {
+class ObArchiveRoundMgr;
 using oceanbase::share::ObLSID;
 using oceanbase::palf::LSN;
 
@@ -51,7 +52,8 @@ public:
       const int64_t piece_interval,
       const int64_t genesis_ts,
       const int64_t base_piece_id,
-      ObArchivePersistMgr *persist_mgr);
+      ObArchivePersistMgr *persist_mgr,
+      ObArchiveRoundMgr *round_mgr);
 
   ~StartArchiveHelper();
 
@@ -65,6 +67,8 @@ public:
   const LSN &get_offset() const { return start_offset_; }
   int64_t get_file_id() const { return archive_file_id_; }
   int64_t get_file_offset() const { return archive_file_offset_; }
+  // 续写已存在归档文件时, 该文件头是否标记为压缩
+  bool is_file_compressed() const { return is_file_compressed_; }
   int64_t get_round_start_ts() const { return min_log_ts_; }
   int64_t get_max_archived_ts() const { return max_archived_ts_; }
   const share::ObArchivePiece &get_piece() const { return piece_; }
@@ -80,6 +84,7 @@ public:
                K_(start_offset),
                K_(archive_file_id),
                K_(archive_file_offset),
+               K_(is_file_compressed),
                K_(max_archived_ts),
                K_(piece));
 
@@ -87,6 +92,7 @@ private:
   int load_inner_log_archive_status_(ObLSArchivePersistInfo &info);
   int fetch_exist_archive_progress_(bool &record_exist);
   int locate_round_start_archive_point_();
+  int load_archive_file_flag_();
   int cal_archive_file_id_offset_(const LSN &lsn, const int64_t archive_file_id, const int64_t archive_file_offset);
   int get_local_base_lsn_(palf::LSN &lsn, bool &log_gap);
   int get_local_start_ts_(int64_t &timestamp);
@@ -104,10 +110,12 @@ private:
   LSN start_offset_;
   int64_t archive_file_id_;
   int64_t archive_file_offset_;
+  bool is_file_compressed_;
   int64_t max_archived_ts_;
   share::ObArchivePiece piece_;
 
   ObArchivePersistMgr *persist_mgr_;
+  ObArchiveRoundMgr *round_mgr_;
 };
 
 } // namespace archive
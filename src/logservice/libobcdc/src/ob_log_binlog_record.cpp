@@ -27,6 +27,7 @@ namespace libobcdc
 {
 const char *ObLogBR::COLUMN_CHANGED_LABEL_PTR = "";
 const char *ObLogBR::COLUMN_UNCHANGED_LABEL_PTR = NULL;
+int64_t ObLogBR::total_column_array_bytes_ = 0;
 
 ObLogBR::ObLogBR() : ObLogResourceRecycleTask(ObLogResourceRecycleTask::BINLOG_RECORD_TASK),
                      data_(nullptr),
@@ -38,7 +39,9 @@ ObLogBR::ObLogBR() : ObLogResourceRecycleTask(ObLogResourceRecycleTask::BINLOG_R
                      schema_version_(OB_INVALID_VERSION),
                      commit_version_(0),
                      row_index_(0),
-                     part_trans_task_count_(0)
+                     part_trans_task_count_(0),
+                     column_array_(nullptr),
+                     column_array_size_(0)
 {
 }
 
@@ -46,6 +49,7 @@ ObLogBR::~ObLogBR()
 {
   reset();
 
+  free_column_array_();
   destruct_data_();
 }
 
@@ -98,6 +102,57 @@ void ObLogBR::reset()
   schema_version_ = OB_INVALID_VERSION;
   commit_version_ = 0;
   part_trans_task_count_ = 0;
+
+  // bound the memory retained by the pooled binlog records
+  const int64_t column_array_bytes = calc_column_array_bytes_(column_array_size_);
+  if (column_array_bytes > MAX_REUSED_COLUMN_ARRAY_BYTES
+      || ATOMIC_LOAD(&total_column_array_bytes_) > MAX_TOTAL_COLUMN_ARRAY_BYTES) {
+    free_column_array_();
+  }
+}
+
+void ObLogBR::free_column_array_()
+{
+  if (NULL != column_array_) {
+    ob_free(column_array_);
+    column_array_ = NULL;
+    (void)ATOMIC_FAA(&total_column_array_bytes_, -calc_column_array_bytes_(column_array_size_));
+  }
+  column_array_size_ = 0;
+}
+
+int ObLogBR::get_column_array(const int64_t column_num,
+    binlogBuf *&new_column_array,
+    binlogBuf *&old_column_array)
+{
+  int ret = OB_SUCCESS;
+  new_column_array = NULL;
+  old_column_array = NULL;
+
+  if (OB_UNLIKELY(column_num <= 0)) {
+    LOG_ERROR("invalid argument", K(column_num));
+    ret = OB_INVALID_ARGUMENT;
+  } else if (column_num > column_array_size_) {
+    const int64_t alloc_size = calc_column_array_bytes_(column_num);
+    binlogBuf *column_array = static_cast<binlogBuf *>(ob_malloc(alloc_size, ObModIds::OB_LOG_BINLOG_RECORD));
+
+    if (OB_ISNULL(column_array)) {
+      LOG_ERROR("allocate memory for column array fail", K(alloc_size), K(column_num));
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+    } else {
+      free_column_array_();
+      column_array_ = column_array;
+      column_array_size_ = column_num;
+      (void)ATOMIC_FAA(&total_column_array_bytes_, alloc_size);
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    new_column_array = column_array_;
+    old_column_array = column_array_ + column_array_size_;
+  }
+
+  return ret;
 }
 
 int ObLogBR::set_table_meta(ITableMeta *table_meta)
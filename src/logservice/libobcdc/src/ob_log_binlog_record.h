@@ -19,6 +19,7 @@
 #include "lib/queue/ob_link.h"                       // ObLink
 
 #include "share/ob_define.h"
+#include "lib/atomic/ob_atomic.h"                    // ATOMIC_*
 #include "lib/oblog/ob_log_module.h"                 // OBLOG_LOG
 #include "lib/string/ob_string.h"                    // ObString
 
@@ -36,6 +37,13 @@ public:
   static const char *COLUMN_UNCHANGED_LABEL_PTR;
   static const uint64_t MIN_DRC_CLUSTER_ID = 4294901760; // 0xffff0000
   static const uint64_t MAX_DRC_CLUSTER_ID = 4294967295; // 0xffffffff
+  // column array larger than this is freed when the binlog record is recycled
+  static const int64_t MAX_REUSED_COLUMN_ARRAY_BYTES = 8L << 10;
+  // column arrays held by all the binlog records, beyond which recycled ones are freed
+  static const int64_t MAX_TOTAL_COLUMN_ARRAY_BYTES = 64L << 20;
+
+public:
+  static int64_t get_total_column_array_bytes() { return ATOMIC_LOAD(&total_column_array_bytes_); }
 
 public:
   ObLogBR();
@@ -90,6 +98,13 @@ public:
   uint64_t get_row_index() const { return row_index_; }
   int64_t get_part_trans_task_count() const { return part_trans_task_count_; }
 
+  // Get the new and old column array of a row with column_num columns.
+  // The arrays are owned by the binlog record and kept after it is recycled into ObLogBRPool, so
+  // formatting a row allocates nothing unless it is wider than the rows formatted before.
+  int get_column_array(const int64_t column_num,
+      binlogBuf *&new_column_array,
+      binlogBuf *&old_column_array);
+
   // Aone: https://aone.alibaba-inc.com/issue/19411533
   // for put operation of HBASE: store data type as update, new value use full-column mode, old value is empty
   // special treatment for libobcdc:
@@ -98,9 +113,16 @@ public:
 
  public:
   TO_STRING_KV(K_(valid),
-      K_(commit_version));
+      K_(commit_version),
+      K_(column_array_size));
 
 private:
+  void free_column_array_();
+  static int64_t calc_column_array_bytes_(const int64_t column_num)
+  {
+    return static_cast<int64_t>(sizeof(binlogBuf)) * column_num * 2;
+  }
+
   int verify_part_trans_task_count_(const RecordType type,
     const int64_t part_trans_task_count);
 
@@ -132,6 +154,13 @@ private:
   // 2. DML begin/commit binglog record will carry this info
   int64_t       part_trans_task_count_;
 
+  // new column array followed by old column array, reused between rows
+  binlogBuf     *column_array_;
+  // number of columns that column_array_ can hold
+  int64_t       column_array_size_;
+  // bytes of column arrays held by all the binlog records
+  static int64_t total_column_array_bytes_;
+
 protected:
   /*
    * DRCMessageFactory
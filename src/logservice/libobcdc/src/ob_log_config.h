@@ -510,6 +510,12 @@ public:
   // No printing by default
   T_DEF_BOOL(enable_formatter_print_log, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
 
+  // The stmts of a log entry with at least formatter_parallel_stmt_threshold rows are formatted by
+  // all formatter threads row by row, otherwise the log entry is formatted by one formatter thread
+  // 0 means that a log entry is always formatted by one formatter thread
+  T_DEF_INT_INFT(formatter_parallel_stmt_threshold, OB_CLUSTER_PARAMETER, 256, 0,
+      "min stmt count of log entry formatted in parallel, 0 means disabled");
+
   // Switch: Whether to enable SSL authentication: including MySQL and RPC
   // Disabled by default
   T_DEF_BOOL(ssl_client_authentication, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
@@ -95,7 +95,8 @@ ObLogFormatter::ObLogFormatter() : inited_(false),
                                    hbase_util_(NULL),
                                    skip_hbase_mode_put_column_count_not_consistency_(false),
                                    enable_output_hidden_primary_key_(false),
-                                   log_entry_task_count_(0)
+                                   log_entry_task_count_(0),
+                                   parallel_log_entry_task_count_(0)
 
 {
 }
@@ -156,6 +157,7 @@ int ObLogFormatter::init(const int64_t thread_num,
     skip_hbase_mode_put_column_count_not_consistency_ = skip_hbase_mode_put_column_count_not_consistency;
     enable_output_hidden_primary_key_ = enable_output_hidden_primary_key;
     log_entry_task_count_ = 0;
+    parallel_log_entry_task_count_ = 0;
     inited_ = true;
     LOG_INFO("Formatter init succ", K(working_mode_), "working_mode", print_working_mode(working_mode_),
         K(thread_num), K(queue_size));
@@ -187,6 +189,7 @@ void ObLogFormatter::destroy()
   skip_hbase_mode_put_column_count_not_consistency_ = false;
   enable_output_hidden_primary_key_ = false;
   log_entry_task_count_ = 0;
+  parallel_log_entry_task_count_ = 0;
 }
 
 int ObLogFormatter::start()
@@ -224,34 +227,63 @@ int ObLogFormatter::push(IStmtTask *stmt_task, volatile bool &stop_flag)
     LOG_ERROR("invalid arguments", K(stmt_task));
     ret = OB_INVALID_ARGUMENT;
   } else {
-    // Ensure that all stmt of ObLogEntryTask are pushed to the same queue
+    // All stmt of a small ObLogEntryTask are pushed to the same queue.
+    // Stmt of a large ObLogEntryTask are spread over all queues row by row, the formatted rows are
+    // linked in the order of stmt list by the thread which formats the last stmt, see finish_format_
+    const bool is_parallel = need_parallel_format_(*stmt_task);
     const uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
     int64_t stmt_count = 0;
 
+    if (is_parallel) {
+      // shard the allocator of log entry task before any stmt is formatted
+      static_cast<DmlStmtTask *>(stmt_task)->get_redo_log_entry_task().enable_parallel_alloc();
+    }
+
     while (OB_SUCC(ret) && NULL != stmt_task) {
+      // NOTE: stmt_task can not be referenced after pushed, it may be formatted and recycled at any time
       IStmtTask *next = stmt_task->get_next();
       void *push_task = static_cast<void *>(stmt_task);
+      const uint64_t stmt_hash_value = is_parallel ? hash_value + stmt_count : hash_value;
 
-      RETRY_FUNC(stop_flag, *(static_cast<ObMQThread *>(this)), push, push_task, hash_value, DATA_OP_TIMEOUT);
+      RETRY_FUNC(stop_flag, *(static_cast<ObMQThread *>(this)), push, push_task, stmt_hash_value, DATA_OP_TIMEOUT);
 
       if (OB_SUCC(ret)) {
         stmt_task = next;
         ++stmt_count;
       } else {
         if (OB_IN_STOP_STATE != ret) {
-          LOG_ERROR("push task into formatter fail", KR(ret), K(push_task), K(hash_value));
+          LOG_ERROR("push task into formatter fail", KR(ret), K(push_task), K(stmt_hash_value));
         }
       }
     } // while
 
     if (OB_SUCC(ret)) {
       ATOMIC_INC(&log_entry_task_count_);
+
+      if (is_parallel) {
+        ATOMIC_INC(&parallel_log_entry_task_count_);
+      }
     }
   }
 
   return ret;
 }
 
+bool ObLogFormatter::need_parallel_format_(IStmtTask &stmt_task)
+{
+  bool bool_ret = false;
+  const int64_t parallel_stmt_threshold = TCONF.formatter_parallel_stmt_threshold;
+  DmlStmtTask *dml_stmt_task = dynamic_cast<DmlStmtTask *>(&stmt_task);
+
+  if (parallel_stmt_threshold <= 0 || get_thread_num() <= 1 || OB_ISNULL(dml_stmt_task)) {
+    bool_ret = false;
+  } else {
+    bool_ret = dml_stmt_task->get_redo_log_entry_task().get_stmt_num() >= parallel_stmt_threshold;
+  }
+
+  return bool_ret;
+}
+
 int ObLogFormatter::push_single_task(IStmtTask *stmt_task, volatile bool &stop_flag)
 {
   int ret = OB_SUCCESS;
@@ -290,6 +322,11 @@ int ObLogFormatter::get_task_count(int64_t &br_count,
     LOG_ERROR("get_total_task_num fail", KR(ret), K(br_count));
   } else {
     log_entry_task_count = ATOMIC_LOAD(&log_entry_task_count_);
+
+    if (REACH_TIME_INTERVAL(PRINT_LOG_INTERVAL)) {
+      LOG_INFO("[STAT] [FORMATTER]", K(br_count), K(log_entry_task_count),
+          "parallel_log_entry_task_count", ATOMIC_LOAD(&parallel_log_entry_task_count_));
+    }
   }
 
   return ret;
@@ -429,7 +466,7 @@ int ObLogFormatter::handle(void *data, const int64_t thread_index, volatile bool
         LOG_ERROR("set_meta_info_ fail", KR(ret), K(table_schema), K(db_schema_info), K(br),
             "compat_mode", print_compat_mode(compat_mode));
       }
-    } else if (OB_FAIL(build_row_value_(tenant_id, rv, dml_stmt_task, table_schema, new_column_cnt,
+    } else if (OB_FAIL(build_row_value_(tenant_id, rv, br, dml_stmt_task, table_schema, new_column_cnt,
             cur_stmt_need_callback, stop_flag))) {
       LOG_ERROR("build_row_value_ fail", KR(ret), K(tenant_id), K(rv), "dml_stmt_task", *dml_stmt_task,
           K(new_column_cnt), K(cur_stmt_need_callback),
@@ -734,6 +771,7 @@ void ObLogFormatter::destroy_row_value_array_()
 int ObLogFormatter::build_row_value_(
     const uint64_t tenant_id,
     RowValue *rv,
+    ObLogBR *br,
     DmlStmtTask *stmt_task,
     const TableSchemaType *simple_table_schema,
     int64_t &new_column_cnt,
@@ -752,8 +790,8 @@ int ObLogFormatter::build_row_value_(
   if (OB_UNLIKELY(! inited_)) {
     LOG_ERROR("ObLogFormatter has not been initialized");
     ret = OB_NOT_INIT;
-  } else if (OB_ISNULL(rv) || OB_ISNULL(stmt_task) || OB_ISNULL(simple_table_schema)) {
-    LOG_ERROR("invalid argument", K(rv), K(stmt_task), K(simple_table_schema));
+  } else if (OB_ISNULL(rv) || OB_ISNULL(br) || OB_ISNULL(stmt_task) || OB_ISNULL(simple_table_schema)) {
+    LOG_ERROR("invalid argument", K(rv), K(br), K(stmt_task), K(simple_table_schema));
     ret = OB_INVALID_ARGUMENT;
   } else if (OB_ISNULL(meta_manager_)) {
     LOG_ERROR("meta_manager_ is null", K(meta_manager_));
@@ -817,15 +855,12 @@ int ObLogFormatter::build_row_value_(
         LOG_ERROR("fill_orig_default_value_ fail", KR(ret), K(rv), K(simple_table_schema));
       } else {
         new_column_cnt = new_cols->num_;
-        int64_t column_array_size = sizeof(binlogBuf) * column_num;
-        binlogBuf *new_column_array =
-          static_cast<binlogBuf *>(stmt_task->get_redo_log_entry_task().alloc(column_array_size));
-        binlogBuf *old_column_array =
-          static_cast<binlogBuf *>(stmt_task->get_redo_log_entry_task().alloc(column_array_size));
-
-        if (OB_ISNULL(new_column_array) || OB_ISNULL(old_column_array)) {
-          LOG_ERROR("allocate memory for column array fail", K(column_array_size), K(column_num));
-          ret = OB_ALLOCATE_MEMORY_FAILED;
+        binlogBuf *new_column_array = NULL;
+        binlogBuf *old_column_array = NULL;
+
+        // Column arrays are cached in binlog record, reuse them to avoid allocating for every row
+        if (OB_FAIL(br->get_column_array(column_num, new_column_array, old_column_array))) {
+          LOG_ERROR("get column array from binlog record fail", KR(ret), K(column_num));
         } else {
           rv->new_column_array_ = new_column_array;
           rv->old_column_array_ = old_column_array;
@@ -135,6 +135,9 @@ private:
   static const int64_t DATA_OP_TIMEOUT = 1 * 1000 * 1000;
   static const int64_t PRINT_LOG_INTERVAL = 10 * 1000 * 1000;
 
+  // Whether to format the stmts of the ObLogEntryTask in parallel,
+  // which is decided by the stmt count of ObLogEntryTask and formatter_parallel_stmt_threshold
+  bool need_parallel_format_(IStmtTask &stmt_task);
   void handle_non_full_columns_(DmlStmtTask &dml_stmt_task,
       const TableSchemaType &table_schema);
   int init_row_value_array_(const int64_t row_value_num);
@@ -156,6 +159,7 @@ private:
   int build_row_value_(
       const uint64_t tenant_id,
       RowValue *rv,
+      ObLogBR *br,
       DmlStmtTask *stmt_task,
       const TableSchemaType *simple_table_schema,
       int64_t &new_column_cnt,
@@ -259,6 +263,8 @@ private:
   bool                       skip_hbase_mode_put_column_count_not_consistency_;
   bool                       enable_output_hidden_primary_key_;
   int64_t                    log_entry_task_count_;
+  // Number of ObLogEntryTask formatted by multiple threads
+  int64_t                    parallel_log_entry_task_count_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLogFormatter);
@@ -1654,6 +1654,35 @@ void DdlStmtTask::reset()
 
 ////////////////////////////////////////////////////////////////////////////////////
 
+int64_t ObLogEntryAllocator::used() const
+{
+  int64_t used = 0;
+  for (int64_t idx = 0; idx < ARENA_NUM; idx++) {
+    used += arenas_[idx].allocator_.used();
+  }
+  return used;
+}
+
+int64_t ObLogEntryAllocator::total() const
+{
+  int64_t total = 0;
+  for (int64_t idx = 0; idx < ARENA_NUM; idx++) {
+    total += arenas_[idx].allocator_.total();
+  }
+  return total;
+}
+
+void ObLogEntryAllocator::clear()
+{
+  const int64_t arena_num = ATOMIC_LOAD(&is_parallel_) ? ARENA_NUM : 1;
+  for (int64_t idx = 0; idx < arena_num; idx++) {
+    arenas_[idx].allocator_.clear();
+  }
+  ATOMIC_STORE(&is_parallel_, false);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
 ObLogEntryTask::ObLogEntryTask() :
     host_(NULL),
     participant_(NULL),
@@ -1664,7 +1693,7 @@ ObLogEntryTask::ObLogEntryTask() :
     stmt_list_(),
     formatted_stmt_num_(0),
     row_ref_cnt_(0),
-    arena_allocator_("LogEntryTask", OB_MALLOC_MIDDLE_BLOCK_SIZE)
+    arena_allocator_()
 {
 }
 
@@ -2230,7 +2259,27 @@ int PartTransTask::push_redo_log(
     int64_t redo_data_size = buf_len - pos;
     const uint8_t row_flags = meta.get_flags();
 
-    if (meta.is_row_start()) {
+    // Compressed mutator rows are decompressed into the data buffer of the redo node if the data
+    // is kept in memory. If the data is stored, a temporary buffer is used, which is copied into
+    // the batch buffer when the store task is submitted and freed at the end of this function.
+    char *store_buf = NULL;
+    int64_t store_data_len = 0;
+
+    if (meta.is_compressed() && need_store_data && ! is_sys_ls_part_trans()) {
+      const int64_t orig_data_size = meta.get_uncompressed_data_size();
+      ObMemAttr attr(tls_id_.get_tenant_id(), "CDCRedoDecomp");
+
+      if (OB_ISNULL(store_buf = static_cast<char *>(ob_malloc(orig_data_size, attr)))) {
+        LOG_ERROR("allocate memory for decompress buf fail", K(orig_data_size), K(meta));
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+      } else if (OB_FAIL(fill_mutator_row_data_(meta, redo_data, redo_data_size,
+              store_buf, orig_data_size, store_data_len))) {
+        LOG_ERROR("fill_mutator_row_data_ fail", KR(ret), K(meta), K(log_lsn), K(redo_data_size));
+      }
+    }
+
+    if (OB_FAIL(ret)) {
+    } else if (meta.is_row_start()) {
       // If it is the start of a row, a new redo node is generated
       if (OB_FAIL(push_redo_on_row_start_(need_store_data, trans_id, meta, log_lsn, redo_data, redo_data_size))) {
         if (OB_ENTRY_EXIST == ret) {
@@ -2255,8 +2304,8 @@ int PartTransTask::push_redo_log(
       if ( ! is_sys_ls_part_trans()) {
         if (ObTransRowFlag::is_normal_row(row_flags)) {
           store_log_lsn = log_lsn;
-          data_buf = redo_data;
-          data_len = redo_data_size;
+          data_buf = (NULL != store_buf) ? store_buf : redo_data;
+          data_len = (NULL != store_buf) ? store_data_len : redo_data_size;
         } else {
           ret = OB_NOT_SUPPORTED;
         }
@@ -2273,6 +2322,11 @@ int PartTransTask::push_redo_log(
         } // need_store_data
       }
     }
+
+    if (NULL != store_buf) {
+      ob_free(store_buf);
+      store_buf = NULL;
+    }
   }
 
   LOG_DEBUG("push redo log", KR(ret), K_(tls_id), K(log_lsn), K(tstamp), K(buf_len), K(meta),
@@ -2497,7 +2551,7 @@ int PartTransTask::push_redo_on_row_start_(
 {
   int ret = OB_SUCCESS;
   // Length of the actual data, minus the meta information
-  const int64_t mutator_row_size = meta.get_data_size();
+  const int64_t mutator_row_size = meta.get_uncompressed_data_size();
 
   if (is_sys_ls_part_trans()) {
     if (OB_FAIL(push_ddl_redo_on_row_start_(meta, log_lsn, redo_data, redo_data_size, mutator_row_size))) {
@@ -2529,6 +2583,7 @@ int PartTransTask::push_ddl_redo_on_row_start_(
   int ret = OB_SUCCESS;
   DdlRedoLogNode *node = NULL;
   char *mutator_row_data = NULL;
+  int64_t data_len = 0;
 
   // alloc a Node
   if (OB_ISNULL(node = static_cast<DdlRedoLogNode *>(allocator_.alloc(sizeof(DdlRedoLogNode))))) {
@@ -2538,12 +2593,13 @@ int PartTransTask::push_ddl_redo_on_row_start_(
   } else if (OB_ISNULL(mutator_row_data = static_cast<char *>(allocator_.alloc(mutator_row_size)))) {
     LOG_ERROR("allocate memory for mutator row data fail", K(mutator_row_size), K(meta));
     ret = OB_ALLOCATE_MEMORY_FAILED;
+  // Fill the data carried in this redo
+  } else if (OB_FAIL(fill_mutator_row_data_(meta, redo_data, redo_data_size, mutator_row_data,
+          mutator_row_size, data_len))) {
+    LOG_ERROR("fill_mutator_row_data_ fail", KR(ret), K(meta), K(log_lsn), K(redo_data_size));
   } else {
-    // Fill the data carried in this redo
-    (void)MEMCPY(mutator_row_data, redo_data, redo_data_size);
-
     // reset redo log node
-    node->reset(log_lsn, mutator_row_data, mutator_row_size, redo_data_size);
+    node->reset(log_lsn, mutator_row_data, mutator_row_size, data_len);
 
     // Push to redo list
     if (OB_FAIL(sorted_redo_list_.push(true/*is_data_in_memory*/, node))) {
@@ -2581,6 +2637,7 @@ int PartTransTask::push_dml_redo_on_row_start_(
 {
   int ret = OB_SUCCESS;
   char *mutator_row_data = NULL;
+  int64_t data_len = 0;
   DmlRedoLogNode *meta_node = NULL;
   const uint8_t row_flags = meta.get_flags();
 
@@ -2593,11 +2650,12 @@ int PartTransTask::push_dml_redo_on_row_start_(
       if (OB_ISNULL(mutator_row_data = static_cast<char *>(allocator_.alloc(mutator_row_size)))) {
         LOG_ERROR("allocate memory for mutator row data fail", K(mutator_row_size), K(meta));
         ret = OB_ALLOCATE_MEMORY_FAILED;
+      // Fill the data carried in this redo log
+      } else if (OB_FAIL(fill_mutator_row_data_(meta, redo_data, redo_data_size, mutator_row_data,
+              mutator_row_size, data_len))) {
+        LOG_ERROR("fill_mutator_row_data_ fail", KR(ret), K(meta), K(log_lsn), K(redo_data_size));
       } else {
-        // Fill the data carried in this redo log
-        (void)MEMCPY(mutator_row_data, redo_data, redo_data_size);
-
-        meta_node->init_for_data_memory(log_lsn, mutator_row_data, mutator_row_size, redo_data_size);
+        meta_node->init_for_data_memory(log_lsn, mutator_row_data, mutator_row_size, data_len);
       }
     } else {
       // need store
@@ -2623,6 +2681,39 @@ int PartTransTask::push_dml_redo_on_row_start_(
       allocator_.free(meta_node);
       meta_node = NULL;
     }
+
+    if (NULL != mutator_row_data) {
+      allocator_.free(mutator_row_data);
+      mutator_row_data = NULL;
+    }
+  }
+
+  return ret;
+}
+
+int PartTransTask::fill_mutator_row_data_(
+    const memtable::ObMemtableMutatorMeta &meta,
+    const char *redo_data,
+    const int64_t redo_data_size,
+    char *buf,
+    const int64_t buf_len,
+    int64_t &data_len)
+{
+  int ret = OB_SUCCESS;
+  data_len = 0;
+
+  if (OB_ISNULL(redo_data) || OB_ISNULL(buf) || OB_UNLIKELY(buf_len < meta.get_uncompressed_data_size())) {
+    LOG_ERROR("invalid argument", KP(redo_data), KP(buf), K(buf_len), K(meta));
+    ret = OB_INVALID_ARGUMENT;
+  } else if (meta.is_compressed()) {
+    if (OB_FAIL(meta.decompress_data(redo_data, buf, buf_len))) {
+      LOG_ERROR("decompress redo data fail", KR(ret), K(meta), K(redo_data_size));
+    } else {
+      data_len = meta.get_uncompressed_data_size();
+    }
+  } else {
+    (void)MEMCPY(buf, redo_data, redo_data_size);
+    data_len = redo_data_size;
   }
 
   return ret;
@@ -18,6 +18,8 @@
 #include "lib/queue/ob_link.h"                      // ObLink
 #include "lib/atomic/ob_atomic.h"                   // ATOMIC_LOAD
 #include "lib/lock/ob_small_spin_lock.h"            // ObByteLock
+#include "lib/allocator/ob_safe_arena.h"            // ObSafeArena
+#include "lib/thread_local/ob_tsi_utils.h"          // get_itid
 #include "common/object/ob_object.h"                // ObObj
 #include "common/ob_queue_thread.h"                 // ObCond
 #include "ob_cdc_tablet_to_table_info.h"            // ObCDCTabletChangeInfo
@@ -608,6 +610,58 @@ private:
 
 typedef LightyList<IStmtTask> StmtList;
 
+// Allocator of ObLogEntryTask
+// A log entry formatted by one thread allocates from a single arena. When its stmts are
+// formatted by multiple Formatter threads, the allocation is sharded by thread so that
+// the Formatter threads do not serialize on one lock.
+class ObLogEntryAllocator : public common::ObIAllocator
+{
+public:
+  static const int64_t ARENA_NUM = 8;
+
+public:
+  ObLogEntryAllocator() : is_parallel_(false) {}
+  virtual ~ObLogEntryAllocator() { clear(); }
+
+public:
+  virtual void *alloc(const int64_t size) override
+  {
+    return get_arena_().alloc(size);
+  }
+  virtual void *alloc(const int64_t size, const common::ObMemAttr &attr) override
+  {
+    return get_arena_().alloc(size, attr);
+  }
+  // NOTE: free of arena does nothing, memory is released by clear()
+  virtual void free(void *ptr) override { UNUSED(ptr); }
+  int64_t used() const override;
+  int64_t total() const override;
+
+  // must be called before the stmts are dispatched to multiple threads
+  void enable_parallel() { ATOMIC_STORE(&is_parallel_, true); }
+  bool is_parallel() const { return ATOMIC_LOAD(&is_parallel_); }
+  void clear();
+
+private:
+  struct Arena
+  {
+    Arena() : allocator_("LogEntryTask", common::OB_MALLOC_MIDDLE_BLOCK_SIZE) {}
+    common::ObSafeArena allocator_;
+  };
+  common::ObSafeArena &get_arena_()
+  {
+    const int64_t idx = ATOMIC_LOAD(&is_parallel_) ? (common::get_itid() % ARENA_NUM) : 0;
+    return arenas_[idx].allocator_;
+  }
+
+private:
+  bool  is_parallel_;
+  Arena arenas_[ARENA_NUM];
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObLogEntryAllocator);
+};
+
 class ObLogEntryTask
 {
 public:
@@ -647,6 +701,8 @@ public:
   int get_valid_row_num(int64_t &valid_row_num);
 
   common::ObIAllocator &get_allocator() { return arena_allocator_; }
+  // the stmts will be formatted by multiple threads
+  void enable_parallel_alloc() { arena_allocator_.enable_parallel(); }
   void *alloc(const int64_t size);
   void free(void *ptr);
 
@@ -703,9 +759,9 @@ private:
   int64_t            formatted_stmt_num_;   // Number of statements that formatted
   int64_t            row_ref_cnt_;          // reference count
 
-  // Non-thread safe allocator
-  // used for Parser/Formatter
-  common::ObArenaAllocator arena_allocator_;          // allocator
+  // Thread safe allocator used for Parser/Formatter
+  // the stmts of a large log entry are formatted by multiple Formatter threads concurrently
+  ObLogEntryAllocator arena_allocator_;               // allocator
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLogEntryTask);
@@ -1152,6 +1208,14 @@ private:
       const char *redo_data,
       const int64_t redo_data_size,
       const int64_t mutator_row_size);
+  // copy or decompress the mutator rows carried in redo into buf
+  int fill_mutator_row_data_(
+      const memtable::ObMemtableMutatorMeta &meta,
+      const char *redo_data,
+      const int64_t redo_data_size,
+      char *buf,
+      const int64_t buf_len,
+      int64_t &data_len);
   int get_and_submit_store_task_(
       const uint64_t tenant_id,
       const uint8_t row_flags,
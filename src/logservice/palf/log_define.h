@@ -87,6 +87,8 @@ const int64_t PALF_PARENT_KEEPALIVE_INTERVAL_NS = 1 * 1000 * 1000 * 1000L;
 const int64_t PALF_CHILD_RESEND_REGISTER_INTERVAL_NS = 4 * 1000 * 1000 * 1000L;     // 4000ms
 const int64_t PALF_CHECK_PARENT_CHILD_INTERVAL_US = 1 * 1000 * 1000;                // 1000ms
 const int64_t PALF_DUMP_DEBUG_INFO_INTERVAL_US = 10 * 1000 * 1000;                  // 10s
+const int64_t PALF_MAX_RELOAD_THREAD_NUM = 8;                                        // max number of threads used for loading palf instances on restart
+const int64_t PALF_SYS_LS_ID = 1;                                                   // palf id of sys ls, loaded first on restart
 constexpr int64_t INVALID_PROPOSAL_ID = INT64_MAX;
 
 inline int64_t max_proposal_id(const int64_t a, const int64_t b)
@@ -33,6 +33,8 @@ void LogGroupBuffer::reset()
   is_inited_ = false;
   start_lsn_.reset();
   reuse_lsn_.reset();
+  readable_begin_lsn_.reset();
+  max_filled_end_lsn_.reset();
   data_buf_ = NULL;
   ATOMIC_STORE(&reserved_buffer_size_, 0);
   ATOMIC_STORE(&available_buffer_size_, 0);
@@ -62,6 +64,8 @@ int LogGroupBuffer::init(const LSN &start_lsn)
       memset(data_buf_, 0, group_buffer_size);
       start_lsn_ = start_lsn;
       reuse_lsn_ = start_lsn;
+      readable_begin_lsn_ = start_lsn;
+      max_filled_end_lsn_ = start_lsn;
       ATOMIC_STORE(&reserved_buffer_size_, group_buffer_size);
       ATOMIC_STORE(&available_buffer_size_, group_buffer_size);
       is_inited_ = true;
@@ -82,6 +86,8 @@ void LogGroupBuffer::destroy()
   is_inited_ = false;
   start_lsn_.reset();
   reuse_lsn_.reset();
+  readable_begin_lsn_.reset();
+  max_filled_end_lsn_.reset();
   if (NULL != data_buf_) {
     mtl_free(data_buf_);
     data_buf_ = NULL;
@@ -245,6 +251,8 @@ int LogGroupBuffer::fill(const LSN &lsn,
   } else if (OB_FAIL(get_buffer_pos_(lsn, start_pos))) {
     PALF_LOG(WARN, "get_buffer_pos_ failed", K(ret), K(lsn));
   } else {
+    // must be updated before the data is overwritten, see read_data
+    inc_update_max_filled_end_lsn_(end_lsn);
     const int64_t group_buf_tail_len = reserved_buf_size - start_pos;
     int64_t first_part_len = min(group_buf_tail_len, data_len);
     memcpy(data_buf_ + start_pos, data, first_part_len);
@@ -289,6 +297,7 @@ int LogGroupBuffer::fill_padding(const LSN &lsn,
   } else if (OB_FAIL(get_buffer_pos_(lsn, start_pos))) {
     PALF_LOG(WARN, "get_buffer_pos_ failed", K(ret), K(lsn));
   } else {
+    inc_update_max_filled_end_lsn_(end_lsn);
     const int64_t group_buf_tail_len = reserved_buf_size - start_pos;
     int64_t first_part_len = min(group_buf_tail_len, padding_len);
     memset(data_buf_ + start_pos, 0, first_part_len);
@@ -312,6 +321,73 @@ void LogGroupBuffer::get_reuse_lsn_(LSN &reuse_lsn) const
   reuse_lsn = ATOMIC_LOAD(&reuse_lsn_.val_);
 }
 
+void LogGroupBuffer::inc_update_max_filled_end_lsn_(const LSN &end_lsn)
+{
+  LSN curr_end_lsn = ATOMIC_LOAD(&max_filled_end_lsn_.val_);
+  while (end_lsn > curr_end_lsn) {
+    if (ATOMIC_BCAS(&max_filled_end_lsn_.val_, curr_end_lsn.val_, end_lsn.val_)) {
+      break;
+    } else {
+      curr_end_lsn = ATOMIC_LOAD(&max_filled_end_lsn_.val_);
+    }
+  }
+}
+
+// The data of [read_lsn, read_lsn + read_size) is readable when:
+// 1. it has been flushed, namely it is before reuse_lsn_;
+// 2. it has not been invalidated by truncate or rebuild;
+// 3. no log has been filled into its position, each position in buffer is reused every
+//    reserved_buffer_size_, so the max end lsn which has been filled must not exceed
+//    read_lsn + reserved_buffer_size_.
+bool LogGroupBuffer::is_data_readable_(const LSN &read_lsn, const int64_t read_size) const
+{
+  LSN start_lsn, reuse_lsn;
+  get_buffer_start_lsn_(start_lsn);
+  get_reuse_lsn_(reuse_lsn);
+  const LSN readable_begin_lsn(ATOMIC_LOAD(&readable_begin_lsn_.val_));
+  const LSN max_filled_end_lsn(ATOMIC_LOAD(&max_filled_end_lsn_.val_));
+  const int64_t reserved_buf_size = get_reserved_buffer_size();
+  return read_lsn >= start_lsn
+      && read_lsn >= readable_begin_lsn
+      && read_lsn + read_size <= reuse_lsn
+      && max_filled_end_lsn <= read_lsn + reserved_buf_size;
+}
+
+int LogGroupBuffer::read_data(const LSN &read_lsn,
+                              const int64_t read_size,
+                              char *buf) const
+{
+  int ret = OB_SUCCESS;
+  int64_t start_pos = 0;
+  const int64_t reserved_buf_size = get_reserved_buffer_size();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (!read_lsn.is_valid() || read_size <= 0 || NULL == buf) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid arguments", K(ret), K(read_lsn), K(read_size), KP(buf));
+  } else if (read_size > reserved_buf_size || !is_data_readable_(read_lsn, read_size)) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (OB_FAIL(get_buffer_pos_(read_lsn, start_pos))) {
+    PALF_LOG(WARN, "get_buffer_pos_ failed", K(ret), K(read_lsn));
+  } else {
+    const int64_t group_buf_tail_len = reserved_buf_size - start_pos;
+    int64_t first_part_len = min(group_buf_tail_len, read_size);
+    memcpy(buf, data_buf_ + start_pos, first_part_len);
+    if (read_size > first_part_len) {
+      // seeking to buffer's beginning
+      memcpy(buf + first_part_len, data_buf_, read_size - first_part_len);
+    }
+    // the data may be overwritten by fill() while copying, check again after copy
+    MEM_BARRIER();
+    if (!is_data_readable_(read_lsn, read_size)) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      PALF_LOG(TRACE, "read group buffer success", K(ret), K(read_lsn), K(read_size), K(start_pos));
+    }
+  }
+  return ret;
+}
+
 int LogGroupBuffer::check_log_buf_wrapped(const LSN &lsn, const int64_t log_len, bool &is_buf_wrapped) const
 {
   int ret = OB_SUCCESS;
@@ -413,6 +489,9 @@ int LogGroupBuffer::set_reuse_lsn(const LSN &new_reuse_lsn)
   } else {
     LSN old_reuse_lsn;
     get_reuse_lsn_(old_reuse_lsn);
+    // the data before new_reuse_lsn may not be same as the data on disk after rebuild,
+    // and the data after it will be overwritten after truncate.
+    ATOMIC_STORE(&readable_begin_lsn_.val_, new_reuse_lsn.val_);
     ATOMIC_STORE(&reuse_lsn_.val_, new_reuse_lsn.val_);
     PALF_LOG(INFO, "set_reuse_lsn success", K(old_reuse_lsn), K(new_reuse_lsn));
   }
@@ -50,6 +50,19 @@ public:
                    const int64_t padding_len);
   int wait(const LSN &lsn, const int64_t data_len);
   int get_log_buf(const LSN &lsn, const int64_t total_len, LogWriteBuf &log_buf);
+  //
+  // 功能: 从聚合buffer中读取已经落盘的日志, 用于follower拉日志和CDC读取最近写入的日志时避免读盘
+  //
+  // @param [in] read_lsn, 读取的起点
+  // @param [in] read_size, 读取的长度
+  // @param [out] buf, 存放读取的数据
+  //
+  // return code:
+  //      OB_SUCCESS
+  //      OB_ENTRY_NOT_EXIST, 读取的范围不在buffer中或在读取期间被覆盖, 需要从磁盘读取
+  int read_data(const LSN &read_lsn,
+                const int64_t read_size,
+                char *buf) const;
   bool can_handle_new_log(const LSN &lsn,
                           const int64_t total_len) const;
   bool can_handle_new_log(const LSN &lsn,
@@ -70,12 +83,18 @@ private:
   int get_buffer_pos_(const LSN &lsn, int64_t &start_pos) const;
   void get_buffer_start_lsn_(LSN &start_lsn) const;
   void get_reuse_lsn_(LSN &reuse_lsn) const;
+  void inc_update_max_filled_end_lsn_(const LSN &end_lsn);
+  bool is_data_readable_(const LSN &read_lsn, const int64_t read_size) const;
 private:
   // buffer起始位置对应的lsn
   LSN start_lsn_;
   // buffer可复用起点对应的lsn, 与max_flushed_end_lsn预期最终是相等的.
   // 所有更新max_flushed_end_lsn的逻辑都要考虑一并更新该值.
   LSN reuse_lsn_;
+  // buffer中可读日志的起点, truncate/rebuild之后之前的数据不再可读
+  LSN readable_begin_lsn_;
+  // 所有填充过的日志的最大终点, 在拷贝数据之前更新, 用于读者判断数据是否被覆盖
+  LSN max_filled_end_lsn_;
   // 分配的buffer size
   int64_t reserved_buffer_size_;
   // 当前可用的buffer size
@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "log_group_commit_ctrl.h"
+#include "lib/ob_define.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace palf
+{
+LogGroupCommitHistogram::LogGroupCommitHistogram(const int64_t base)
+  : base_(base)
+{
+  reset();
+}
+
+void LogGroupCommitHistogram::reset()
+{
+  for (int64_t i = 0; i < BUCKET_CNT; i++) {
+    ATOMIC_STORE(&buckets_[i], 0);
+  }
+}
+
+void LogGroupCommitHistogram::record(const int64_t value)
+{
+  int64_t idx = 0;
+  int64_t upper_bound = base_;
+  while (idx < BUCKET_CNT - 1 && value >= upper_bound) {
+    upper_bound <<= 2;
+    idx++;
+  }
+  ATOMIC_INC(&buckets_[idx]);
+}
+
+int64_t LogGroupCommitHistogram::get_bucket_cnt(const int64_t idx) const
+{
+  return (0 <= idx && idx < BUCKET_CNT) ? ATOMIC_LOAD(&buckets_[idx]) : 0;
+}
+
+int64_t LogGroupCommitHistogram::get_upper_bound(const int64_t idx) const
+{
+  return (idx < BUCKET_CNT - 1) ? (base_ << (2 * idx)) : INT64_MAX;
+}
+
+int64_t LogGroupCommitHistogram::to_string(char *buf, const int64_t buf_len) const
+{
+  int64_t pos = 0;
+  for (int64_t i = 0; i < BUCKET_CNT; i++) {
+    if (i < BUCKET_CNT - 1) {
+      (void) databuff_printf(buf, buf_len, pos, "<%ld:%ld,", get_upper_bound(i), get_bucket_cnt(i));
+    } else {
+      (void) databuff_printf(buf, buf_len, pos, ">=%ld:%ld", get_upper_bound(i - 1), get_bucket_cnt(i));
+    }
+  }
+  return pos;
+}
+
+LogGroupCommitStat::LogGroupCommitStat()
+  : freeze_wait_us_(0),
+    avg_flush_cost_us_(0),
+    append_interval_us_(0),
+    group_size_histogram_(GROUP_SIZE_HISTOGRAM_BASE),
+    group_wait_histogram_(GROUP_WAIT_HISTOGRAM_BASE)
+{
+}
+
+void LogGroupCommitStat::reset()
+{
+  freeze_wait_us_ = 0;
+  avg_flush_cost_us_ = 0;
+  append_interval_us_ = 0;
+  group_size_histogram_.reset();
+  group_wait_histogram_.reset();
+}
+
+LogGroupCommitCtrl::LogGroupCommitCtrl()
+  : stat_()
+{
+}
+
+void LogGroupCommitCtrl::reset()
+{
+  stat_.reset();
+}
+
+void LogGroupCommitCtrl::update_freeze_wait_us(const int64_t append_cnt,
+                                               const int64_t append_bytes,
+                                               const int64_t interval_us,
+                                               const int64_t latency_budget_us)
+{
+  const int64_t avg_flush_cost_us = ATOMIC_LOAD(&stat_.avg_flush_cost_us_);
+  const int64_t append_interval_us = (append_cnt > 0) ? interval_us / append_cnt : INT64_MAX;
+  const int64_t wait_budget_us = latency_budget_us - avg_flush_cost_us;
+  int64_t freeze_wait_us = 0;
+  if (0 >= wait_budget_us || 0 >= append_bytes || 0 >= interval_us) {
+    // no budget for waiting or no log
+  } else if (append_interval_us >= wait_budget_us) {
+    // few logs will arrive while waiting, freeze immediately
+  } else {
+    // the time to accumulate TARGET_GROUP_LOG_SIZE logs
+    const int64_t fill_us = TARGET_GROUP_LOG_SIZE * interval_us / append_bytes;
+    freeze_wait_us = MIN(MIN(wait_budget_us, fill_us), MAX_FREEZE_WAIT_US);
+  }
+  ATOMIC_STORE(&stat_.append_interval_us_, (append_cnt > 0) ? append_interval_us : 0);
+  ATOMIC_STORE(&stat_.freeze_wait_us_, freeze_wait_us);
+}
+
+void LogGroupCommitCtrl::record_flush_cost(const int64_t flush_cost_us)
+{
+  if (flush_cost_us >= 0) {
+    const int64_t avg_flush_cost_us = ATOMIC_LOAD(&stat_.avg_flush_cost_us_);
+    // exponential moving average with weight 1/8
+    const int64_t new_avg_flush_cost_us = (0 == avg_flush_cost_us) ? flush_cost_us :
+        (avg_flush_cost_us * 7 + flush_cost_us) / 8;
+    ATOMIC_STORE(&stat_.avg_flush_cost_us_, new_avg_flush_cost_us);
+  }
+}
+
+void LogGroupCommitCtrl::record_group_log(const int64_t group_log_size, const int64_t wait_us)
+{
+  stat_.group_size_histogram_.record(group_log_size);
+  stat_.group_wait_histogram_.record(wait_us);
+}
+
+void LogGroupCommitCtrl::get_stat(LogGroupCommitStat &stat) const
+{
+  stat = stat_;
+}
+} // namespace palf
+} // namespace oceanbase
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LOGSERVICE_LOG_GROUP_COMMIT_CTRL_
+#define OCEANBASE_LOGSERVICE_LOG_GROUP_COMMIT_CTRL_
+
+#include <stdint.h>
+#include "lib/atomic/ob_atomic.h"
+#include "lib/utility/ob_macro_utils.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+namespace palf
+{
+// 统计group log大小和等待时间的分布.
+// 第0个桶记录[0, base), 第i个桶记录[base * 4^(i-1), base * 4^i), 最后一个桶没有上界.
+class LogGroupCommitHistogram
+{
+public:
+  static const int64_t BUCKET_CNT = 8;
+  explicit LogGroupCommitHistogram(const int64_t base);
+  ~LogGroupCommitHistogram() {}
+public:
+  void reset();
+  void record(const int64_t value);
+  int64_t get_bucket_cnt(const int64_t idx) const;
+  // upper bound of idx-th bucket, INT64_MAX for the last bucket
+  int64_t get_upper_bound(const int64_t idx) const;
+  // format as "<4096:10,<16384:2,...,>=67108864:0"
+  int64_t to_string(char *buf, const int64_t buf_len) const;
+private:
+  int64_t base_;
+  int64_t buckets_[BUCKET_CNT];
+};
+
+struct LogGroupCommitStat
+{
+  static const int64_t GROUP_SIZE_HISTOGRAM_BASE = 4 * 1024;
+  static const int64_t GROUP_WAIT_HISTOGRAM_BASE = 64;
+  LogGroupCommitStat();
+  void reset();
+  TO_STRING_KV(K_(freeze_wait_us), K_(avg_flush_cost_us), K_(append_interval_us),
+      K_(group_size_histogram), K_(group_wait_histogram));
+  int64_t freeze_wait_us_;
+  int64_t avg_flush_cost_us_;
+  int64_t append_interval_us_;
+  LogGroupCommitHistogram group_size_histogram_;
+  LogGroupCommitHistogram group_wait_histogram_;
+};
+
+// 自适应的group commit控制器.
+//
+// LogSlidingWindow在日志刷盘完成(FEEDBACK_FREEZE_MODE)或者LogLoopThread周期性
+// 调度时(PERIOD_FREEZE_MODE)冻结最后一条group log. 低并发时每条日志单独刷盘,
+// 高并发时group log往往小于磁盘合适的写入大小. 控制器根据日志的到达速率和刷盘
+// 耗时计算group log冻结前最多等待的时间freeze_wait_us:
+//
+// 1. 可用于等待的时间为commit延迟预算减去平均刷盘耗时, 没有余量时不等待;
+// 2. 平均到达间隔不小于可用等待时间时, 等待期间大概率没有新日志, 不等待;
+// 3. 否则等待攒够TARGET_GROUP_LOG_SIZE所需的时间, 不超过可用等待时间.
+//
+// freeze_wait_us为0时冻结行为与原有逻辑一致.
+class LogGroupCommitCtrl
+{
+public:
+  LogGroupCommitCtrl();
+  ~LogGroupCommitCtrl() {}
+public:
+  void reset();
+  // 根据上一个统计周期内append的日志条数和字节数更新freeze_wait_us,
+  // 由LogLoopThread周期性调用
+  void update_freeze_wait_us(const int64_t append_cnt,
+                             const int64_t append_bytes,
+                             const int64_t interval_us,
+                             const int64_t latency_budget_us);
+  // flush_cost_us为group log从提交到刷盘完成的耗时
+  void record_flush_cost(const int64_t flush_cost_us);
+  // wait_us为group log从生成到提交刷盘的耗时
+  void record_group_log(const int64_t group_log_size, const int64_t wait_us);
+  int64_t get_freeze_wait_us() const { return ATOMIC_LOAD(&stat_.freeze_wait_us_); }
+  void get_stat(LogGroupCommitStat &stat) const;
+  TO_STRING_KV(K_(stat));
+public:
+  // 磁盘写入效率较高的group log大小
+  static const int64_t TARGET_GROUP_LOG_SIZE = 256 * 1024;
+  static const int64_t MAX_FREEZE_WAIT_US = 10 * 1000;
+private:
+  LogGroupCommitStat stat_;
+private:
+  DISALLOW_COPY_AND_ASSIGN(LogGroupCommitCtrl);
+};
+} // namespace palf
+} // namespace oceanbase
+
+#endif // OCEANBASE_LOGSERVICE_LOG_GROUP_COMMIT_CTRL_
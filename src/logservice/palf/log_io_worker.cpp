@@ -15,6 +15,7 @@
 #include <sys/prctl.h>                        // prctl
 #include "lib/ob_errno.h"                     // OB_SUCCESS
 #include "lib/thread/ob_thread_name.h"        // set_thread_name
+#include "lib/stat/ob_diagnose_info.h"        // EVENT_ADD
 #include "share/rc/ob_tenant_base.h"          // mtl_free
 #include "log_io_task.h"                      // LogIOTask
 #include "palf_env_impl.h"                    // PalfEnvImpl
@@ -25,10 +26,234 @@ using namespace common;
 using namespace share;
 namespace palf
 {
+LogIOParallelFlusher::LogIOParallelFlusher()
+    : thread_num_(0),
+      cb_thread_pool_tg_id_(-1),
+      palf_env_impl_(NULL),
+      cond_(),
+      tasks_(NULL),
+      round_(0),
+      task_count_(0),
+      next_task_idx_(0),
+      finished_count_(0),
+      running_count_(0),
+      last_ret_(OB_SUCCESS),
+      write_count_(0),
+      write_total_cost_(0),
+      write_max_cost_(0),
+      round_count_(0),
+      round_total_cost_(0),
+      max_queue_size_(0),
+      last_stat_ts_(OB_INVALID_TIMESTAMP),
+      is_inited_(false)
+{
+}
+
+LogIOParallelFlusher::~LogIOParallelFlusher()
+{
+  destroy();
+}
+
+int LogIOParallelFlusher::init(const int64_t thread_num,
+                               const int cb_thread_pool_tg_id,
+                               PalfEnvImpl *palf_env_impl)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    PALF_LOG(ERROR, "LogIOParallelFlusher has been inited", K(ret));
+  } else if (0 > thread_num || 0 >= cb_thread_pool_tg_id || OB_ISNULL(palf_env_impl)) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(ERROR, "invalid argument!!!", K(ret), K(thread_num), K(cb_thread_pool_tg_id),
+             KP(palf_env_impl));
+  } else if (OB_FAIL(cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT))) {
+    PALF_LOG(ERROR, "cond_ init failed", K(ret));
+  } else if (0 < thread_num && OB_FAIL(set_thread_count(thread_num))) {
+    PALF_LOG(ERROR, "set_thread_count failed", K(ret), K(thread_num));
+  } else {
+    share::ObThreadPool::set_run_wrapper(MTL_CTX());
+    thread_num_ = thread_num;
+    cb_thread_pool_tg_id_ = cb_thread_pool_tg_id;
+    palf_env_impl_ = palf_env_impl;
+    is_inited_ = true;
+    PALF_LOG(INFO, "LogIOParallelFlusher init success", K(ret), K(thread_num));
+  }
+  return ret;
+}
+
+void LogIOParallelFlusher::destroy()
+{
+  if (0 < thread_num_) {
+    (void)stop();
+    (void)wait();
+  }
+  is_inited_ = false;
+  thread_num_ = 0;
+  cb_thread_pool_tg_id_ = -1;
+  palf_env_impl_ = NULL;
+  tasks_ = NULL;
+  round_ = task_count_ = next_task_idx_ = finished_count_ = running_count_ = 0;
+  last_ret_ = OB_SUCCESS;
+  cond_.destroy();
+}
+
+int LogIOParallelFlusher::start()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (0 == thread_num_) {
+    // the io worker flushes all the tasks by itself
+  } else if (OB_FAIL(share::ObThreadPool::start())) {
+    PALF_LOG(ERROR, "LogIOParallelFlusher start failed", K(ret), K_(thread_num));
+  }
+  return ret;
+}
+
+int64_t LogIOParallelFlusher::calc_thread_num(const int64_t configured_num,
+                                              const int64_t cpu_count,
+                                              const int64_t batch_width)
+{
+  int64_t thread_num = configured_num;
+  if (0 > thread_num) {
+    thread_num = MAX(1, cpu_count / CPUS_PER_FLUSH_THREAD);
+  }
+  return MAX(0, MIN(thread_num, batch_width - 1));
+}
+
+void LogIOParallelFlusher::run1()
+{
+  lib::set_thread_name("IOFlusher");
+  int64_t last_round = 0;
+  while (false == has_set_stop()) {
+    bool need_flush = false;
+    {
+      ObThreadCondGuard guard(cond_);
+      if (last_round == round_) {
+        (void)cond_.wait_us(WAIT_ROUND_TIME_US);
+      }
+      // join the round only when there are unclaimed tasks, the io worker
+      // does not start next round until all the joined threads have left.
+      if (last_round != round_) {
+        last_round = round_;
+        if (next_task_idx_ < task_count_) {
+          running_count_++;
+          need_flush = true;
+        }
+      }
+    }
+    if (need_flush) {
+      do_flush_();
+      ObThreadCondGuard guard(cond_);
+      running_count_--;
+      (void)cond_.broadcast();
+    }
+  }
+}
+
+int LogIOParallelFlusher::flush(ObIArray<BatchLogIOFlushLogTask *> &tasks, const int64_t count)
+{
+  int ret = OB_SUCCESS;
+  const int64_t start_ts = ObTimeUtility::fast_current_time();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (0 >= count || count > tasks.count()) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(ERROR, "invalid argument", K(ret), K(count), "task_count", tasks.count());
+  } else {
+    {
+      ObThreadCondGuard guard(cond_);
+      tasks_ = &tasks;
+      task_count_ = count;
+      next_task_idx_ = 0;
+      finished_count_ = 0;
+      last_ret_ = OB_SUCCESS;
+      round_++;
+      if (1 < count && 0 < thread_num_) {
+        (void)cond_.broadcast();
+      }
+    }
+    do_flush_();
+    {
+      ObThreadCondGuard guard(cond_);
+      while (finished_count_ < task_count_ || 0 < running_count_) {
+        (void)cond_.wait_us(WAIT_ROUND_TIME_US);
+      }
+      ret = last_ret_;
+      tasks_ = NULL;
+      task_count_ = 0;
+    }
+    const int64_t round_cost = ObTimeUtility::fast_current_time() - start_ts;
+    round_count_++;
+    round_total_cost_ += round_cost;
+    EVENT_INC(CLOG_PARALLEL_FLUSH_ROUND_COUNT);
+    EVENT_ADD(CLOG_PARALLEL_FLUSH_ROUND_TIME, round_cost);
+  }
+  return ret;
+}
+
+void LogIOParallelFlusher::do_flush_()
+{
+  int64_t idx = 0;
+  while ((idx = ATOMIC_FAA(&next_task_idx_, 1)) < ATOMIC_LOAD(&task_count_)) {
+    flush_one_(tasks_->at(idx));
+  }
+}
+
+void LogIOParallelFlusher::flush_one_(BatchLogIOFlushLogTask *io_task)
+{
+  int ret = OB_SUCCESS;
+  const int64_t start_ts = ObTimeUtility::fast_current_time();
+  if (OB_ISNULL(io_task)) {
+    ret = OB_ERR_UNEXPECTED;
+    PALF_LOG(ERROR, "BatchLogIOFlushLogTask is nullptr, unexpected error!!!", K(ret), KP(io_task));
+  } else if (OB_FAIL(io_task->do_task(cb_thread_pool_tg_id_, palf_env_impl_))) {
+    PALF_LOG(WARN, "do_task failed", K(ret), KPC(io_task));
+  } else {
+    PALF_LOG(TRACE, "LogIOParallelFlusher flush_one_ success", K(ret), KPC(io_task));
+  }
+  const int64_t cost_ts = ObTimeUtility::fast_current_time() - start_ts;
+  (void)ATOMIC_AAF(&write_count_, 1);
+  (void)ATOMIC_AAF(&write_total_cost_, cost_ts);
+  EVENT_INC(CLOG_PARALLEL_FLUSH_WRITE_COUNT);
+  EVENT_ADD(CLOG_PARALLEL_FLUSH_WRITE_TIME, cost_ts);
+  int64_t max_cost = ATOMIC_LOAD(&write_max_cost_);
+  while (cost_ts > max_cost && !ATOMIC_BCAS(&write_max_cost_, max_cost, cost_ts)) {
+    max_cost = ATOMIC_LOAD(&write_max_cost_);
+  }
+  ObThreadCondGuard guard(cond_);
+  if (OB_FAIL(ret)) {
+    last_ret_ = ret;
+  }
+  if (++finished_count_ >= task_count_) {
+    (void)cond_.broadcast();
+  }
+}
+
+void LogIOParallelFlusher::statistics(const int64_t queue_size)
+{
+  max_queue_size_ = MAX(max_queue_size_, queue_size);
+  if (palf_reach_time_interval(STAT_INTERVAL_US, last_stat_ts_)) {
+    const int64_t write_count = ATOMIC_LOAD(&write_count_);
+    const int64_t write_total_cost = ATOMIC_LOAD(&write_total_cost_);
+    const int64_t avg_write_cost = 0 == write_count ? 0 : write_total_cost / write_count;
+    const int64_t avg_round_cost = 0 == round_count_ ? 0 : round_total_cost_ / round_count_;
+    const int64_t avg_round_width = 0 == round_count_ ? 0 : write_count / round_count_;
+    PALF_LOG(INFO, "[PALF STAT IO WORKER]", K_(thread_num), K(queue_size), K_(max_queue_size),
+             K(write_count), K(avg_write_cost), "max_write_cost", ATOMIC_LOAD(&write_max_cost_),
+             K_(round_count), K(avg_round_cost), K(avg_round_width));
+    ATOMIC_STORE(&write_count_, 0);
+    ATOMIC_STORE(&write_total_cost_, 0);
+    ATOMIC_STORE(&write_max_cost_, 0);
+    round_count_ = round_total_cost_ = max_queue_size_ = 0;
+  }
+}
+
 LogIOWorker::LogIOWorker()
     : log_io_worker_num_(-1),
       cb_thread_pool_tg_id_(-1),
       palf_env_impl_(NULL),
+      parallel_flusher_(),
       is_inited_(false)
 {
 }
@@ -58,6 +283,10 @@ int LogIOWorker::init(const LogIOWorkerConfig &config,
                                              config.batch_depth_,
                                              allocator))) {
     PALF_LOG(ERROR, "BatchLogIOFlushLogTaskMgr init failed", K(ret), K(config));
+  } else if (OB_FAIL(parallel_flusher_.init(config.flush_thread_num_,
+                                            cb_thread_pool_tg_id,
+                                            palf_env_impl))) {
+    PALF_LOG(ERROR, "LogIOParallelFlusher init failed", K(ret), K(config));
   } else {
     share::ObThreadPool::set_run_wrapper(MTL_CTX());
     log_io_worker_num_ = config.io_worker_num_;
@@ -83,9 +312,37 @@ void LogIOWorker::destroy()
   log_io_worker_num_ = -1;
   queue_.destroy();
   batch_io_task_mgr_.destroy();
+  parallel_flusher_.destroy();
   PALF_LOG(INFO, "LogIOWorker destroy success");
 }
 
+int LogIOWorker::start()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(parallel_flusher_.start())) {
+    PALF_LOG(ERROR, "LogIOParallelFlusher start failed", K(ret));
+  } else if (OB_FAIL(share::ObThreadPool::start())) {
+    PALF_LOG(ERROR, "LogIOWorker start failed", K(ret));
+  } else {
+    PALF_LOG(INFO, "LogIOWorker start success", K(ret), KPC(this));
+  }
+  return ret;
+}
+
+void LogIOWorker::stop()
+{
+  share::ObThreadPool::stop();
+  parallel_flusher_.stop();
+}
+
+void LogIOWorker::wait()
+{
+  share::ObThreadPool::wait();
+  parallel_flusher_.wait();
+}
+
 int LogIOWorker::submit_io_task(LogIOTask *io_task)
 {
   int ret = OB_SUCCESS;
@@ -196,9 +453,10 @@ int LogIOWorker::reduce_io_task_(void *task)
     }
   }
 
-  if (OB_FAIL(batch_io_task_mgr_.handle(cb_thread_pool_tg_id_, palf_env_impl_))) {
+  if (OB_FAIL(batch_io_task_mgr_.handle(parallel_flusher_))) {
     PALF_LOG(WARN, "batch_io_task_mgr_ handle failed", K(ret), K(batch_io_task_mgr_));
   }
+  parallel_flusher_.statistics(queue_.size());
 
   if (false == last_io_task_has_been_reduced && OB_NOT_NULL(io_task)) {
     ret = handle_io_task_(io_task);
@@ -276,27 +534,21 @@ int LogIOWorker::BatchLogIOFlushLogTaskMgr::insert(LogIOFlushLogTask *io_task)
   return ret;
 }
 
-int LogIOWorker::BatchLogIOFlushLogTaskMgr::handle(const int64_t tg_id, PalfEnvImpl *palf_env_impl)
+int LogIOWorker::BatchLogIOFlushLogTaskMgr::handle(LogIOParallelFlusher &flusher)
 {
   int ret = OB_SUCCESS;
   const int64_t count = batch_io_task_array_.count() - usable_count_;
   // Each BatchLogIOFlushLogTask is a set LogIOFlushLogTask of one palf instance,
   // even if execute 'do_task_' for one of LogIOFlushLogTask failed, we need
-  // execute 'do_task_' for next LogIOFlushLogTask.
+  // execute 'do_task_' for next LogIOFlushLogTask, the flusher guarantees it.
+  if (0 < count && OB_FAIL(flusher.flush(batch_io_task_array_, count))) {
+    PALF_LOG(WARN, "LogIOParallelFlusher flush failed", K(ret), K(count));
+  }
   for (int64_t i = 0; i < count; i++) {
     BatchLogIOFlushLogTask *io_task = batch_io_task_array_[i];
-    if (OB_ISNULL(io_task)) {
-      ret = OB_ERR_UNEXPECTED;
-      PALF_LOG(ERROR,
-               "BatchLogIOFlushLogTask in batch_io_task_array_ is nullptr, unexpected error!!!",
-               K(ret), KP(io_task), K(i));
-    } else if (OB_FAIL(io_task->do_task(tg_id, palf_env_impl))) {
-      PALF_LOG(WARN, "do_task failed", K(ret), KPC(io_task));
-    } else {
-      PALF_LOG(TRACE, "BatchLogIOFlushLogTaskMgr::handle success", K(ret), K(has_batched_size_),
-          KPC(io_task));
-    }
     if (OB_NOT_NULL(io_task)) {
+      PALF_LOG(TRACE, "BatchLogIOFlushLogTaskMgr::handle finished", K(ret), K(has_batched_size_),
+          KPC(io_task));
       // 'handle_count_' and 'has_batched_size_' are used for statistics
       handle_count_ += io_task->get_count() <= 1 ? 0 : 1;
       has_batched_size_ += io_task->get_count() == 1 ? 0 : io_task->get_count();
@@ -20,6 +20,7 @@
 #include "lib/thread/thread_mgr_interface.h"        // TGTaskHandler
 #include "lib/container/ob_fixed_array.h"           // ObSEArrayy
 #include "lib/hash/ob_array_hash_map.h"             // ObArrayHashMap
+#include "lib/lock/ob_thread_cond.h"                // ObThreadCond
 #include "share/ob_thread_pool.h"                   // ObThreadPool
 #include "log_io_task.h"                            // LogBatchIOFlushLogTask
 #include "log_define.h"                             // ALF_SLIDING_WINDOW_SIZE
@@ -46,7 +47,8 @@ struct LogIOWorkerConfig
   }
   bool is_valid() const
   {
-    return 0 < io_worker_num_ && 0 < io_queue_capcity_ && 0 < batch_width_ && 0 < batch_depth_;
+    return 0 < io_worker_num_ && 0 < io_queue_capcity_ && 0 < batch_width_ && 0 < batch_depth_
+        && 0 <= flush_thread_num_ && flush_thread_num_ < batch_width_;
   }
   void reset()
   {
@@ -54,12 +56,87 @@ struct LogIOWorkerConfig
     io_queue_capcity_ = 0;
     batch_width_ = 0;
     batch_depth_ = 0;
+    flush_thread_num_ = 0;
   }
   int64_t io_worker_num_;
   int64_t io_queue_capcity_;
   int64_t batch_width_;
   int64_t batch_depth_;
-  TO_STRING_KV(K_(io_worker_num), K_(io_queue_capcity), K_(batch_width), K_(batch_depth));
+  // the number of helper threads which flush the logs of different palf
+  // instances in parallel with the io worker, 0 means flush serially.
+  int64_t flush_thread_num_;
+  TO_STRING_KV(K_(io_worker_num), K_(io_queue_capcity), K_(batch_width), K_(batch_depth),
+               K_(flush_thread_num));
+};
+
+// LogIOParallelFlusher keeps the writes of different palf instances in flight
+// at the same time.
+//
+// The io worker aggregates LogIOFlushLogTasks into at most one
+// BatchLogIOFlushLogTask per palf instance, and each round used to write them
+// one by one, so a slow write of one log stream delayed all the others. A round
+// is now shared by the io worker and the helper threads: each of them claims the
+// next unflushed BatchLogIOFlushLogTask until all of them have been claimed, and
+// the round ends after all the claimed tasks have finished. The logs of one palf
+// instance are still written and called back in LSN order, because one palf
+// instance has only one BatchLogIOFlushLogTask in a round and rounds never
+// overlap.
+class LogIOParallelFlusher : public share::ObThreadPool
+{
+public:
+  LogIOParallelFlusher();
+  ~LogIOParallelFlusher();
+  int init(const int64_t thread_num,
+           const int cb_thread_pool_tg_id,
+           PalfEnvImpl *palf_env_impl);
+  void destroy();
+  int start() override;
+  void run1() override final;
+  // the number of helper threads, 'configured_num' is the value of
+  // _log_io_flush_thread_num, a negative value means deriving it from
+  // 'cpu_count', one helper thread per CPUS_PER_FLUSH_THREAD cpus. The result
+  // is less than 'batch_width' because a round has at most 'batch_width' tasks
+  // and the io worker flushes one of them.
+  static int64_t calc_thread_num(const int64_t configured_num,
+                                 const int64_t cpu_count,
+                                 const int64_t batch_width);
+  // flush the first 'count' tasks of 'tasks', the caller takes part in the
+  // round and returns after all the tasks have finished.
+  //
+  // @return the last error of BatchLogIOFlushLogTask::do_task
+  int flush(common::ObIArray<BatchLogIOFlushLogTask *> &tasks, const int64_t count);
+  // print the queue depth of the io worker and the latency of writes periodically
+  void statistics(const int64_t queue_size);
+  TO_STRING_KV(K_(thread_num), K_(round), K_(task_count), K_(finished_count), K_(running_count));
+private:
+  void do_flush_();
+  void flush_one_(BatchLogIOFlushLogTask *io_task);
+private:
+  static constexpr int64_t WAIT_ROUND_TIME_US = 100 * 1000;
+  static constexpr int64_t STAT_INTERVAL_US = 10 * 1000 * 1000;
+  static constexpr int64_t CPUS_PER_FLUSH_THREAD = 16;
+private:
+  int64_t thread_num_;
+  int cb_thread_pool_tg_id_;
+  PalfEnvImpl *palf_env_impl_;
+  common::ObThreadCond cond_;
+  common::ObIArray<BatchLogIOFlushLogTask *> *tasks_;
+  int64_t round_;
+  int64_t task_count_;
+  int64_t next_task_idx_;
+  int64_t finished_count_;
+  // the number of helper threads which have joined the current round
+  int64_t running_count_;
+  int last_ret_;
+  // statistics since last print, a write flushes one BatchLogIOFlushLogTask
+  int64_t write_count_;
+  int64_t write_total_cost_;
+  int64_t write_max_cost_;
+  int64_t round_count_;
+  int64_t round_total_cost_;
+  int64_t max_queue_size_;
+  int64_t last_stat_ts_;
+  bool is_inited_;
 };
 
 class LogIOWorker : public share::ObThreadPool
@@ -73,10 +150,13 @@ public:
            PalfEnvImpl *palf_env_impl);
   void destroy();
 
+  int start() override;
+  void stop() override;
+  void wait() override;
   void run1() override final;
   int submit_io_task(LogIOTask *io_task);
   static constexpr int64_t MAX_THREAD_NUM = 1;
-  TO_STRING_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id));
+  TO_STRING_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id), K_(parallel_flusher));
 private:
 
   bool need_reduce_(LogIOTask *task);
@@ -94,7 +174,7 @@ private:
     int init(int64_t batch_width, int64_t batch_depth, ObIAllocator *allocator);
     void destroy();
     int insert(LogIOFlushLogTask *io_task);
-    int handle(const int64_t tg_id, PalfEnvImpl *palf_env_impl);
+    int handle(LogIOParallelFlusher &flusher);
     bool empty();
     TO_STRING_KV(K_(batch_io_task_array), K_(usable_count), K_(batch_width));
   private:
@@ -118,6 +198,7 @@ private:
   PalfEnvImpl *palf_env_impl_;
   ObLightyQueue queue_;
   BatchLogIOFlushLogTaskMgr batch_io_task_mgr_;
+  LogIOParallelFlusher parallel_flusher_;
   bool is_inited_;
 };
 } // end namespace palf
@@ -245,8 +245,14 @@ int LogIteratorImpl<ENTRY>::get_next_entry_()
     int64_t read_storage_max_retry_time = 2;
     do {
       int64_t header_size = 0;
+      int tmp_ret = OB_SUCCESS;
       if (OB_SUCC(parse_one_entry_())) {
         curr_entry_size_ = curr_entry_.get_serialize_size();
+        // NB: mmap读的数据在解析过程中所在block可能被回收, 解析后需要再次校验
+        if (OB_FAIL(log_storage_->check_read_data_valid())) {
+          curr_entry_size_ = 0;
+          PALF_LOG(WARN, "the block may be recycled after parse", K(ret), KPC(this));
+        }
       } else if (OB_BUF_NOT_ENOUGH == ret) {
         if (OB_FAIL(read_data_from_storage_()) && OB_ITER_END != ret
             && OB_ERR_OUT_OF_LOWER_BOUND != ret) {
@@ -260,7 +266,17 @@ int LogIteratorImpl<ENTRY>::get_next_entry_()
           read_storage_max_retry_time--;
           ret = OB_EAGAIN;
         }
+      } else if (OB_NOT_SUPPORTED == (tmp_ret = log_storage_->fallback_to_disk_read())) {
+      } else if (OB_SUCCESS != tmp_ret) {
+        ret = tmp_ret;
+        PALF_LOG(WARN, "the block may be unlinked", K(ret), KPC(this));
       } else {
+        // mmap读出的数据解析失败, 从磁盘重新读取
+        PALF_LOG(WARN, "parse mmap data failed, read from disk again", K(ret), KPC(this));
+        log_storage_->reuse(log_storage_->get_lsn(curr_read_pos_));
+        curr_read_buf_end_pos_ = curr_read_buf_start_pos_ = curr_read_pos_ = 0;
+        read_storage_max_retry_time--;
+        ret = OB_EAGAIN;
       }
     } while (OB_EAGAIN == ret && 0 <= read_storage_max_retry_time);
 
@@ -302,13 +318,21 @@ template<class ENTRY>
 int LogIteratorImpl<ENTRY>::get_entry(ENTRY &entry, LSN &lsn, bool &is_raw_write)
 {
   int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
   int64_t pos = curr_read_pos_;
   if (OB_FAIL(entry.shallow_copy(curr_entry_))) {
     ret = OB_ERR_UNEXPECTED;
     PALF_LOG(ERROR, "shallow_copy failed", K(ret), KPC(this));
   } else if (false == entry.check_integrity()) {
     ret = OB_INVALID_DATA;
+    // mmap中的数据被回收清零时同样会校验失败
+    if (OB_SUCCESS != (tmp_ret = log_storage_->check_read_data_valid())) {
+      ret = tmp_ret;
+    }
     PALF_LOG(WARN, "data has been corrupted, attention!!!", K(ret), KPC(this));
+  // NB: 校验完整性之后再确认block未被回收, 避免返回mmap中已被清零或复用的数据
+  } else if (OB_FAIL(log_storage_->check_read_data_valid())) {
+    PALF_LOG(WARN, "the block may be recycled", K(ret), KPC(this));
   } else {
     lsn = log_storage_->get_lsn(curr_read_pos_);
     is_raw_write = curr_entry_is_raw_write_;
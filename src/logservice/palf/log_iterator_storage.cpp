@@ -186,6 +186,21 @@ int MemoryStorage::pread(const LSN &lsn, const int64_t in_read_size, ReadBuf &re
   return ret;
 }
 
+int MemoryStorage::mmap_block(const int64_t block_id, char *&addr, int64_t &len)
+{
+  UNUSED(block_id);
+  addr = NULL;
+  len = 0;
+  return OB_NOT_SUPPORTED;
+}
+
+int MemoryStorage::munmap_block(char *addr, const int64_t len)
+{
+  UNUSED(addr);
+  UNUSED(len);
+  return OB_NOT_SUPPORTED;
+}
+
 MemoryIteratorStorage:: ~MemoryIteratorStorage()
 {
   destroy();
@@ -213,6 +228,15 @@ int MemoryIteratorStorage::read_data_from_storage_(
   return ret;
 }
 
+DiskIteratorStorage::DiskIteratorStorage() :
+  IteratorStorage(),
+  mmap_addr_(NULL),
+  mmap_len_(0),
+  mmap_block_id_(LOG_INVALID_BLOCK_ID),
+  fallback_block_id_(LOG_INVALID_BLOCK_ID),
+  enable_mmap_read_(false),
+  is_last_read_from_mmap_(false) {}
+
 DiskIteratorStorage::~DiskIteratorStorage()
 {
   destroy();
@@ -220,6 +244,10 @@ DiskIteratorStorage::~DiskIteratorStorage()
 
 void DiskIteratorStorage::destroy()
 {
+  unmap_block_();
+  fallback_block_id_ = LOG_INVALID_BLOCK_ID;
+  enable_mmap_read_ = false;
+  is_last_read_from_mmap_ = false;
   free_read_buf(read_buf_);
   IteratorStorage::destroy();
 }
@@ -229,6 +257,117 @@ int DiskIteratorStorage::read_data_from_storage_(
     const int64_t in_read_size,
     char *&buf,
     int64_t &out_read_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_SUCC(read_data_from_mmap_(pos, in_read_size, buf, out_read_size))) {
+    is_last_read_from_mmap_ = true;
+  } else if (OB_ERR_OUT_OF_LOWER_BOUND == ret) {
+    PALF_LOG(WARN, "block has been recycled", K(ret), K(pos), K(in_read_size), KPC(this));
+  } else {
+    // NB: 'read_buf_'中的数据在上一次mmap读之后已经失效, 不能复用
+    if (true == is_last_read_from_mmap_) {
+      end_lsn_ = start_lsn_ + pos;
+      is_last_read_from_mmap_ = false;
+    }
+    // 不再持有之前block的映射, 避免block回收后仍被映射
+    unmap_block_();
+    ret = read_data_from_disk_(pos, in_read_size, buf, out_read_size);
+  }
+  return ret;
+}
+
+int DiskIteratorStorage::check_read_data_valid()
+{
+  int ret = OB_SUCCESS;
+  if (false == is_last_read_from_mmap_) {
+  } else if (true == log_storage_->check_read_out_of_lower_bound(mmap_block_id_)) {
+    ret = OB_ERR_OUT_OF_LOWER_BOUND;
+    PALF_LOG(WARN, "mmap block has been recycled, the data read is invalid", K(ret), KPC(this));
+    // 映射中的数据已被清零或复用, 丢弃已读出的数据
+    unmap_block_();
+    end_lsn_ = start_lsn_;
+    is_last_read_from_mmap_ = false;
+  }
+  return ret;
+}
+
+int DiskIteratorStorage::fallback_to_disk_read()
+{
+  int ret = OB_SUCCESS;
+  if (false == is_last_read_from_mmap_) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (OB_FAIL(check_read_data_valid())) {
+    PALF_LOG(WARN, "check_read_data_valid failed", K(ret), KPC(this));
+  } else {
+    // NB: block可能正在被回收(已清零但还未推进下界), 也可能数据确实损坏, 均由pread判断
+    fallback_block_id_ = mmap_block_id_;
+    unmap_block_();
+    end_lsn_ = start_lsn_;
+    is_last_read_from_mmap_ = false;
+    PALF_LOG(WARN, "parse mmap data failed, fallback to read from disk", K(ret), KPC(this));
+  }
+  return ret;
+}
+
+int DiskIteratorStorage::read_data_from_mmap_(
+    const int64_t pos,
+    const int64_t in_read_size,
+    char *&buf,
+    int64_t &out_read_size)
+{
+  int ret = OB_SUCCESS;
+  const LSN read_lsn = start_lsn_ + pos;
+  const block_id_t block_id = lsn_2_block(read_lsn, block_size_);
+  const LSN block_end_lsn((block_id + 1) * block_size_);
+  if (false == enable_mmap_read_) {
+    ret = OB_NOT_SUPPORTED;
+  // 只有整个block都在迭代上界之内时才能mmap, 否则该block可能仍在写入或被truncate
+  } else if (block_end_lsn > get_file_end_lsn_()) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (block_id == fallback_block_id_) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (block_id != mmap_block_id_) {
+    unmap_block_();
+    if (OB_FAIL(log_storage_->mmap_block(block_id, mmap_addr_, mmap_len_))) {
+      PALF_LOG(WARN, "ILogStorage mmap_block failed", K(ret), K(block_id), K(read_lsn), KPC(this));
+      mmap_addr_ = NULL;
+      mmap_len_ = 0;
+    } else {
+      mmap_block_id_ = block_id;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    const int64_t offset = lsn_2_offset(read_lsn, block_size_) + MAX_INFO_BLOCK_SIZE;
+    if (OB_UNLIKELY(offset >= mmap_len_)) {
+      ret = OB_ERR_UNEXPECTED;
+      PALF_LOG(ERROR, "read offset exceeds mmap len", K(ret), K(offset), K(read_lsn), KPC(this));
+    } else {
+      buf = mmap_addr_ + offset;
+      out_read_size = MIN(in_read_size, block_end_lsn - read_lsn);
+      PALF_LOG(TRACE, "read_data_from_mmap_ success", K(ret), K(pos), K(in_read_size),
+          K(read_lsn), K(out_read_size), KPC(this));
+    }
+  }
+  return ret;
+}
+
+void DiskIteratorStorage::unmap_block_()
+{
+  int tmp_ret = OB_SUCCESS;
+  if (NULL != mmap_addr_ && NULL != log_storage_
+      && OB_SUCCESS != (tmp_ret = log_storage_->munmap_block(mmap_addr_, mmap_len_))) {
+    PALF_LOG(WARN, "ILogStorage munmap_block failed", K(tmp_ret), KP(mmap_addr_), K(mmap_len_));
+  }
+  mmap_addr_ = NULL;
+  mmap_len_ = 0;
+  mmap_block_id_ = LOG_INVALID_BLOCK_ID;
+}
+
+int DiskIteratorStorage::read_data_from_disk_(
+    int64_t &pos,
+    const int64_t in_read_size,
+    char *&buf,
+    int64_t &out_read_size)
 {
   int ret = OB_SUCCESS;
   int64_t remain_valid_data_size = 0;
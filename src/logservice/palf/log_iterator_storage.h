@@ -44,6 +44,19 @@ public:
             const int64_t in_read_size,
             char *&buf,
             int64_t &out_read_size);
+  // 校验上一次读出的数据仍然有效, 只有mmap读的数据需要校验
+  //
+  // @retval
+  //   OB_SUCCESS
+  //   OB_ERR_OUT_OF_LOWER_BOUND, 数据所在的block已被回收
+  virtual int check_read_data_valid() { return OB_SUCCESS; }
+  // 上一次mmap读出的数据解析失败时, 放弃mmap读, 调用方reuse后从磁盘重新读取
+  //
+  // @retval
+  //   OB_SUCCESS
+  //   OB_NOT_SUPPORTED, 上一次不是mmap读
+  //   OB_ERR_OUT_OF_LOWER_BOUND, 数据所在的block已被回收
+  virtual int fallback_to_disk_read() { return OB_NOT_SUPPORTED; }
   VIRTUAL_TO_STRING_KV(K_(start_lsn), K_(end_lsn), K_(read_buf), K_(block_size), KP(log_storage_), K_(read_buf_has_log_block_header));
 protected:
   inline int64_t get_valid_data_len_()
@@ -74,6 +87,10 @@ public:
   void destroy();
   int append(const char *buf, const int64_t buf_len);
   int pread(const LSN& lsn, const int64_t in_read_size, ReadBuf &read_buf, int64_t &out_read_size) final;
+  int mmap_block(const int64_t block_id, char *&addr, int64_t &len) final;
+  int munmap_block(char *addr, const int64_t len) final;
+  bool check_read_out_of_lower_bound(const int64_t block_id) const final
+  { UNUSED(block_id); return false; }
   TO_STRING_KV(K_(start_lsn), K_(log_tail), K_(buf), K_(buf_len), K_(is_inited));
 private:
   const char *buf_;
@@ -98,13 +115,27 @@ public:
 
 class DiskIteratorStorage : public IteratorStorage {
 public:
+  DiskIteratorStorage();
   ~DiskIteratorStorage();
   void destroy();
+  // 已写满的block直接通过只读mmap访问, 避免拷贝到read_buf_,
+  // 调用方需保证迭代上界不超过committed_end_lsn
+  void enable_mmap_read() { enable_mmap_read_ = true; }
+  // NB: 回收block时会原地清零并复用, 映射中的数据随之改变, 因此每次解析出entry后
+  // 都需要校验block未被回收, 解析失败时退回pread
+  int check_read_data_valid() final;
+  int fallback_to_disk_read() final;
   INHERIT_TO_STRING_KV(
       "IteratorStorage",
       IteratorStorage,
       "IteratorStorageType:",
-      "DiskIteratorStorage");
+      "DiskIteratorStorage",
+      KP(mmap_addr_),
+      K_(mmap_len),
+      K_(mmap_block_id),
+      K_(fallback_block_id),
+      K_(enable_mmap_read),
+      K_(is_last_read_from_mmap));
 
 private:
   int read_data_from_storage_(
@@ -112,9 +143,33 @@ private:
       const int64_t in_read_size,
       char *&buf,
       int64_t &out_read_size) final;
+  int read_data_from_disk_(
+      int64_t &pos,
+      const int64_t in_read_size,
+      char *&buf,
+      int64_t &out_read_size);
+  // @retval
+  //   OB_SUCCESS
+  //   OB_NOT_SUPPORTED, block has not been sealed or mmap is disabled, need read from disk.
+  //   OB_ERR_OUT_OF_LOWER_BOUND
+  //   other errors, need read from disk.
+  int read_data_from_mmap_(
+      const int64_t pos,
+      const int64_t in_read_size,
+      char *&buf,
+      int64_t &out_read_size);
+  void unmap_block_();
 
   int ensure_memory_layout_correct_(const int64_t pos, const int64_t in_read_size, int64_t &remain_valid_data_size);
   void do_memove_(ReadBuf &dst, const int64_t pos, int64_t &valid_tail_part_size);
+private:
+  char *mmap_addr_;
+  int64_t mmap_len_;
+  block_id_t mmap_block_id_;
+  // mmap读出的数据解析失败的block, 从磁盘读取
+  block_id_t fallback_block_id_;
+  bool enable_mmap_read_;
+  bool is_last_read_from_mmap_;
 };
 
 } // end namespace palf
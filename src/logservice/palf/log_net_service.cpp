@@ -21,6 +21,7 @@
 #include "log_rpc.h"                                   // ObLgRpc
 #include "log_meta_info.h"                             // LogPrepareMeta
 #include "log_writer_utils.h"                          // LogWriteBuf
+#include "lib/compress/ob_compressor_pool.h"           // ObCompressorPool
 
 namespace oceanbase
 {
@@ -89,7 +90,94 @@ int LogNetService::submit_push_log_req(
                             prev_lsn,
                             curr_lsn,
                             write_buf);
-    ret = post_request_to_server_(server, push_log_req);
+    LogPushReq compressed_req;
+    char *compress_buf = NULL;
+    if (log_rpc_->is_compress_supported(server)) {
+      (void) compress_push_log_req_(push_log_req, compressed_req, compress_buf);
+    }
+    ret = post_push_log_req_to_server_(server, push_log_req, compressed_req);
+    free_compress_buf_(compress_buf);
+  }
+  return ret;
+}
+
+int LogNetService::compress_push_log_req_(const LogPushReq &req,
+                                          LogPushReq &compressed_req,
+                                          char *&compress_buf)
+{
+  int ret = OB_SUCCESS;
+  const ObCompressorType compressor_type = log_rpc_->get_transport_compressor_type();
+  const int64_t orig_size = req.write_buf_.get_total_size();
+  ObCompressor *compressor = NULL;
+  int64_t max_overflow_size = 0;
+  compress_buf = NULL;
+  if (NONE_COMPRESSOR == compressor_type || MIN_COMPRESS_LOG_SIZE > orig_size) {
+    // compression is disabled or logs are too small
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compressor_type, compressor))) {
+    PALF_LOG(WARN, "get_compressor failed", K(ret), K_(palf_id), K(compressor_type));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(orig_size, max_overflow_size))) {
+    PALF_LOG(WARN, "get_max_overflow_size failed", K(ret), K_(palf_id), K(orig_size));
+  } else {
+    // NB: if logs are not continous, copy them to the tail of compress_buf firstly
+    const bool is_continous = req.write_buf_.check_memory_is_continous();
+    const int64_t dst_size = orig_size + max_overflow_size;
+    const int64_t buf_size = is_continous ? dst_size : dst_size + orig_size;
+    const char *src = NULL;
+    int64_t compressed_size = 0;
+    if (NULL == (compress_buf = static_cast<char *>(mtl_malloc(buf_size, "LogCompress")))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      PALF_LOG(WARN, "allocate memory failed", K(ret), K_(palf_id), K(buf_size));
+    } else if (is_continous) {
+      src = req.write_buf_.write_buf_[0].buf_;
+    } else {
+      req.write_buf_.memcpy_to_continous_memory(compress_buf + dst_size);
+      src = compress_buf + dst_size;
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(compressor->compress(src, orig_size, compress_buf, dst_size, compressed_size))) {
+      PALF_LOG(WARN, "compress failed", K(ret), K_(palf_id), K(orig_size), K(compressor_type));
+    } else if (compressed_size >= orig_size) {
+      // compression is useless, send raw logs
+      PALF_LOG(TRACE, "compressed size is larger than raw logs", K_(palf_id), K(orig_size),
+          K(compressed_size), K(compressor_type));
+    } else if (OB_FAIL(compressed_req.write_buf_.push_back(compress_buf, compressed_size))) {
+      PALF_LOG(WARN, "push_back compress_buf failed", K(ret), K_(palf_id), K(compressed_size));
+    } else {
+      compressed_req.push_log_type_ = req.push_log_type_;
+      compressed_req.msg_proposal_id_ = req.msg_proposal_id_;
+      compressed_req.prev_log_proposal_id_ = req.prev_log_proposal_id_;
+      compressed_req.prev_lsn_ = req.prev_lsn_;
+      compressed_req.curr_lsn_ = req.curr_lsn_;
+      compressed_req.compressor_type_ = compressor_type;
+      compressed_req.orig_data_len_ = orig_size;
+    }
+  }
+  if (!compressed_req.is_compressed()) {
+    compressed_req.reset();
+    free_compress_buf_(compress_buf);
+  }
+  return ret;
+}
+
+void LogNetService::free_compress_buf_(char *&compress_buf)
+{
+  if (NULL != compress_buf) {
+    mtl_free(compress_buf);
+    compress_buf = NULL;
+  }
+}
+
+int LogNetService::post_push_log_req_to_server_(const common::ObAddr &server,
+                                                const LogPushReq &req,
+                                                const LogPushReq &compressed_req)
+{
+  int ret = OB_SUCCESS;
+  if (compressed_req.is_compressed() && log_rpc_->is_compress_supported(server)) {
+    ret = post_request_to_server_(server, compressed_req);
+    log_rpc_->record_transport_stat(server, compressed_req.orig_data_len_,
+        compressed_req.write_buf_.get_total_size());
+  } else {
+    ret = post_request_to_server_(server, req);
   }
   return ret;
 }
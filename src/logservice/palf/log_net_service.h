@@ -68,7 +68,12 @@ public:
                               prev_lsn,
                               curr_lsn,
                               write_buf);
-      ret = post_request_to_member_list_(member_list, push_log_req);
+      // compress logs only once for all members
+      LogPushReq compressed_req;
+      char *compress_buf = NULL;
+      (void) compress_push_log_req_(push_log_req, compressed_req, compress_buf);
+      ret = post_push_log_req_to_member_list_(member_list, push_log_req, compressed_req);
+      free_compress_buf_(compress_buf);
     }
     return ret;
   }
@@ -225,6 +230,23 @@ public:
                                    const int64_t timeout_us,
                                    const ReqType &req,
                                    RespType &resp);
+private:
+  // logs smaller than it are not worth compressing
+  static const int64_t MIN_COMPRESS_LOG_SIZE = 4 * 1024;
+  // compress logs of req into compressed_req, compressed_req keeps invalid when
+  // compression is disabled or useless, compress_buf should be freed by caller.
+  int compress_push_log_req_(const LogPushReq &req,
+                             LogPushReq &compressed_req,
+                             char *&compress_buf);
+  void free_compress_buf_(char *&compress_buf);
+  // send compressed_req to server only when it supports compression
+  int post_push_log_req_to_server_(const common::ObAddr &server,
+                                   const LogPushReq &req,
+                                   const LogPushReq &compressed_req);
+  template <class List>
+  int post_push_log_req_to_member_list_(const List &member_list,
+                                        const LogPushReq &req,
+                                        const LogPushReq &compressed_req);
 private:
   int64_t palf_id_;
   LogRpc *log_rpc_;
@@ -271,6 +293,32 @@ int LogNetService::post_request_to_member_list_(
   return ret;
 }
 
+template <class List>
+int LogNetService::post_push_log_req_to_member_list_(
+    const List &member_list,
+    const LogPushReq &req,
+    const LogPushReq &compressed_req)
+{
+  int ret = common::OB_SUCCESS;
+  int64_t member_number = member_list.get_member_number();
+  common::ObAddr server;
+  if (!req.is_valid() || !member_list.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+  } else {
+    for (int64_t i = 0; i < member_number && OB_SUCC(ret); i++) {
+      if (OB_FAIL(member_list.get_server_by_index(i, server))) {
+        PALF_LOG(WARN, "ObMemberList get_server_by_index failed", K(ret),
+            K(server), K(palf_id_), K(req));
+      } else if (OB_FAIL(post_push_log_req_to_server_(server, req, compressed_req))) {
+        PALF_LOG(WARN, "post_push_log_req_to_server_ failed", K(ret),
+            K(server), K(palf_id_));
+      } else {
+      }
+    }
+  }
+  return ret;
+}
+
 template <class ReqType, class RespType>
 int LogNetService::post_sync_request_to_server_(const common::ObAddr &server,
                                                 const int64_t timeout_us,
@@ -11,6 +11,7 @@
  */
 
 #include "log_reader.h"
+#include <sys/mman.h>                     // mmap
 #include "lib/ob_define.h"                // some constexpr
 #include "lib/ob_errno.h"
 #include "share/ob_errno.h"               // ERRNO
@@ -102,6 +103,60 @@ int LogReader::pread(const block_id_t block_id,
   return ret;
 }
 
+int LogReader::mmap(const block_id_t block_id,
+                    char *&addr,
+                    int64_t &len) const
+{
+  int ret = OB_SUCCESS;
+  int read_io_fd = -1;
+  void *map_addr = MAP_FAILED;
+  char block_path[OB_MAX_FILE_NAME_LENGTH] = {'\0'};
+  addr = NULL;
+  len = 0;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(convert_to_normal_block(log_dir_, block_id, block_path, OB_MAX_FILE_NAME_LENGTH))) {
+    PALF_LOG(ERROR, "convert_to_normal_block failed", K(ret));
+  } else if (-1 == (read_io_fd = ::open(block_path, O_RDONLY))) {
+    ret = ENOENT == errno ? OB_NO_SUCH_FILE_OR_DIRECTORY : OB_IO_ERROR;
+    PALF_LOG(WARN, "LogReader open block failed", K(ret), K(errno), K(block_path), K(read_io_fd));
+  } else if (MAP_FAILED == (map_addr = ::mmap(NULL, block_size_, PROT_READ, MAP_SHARED, read_io_fd, 0))) {
+    ret = OB_IO_ERROR;
+    PALF_LOG(WARN, "LogReader mmap block failed", K(ret), K(errno), K(block_path), K(block_size_));
+  } else {
+    // 迭代器顺序读, 提示内核预读
+    (void) ::madvise(map_addr, block_size_, MADV_SEQUENTIAL);
+    addr = static_cast<char *>(map_addr);
+    len = block_size_;
+    PALF_LOG(TRACE, "LogReader mmap block success", K(ret), K(block_path), KP(addr), K(len));
+  }
+
+  // 映射建立后即可关闭fd, 不影响映射
+  if (-1 != read_io_fd && -1 == ::close(read_io_fd)) {
+    ret = OB_IO_ERROR;
+    PALF_LOG(ERROR, "close read_io_fd failed", K(ret), K(read_io_fd));
+  }
+  if (OB_FAIL(ret) && MAP_FAILED != map_addr) {
+    (void) ::munmap(map_addr, block_size_);
+    addr = NULL;
+    len = 0;
+  }
+  return ret;
+}
+
+int LogReader::munmap(char *addr, const int64_t len) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(addr) || 0 >= len) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(addr), K(len));
+  } else if (-1 == ::munmap(addr, len)) {
+    ret = OB_IO_ERROR;
+    PALF_LOG(ERROR, "LogReader munmap block failed", K(ret), K(errno), KP(addr), K(len));
+  }
+  return ret;
+}
+
 int LogReader::inner_pread_(const int read_io_fd,
                             offset_t start_offset,
                             int64_t in_read_size,
@@ -43,6 +43,19 @@ public:
             int64_t in_read_size,
             ReadBuf &read_buf,
             int64_t &out_read_size) const;
+  // 只读映射整个物理block, 调用方需保证block已经写满且不会被truncate
+  //
+  // @param [in], block_id      block id
+  // @param [out], addr         映射地址
+  // @param [out], len          映射长度, 即物理block大小
+  // @retval
+  //   OB_SUCCESS
+  //   OB_NO_SUCH_FILE_OR_DIRECTORY, block已被回收
+  //   OB_IO_ERROR
+  int mmap(const block_id_t block_id,
+           char *&addr,
+           int64_t &len) const;
+  int munmap(char *addr, const int64_t len) const;
 private:
   int limit_and_align_in_read_size_by_block_size_(
       offset_t aligned_start_offset,
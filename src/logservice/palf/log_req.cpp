@@ -31,7 +31,9 @@ LogPushReq::LogPushReq()
       prev_log_proposal_id_(INVALID_PROPOSAL_ID),
       prev_lsn_(),
       curr_lsn_(),
-      write_buf_()
+      write_buf_(),
+      compressor_type_(NONE_COMPRESSOR),
+      orig_data_len_(0)
 {
 }
 
@@ -46,7 +48,9 @@ LogPushReq::LogPushReq(const PushLogType push_log_type,
       prev_log_proposal_id_(prev_log_proposal_id),
       prev_lsn_(prev_lsn),
       curr_lsn_(curr_lsn),
-      write_buf_(write_buf)
+      write_buf_(write_buf),
+      compressor_type_(NONE_COMPRESSOR),
+      orig_data_len_(0)
 {
 }
 
@@ -71,6 +75,8 @@ void LogPushReq::reset()
   prev_lsn_.reset();
   curr_lsn_.reset();
   write_buf_.reset();
+  compressor_type_ = NONE_COMPRESSOR;
+  orig_data_len_ = 0;
 }
 
 OB_DEF_SERIALIZE(LogPushReq)
@@ -84,7 +90,9 @@ OB_DEF_SERIALIZE(LogPushReq)
              || OB_FAIL(serialization::encode_i64(buf, buf_len, new_pos, prev_log_proposal_id_))
              || OB_FAIL(prev_lsn_.serialize(buf, buf_len, new_pos))
              || OB_FAIL(curr_lsn_.serialize(buf, buf_len, new_pos))
-             || OB_FAIL(write_buf_.serialize(buf, buf_len, new_pos))) {
+             || OB_FAIL(write_buf_.serialize(buf, buf_len, new_pos))
+             || OB_FAIL(serialization::encode_i16(buf, buf_len, new_pos, compressor_type_))
+             || OB_FAIL(serialization::encode_i64(buf, buf_len, new_pos, orig_data_len_))) {
     PALF_LOG(ERROR, "LogPushReq serialize failed", K(ret), K(new_pos));
   } else {
     pos = new_pos;
@@ -105,6 +113,11 @@ OB_DEF_DESERIALIZE(LogPushReq)
              || OB_FAIL(curr_lsn_.deserialize(buf, data_len, new_pos))
              || OB_FAIL(write_buf_.deserialize(buf, data_len, new_pos))) {
     PALF_LOG(ERROR, "LogPushReq serialize failed", K(ret), K(new_pos));
+  } else if (new_pos < data_len
+             && (OB_FAIL(serialization::decode_i16(buf, data_len, new_pos, &compressor_type_))
+                 || OB_FAIL(serialization::decode_i64(buf, data_len, new_pos, &orig_data_len_)))) {
+    // the request sent by old version has no compression info
+    PALF_LOG(ERROR, "LogPushReq deserialize compression info failed", K(ret), K(new_pos));
   } else {
     pos = new_pos;
   }
@@ -120,6 +133,8 @@ OB_DEF_SERIALIZE_SIZE(LogPushReq)
   size += prev_lsn_.get_serialize_size();
   size += curr_lsn_.get_serialize_size();
   size += write_buf_.get_serialize_size();
+  size += serialization::encoded_length_i16(compressor_type_);
+  size += serialization::encoded_length_i64(orig_data_len_);
   return size;
 }
 // ================== LogPushReq end =========================
@@ -127,14 +142,16 @@ OB_DEF_SERIALIZE_SIZE(LogPushReq)
 // ================== LogPushResp start ======================
 LogPushResp::LogPushResp()
     : msg_proposal_id_(INVALID_PROPOSAL_ID),
-      lsn_()
+      lsn_(),
+      is_compress_supported_(false)
 {
 }
 
 LogPushResp::LogPushResp(const int64_t &msg_proposal_id,
                              const LSN &lsn)
     : msg_proposal_id_(msg_proposal_id),
-      lsn_(lsn)
+      lsn_(lsn),
+      is_compress_supported_(true)
 {
 }
 
@@ -153,9 +170,10 @@ void LogPushResp::reset()
 {
   msg_proposal_id_ = INVALID_PROPOSAL_ID;
   lsn_.reset();
+  is_compress_supported_ = false;
 }
 
-OB_SERIALIZE_MEMBER(LogPushResp, msg_proposal_id_, lsn_);
+OB_SERIALIZE_MEMBER(LogPushResp, msg_proposal_id_, lsn_, is_compress_supported_);
 // ================= LogPushResp end =======================
 
 // ================= LogFetchReq start =====================
@@ -165,7 +183,9 @@ LogFetchReq::LogFetchReq()
       prev_lsn_(),
       lsn_(),
       fetch_log_size_(0),
-      fetch_log_count_(0)
+      fetch_log_count_(0),
+      accepted_mode_pid_(INVALID_PROPOSAL_ID),
+      is_compress_supported_(false)
 {
 }
 
@@ -182,7 +202,8 @@ LogFetchReq::LogFetchReq(const FetchLogType fetch_type,
       lsn_(lsn),
       fetch_log_size_(fetch_log_size),
       fetch_log_count_(fetch_log_count),
-      accepted_mode_pid_(accepted_mode_pid)
+      accepted_mode_pid_(accepted_mode_pid),
+      is_compress_supported_(true)
 {
 }
 
@@ -206,10 +227,11 @@ void LogFetchReq::reset()
   fetch_log_size_ = 0;
   fetch_log_count_ = 0;
   accepted_mode_pid_ = INVALID_PROPOSAL_ID;
+  is_compress_supported_ = false;
 }
 
 OB_SERIALIZE_MEMBER(LogFetchReq, fetch_type_, msg_proposal_id_, prev_lsn_, lsn_, fetch_log_size_,
-    fetch_log_count_, accepted_mode_pid_);
+    fetch_log_count_, accepted_mode_pid_, is_compress_supported_);
 // ================= LogFetchReq end ======================
 
 NotifyRebuildReq::NotifyRebuildReq()
@@ -19,6 +19,7 @@
 #include "log_learner.h"                             // LogLearner, LogLearnerList
 #include "logservice/palf/lsn.h"                                     // LSN
 #include "log_writer_utils.h"                               // LogWriteBuf
+#include "lib/compress/ob_compress_util.h"                  // ObCompressorType
 
 namespace oceanbase
 {
@@ -45,8 +46,9 @@ public:
   ~LogPushReq();
   bool is_valid() const;
   void reset();
+  bool is_compressed() const { return common::NONE_COMPRESSOR != compressor_type_; }
   TO_STRING_KV(K_(push_log_type), K_(msg_proposal_id), K_(prev_log_proposal_id),
-               K_(prev_lsn), K_(curr_lsn), K_(write_buf));
+               K_(prev_lsn), K_(curr_lsn), K_(write_buf), K_(compressor_type), K_(orig_data_len));
   int16_t push_log_type_;
   int64_t msg_proposal_id_;
   int64_t prev_log_proposal_id_;
@@ -55,6 +57,12 @@ public:
   // to LogGroupEntry.
   LSN curr_lsn_;
   LogWriteBuf write_buf_;
+  // NB: the logs in write_buf_ are compressed during transport when compressor_type_ is not
+  // NONE_COMPRESSOR, and orig_data_len_ is the length of logs before compression. They are
+  // serialized after write_buf_, so the receiver of old version will ignore them, the sender
+  // only compresses logs for the receivers which have declared that they support it.
+  int16_t compressor_type_;
+  int64_t orig_data_len_;
 };
 
 struct LogPushResp {
@@ -66,9 +74,11 @@ public:
   ~LogPushResp();
   bool is_valid() const;
   void reset();
-  TO_STRING_KV(K_(msg_proposal_id), K_(lsn));
+  TO_STRING_KV(K_(msg_proposal_id), K_(lsn), K_(is_compress_supported));
   int64_t msg_proposal_id_;
   LSN lsn_;
+  // whether the sender can receive compressed logs
+  bool is_compress_supported_;
 };
 
 enum FetchLogType
@@ -95,7 +105,7 @@ public:
   bool is_valid() const;
   void reset();
   TO_STRING_KV(K_(msg_proposal_id), K_(fetch_type), K_(prev_lsn), K_(lsn), K_(fetch_log_size),
-      K_(fetch_log_count), K_(accepted_mode_pid));
+      K_(fetch_log_count), K_(accepted_mode_pid), K_(is_compress_supported));
   int16_t fetch_type_;
   int64_t msg_proposal_id_;
   LSN prev_lsn_;
@@ -103,6 +113,8 @@ public:
   int64_t fetch_log_size_;
   int64_t fetch_log_count_;
   int64_t accepted_mode_pid_;
+  // whether the sender can receive compressed logs
+  bool is_compress_supported_;
 };
 
 struct NotifyRebuildReq {
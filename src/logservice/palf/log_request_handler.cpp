@@ -13,6 +13,7 @@
 #include "log_request_handler.h"
 #include "log_req.h"
 #include "share/ob_occam_time_guard.h"
+#include "lib/compress/ob_compressor_pool.h"        // ObCompressorPool
 
 namespace oceanbase
 {
@@ -20,6 +21,7 @@ namespace palf
 {
 
 using namespace election;
+using namespace common;
 
 LogRequestHandler::LogRequestHandler(PalfEnvImpl *palf_env_impl) : palf_env_impl_(palf_env_impl)
 {
@@ -30,6 +32,42 @@ LogRequestHandler::~LogRequestHandler()
   palf_env_impl_ = NULL;
 }
 
+int LogRequestHandler::decompress_log_if_needed_(const LogPushReq &req,
+                                                 const char *&buf,
+                                                 int64_t &buf_len,
+                                                 char *&decompress_buf)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = NULL;
+  int64_t decompressed_len = 0;
+  decompress_buf = NULL;
+  if (false == req.is_compressed()) {
+  } else if (0 >= req.orig_data_len_) {
+    ret = OB_INVALID_DATA;
+    PALF_LOG(ERROR, "invalid orig_data_len", K(ret), K(req));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(
+      static_cast<ObCompressorType>(req.compressor_type_), compressor))) {
+    PALF_LOG(WARN, "get_compressor failed", K(ret), K(req));
+  } else if (NULL == (decompress_buf = static_cast<char *>(mtl_malloc(req.orig_data_len_, "LogDecompress")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    PALF_LOG(WARN, "allocate memory failed", K(ret), K(req));
+  } else if (OB_FAIL(compressor->decompress(buf, buf_len, decompress_buf, req.orig_data_len_,
+      decompressed_len))) {
+    PALF_LOG(WARN, "decompress failed", K(ret), K(req));
+  } else if (decompressed_len != req.orig_data_len_) {
+    ret = OB_INVALID_DATA;
+    PALF_LOG(ERROR, "decompressed length not match", K(ret), K(decompressed_len), K(req));
+  } else {
+    buf = decompress_buf;
+    buf_len = decompressed_len;
+  }
+  if (OB_FAIL(ret) && NULL != decompress_buf) {
+    mtl_free(decompress_buf);
+    decompress_buf = NULL;
+  }
+  return ret;
+}
+
 template <>
 int LogRequestHandler::handle_request<LogPushReq>(
     const int64_t palf_id,
@@ -43,8 +81,11 @@ int LogRequestHandler::handle_request<LogPushReq>(
   } else {
     PalfHandleImplGuard guard;
     const char *buf = req.write_buf_.write_buf_[0].buf_;
-    const int64_t buf_len = req.write_buf_.write_buf_[0].buf_len_;
-    if (OB_FAIL(palf_env_impl_->get_palf_handle_impl(palf_id, guard))) {
+    int64_t buf_len = req.write_buf_.write_buf_[0].buf_len_;
+    char *decompress_buf = NULL;
+    if (OB_FAIL(decompress_log_if_needed_(req, buf, buf_len, decompress_buf))) {
+      PALF_LOG(WARN, "decompress_log_if_needed_ failed", K(ret), K(palf_id), K(server), K(req));
+    } else if (OB_FAIL(palf_env_impl_->get_palf_handle_impl(palf_id, guard))) {
       PALF_LOG(WARN, "PalfEnvImpl get_palf_handle_impl failed", K(ret), K(palf_id));
     } else if (OB_FAIL(guard.get_palf_handle_impl()->receive_log(server,
                                                                  (PushLogType) req.push_log_type_,
@@ -59,6 +100,11 @@ int LogRequestHandler::handle_request<LogPushReq>(
       PALF_LOG(TRACE, "PalfHandleImpl receive_log success", K(ret), K(palf_id),
           K(server), K(req), KPC(palf_env_impl_));
     }
+    // receive_log has copied logs into group buffer
+    if (NULL != decompress_buf) {
+      mtl_free(decompress_buf);
+      decompress_buf = NULL;
+    }
   }
   return ret;
 }
@@ -75,6 +121,9 @@ int LogRequestHandler::handle_request<LogPushResp>(
     PALF_LOG(ERROR, "Invalid argument!!!", K(ret), K(palf_id), K(req), KPC(palf_env_impl_));
   } else {
     PalfHandleImplGuard guard;
+    if (req.is_compress_supported_) {
+      palf_env_impl_->get_log_rpc()->set_compress_supported(server);
+    }
     if (OB_FAIL(palf_env_impl_->get_palf_handle_impl(palf_id, guard))) {
       PALF_LOG(WARN, "PalfEnvImpl get_palf_handle_impl failed", K(ret), K(palf_id));
     } else if (OB_FAIL(guard.get_palf_handle_impl()->ack_log(server, req.msg_proposal_id_,
@@ -151,6 +200,9 @@ int LogRequestHandler::handle_request<LogFetchReq>(
     PALF_LOG(ERROR, "Invalid argument!!!", K(ret), K(palf_id), K(req), KPC(palf_env_impl_));
   } else {
     PalfHandleImplGuard guard;
+    if (req.is_compress_supported_) {
+      palf_env_impl_->get_log_rpc()->set_compress_supported(server);
+    }
     if (OB_FAIL(palf_env_impl_->get_palf_handle_impl(palf_id, guard))) {
       PALF_LOG(WARN, "PalfEnvImpl get_palf_handle_impl failed", K(ret), K(palf_id));
     } else if (OB_FAIL(guard.get_palf_handle_impl()->get_log(server, (FetchLogType) req.fetch_type_, req.msg_proposal_id_,
@@ -36,6 +36,13 @@ public:
                           const common::ObAddr &server,
                           const ReqType &req,
                           RespType &resp);
+private:
+  // decompress logs of req into decompress_buf, and make buf point to it,
+  // decompress_buf should be freed by caller.
+  int decompress_log_if_needed_(const LogPushReq &req,
+                                const char *&buf,
+                                int64_t &buf_len,
+                                char *&decompress_buf);
 private:
   PalfEnvImpl *palf_env_impl_;
 };
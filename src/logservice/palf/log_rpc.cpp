@@ -15,6 +15,8 @@
 #include "log_rpc_proxy.h"                         // LogRpcProxyV2
 #include "log_rpc_packet.h"                        // LogRpcPaket
 #include "log_req.h"                               // LogPushReq...
+#include "lib/compress/ob_compressor_pool.h"        // ObCompressorPool
+#include "share/config/ob_server_config.h"         // GCONF
 
 namespace oceanbase
 {
@@ -23,6 +25,12 @@ using namespace obrpc;
 namespace palf
 {
 LogRpc::LogRpc() : rpc_proxy_(NULL),
+                   peer_lock_(),
+                   peer_stats_(),
+                   transport_compressor_type_(NONE_COMPRESSOR),
+                   last_refresh_config_ts_(OB_INVALID_TIMESTAMP),
+                   last_print_stat_ts_(OB_INVALID_TIMESTAMP),
+                   last_purge_peer_ts_(OB_INVALID_TIMESTAMP),
                    is_inited_(false)
 {
 }
@@ -51,8 +59,166 @@ void LogRpc::destroy()
   if (IS_INIT) {
     is_inited_ = false;
     rpc_proxy_.destroy();
+    SpinWLockGuard guard(peer_lock_);
+    peer_stats_.reset();
+    transport_compressor_type_ = NONE_COMPRESSOR;
+    last_refresh_config_ts_ = OB_INVALID_TIMESTAMP;
+    last_purge_peer_ts_ = OB_INVALID_TIMESTAMP;
     PALF_LOG(INFO, "LogRpc destroy success");
   }
 }
+
+ObCompressorType LogRpc::get_transport_compressor_type()
+{
+  refresh_transport_config_();
+  return ATOMIC_LOAD(&transport_compressor_type_);
+}
+
+void LogRpc::refresh_transport_config_()
+{
+  const int64_t last_refresh_ts = ATOMIC_LOAD(&last_refresh_config_ts_);
+  const int64_t now = ObTimeUtility::current_time();
+  if (OB_UNLIKELY(now - last_refresh_ts > REFRESH_CONFIG_INTERVAL)
+      && ATOMIC_BCAS(&last_refresh_config_ts_, last_refresh_ts, now)) {
+    int ret = OB_SUCCESS;
+    ObCompressorType compressor_type = NONE_COMPRESSOR;
+    if (GCONF._enable_log_transport_compress
+        && OB_FAIL(ObCompressorPool::get_instance().get_compressor_type(
+            GCONF._log_transport_compress_func, compressor_type))) {
+      PALF_LOG(WARN, "get_compressor_type failed", K(ret));
+      compressor_type = NONE_COMPRESSOR;
+    }
+    // NB: logs are compressed per LogPushReq, the stream compressors keep context
+    // between messages of one connection which isn't supported by rpc layer, so they
+    // are replaced by the block compressors with the same algorithm.
+    switch (compressor_type) {
+      case STREAM_LZ4_COMPRESSOR:
+        compressor_type = LZ4_COMPRESSOR;
+        break;
+      case STREAM_ZSTD_COMPRESSOR:
+        compressor_type = ZSTD_COMPRESSOR;
+        break;
+      case STREAM_ZSTD_1_3_8_COMPRESSOR:
+        compressor_type = ZSTD_1_3_8_COMPRESSOR;
+        break;
+      default:
+        break;
+    }
+    if (compressor_type != ATOMIC_LOAD(&transport_compressor_type_)) {
+      PALF_LOG(INFO, "transport compressor changed", K(ret), "old_type",
+          ATOMIC_LOAD(&transport_compressor_type_), "new_type", compressor_type);
+      ATOMIC_STORE(&transport_compressor_type_, compressor_type);
+    }
+  }
+}
+
+int64_t LogRpc::get_peer_idx_(const ObAddr &server) const
+{
+  int64_t idx = -1;
+  for (int64_t i = 0; -1 == idx && i < peer_stats_.count(); i++) {
+    if (peer_stats_[i].server_ == server) {
+      idx = i;
+    }
+  }
+  return idx;
+}
+
+bool LogRpc::is_compress_supported(const ObAddr &server) const
+{
+  SpinRLockGuard guard(peer_lock_);
+  return -1 != get_peer_idx_(server);
+}
+
+void LogRpc::set_compress_supported(const ObAddr &server)
+{
+  int ret = OB_SUCCESS;
+  const int64_t now = ObTimeUtility::current_time();
+  bool found = false;
+  {
+    SpinRLockGuard guard(peer_lock_);
+    const int64_t idx = get_peer_idx_(server);
+    if (-1 != idx) {
+      found = true;
+      TransportPeerStat &peer_stat = peer_stats_[idx];
+      if (now - ATOMIC_LOAD(&peer_stat.last_active_ts_) > UPDATE_ACTIVE_TS_INTERVAL) {
+        ATOMIC_STORE(&peer_stat.last_active_ts_, now);
+      }
+    }
+  }
+  if (false == found) {
+    SpinWLockGuard guard(peer_lock_);
+    TransportPeerStat peer_stat;
+    peer_stat.server_ = server;
+    peer_stat.last_active_ts_ = now;
+    if (-1 != get_peer_idx_(server)) {
+      // other thread has added it
+    } else if (MAX_PEER_COUNT <= peer_stats_.count()) {
+      // replace the least recently active server
+      int64_t oldest_idx = 0;
+      for (int64_t i = 1; i < peer_stats_.count(); i++) {
+        if (peer_stats_[i].last_active_ts_ < peer_stats_[oldest_idx].last_active_ts_) {
+          oldest_idx = i;
+        }
+      }
+      PALF_LOG(INFO, "too many servers support compressed log transport, replace the oldest one",
+          K(server), "oldest_peer", peer_stats_[oldest_idx]);
+      peer_stats_[oldest_idx] = peer_stat;
+    } else if (OB_FAIL(peer_stats_.push_back(peer_stat))) {
+      PALF_LOG(WARN, "push_back peer_stat failed", K(ret), K(server));
+    } else {
+      PALF_LOG(INFO, "server supports compressed log transport", K(ret), K(server));
+    }
+  }
+  purge_expired_peers_();
+}
+
+void LogRpc::purge_expired_peers_()
+{
+  if (palf_reach_time_interval(PEER_EXPIRE_INTERVAL, last_purge_peer_ts_)) {
+    const int64_t now = ObTimeUtility::current_time();
+    SpinWLockGuard guard(peer_lock_);
+    for (int64_t i = peer_stats_.count() - 1; i >= 0; i--) {
+      if (now - peer_stats_[i].last_active_ts_ > PEER_EXPIRE_INTERVAL) {
+        PALF_LOG(INFO, "server has not declared compressed log transport for a long time, forget it",
+            "peer_stat", peer_stats_[i]);
+        (void)peer_stats_.remove(i);
+      }
+    }
+  }
+}
+
+void LogRpc::record_transport_stat(const ObAddr &server,
+                                   const int64_t orig_size,
+                                   const int64_t sent_size)
+{
+  {
+    SpinRLockGuard guard(peer_lock_);
+    const int64_t idx = get_peer_idx_(server);
+    if (-1 != idx) {
+      TransportPeerStat &peer_stat = peer_stats_[idx];
+      ATOMIC_INC(&peer_stat.compressed_cnt_);
+      ATOMIC_AAF(&peer_stat.orig_size_, orig_size);
+      ATOMIC_AAF(&peer_stat.sent_size_, sent_size);
+    }
+  }
+  print_transport_stat_();
+}
+
+void LogRpc::print_transport_stat_()
+{
+  if (palf_reach_time_interval(PRINT_STAT_INTERVAL, last_print_stat_ts_)) {
+    SpinRLockGuard guard(peer_lock_);
+    for (int64_t i = 0; i < peer_stats_.count(); i++) {
+      TransportPeerStat &peer_stat = peer_stats_[i];
+      const int64_t compressed_cnt = ATOMIC_TAS(&peer_stat.compressed_cnt_, 0);
+      const int64_t orig_size = ATOMIC_TAS(&peer_stat.orig_size_, 0);
+      const int64_t sent_size = ATOMIC_TAS(&peer_stat.sent_size_, 0);
+      const double compress_ratio = (0 == orig_size) ? 1.0 : (double)sent_size / orig_size;
+      PALF_LOG(INFO, "[PALF STAT TRANSPORT COMPRESS]", "server", peer_stat.server_,
+          K(compressed_cnt), K(orig_size), K(sent_size), K(compress_ratio),
+          "compressor_type", ATOMIC_LOAD(&transport_compressor_type_));
+    }
+  }
+}
 } // end namespace palf
 } // end namespace oceanbase
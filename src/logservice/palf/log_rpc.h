@@ -16,6 +16,9 @@
 #include "lib/ob_errno.h"
 #include "lib/utility/ob_macro_utils.h"            // IS_NOT_INIT
 #include "lib/net/ob_addr.h"                       // ObAddr
+#include "lib/lock/ob_spin_rwlock.h"               // SpinRWLock
+#include "lib/container/ob_se_array.h"             // ObSEArray
+#include "lib/compress/ob_compress_util.h"         // ObCompressorType
 #include "rpc/obrpc/ob_rpc_packet.h"               // ObRpcPacketCode
 #include "share/rc/ob_tenant_base.h"               // MTL_ID
 #include "log_rpc_macros.h"                        // MACROS...
@@ -115,10 +118,54 @@ public:
     return ret;
   }
 
-  TO_STRING_KV(K_(self), K_(is_inited));
+  // Compression of logs transported between replicas.
+  //
+  // The receiver declares that it can decode compressed LogPushReq by LogPushResp
+  // and LogFetchReq, the sender only compresses logs for the servers which have
+  // declared it, so the replicas of old version always receive raw logs.
+  //
+  // @return the compressor used to compress LogPushReq, NONE_COMPRESSOR means
+  //         the compression is disabled.
+  common::ObCompressorType get_transport_compressor_type();
+  bool is_compress_supported(const common::ObAddr &server) const;
+  void set_compress_supported(const common::ObAddr &server);
+  void record_transport_stat(const common::ObAddr &server,
+                             const int64_t orig_size,
+                             const int64_t sent_size);
+
+  TO_STRING_KV(K_(self), K_(is_inited), K_(transport_compressor_type));
+private:
+  struct TransportPeerStat {
+    TransportPeerStat() : server_(), compressed_cnt_(0), orig_size_(0), sent_size_(0),
+                          last_active_ts_(OB_INVALID_TIMESTAMP) {}
+    TO_STRING_KV(K_(server), K_(compressed_cnt), K_(orig_size), K_(sent_size), K_(last_active_ts));
+    common::ObAddr server_;
+    int64_t compressed_cnt_;
+    int64_t orig_size_;
+    int64_t sent_size_;
+    // the last time the server declared that it supports compression
+    int64_t last_active_ts_;
+  };
+  static const int64_t REFRESH_CONFIG_INTERVAL = 5 * 1000 * 1000;
+  static const int64_t PRINT_STAT_INTERVAL = 10 * 1000 * 1000;
+  static const int64_t UPDATE_ACTIVE_TS_INTERVAL = 1 * 1000 * 1000;
+  // a server which hasn't declared it for a long time, e.g. it has been removed
+  // from the member lists, is forgot and receives raw logs until it declares again.
+  static const int64_t PEER_EXPIRE_INTERVAL = 60 * 1000 * 1000;
+  static const int64_t MAX_PEER_COUNT = 256;
+  void refresh_transport_config_();
+  int64_t get_peer_idx_(const common::ObAddr &server) const;
+  void purge_expired_peers_();
+  void print_transport_stat_();
 private:
   ObAddr self_;
   obrpc::LogRpcProxyV2 rpc_proxy_;
+  mutable common::SpinRWLock peer_lock_;
+  common::ObSEArray<TransportPeerStat, 16> peer_stats_;
+  common::ObCompressorType transport_compressor_type_;
+  int64_t last_refresh_config_ts_;
+  int64_t last_print_stat_ts_;
+  int64_t last_purge_peer_ts_;
   bool is_inited_;
 };
 } // end namespace palf
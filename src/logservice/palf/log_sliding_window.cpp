@@ -91,6 +91,10 @@ LogSlidingWindow::LogSlidingWindow()
     accum_group_log_size_(0),
     last_record_group_log_id_(FIRST_VALID_LOG_ID - 1),
     freeze_mode_(FEEDBACK_FREEZE_MODE),
+    group_commit_ctrl_(),
+    last_check_freeze_mode_ts_(OB_INVALID_TIMESTAMP),
+    last_check_freeze_mode_end_lsn_(),
+    group_commit_stat_time_us_(OB_INVALID_TIMESTAMP),
     is_inited_(false)
 {}
 
@@ -176,6 +180,9 @@ int LogSlidingWindow::init(const int64_t palf_id,
     committed_end_lsn_ = palf_base_info.curr_lsn_;
 
     MEMSET(append_cnt_array_, 0, APPEND_CNT_ARRAY_SIZE * sizeof(int64_t));
+    group_commit_ctrl_.reset();
+    last_check_freeze_mode_ts_ = ObTimeUtility::current_time();
+    last_check_freeze_mode_end_lsn_ = palf_base_info.curr_lsn_;
 
     is_inited_ = true;
     LogGroupEntryHeader group_header;
@@ -393,10 +400,7 @@ int LogSlidingWindow::submit_log(const char *buf,
       OB_ASSERT(0 <= array_idx && array_idx < APPEND_CNT_ARRAY_SIZE);
       ATOMIC_INC(&append_cnt_array_[array_idx]);
 
-      LSN last_submit_end_lsn, max_flushed_end_lsn;
-      get_last_submit_end_lsn_(last_submit_end_lsn);
-      get_max_flushed_end_lsn(max_flushed_end_lsn);
-      if (max_flushed_end_lsn >= last_submit_end_lsn) {
+      if (is_all_submitted_log_flushed_()) {
         // all logs have been flushed, freeze last log in feedback mode
         (void) feedback_freeze_last_log_();
       }
@@ -867,6 +871,7 @@ int LogSlidingWindow::handle_next_submit_log_(bool &is_committed_lsn_updated)
             }
 
             log_task->set_submit_ts(ObTimeUtility::current_time());
+            group_commit_ctrl_.record_group_log(group_log_size, log_task->get_submit_ts() - log_task->get_gen_ts());
             if (OB_FAIL(ret)) {
             } else if (OB_FAIL(log_engine_->submit_flush_log_task(flush_log_cb_ctx, log_write_buf))) {
               PALF_LOG(WARN, "submit_flush_log_task failed", K(ret), K_(palf_id), K_(self));
@@ -1043,6 +1048,8 @@ int LogSlidingWindow::feedback_freeze_last_log_()
   if (FEEDBACK_FREEZE_MODE != freeze_mode_) {
     // Only FEEDBACK_FREEZE_MODE need exec this fucntion
     PALF_LOG(TRACE, "current freeze mode is not feedback", K_(palf_id), K_(self), K_(freeze_mode));
+  } else if (!is_group_commit_window_expired_(ObTimeUtility::current_time())) {
+    // wait for more logs, LogLoopThread will freeze it by period_freeze_last_log
   } else if (OB_FAIL(lsn_allocator_.try_freeze(last_log_end_lsn, last_log_id))) {
     PALF_LOG(WARN, "lsn_allocator try_freeze failed", K(ret), K_(palf_id), K_(self), K(last_log_end_lsn), K(last_log_id));
   } else if (last_log_id <= 0) {
@@ -1057,7 +1064,42 @@ int LogSlidingWindow::feedback_freeze_last_log_()
   return ret;
 }
 
-int LogSlidingWindow::check_and_switch_freeze_mode()
+bool LogSlidingWindow::is_all_submitted_log_flushed_() const
+{
+  LSN last_submit_end_lsn, max_flushed_end_lsn;
+  get_last_submit_end_lsn_(last_submit_end_lsn);
+  get_max_flushed_end_lsn(max_flushed_end_lsn);
+  return max_flushed_end_lsn >= last_submit_end_lsn;
+}
+
+bool LogSlidingWindow::is_group_commit_window_expired_(const int64_t now)
+{
+  bool bool_ret = true;
+  const int64_t freeze_wait_us = group_commit_ctrl_.get_freeze_wait_us();
+  const int64_t last_log_id = lsn_allocator_.get_max_log_id();
+  if (0 >= freeze_wait_us || 0 >= last_log_id) {
+    // group commit window is disabled or no log
+  } else {
+    LogTask *log_task = NULL;
+    LogTaskGuard guard(this);
+    if (OB_SUCCESS != guard.get_log_task(last_log_id, log_task)) {
+      // the log may slide out, freeze it as usual
+    } else if (log_task->is_freezed()) {
+      // the last log has been freezed
+    } else {
+      const int64_t gen_ts = log_task->get_gen_ts();
+      bool_ret = (0 >= gen_ts || now - gen_ts >= freeze_wait_us);
+    }
+  }
+  return bool_ret;
+}
+
+void LogSlidingWindow::get_group_commit_stat(LogGroupCommitStat &stat) const
+{
+  group_commit_ctrl_.get_stat(stat);
+}
+
+int LogSlidingWindow::check_and_switch_freeze_mode(const int64_t group_commit_latency_budget_us)
 {
   int ret = OB_SUCCESS;
   int64_t total_append_cnt = 0;
@@ -1065,6 +1107,19 @@ int LogSlidingWindow::check_and_switch_freeze_mode()
     total_append_cnt += ATOMIC_LOAD(&append_cnt_array_[i]);
     ATOMIC_STORE(&append_cnt_array_[i], 0);
   }
+  // update group commit window with the arrival rate of logs
+  const int64_t now = ObTimeUtility::current_time();
+  const LSN curr_end_lsn = get_max_lsn();
+  const int64_t interval_us = now - last_check_freeze_mode_ts_;
+  const int64_t append_bytes = (curr_end_lsn.is_valid() && last_check_freeze_mode_end_lsn_.is_valid()
+      && curr_end_lsn > last_check_freeze_mode_end_lsn_) ? (curr_end_lsn - last_check_freeze_mode_end_lsn_) : 0;
+  group_commit_ctrl_.update_freeze_wait_us(total_append_cnt, append_bytes, interval_us,
+      group_commit_latency_budget_us);
+  last_check_freeze_mode_ts_ = now;
+  last_check_freeze_mode_end_lsn_ = curr_end_lsn;
+  if (palf_reach_time_interval(10 * 1000 * 1000, group_commit_stat_time_us_)) {
+    PALF_LOG(INFO, "[PALF STAT GROUP COMMIT]", K_(palf_id), K_(self), K_(freeze_mode), K_(group_commit_ctrl));
+  }
   if (FEEDBACK_FREEZE_MODE == freeze_mode_) {
     if (total_append_cnt >= APPEND_CNT_LB_FOR_PERIOD_FREEZE) {
       freeze_mode_ = PERIOD_FREEZE_MODE;
@@ -1088,8 +1143,14 @@ int LogSlidingWindow::period_freeze_last_log()
   int64_t last_log_id = OB_INVALID_LOG_ID;
   bool is_need_handle = false;
   if (PERIOD_FREEZE_MODE != freeze_mode_) {
-    // Only PERIOD_FREEZE_MODE need exec this fucntion
+    // Only PERIOD_FREEZE_MODE need exec this fucntion, except that the last log is
+    // waiting in group commit window of FEEDBACK_FREEZE_MODE
+    if (0 < group_commit_ctrl_.get_freeze_wait_us() && is_all_submitted_log_flushed_()) {
+      (void) feedback_freeze_last_log_();
+    }
     PALF_LOG(TRACE, "current freeze mode is not period", K_(palf_id), K_(self), K_(freeze_mode));
+  } else if (!is_group_commit_window_expired_(ObTimeUtility::current_time())) {
+    // wait for more logs
   } else if (OB_FAIL(lsn_allocator_.try_freeze(last_log_end_lsn, last_log_id))) {
     PALF_LOG(WARN, "lsn_allocator try_freeze failed", K(ret), K_(palf_id), K_(self), K(last_log_end_lsn), K(last_log_id));
   } else if (last_log_id <= 0) {
@@ -1194,6 +1255,7 @@ int LogSlidingWindow::after_flush_log(const FlushLogCbCtx &flush_cb_ctx)
         can_exec_cb = true;
         // update log_task's flushed_ts
         log_task->set_flushed_ts(cb_begin_ts);
+        group_commit_ctrl_.record_flush_cost(cb_begin_ts - log_task->get_submit_ts());
       }
       log_task->unlock();
     }
@@ -1206,6 +1268,7 @@ int LogSlidingWindow::after_flush_log(const FlushLogCbCtx &flush_cb_ctx)
       PALF_LOG(WARN, "get_log_task failed", K(ret), K(log_id), K_(palf_id), K_(self));
     } else {
       log_task->set_flushed_ts(cb_begin_ts);
+      group_commit_ctrl_.record_flush_cost(cb_begin_ts - log_task->get_submit_ts());
     }
   }
 
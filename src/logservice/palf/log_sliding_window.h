@@ -20,6 +20,7 @@
 #include "log_group_entry.h"
 #include "log_group_buffer.h"
 #include "log_checksum.h"
+#include "log_group_commit_ctrl.h"
 #include "log_req.h"
 #include "lsn.h"
 #include "lsn_allocator.h"
@@ -191,8 +192,10 @@ public:
   virtual int get_last_submit_log_info(LSN &last_submit_lsn, int64_t &log_id, int64_t &log_proposal_id) const;
   virtual int get_last_slide_end_lsn(LSN &out_end_lsn) const;
   virtual int64_t get_last_slide_log_ts() const;
-  virtual int check_and_switch_freeze_mode();
+  // @param [in] group_commit_latency_budget_us, the latency budget used to adjust group commit window
+  virtual int check_and_switch_freeze_mode(const int64_t group_commit_latency_budget_us);
   virtual int period_freeze_last_log();
+  virtual void get_group_commit_stat(LogGroupCommitStat &stat) const;
   virtual int inc_update_log_ts_base(const int64_t log_ts);
   // location cache will be removed TODO by yunlong
   virtual int set_location_cache_cb(PalfLocationCacheCb *lc_cb);
@@ -202,6 +205,8 @@ public:
                                       const LSN &log_lsn,
                                       const LSN &log_end_lsn,
                                       const int64_t &log_proposal_id);
+  // the flushed logs in group buffer are served to readers as hot cache of LogStorage
+  const LogGroupBuffer *get_group_buffer() const { return &group_buffer_; }
   TO_STRING_KV(K_(palf_id), K_(self), K_(lsn_allocator), K_(group_buffer),                         \
   K_(last_submit_lsn), K_(last_submit_end_lsn), K_(last_submit_log_id), K_(last_submit_log_pid),   \
   K_(max_flushed_lsn), K_(max_flushed_end_lsn), K_(max_flushed_log_pid), K_(committed_end_lsn),    \
@@ -259,6 +264,9 @@ private:
                                 const int64_t &log_proposal_id);
   int try_freeze_prev_log_(const int64_t next_log_id, const LSN &lsn, bool &is_need_handle);
   int feedback_freeze_last_log_();
+  bool is_all_submitted_log_flushed_() const;
+  // whether the last log has waited for enough time in group commit window
+  bool is_group_commit_window_expired_(const int64_t now);
   int try_freeze_last_log_task_(const int64_t expected_log_id, const LSN &expected_end_lsn, bool &is_need_handle);
   int generate_new_group_log_(const LSN &lsn,
                               const int64_t log_id,
@@ -462,6 +470,11 @@ private:
   int64_t last_record_group_log_id_;
   int64_t append_cnt_array_[APPEND_CNT_ARRAY_SIZE];
   FreezeMode freeze_mode_;
+  // adaptive group commit window, updated with append count in check_and_switch_freeze_mode
+  LogGroupCommitCtrl group_commit_ctrl_;
+  int64_t last_check_freeze_mode_ts_;
+  LSN last_check_freeze_mode_end_lsn_;
+  int64_t group_commit_stat_time_us_;
   bool is_inited_;
 private:
   DISALLOW_COPY_AND_ASSIGN(LogSlidingWindow);
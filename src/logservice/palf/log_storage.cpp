@@ -15,6 +15,7 @@
 #include "lib/ob_errno.h"            // OB_INVALID_ARGUMENT
 #include "share/rc/ob_tenant_base.h" // mtl_malloc
 #include "log_reader_utils.h"        // ReadBuf
+#include "log_group_buffer.h"        // LogGroupBuffer
 
 namespace oceanbase
 {
@@ -35,6 +36,10 @@ LogStorage::LogStorage() :
     tail_info_lock_(),
     delete_block_lock_(),
     switch_next_block_cb_(),
+    hot_cache_(NULL),
+    hot_cache_read_cnt_(0),
+    hot_cache_hit_cnt_(0),
+    hot_cache_stat_time_(OB_INVALID_TIMESTAMP),
     is_inited_(false)
 {}
 
@@ -102,6 +107,9 @@ void LogStorage::destroy()
   log_block_header_.reset();
   curr_block_writable_size_ = 0;
   need_append_block_header_ = false;
+  hot_cache_ = NULL;
+  hot_cache_read_cnt_ = 0;
+  hot_cache_hit_cnt_ = 0;
   PALF_LOG(INFO, "LogStorage destroy success");
 }
 
@@ -285,6 +293,52 @@ int LogStorage::pread_without_block_header(const LSN &read_lsn,
   return ret;
 }
 
+int LogStorage::mmap_block(const int64_t block_id,
+                           char *&addr,
+                           int64_t &len)
+{
+  int ret = OB_SUCCESS;
+  const LSN log_tail = get_log_tail_guarded_by_lock_();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(ERROR, "LogStorage not inited!!!", K(ret));
+  } else if (0 > block_id) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(ERROR, "Invalid argument!!!", K(ret), K(block_id));
+  // NB: 只映射已经写满的block, 正在写入的block可能被truncate, 访问映射会触发SIGBUS
+  } else if (static_cast<block_id_t>(block_id) >= lsn_2_block(log_tail, logical_block_size_)) {
+    ret = OB_STATE_NOT_MATCH;
+    PALF_LOG(TRACE, "block has not been sealed, can not mmap", K(ret), K(block_id), K(log_tail));
+  } else if (OB_FAIL(log_reader_.mmap(block_id, addr, len))) {
+    PALF_LOG(WARN, "LogReader mmap failed", K(ret), K(block_id), K(log_tail));
+  } else {
+    PALF_LOG(TRACE, "mmap_block success", K(ret), K(block_id), KP(addr), K(len));
+  }
+
+  if (OB_NO_SUCH_FILE_OR_DIRECTORY == ret) {
+    if (true == check_read_out_of_lower_bound_(block_id)) {
+      ret = OB_ERR_OUT_OF_LOWER_BOUND;
+      PALF_LOG(WARN, "this block has been deleted", K(ret), K(block_id));
+    } else {
+      ret = OB_ERR_UNEXPECTED;
+      PALF_LOG(ERROR, "unexpected error, maybe deleted by human!!!", K(ret), K(block_id));
+    }
+  }
+  return ret;
+}
+
+int LogStorage::munmap_block(char *addr, const int64_t len)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(ERROR, "LogStorage not inited!!!", K(ret));
+  } else if (OB_FAIL(log_reader_.munmap(addr, len))) {
+    PALF_LOG(WARN, "LogReader munmap failed", K(ret), KP(addr), K(len));
+  }
+  return ret;
+}
+
 int LogStorage::truncate(const LSN &lsn)
 {
   int ret = OB_SUCCESS;
@@ -741,6 +795,11 @@ int LogStorage::inner_pread_(const LSN &read_lsn,
   if (read_lsn >= log_tail) {
     ret = OB_ERR_OUT_OF_UPPER_BOUND;
     PALF_LOG(WARN, "read something out of upper bound", K(ret), K(read_lsn), K(log_tail_));
+  } else if (real_read_offset == get_phy_offset_(read_lsn)
+             && true == read_hot_cache_(read_lsn, real_in_read_size, read_buf)) {
+    out_read_size = real_in_read_size;
+    PALF_LOG(TRACE, "inner_pread from hot cache success", K(ret), K(read_lsn), K(in_read_size),
+             K(real_in_read_size), K(log_tail));
   } else if (OB_FAIL(log_reader_.pread(read_block_id,
                                        real_read_offset,
                                        real_in_read_size,
@@ -772,5 +831,26 @@ int LogStorage::inner_pread_(const LSN &read_lsn,
   return ret;
 }
 
+bool LogStorage::read_hot_cache_(const LSN &read_lsn, const int64_t read_size, ReadBuf &read_buf)
+{
+  bool bool_ret = false;
+  if (NULL != hot_cache_ && read_size <= read_buf.buf_len_) {
+    bool_ret = (OB_SUCCESS == hot_cache_->read_data(read_lsn, read_size, read_buf.buf_));
+    ATOMIC_INC(&hot_cache_read_cnt_);
+    if (bool_ret) {
+      ATOMIC_INC(&hot_cache_hit_cnt_);
+    }
+    if (palf_reach_time_interval(10 * 1000 * 1000, hot_cache_stat_time_)) {
+      const int64_t read_cnt = ATOMIC_LOAD(&hot_cache_read_cnt_);
+      const int64_t hit_cnt = ATOMIC_LOAD(&hot_cache_hit_cnt_);
+      PALF_LOG(INFO, "[PALF STAT HOT CACHE]", K_(palf_id), K(read_cnt), K(hit_cnt),
+               "hit_ratio", 0 == read_cnt ? 0 : hit_cnt * 100 / read_cnt);
+      ATOMIC_STORE(&hot_cache_read_cnt_, 0);
+      ATOMIC_STORE(&hot_cache_hit_cnt_, 0);
+    }
+  }
+  return bool_ret;
+}
+
 } // end namespace palf
 } // end namespace oceanbase
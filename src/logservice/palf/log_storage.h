@@ -32,6 +32,7 @@ class ObILogAllocator;
 namespace palf
 {
 class ReadBuf;
+class LogGroupBuffer;
 class LogStorage : public ILogStorage
 {
 public:
@@ -81,6 +82,19 @@ public:
                                  ReadBuf &read_buf,
                                  int64_t &out_read_size);
 
+  // @retval
+  //   OB_SUCCESS
+  //   OB_INVALID_ARGUMENT
+  //   OB_STATE_NOT_MATCH, 'block_id' is the active block or has been truncated.
+  //   OB_ERR_OUT_OF_LOWER_BOUND
+  //   OB_ERR_UNEXPECTED, file maybe deleted by human.
+  int mmap_block(const int64_t block_id,
+                 char *&addr,
+                 int64_t &len) final;
+  int munmap_block(char *addr, const int64_t len) final;
+  bool check_read_out_of_lower_bound(const int64_t block_id) const final
+  { return check_read_out_of_lower_bound_(static_cast<block_id_t>(block_id)); }
+
   int truncate(const LSN &lsn);
   int truncate_prefix_blocks(const LSN &lsn);
   int delete_block(const block_id_t &block_id);
@@ -97,11 +111,16 @@ public:
 
   int update_manifest_used_for_meta_storage(const block_id_t expected_max_block_id);
 
+  // The recently flushed logs are still in the group buffer of the sliding window,
+  // pread serves them from there before reading disk.
+  void set_hot_cache(const LogGroupBuffer *group_buffer) { hot_cache_ = group_buffer; }
+
   TO_STRING_KV(K_(log_tail),
                K_(log_block_header),
                K_(block_mgr),
                K(logical_block_size_),
-               K(curr_block_writable_size_));
+               K(curr_block_writable_size_),
+               KP_(hot_cache));
 
 private:
   int do_init_(const char *log_dir,
@@ -140,6 +159,7 @@ private:
                    const bool need_read_block_header,
                    ReadBuf &read_buf,
                    int64_t &out_read_size);
+  bool read_hot_cache_(const LSN &read_lsn, const int64_t read_size, ReadBuf &read_buf);
 private:
   // Used to perform IO tasks in the background
   LogBlockMgr block_mgr_;
@@ -156,6 +176,10 @@ private:
   mutable ObSpinLock tail_info_lock_;
   mutable ObSpinLock delete_block_lock_;
   SwitchNextBlockCallback switch_next_block_cb_;
+  const LogGroupBuffer *hot_cache_;
+  int64_t hot_cache_read_cnt_;
+  int64_t hot_cache_hit_cnt_;
+  int64_t hot_cache_stat_time_;
   bool is_inited_;
 };
 
@@ -32,6 +32,20 @@ public:
                     const int64_t in_read_size,
                     ReadBuf &read_buf,
                     int64_t &out_read_size) = 0;
+  // map the whole physical block read-only, only sealed block can be mapped.
+  // @retval
+  //   OB_SUCCESS
+  //   OB_NOT_SUPPORTED, storage does not support mmap.
+  //   OB_STATE_NOT_MATCH, block has not been sealed.
+  //   OB_ERR_OUT_OF_LOWER_BOUND, block has been recycled.
+  //   OB_IO_ERROR
+  virtual int mmap_block(const int64_t block_id,
+                         char *&addr,
+                         int64_t &len) = 0;
+  virtual int munmap_block(char *addr, const int64_t len) = 0;
+  // whether the block has been recycled, the data read through mmap must be re-validated
+  // with it, because a recycled block is zeroed and reused in place.
+  virtual bool check_read_out_of_lower_bound(const int64_t block_id) const = 0;
 };
 }
 }
@@ -11,16 +11,20 @@
  */
 
 #include "palf_env_impl.h"
+#include <algorithm>
 #include "lib/lock/ob_spin_lock.h"
 #include "lib/ob_define.h"
 #include "lib/ob_errno.h"
 #include "lib/oblog/ob_log.h"
+#include "lib/cpu/ob_cpu_topology.h"
+#include "lib/thread/ob_thread_name.h"
 #include "lib/time/ob_time_utility.h"
 #include "lib/utility/ob_macro_utils.h"
 #include "share/allocator/ob_tenant_mutil_allocator.h"
 #include "share/config/ob_server_config.h"
 #include "share/ob_errno.h"
 #include "share/ob_occam_thread_pool.h"
+#include "share/rc/ob_tenant_base.h"
 #include "log_define.h"
 #include "palf_handle_impl_guard.h"             // PalfHandleImplGuard
 #include "palf_handle.h"
@@ -145,6 +149,8 @@ int PalfEnvImpl::init(
   log_io_worker_config_.io_queue_capcity_ = 100 * 1024;
   log_io_worker_config_.batch_width_ = 8;
   log_io_worker_config_.batch_depth_ = PALF_SLIDING_WINDOW_SIZE;
+  log_io_worker_config_.flush_thread_num_ = LogIOParallelFlusher::calc_thread_num(
+      GCONF._log_io_flush_thread_num, get_cpu_count(), log_io_worker_config_.batch_width_);
   if (is_inited_) {
     ret = OB_INIT_TWICE;
     PALF_LOG(ERROR, "PalfEnvImpl is inited twiced", K(ret));
@@ -462,21 +468,69 @@ void PalfEnvImpl::revert_palf_handle_impl(PalfHandleImpl *palf_handle_impl)
   }
 }
 
+// 重启时先扫描目录获取所有日志流, 再由有限个线程并发加载, 系统日志流优先加载
 int PalfEnvImpl::scan_all_palf_handle_impl_director_()
 {
   int ret = OB_SUCCESS;
   ObTimeGuard guard("PalfEnvImplStart", 0);
+  const int64_t start_ts = ObTimeUtility::current_time();
+  common::ObSEArray<int64_t, 16> palf_ids;
 	// TODO by runlin: how to avoid modify 'log_disk_usage_limit_size_' after restart?
-  ReloadPalfHandleImplFunctor functor(this);
+  ReloadPalfHandleImplFunctor functor(this, palf_ids);
+  start_stat_.reset();
   if (OB_FAIL(scan_dir(log_dir_, functor))) {
     PALF_LOG(WARN, "scan_dir failed", K(ret));
+  } else if (FALSE_IT(guard.click("scan_dir"))) {
+  } else if (FALSE_IT(start_stat_.scan_dir_cost_us_ = ObTimeUtility::current_time() - start_ts)) {
+  } else if (OB_FAIL(reload_palf_handle_impls_(palf_ids))) {
+    PALF_LOG(WARN, "reload_palf_handle_impls_ failed", K(ret), K_(start_stat));
   } else {
-    guard.click("scan_dir");
-    PALF_LOG(INFO, "scan_all_palf_handle_impl_director_ success", K(ret), K(log_dir_), K(guard));
+    guard.click("reload_palf_handle_impls");
+    PALF_LOG(INFO, "scan_all_palf_handle_impl_director_ success", K(ret), K(log_dir_), K_(start_stat), K(guard));
   }
   return ret;
 }
 
+int PalfEnvImpl::reload_palf_handle_impls_(ObIArray<int64_t> &palf_ids)
+{
+  int ret = OB_SUCCESS;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  const int64_t palf_cnt = palf_ids.count();
+  const int64_t thread_num = MIN(palf_cnt, PALF_MAX_RELOAD_THREAD_NUM);
+  ReloadPalfHandleImplThreadPool reload_pool(this, palf_ids);
+  if (0 == palf_cnt) {
+    PALF_LOG(INFO, "there is no palf instance need to be reloaded", K(ret), K(log_dir_));
+  } else if (FALSE_IT(sort_palf_ids_for_reload_(palf_ids))) {
+  } else if (FALSE_IT(reload_pool.set_run_wrapper(MTL_CTX()))) {
+  } else if (OB_FAIL(reload_pool.set_thread_count(thread_num))) {
+    PALF_LOG(WARN, "set_thread_count failed", K(ret), K(thread_num));
+  } else if (OB_FAIL(reload_pool.start())) {
+    PALF_LOG(WARN, "start reload thread pool failed", K(ret), K(thread_num));
+  } else {
+    reload_pool.wait();
+    ret = reload_pool.get_ret_code();
+    reload_pool.get_max_reload_cost(start_stat_.max_reload_cost_us_, start_stat_.slowest_palf_id_);
+  }
+  reload_pool.destroy();
+  start_stat_.palf_cnt_ = palf_cnt;
+  start_stat_.thread_num_ = thread_num;
+  start_stat_.reload_cost_us_ = ObTimeUtility::current_time() - start_ts;
+  return ret;
+}
+
+// 系统日志流优先加载, 其余按照palf_id递增加载
+void PalfEnvImpl::sort_palf_ids_for_reload_(ObIArray<int64_t> &palf_ids)
+{
+  if (palf_ids.count() > 1) {
+    std::sort(&palf_ids.at(0), &palf_ids.at(0) + palf_ids.count(),
+        [](const int64_t lhs, const int64_t rhs) {
+          const bool is_lhs_sys = (PALF_SYS_LS_ID == lhs);
+          const bool is_rhs_sys = (PALF_SYS_LS_ID == rhs);
+          return (is_lhs_sys != is_rhs_sys) ? is_lhs_sys : lhs < rhs;
+        });
+  }
+}
+
 int PalfEnvImpl::create_directory(const char *base_dir)
 {
   int ret = OB_SUCCESS;
@@ -567,7 +621,8 @@ bool PalfEnvImpl::CheckFreezeModeFunctor::operator() (const LSKey &palf_id, Palf
   int tmp_ret = OB_SUCCESS;
   if (NULL == palf_handle_impl) {
     PALF_LOG(ERROR, "palf_handle_impl is NULL", KP(palf_handle_impl), K(palf_id));
-  } else if (OB_SUCCESS != (tmp_ret = palf_handle_impl->check_and_switch_freeze_mode())) {
+  } else if (OB_SUCCESS != (tmp_ret = palf_handle_impl->check_and_switch_freeze_mode(
+      group_commit_latency_budget_us_))) {
     PALF_LOG(WARN, "check_and_switch_freeze_mode failed", K(tmp_ret), K(palf_id));
   } else {}
   return true;
@@ -589,7 +644,7 @@ int PalfEnvImpl::try_switch_state_for_all()
 int PalfEnvImpl::check_and_switch_freeze_mode()
 {
   int ret = OB_SUCCESS;
-  CheckFreezeModeFunctor check_freeze_mode_functor;
+  CheckFreezeModeFunctor check_freeze_mode_functor(GCONF._log_group_commit_latency_budget);
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
     PALF_LOG(WARN, "PalfEnvImpl is not inited", K(ret));
@@ -879,7 +934,10 @@ common::ObILogAllocator* PalfEnvImpl::get_log_allocator()
   return log_alloc_mgr_;
 }
 
-PalfEnvImpl::ReloadPalfHandleImplFunctor::ReloadPalfHandleImplFunctor(PalfEnvImpl *palf_env_impl) : palf_env_impl_(palf_env_impl)
+PalfEnvImpl::ReloadPalfHandleImplFunctor::ReloadPalfHandleImplFunctor(PalfEnvImpl *palf_env_impl,
+                                                                      ObIArray<int64_t> &palf_ids)
+  : palf_env_impl_(palf_env_impl),
+    palf_ids_(palf_ids)
 {
 }
 
@@ -887,7 +945,6 @@ int PalfEnvImpl::ReloadPalfHandleImplFunctor::func(const struct dirent *entry)
 {
   int ret = OB_SUCCESS;
   int pret = 0;
-  ObTimeGuard guard("ReloadFunctor");
   struct stat st;
   char log_dir[OB_MAX_FILE_NAME_LENGTH] = {'\0'};
   if (OB_ISNULL(entry)) {
@@ -915,16 +972,69 @@ int PalfEnvImpl::ReloadPalfHandleImplFunctor::func(const struct dirent *entry)
       // do nothing, skip invalid block like tmp
     } else {
       int64_t id = strtol(path, nullptr, 10);
-      if (OB_FAIL(palf_env_impl_->reload_palf_handle_impl_(id))) {
-        PALF_LOG(WARN, "reload_palf_handle_impl failed", K(ret));
+      if (OB_FAIL(palf_ids_.push_back(id))) {
+        PALF_LOG(WARN, "push_back failed", K(ret), K(id));
       }
-      guard.click("reload_palf_handle_impl");
-      PALF_LOG(INFO, "reload_palf_handle_impl_", K(ret), K(id), K(guard));
     }
   }
   return ret;
 }
 
+PalfEnvImpl::ReloadPalfHandleImplThreadPool::ReloadPalfHandleImplThreadPool(
+    PalfEnvImpl *palf_env_impl,
+    const ObIArray<int64_t> &palf_ids)
+  : palf_env_impl_(palf_env_impl),
+    palf_ids_(palf_ids),
+    next_idx_(0),
+    ret_code_(OB_SUCCESS),
+    lock_(),
+    max_reload_cost_us_(0),
+    slowest_palf_id_(INVALID_PALF_ID)
+{
+}
+
+void PalfEnvImpl::ReloadPalfHandleImplThreadPool::run1()
+{
+  lib::set_thread_name("PalfReload");
+  int64_t idx = 0;
+  // 任意日志流加载失败后, 其余线程不再领取新的日志流
+  while (OB_SUCCESS == get_ret_code()
+         && (idx = ATOMIC_FAA(&next_idx_, 1)) < palf_ids_.count()) {
+    int ret = OB_SUCCESS;
+    const int64_t palf_id = palf_ids_.at(idx);
+    const int64_t start_ts = ObTimeUtility::current_time();
+    if (OB_FAIL(palf_env_impl_->reload_palf_handle_impl_(palf_id))) {
+      PALF_LOG(WARN, "reload_palf_handle_impl failed", K(ret), K(palf_id));
+      (void) ATOMIC_BCAS(&ret_code_, OB_SUCCESS, ret);
+    } else {
+      const int64_t cost_ts = ObTimeUtility::current_time() - start_ts;
+      ObSpinLockGuard guard(lock_);
+      if (cost_ts > max_reload_cost_us_) {
+        max_reload_cost_us_ = cost_ts;
+        slowest_palf_id_ = palf_id;
+      }
+    }
+  }
+}
+
+void PalfEnvImpl::ReloadPalfHandleImplThreadPool::get_max_reload_cost(int64_t &max_reload_cost_us,
+                                                                      int64_t &slowest_palf_id) const
+{
+  ObSpinLockGuard guard(lock_);
+  max_reload_cost_us = max_reload_cost_us_;
+  slowest_palf_id = slowest_palf_id_;
+}
+
+void PalfEnvImpl::PalfEnvStartStat::reset()
+{
+  palf_cnt_ = 0;
+  thread_num_ = 0;
+  scan_dir_cost_us_ = 0;
+  reload_cost_us_ = 0;
+  max_reload_cost_us_ = 0;
+  slowest_palf_id_ = INVALID_PALF_ID;
+}
+
 int PalfEnvImpl::reload_palf_handle_impl_(const int64_t palf_id)
 {
   int ret = OB_SUCCESS;
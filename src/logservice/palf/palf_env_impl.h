@@ -22,6 +22,7 @@
 #include "lib/utility/ob_macro_utils.h"
 #include "lib/utility/utility.h"
 #include "share/ob_occam_timer.h"
+#include "share/ob_thread_pool.h"
 #include "fetch_log_engine.h"
 #include "log_loop_thread.h"
 #include "log_define.h"
@@ -217,6 +218,7 @@ public:
   int get_disk_options(PalfDiskOptions &disk_options);
   int for_each(const common::ObFunction<int(const PalfHandle&)> &func);
   common::ObILogAllocator* get_log_allocator();
+  LogRpc *get_log_rpc() { return &log_rpc_; }
   TO_STRING_KV(K_(self), K_(log_dir), K_(disk_options_wrapper));
   // =================== disk space management ==================
 public:
@@ -227,12 +229,50 @@ private:
   class ReloadPalfHandleImplFunctor : public ObBaseDirFunctor
   {
   public:
-    ReloadPalfHandleImplFunctor(PalfEnvImpl *palf_env_impl);
+    ReloadPalfHandleImplFunctor(PalfEnvImpl *palf_env_impl,
+                                common::ObIArray<int64_t> &palf_ids);
     int func(const struct dirent *entry) override;
   private:
     PalfEnvImpl *palf_env_impl_;
+    common::ObIArray<int64_t> &palf_ids_;
+  };
+  // 重启时并发加载各日志流, 每个线程按顺序领取palf_ids中下一个待加载的日志流
+  class ReloadPalfHandleImplThreadPool : public share::ObThreadPool
+  {
+  public:
+    ReloadPalfHandleImplThreadPool(PalfEnvImpl *palf_env_impl,
+                                   const common::ObIArray<int64_t> &palf_ids);
+    ~ReloadPalfHandleImplThreadPool() {}
+    void run1() override;
+    int get_ret_code() const { return ATOMIC_LOAD(&ret_code_); }
+    void get_max_reload_cost(int64_t &max_reload_cost_us, int64_t &slowest_palf_id) const;
+  private:
+    PalfEnvImpl *palf_env_impl_;
+    const common::ObIArray<int64_t> &palf_ids_;
+    int64_t next_idx_;
+    int ret_code_;
+    mutable common::ObSpinLock lock_;
+    int64_t max_reload_cost_us_;
+    int64_t slowest_palf_id_;
+  };
+  // 重启各阶段耗时统计
+  struct PalfEnvStartStat
+  {
+    PalfEnvStartStat() { reset(); }
+    ~PalfEnvStartStat() { reset(); }
+    void reset();
+    int64_t palf_cnt_;
+    int64_t thread_num_;
+    int64_t scan_dir_cost_us_;
+    int64_t reload_cost_us_;
+    int64_t max_reload_cost_us_;
+    int64_t slowest_palf_id_;
+    TO_STRING_KV(K_(palf_cnt), K_(thread_num), K_(scan_dir_cost_us), K_(reload_cost_us),
+                 K_(max_reload_cost_us), K_(slowest_palf_id));
   };
   int reload_palf_handle_impl_(const int64_t palf_id);
+  int reload_palf_handle_impls_(common::ObIArray<int64_t> &palf_ids);
+  static void sort_palf_ids_for_reload_(common::ObIArray<int64_t> &palf_ids);
   class SwitchStateFunctor
   {
   public:
@@ -250,9 +290,12 @@ private:
   class CheckFreezeModeFunctor
   {
   public:
-    CheckFreezeModeFunctor() {}
+    explicit CheckFreezeModeFunctor(const int64_t group_commit_latency_budget_us)
+      : group_commit_latency_budget_us_(group_commit_latency_budget_us) {}
     ~CheckFreezeModeFunctor() {}
     bool operator() (const LSKey &palf_id, PalfHandleImpl *palf_handle_impl);
+  private:
+    int64_t group_commit_latency_budget_us_;
   };
   struct LogGetRecycableFileCandidate {
     LogGetRecycableFileCandidate();
@@ -321,6 +364,7 @@ private:
   int64_t last_palf_epoch_;
 
   LogIOWorkerConfig log_io_worker_config_;
+  PalfEnvStartStat start_stat_;
   bool diskspace_enough_;
   bool is_inited_;
   bool is_running_;
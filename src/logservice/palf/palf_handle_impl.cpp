@@ -24,6 +24,7 @@
 #include "election/interface/election_priority.h"
 #include "palf_iterator.h"                             // Iterator
 #include "palf_env_impl.h"                             // PalfEnvImpl::
+#include "share/config/ob_server_config.h"             // GCONF
 
 namespace oceanbase
 {
@@ -158,6 +159,7 @@ int PalfHandleImpl::load(const int64_t palf_id,
   PalfBaseInfo palf_base_info;
   LogGroupEntryHeader entry_header;
   LSN max_committed_end_lsn;
+  ObTimeGuard guard("PalfHandleImplLoad", 0);
   if (IS_INIT) {
     ret = OB_INIT_TWICE;
   } else if (false == is_valid_palf_id(palf_id)
@@ -175,17 +177,21 @@ int PalfHandleImpl::load(const int64_t palf_id,
     PALF_LOG(WARN, "LogEngine load failed", K(ret), K(palf_id));
     // NB: when 'entry_header' is invalid, means that there is no data on disk, and set max_committed_end_lsn
     //     to 'base_lsn_', we will generate default PalfBaseInfo or get it from LogSnapshotMeta(rebuild).
-  } else if (FALSE_IT(max_committed_end_lsn =
+  } else if (FALSE_IT(guard.click("load_log_engine"))
+             || FALSE_IT(max_committed_end_lsn =
         (true == entry_header.is_valid() ? entry_header.get_committed_end_lsn() : log_engine_.get_log_meta().get_log_snapshot_meta().base_lsn_))) {
   } else if (OB_FAIL(construct_palf_base_info_(max_committed_end_lsn, palf_base_info))) {
     PALF_LOG(WARN, "construct_palf_base_info_ failed", K(ret), K(palf_id), K(entry_header), K(palf_base_info));
-  } else if (OB_FAIL(do_init_mem_(palf_id, palf_base_info, log_engine_.get_log_meta(), log_dir, self,
+  } else if (FALSE_IT(guard.click("construct_palf_base_info"))
+             || OB_FAIL(do_init_mem_(palf_id, palf_base_info, log_engine_.get_log_meta(), log_dir, self,
           fetch_log_engine, alloc_mgr, log_rpc, log_io_worker, palf_env_impl, election_timer))) {
     PALF_LOG(WARN, "PalfHandleImpl do_init_mem_ failed", K(ret), K(palf_id));
-  } else if (OB_FAIL(append_disk_log_to_sw_(max_committed_end_lsn))) {
+  } else if (FALSE_IT(guard.click("do_init_mem"))
+             || OB_FAIL(append_disk_log_to_sw_(max_committed_end_lsn))) {
     PALF_LOG(WARN, "append_disk_log_to_sw_ failed", K(ret), K(palf_id));
   } else {
-    PALF_EVENT("PalfHandleImpl load success", palf_id_, K(ret), K(palf_base_info), K(log_dir), K(palf_epoch));
+    guard.click("append_disk_log_to_sw");
+    PALF_EVENT("PalfHandleImpl load success", palf_id_, K(ret), K(palf_base_info), K(log_dir), K(palf_epoch), K(guard));
   }
   return ret;
 }
@@ -1803,7 +1809,9 @@ int PalfHandleImpl::alloc_palf_buffer_iterator(const LSN &offset,
   };
   if (OB_FAIL(iterator.init(offset, log_engine_.get_log_storage(), get_file_end_lsn))) {
     PALF_LOG(ERROR, "PalfBufferIterator init failed", K(ret), KPC(this));
-  } else {
+  } else if (GCONF._enable_log_mmap_read) {
+    // 迭代上界不超过committed_end_lsn, 已写满的block不会被truncate, 可以mmap读
+    iterator.enable_mmap_read();
   }
   return ret;
 }
@@ -1821,7 +1829,9 @@ int PalfHandleImpl::alloc_palf_group_buffer_iterator(const LSN &offset,
   };
   if (OB_FAIL(iterator.init(offset, log_engine_.get_log_storage(), get_file_end_lsn))) {
     PALF_LOG(ERROR, "PalfGroupBufferIterator init failed", K(ret), KPC(this));
-  } else {
+  } else if (GCONF._enable_log_mmap_read) {
+    // 迭代上界不超过committed_end_lsn, 已写满的block不会被truncate, 可以mmap读
+    iterator.enable_mmap_read();
   }
   return ret;
 }
@@ -1855,6 +1865,10 @@ int PalfHandleImpl::alloc_palf_group_buffer_iterator(const int64_t ts_ns,
   } else if (OB_FAIL(local_iter.init(start_lsn, log_engine_.get_log_storage(), get_file_end_lsn))) {
     PALF_LOG(WARN, "PalfGroupBufferIterator init failed", KR(ret), KPC(this), K(start_lsn));
   } else {
+    const bool enable_mmap_read = GCONF._enable_log_mmap_read;
+    if (enable_mmap_read) {
+      local_iter.enable_mmap_read();
+    }
     LogGroupEntry curr_group_entry;
     LSN curr_lsn, result_lsn;
     while (OB_SUCC(ret) && OB_SUCC(local_iter.next())) {
@@ -1873,6 +1887,9 @@ int PalfHandleImpl::alloc_palf_group_buffer_iterator(const int64_t ts_ns,
         OB_FAIL(iterator.init(result_lsn, log_engine_.get_log_storage(), get_file_end_lsn))) {
       PALF_LOG(WARN, "PalfGroupBufferIterator init failed", KR(ret), KPC(this), K(result_lsn));
     } else {
+      if (OB_SUCC(ret) && result_lsn.is_valid() && enable_mmap_read) {
+        iterator.enable_mmap_read();
+      }
       if (OB_ITER_END == ret) {
         ret = OB_ENTRY_NOT_EXIST;
       }
@@ -2037,14 +2054,14 @@ int PalfHandleImpl::reset_location_cache_cb()
   return ret;
 }
 
-int PalfHandleImpl::check_and_switch_freeze_mode()
+int PalfHandleImpl::check_and_switch_freeze_mode(const int64_t group_commit_latency_budget_us)
 {
   int ret = OB_SUCCESS;
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
   } else {
     RLockGuard guard(lock_);
-    sw_.check_and_switch_freeze_mode();
+    sw_.check_and_switch_freeze_mode(group_commit_latency_budget_us);
   }
   return ret;
 }
@@ -2311,6 +2328,7 @@ int PalfHandleImpl::do_init_mem_(
   } else if (OB_FAIL(mode_mgr_.init(palf_id, self, log_meta.get_log_mode_meta(), &state_mgr_, &log_engine_, &config_mgr_, &sw_))) {
     PALF_LOG(WARN, "mode_mgr_ init failed", K(ret), K(palf_id));
   } else {
+    log_engine_.get_log_storage()->set_hot_cache(sw_.get_group_buffer());
     palf_id_ = palf_id;
     fetch_log_engine_ = fetch_log_engine;
     allocator_ = alloc_mgr;
@@ -3515,6 +3533,7 @@ int PalfHandleImpl::stat(PalfStat &palf_stat)
     palf_stat.end_ts_ns_ = get_end_ts_ns();
     palf_stat.max_lsn_ = get_max_lsn();
     palf_stat.max_ts_ns_ = get_max_ts_ns();
+    sw_.get_group_commit_stat(palf_stat.group_commit_stat_);
     PALF_LOG(INFO, "PalfHandleImpl stat", K(palf_stat));
   }
   return ret;
@@ -79,9 +79,10 @@ struct PalfStat {
   int64_t end_ts_ns_;
   LSN max_lsn_;
   int64_t max_ts_ns_;
+  LogGroupCommitStat group_commit_stat_;
   TO_STRING_KV(K_(self), K_(palf_id), K_(role), K_(log_proposal_id), K_(config_version),
       K_(access_mode), K_(paxos_member_list), K_(paxos_replica_num), K_(allow_vote),
-      K_(replica_type), K_(base_lsn), K_(end_lsn), K_(end_ts_ns), K_(max_lsn));
+      K_(replica_type), K_(base_lsn), K_(end_lsn), K_(end_ts_ns), K_(max_lsn), K_(group_commit_stat));
 };
 
 struct PalfDiagnoseInfo {
@@ -780,7 +781,7 @@ public:
   int inner_truncate_prefix_blocks(const LSN &lsn);
   // ==================================================================
   int check_and_switch_state();
-  int check_and_switch_freeze_mode();
+  int check_and_switch_freeze_mode(const int64_t group_commit_latency_budget_us);
   int period_freeze_last_log();
   int handle_prepare_request(const common::ObAddr &server,
                              const int64_t &proposal_id) override final;
@@ -53,6 +53,8 @@ public:
     }
     return ret;
   }
+  // only supported by DiskIteratorStorage
+  void enable_mmap_read() { iterator_storage_.enable_mmap_read(); }
   void destroy()
   {
     if (IS_INIT) {
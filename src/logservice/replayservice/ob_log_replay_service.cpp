@@ -1214,6 +1214,7 @@ int ObLogReplayService::handle_replay_task_(ObReplayServiceReplayTask *task_queu
     CLOG_LOG(ERROR, "replay status is NULL", KPC(task_queue), KPC(replay_status), KR(ret));
   } else {
     int64_t start_ts = ObTimeUtility::fast_current_time();
+    replay_status->inc_replaying_queue_cnt();
     do {
       int64_t replay_task_used = 0;
       int64_t destroy_task_used = 0;
@@ -1267,6 +1268,7 @@ int ObLogReplayService::handle_replay_task_(ObReplayServiceReplayTask *task_queu
         }
       }
     } while (OB_SUCC(ret) && (!is_queue_empty) && (!is_timeslice_run_out));
+    replay_status->dec_replaying_queue_cnt();
   }
   return ret;
 }
@@ -434,6 +434,18 @@ int ObReplayServiceReplayTask::get_min_unreplayed_log_info(LSN &lsn,
   return ret;
 }
 
+bool ObReplayServiceReplayTask::get_head_log_ts(int64_t &log_ts) const
+{
+  bool bool_ret = false;
+  ObLockGuard<ObSpinLock> guard(lock_);
+  ObLink *top_item = queue_.top();
+  if (NULL != top_item) {
+    log_ts = static_cast<ObLogReplayTask *>(top_item)->log_ts_;
+    bool_ret = true;
+  }
+  return bool_ret;
+}
+
 //---------------ObLogReplayBuffer---------------//
 void ObLogReplayBuffer::reset()
 {
@@ -558,6 +570,7 @@ ObReplayStatus::ObReplayStatus():
     post_barrier_lsn_(),
     err_info_(),
     pending_task_count_(0),
+    replaying_queue_cnt_(0),
     last_check_memstore_lsn_(),
     rwlock_(),
     spinlock_(),
@@ -1284,6 +1297,27 @@ int ObReplayStatus::stat(LSReplayStat &stat) const
       CLOG_LOG(WARN, "get_next_to_submit_log_info failed", KPC(this), K(ret));
     } else if (OB_FAIL(submit_log_task_.get_committed_end_lsn(stat.end_lsn_))) {
       CLOG_LOG(WARN, "get_committed_end_lsn failed", KPC(this), K(ret));
+    } else {
+      // 回放延迟以最小的未回放日志计算, 包括尚未提交的日志和各队列中待回放的日志
+      int64_t min_unreplayed_log_ts = INT64_MAX;
+      int64_t queue_log_ts = OB_INVALID_TIMESTAMP;
+      stat.active_queue_cnt_ = 0;
+      stat.replaying_queue_cnt_ = ATOMIC_LOAD(&replaying_queue_cnt_);
+      if (stat.end_lsn_.is_valid() && stat.unsubmitted_lsn_ < stat.end_lsn_) {
+        min_unreplayed_log_ts = stat.unsubmitted_log_ts_ns_;
+      }
+      for (int64_t i = 0; is_enabled_ && i < REPLAY_TASK_QUEUE_SIZE; ++i) {
+        if (task_queues_[i].get_head_log_ts(queue_log_ts)) {
+          stat.active_queue_cnt_++;
+          min_unreplayed_log_ts = std::min(min_unreplayed_log_ts, queue_log_ts);
+        }
+      }
+      if (!is_enabled_ || INT64_MAX == min_unreplayed_log_ts) {
+        stat.replay_lag_us_ = 0;
+      } else {
+        const int64_t now_ns = common::ObTimeUtility::current_time_ns();
+        stat.replay_lag_us_ = now_ns > min_unreplayed_log_ts ? (now_ns - min_unreplayed_log_ts) / 1000 : 0;
+      }
     }
   }
   return ret;
@@ -65,6 +65,12 @@ struct LSReplayStat
   palf::LSN unsubmitted_lsn_;
   int64_t unsubmitted_log_ts_ns_;
   int64_t pending_cnt_;
+  //当前时间与最小未回放日志ts的差值
+  int64_t replay_lag_us_;
+  //有待回放任务的队列个数, 即可并行回放的程度
+  int64_t active_queue_cnt_;
+  //正在被回放线程处理的队列个数
+  int64_t replaying_queue_cnt_;
 
   TO_STRING_KV(K(ls_id_),
                K(role_),
@@ -72,7 +78,10 @@ struct LSReplayStat
                K(enabled_),
                K(unsubmitted_lsn_),
                K(unsubmitted_log_ts_ns_),
-               K(pending_cnt_));
+               K(pending_cnt_),
+               K(replay_lag_us_),
+               K(active_queue_cnt_),
+               K(replaying_queue_cnt_));
 };
 
 struct ReplayDiagnoseInfo
@@ -386,6 +395,8 @@ public:
                                   int64_t &replay_cost,
                                   int64_t &retry_cost,
                                   bool &is_queue_empty);
+  // 队头任务的log_ts, 队列为空时返回false
+  bool get_head_log_ts(int64_t &log_ts) const;
 private:
   Link *pop_()
   {
@@ -511,6 +522,9 @@ public:
   int push_log_replay_task(ObLogReplayTask &task);
   void inc_pending_task(const int64_t log_size);
   void dec_pending_task(const int64_t log_size);
+  // 统计同时被回放线程处理的队列个数
+  void inc_replaying_queue_cnt() { ATOMIC_INC(&replaying_queue_cnt_); }
+  void dec_replaying_queue_cnt() { ATOMIC_DEC(&replaying_queue_cnt_); }
   //通用的replay task释放内存接口, 前向barrier的任务不会单独释放log buf内存
   //前向barrier完整释放申请的内存需要同时调用
   //free_replay_task_log_buf()和free_replay_task()
@@ -582,6 +596,7 @@ public:
                K(ref_cnt_),
                K(post_barrier_lsn_),
                K(pending_task_count_),
+               K(replaying_queue_cnt_),
                K(submit_log_task_));
 
 private:
@@ -617,6 +632,7 @@ private:
   // record error info, reported when handle submit or replay type task
   LSErrInfo err_info_;
   int64_t pending_task_count_;
+  int64_t replaying_queue_cnt_;
   palf::LSN last_check_memstore_lsn_;
   // protect is_enabled_ and submit_log_task_
   // 回放一条日志时会一直持有读锁直到回放完成
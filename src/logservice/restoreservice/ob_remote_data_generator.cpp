@@ -20,6 +20,7 @@
 #include "logservice/archiveservice/ob_archive_file_utils.h"     // ObArchiveFileUtils
 #include "share/backup/ob_archive_path.h"           // ObArchivePathUtil
 #include "logservice/archiveservice/ob_archive_define.h"         // ObArchiveFileHeader
+#include "logservice/archiveservice/ob_archive_compressor.h"     // ObArchiveCompressor
 #include "logservice/archiveservice/ob_archive_util.h"       // ObArchiveFileUtils
 #include "share/backup/ob_backup_path.h"                // ObBackupPath
 #include "ob_log_restore_rpc.h"                           // proxy
@@ -122,7 +123,9 @@ RemoteDataGenerator::RemoteDataGenerator(const uint64_t tenant_id,
   end_log_ts_(end_log_ts),
   end_lsn_(end_lsn),
   to_end_(false),
-  max_consumed_lsn_(start_lsn)
+  max_consumed_lsn_(start_lsn),
+  process_buf_(NULL),
+  process_buf_size_(0)
 {}
 
 RemoteDataGenerator::~RemoteDataGenerator()
@@ -133,6 +136,11 @@ RemoteDataGenerator::~RemoteDataGenerator()
   max_consumed_lsn_.reset();
   next_fetch_lsn_.reset();
   end_lsn_.reset();
+  if (NULL != process_buf_) {
+    mtl_free(process_buf_);
+    process_buf_ = NULL;
+    process_buf_size_ = 0;
+  }
 }
 
 bool RemoteDataGenerator::is_valid() const
@@ -162,21 +170,59 @@ int RemoteDataGenerator::update_max_lsn(const palf::LSN &lsn)
   }
   return ret;
 }
-// only handle orignal buffer without compression or encryption
-// only to check incomplete LogGroupEntry
-// compression and encryption will be supported in the future
-//
-// 仅支持备份情况下, 不需要处理归档写入不原子情况
+// 归档文件以file header中的ARCHIVE_FILE_FLAG_COMPRESS标识数据区是否由压缩单元组成;
+// 未压缩数据直接返回, 保持原有处理逻辑; encryption will be supported in the future
 int RemoteDataGenerator::process_origin_data_(char *origin_buf,
     const int64_t origin_buf_size,
-    char *buf,
-    int64_t &buf_size)
+    const bool is_compressed,
+    char *&buf,
+    int64_t &buf_size,
+    int64_t &consumed_size)
 {
-  UNUSED(origin_buf);
-  UNUSED(origin_buf_size);
-  UNUSED(buf);
-  UNUSED(buf_size);
-  return OB_NOT_SUPPORTED;
+  int ret = OB_SUCCESS;
+  int64_t orig_size = 0;
+  if (OB_ISNULL(origin_buf) || OB_UNLIKELY(origin_buf_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(origin_buf), K(origin_buf_size));
+  } else if (! is_compressed) {
+    buf = origin_buf;
+    buf_size = origin_buf_size;
+    consumed_size = origin_buf_size;
+  } else if (OB_FAIL(ObArchiveCompressor::get_decompress_size(origin_buf, origin_buf_size,
+          orig_size, consumed_size))) {
+    LOG_WARN("get decompress size failed", K(ret), K(origin_buf_size), KPC(this));
+  } else if (0 == orig_size) {
+    ret = OB_ITER_END;
+    LOG_INFO("no complete compress unit, need retry", K(ret), K(origin_buf_size), KPC(this));
+  } else if (OB_FAIL(reserve_process_buf_(orig_size))) {
+    LOG_WARN("reserve process buf failed", K(ret), K(orig_size), KPC(this));
+  } else if (OB_FAIL(ObArchiveCompressor::decompress(origin_buf, consumed_size,
+          process_buf_, process_buf_size_, buf_size, consumed_size))) {
+    LOG_WARN("decompress failed", K(ret), K(origin_buf_size), K(consumed_size), KPC(this));
+  } else {
+    buf = process_buf_;
+  }
+  return ret;
+}
+
+int RemoteDataGenerator::reserve_process_buf_(const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (size <= process_buf_size_) {
+  } else {
+    if (NULL != process_buf_) {
+      mtl_free(process_buf_);
+      process_buf_ = NULL;
+      process_buf_size_ = 0;
+    }
+    if (OB_ISNULL(process_buf_ = static_cast<char *>(mtl_malloc(size, "ResDataGen")))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("alloc memory failed", K(ret), K(size));
+    } else {
+      process_buf_size_ = size;
+    }
+  }
+  return ret;
 }
 // ================================ ServiceDataGenerator ============================= //
 ServiceDataGenerator::ServiceDataGenerator(const uint64_t tenant_id,
@@ -290,7 +336,8 @@ static int read_file_(const ObString &base,
 
 static int extract_archive_file_header_(char *buf,
     const int64_t buf_size,
-    palf::LSN &lsn)
+    palf::LSN &lsn,
+    bool &is_compressed)
 {
   int ret = OB_SUCCESS;
   archive::ObArchiveFileHeader file_header;
@@ -308,6 +355,7 @@ static int extract_archive_file_header_(char *buf,
     LOG_ERROR("invalid file header", K(ret), K(pos), K(file_header));
   } else {
     lsn = file_header.start_lsn_;
+    is_compressed = file_header.is_compressed();
     LOG_INFO("extract_archive_file_header_ succ", K(pos), K(file_header));
   }
   return ret;
@@ -399,6 +447,10 @@ int LocationDataGenerator::fetch_log_from_location_(char *&buf, int64_t &buf_siz
   int ret = OB_SUCCESS;
   int64_t file_id = 0;
   int64_t file_offset = 0;
+  char *origin_buf = NULL;
+  int64_t origin_buf_size = 0;
+  int64_t consumed_size = 0;
+  bool is_compressed = false;
   palf::LSN max_lsn_in_file = palf::LOG_INVALID_LSN_VAL;
   share::ObBackupPath piece_path;
   if (OB_FAIL(get_precise_file_and_offset_(file_id, file_offset, max_lsn_in_file, piece_path))) {
@@ -407,15 +459,30 @@ int LocationDataGenerator::fetch_log_from_location_(char *&buf, int64_t &buf_siz
           file_id, file_offset, data_, MAX_DATA_BUF_LEN, data_len_))) {
     LOG_WARN("read file failed", K(ret));
   } else if (file_offset > 0) {
-    // 非第一次读文件, 不必再解析file header
-    base_lsn_ = max_lsn_in_file;
-    buf = data_;
-    buf_size = data_len_;
-  } else if (OB_FAIL(extract_archive_file_header_(data_, data_len_, base_lsn_))) {
+    // 非第一次读文件, 单独读取file header获取压缩标识, base_lsn以piece context记录为准
+    palf::LSN file_start_lsn;
+    char header_buf[ARCHIVE_FILE_HEADER_SIZE];
+    int64_t header_len = 0;
+    if (OB_FAIL(read_file_(piece_path.get_ptr(), dest_->get_storage_info(), id_,
+            file_id, 0, header_buf, ARCHIVE_FILE_HEADER_SIZE, header_len))) {
+      LOG_WARN("read file header failed", K(ret), K(file_id), KPC(this));
+    } else if (OB_FAIL(extract_archive_file_header_(header_buf, header_len, file_start_lsn, is_compressed))) {
+      LOG_WARN("extract archive file heaeder failed", K(ret), K(file_id), KPC(this));
+    } else {
+      base_lsn_ = max_lsn_in_file;
+      origin_buf = data_;
+      origin_buf_size = data_len_;
+    }
+  } else if (OB_FAIL(extract_archive_file_header_(data_, data_len_, base_lsn_, is_compressed))) {
     LOG_WARN("extract archive file heaeder failed", K(ret), KPC(this));
   } else {
-    buf = data_ + ARCHIVE_FILE_HEADER_SIZE;
-    buf_size = data_len_ - ARCHIVE_FILE_HEADER_SIZE;
+    origin_buf = data_ + ARCHIVE_FILE_HEADER_SIZE;
+    origin_buf_size = data_len_ - ARCHIVE_FILE_HEADER_SIZE;
+  }
+
+  if (OB_SUCC(ret) && OB_FAIL(process_origin_data_(origin_buf, origin_buf_size,
+          is_compressed, buf, buf_size, consumed_size))) {
+    LOG_WARN("process origin data failed", K(ret), K(origin_buf_size), KPC(this));
   }
 
   if ((OB_SUCC(ret) && base_lsn_ > start_lsn_) || OB_ERR_OUT_OF_LOWER_BOUND == ret) {
@@ -424,10 +491,10 @@ int LocationDataGenerator::fetch_log_from_location_(char *&buf, int64_t &buf_siz
     ret = OB_ITER_END;
   }
 
-  // 更新读取归档文件信息
+  // 更新读取归档文件信息, 末尾不完整的压缩单元下次重新读取
   if (OB_SUCC(ret)) {
     max_file_id_ = file_id;
-    max_file_offset_ = file_offset + data_len_;
+    max_file_offset_ = file_offset + data_len_ - (origin_buf_size - consumed_size);
   }
   return ret;
 }
@@ -472,6 +539,7 @@ RawPathDataGenerator::RawPathDataGenerator(const uint64_t tenant_id,
   array_(array),
   data_len_(0),
   base_lsn_(),
+  is_compressed_(false),
   index_(piece_index),
   min_file_id_(min_file_id),
   max_file_id_(max_file_id)
@@ -483,12 +551,16 @@ RawPathDataGenerator::~RawPathDataGenerator()
   array_.reset();
   data_len_ = 0;
   base_lsn_.reset();
+  is_compressed_ = false;
   index_ = 0;
 }
 
 int RawPathDataGenerator::next_buffer(RemoteDataBuffer &buffer)
 {
   int ret = OB_SUCCESS;
+  char *buf = NULL;
+  int64_t buf_size = 0;
+  int64_t consumed_size = 0;
   if (OB_UNLIKELY(! is_valid())) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("RawPathDataGenerator is invalid", K(ret), KPC(this));
@@ -496,7 +568,10 @@ int RawPathDataGenerator::next_buffer(RemoteDataBuffer &buffer)
     ret = OB_ITER_END;
   } else if (OB_FAIL(fetch_log_from_dest_())) {
     LOG_WARN("fetch log from dest failed", K(ret), KPC(this));
-  } else if (OB_FAIL(buffer.set(base_lsn_, data_ + ARCHIVE_FILE_HEADER_SIZE, data_len_ - ARCHIVE_FILE_HEADER_SIZE))) {
+  } else if (OB_FAIL(process_origin_data_(data_ + ARCHIVE_FILE_HEADER_SIZE,
+          data_len_ - ARCHIVE_FILE_HEADER_SIZE, is_compressed_, buf, buf_size, consumed_size))) {
+    LOG_WARN("process origin data failed", K(ret), KPC(this));
+  } else if (OB_FAIL(buffer.set(base_lsn_, buf, buf_size))) {
     LOG_WARN("buffer set failed", K(ret), KPC(this));
   }
   return ret;
@@ -586,6 +661,7 @@ int RawPathDataGenerator::extract_archive_file_header_()
     LOG_ERROR("invalid file header", K(ret), K(pos), K(file_header), KPC(this));
   } else {
     base_lsn_ = file_header.start_lsn_;
+    is_compressed_ = file_header.is_compressed();
     LOG_INFO("extract_archive_file_header_ succ", K(pos), K(file_header), KPC(this));
   }
   return ret;
@@ -84,7 +84,17 @@ public:
       K_(end_lsn), K_(to_end), K_(max_consumed_lsn));
 
 protected:
-  int process_origin_data_(char *origin_buf, const int64_t origin_buf_size, char *buf, int64_t &buf_size);
+  // 处理归档文件数据区, 压缩文件的数据解压到process_buf_, 否则直接返回原始数据
+  //
+  // @param [in], is_compressed     file header是否标识ARCHIVE_FILE_FLAG_COMPRESS
+  // @param [out], buf, buf_size    连续的LogGroupEntry
+  // @param [out], consumed_size    完整的压缩单元占用的原始数据长度
+  int process_origin_data_(char *origin_buf,
+      const int64_t origin_buf_size,
+      const bool is_compressed,
+      char *&buf,
+      int64_t &buf_size,
+      int64_t &consumed_size);
 
 protected:
   uint64_t tenant_id_;
@@ -96,6 +106,14 @@ protected:
   bool to_end_;
   LSN max_consumed_lsn_;
 
+private:
+  int reserve_process_buf_(const int64_t size);
+
+private:
+  // 解压归档数据使用的buffer, 按需申请
+  char *process_buf_;
+  int64_t process_buf_size_;
+
 private:
   DISALLOW_COPY_AND_ASSIGN(RemoteDataGenerator);
 };
@@ -193,7 +211,7 @@ public:
   int next_buffer(RemoteDataBuffer &buffer);
 
   INHERIT_TO_STRING_KV("RemoteDataGenerator", RemoteDataGenerator, K_(array), K_(data_len),
-      K_(file_id), K_(base_lsn), K_(index), K_(min_file_id), K_(max_file_id));
+      K_(file_id), K_(base_lsn), K_(is_compressed), K_(index), K_(min_file_id), K_(max_file_id));
 
 private:
   int fetch_log_from_dest_();
@@ -212,6 +230,7 @@ private:
 
   int64_t file_id_;
   LSN base_lsn_;
+  bool is_compressed_;
 
   int64_t index_;
   int64_t min_file_id_;
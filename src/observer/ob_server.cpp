@@ -1509,6 +1509,9 @@ int ObServer::init_io()
         cpu_cnt = common::get_cpu_num();
       }
       io_config.disk_io_thread_count_ = GCONF.disk_io_thread_count;
+      io_config.enable_io_coalescing_ = GCONF._enable_io_coalescing;
+      // read ahead is issued as direct io, which requires aligned size
+      io_config.read_ahead_size_ = upper_align(GCONF._io_read_ahead_size, DIO_READ_ALIGN_SIZE);
       const int64_t max_io_depth = 256;
       ObTenantIOConfig server_tenant_io_config = ObTenantIOConfig::default_instance();
       if (OB_FAIL(ObIOManager::get_instance().set_io_config(io_config))) {
@@ -1583,7 +1586,8 @@ int ObServer::init_io()
                 storage_env_.sstable_dir_,
                 storage_env_.default_block_size_,
                 storage_env_.data_disk_percentage_,
-                storage_env_.data_disk_size_))) {
+                storage_env_.data_disk_size_,
+                GCONF._io_engine.str()))) {
             LOG_ERROR("fail to init io device wrapper", KR(ret), K_(storage_env));
           } else if (OB_FAIL(ObIOManager::get_instance().add_device_channel(THE_IO_DEVICE,
                                                                             io_config.disk_io_thread_count_,
@@ -2071,6 +2075,10 @@ int ObServer::init_storage()
                                     storage_env_.bf_cache_priority_,
                                     storage_env_.bf_cache_miss_count_threshold_))) {
       LOG_WARN("Fail to init OB_STORE_CACHE, ", KR(ret), K(storage_env_.data_dir_));
+    } else if (0 != STRLEN(GCONF._micro_block_ssd_cache_dir.str())
+        && OB_FAIL(OB_STORE_CACHE.init_ssd_cache(GCONF._micro_block_ssd_cache_dir.str(),
+                                                 GCONF._micro_block_ssd_cache_size))) {
+      LOG_WARN("Fail to init micro block ssd cache", KR(ret), K(GCONF._micro_block_ssd_cache_dir.str()));
     } else if (OB_FAIL(ObTmpFileManager::get_instance().init())) {
       LOG_WARN("fail to init temp file manager", KR(ret));
     } else if (OB_FAIL(OB_SERVER_BLOCK_MGR.init(THE_IO_DEVICE,
@@ -151,6 +151,9 @@ int ObServerReloadConfig::operator()()
     io_config.data_storage_io_timeout_ms_ = GCONF._data_storage_io_timeout / 1000L;
     io_config.data_storage_warning_tolerance_time_ = GCONF.data_storage_warning_tolerance_time;
     io_config.data_storage_error_tolerance_time_ = GCONF.data_storage_error_tolerance_time;
+    io_config.enable_io_coalescing_ = GCONF._enable_io_coalescing;
+    // read ahead is issued as direct io, which requires aligned size
+    io_config.read_ahead_size_ = upper_align(GCONF._io_read_ahead_size, DIO_READ_ALIGN_SIZE);
     if (OB_FAIL(ObIOManager::get_instance().set_io_config(io_config))) {
       real_ret = ret;
       LOG_WARN("reload io manager config fail, ", K(ret));
@@ -175,6 +178,10 @@ int ObServerReloadConfig::operator()()
   const int64_t cache_size = GCONF.memory_chunk_cache_size;
   const int cache_cnt = (cache_size > 0 ? cache_size : GMEMCONF.get_server_memory_limit()) / INTACT_ACHUNK_SIZE;
   lib::AChunkMgr::instance().set_max_chunk_cache_cnt(cache_cnt);
+  lib::ObjectThreadCache::set_enable(GCONF._enable_malloc_thread_cache);
+  lib::ObHugePageHelper::set_policy(lib::ObHugePageHelper::MEMSTORE_CTX, GCONF._memstore_huge_page_policy.str());
+  lib::ObHugePageHelper::set_policy(lib::ObHugePageHelper::KVCACHE_CTX, GCONF._kvcache_huge_page_policy.str());
+  lib::ObHugePageHelper::set_policy(lib::ObHugePageHelper::WORK_AREA_CTX, GCONF._work_area_huge_page_policy.str());
   if (GCONF.cluster_id.get_value() >= 0) {
     obrpc::ObRpcNetHandler::CLUSTER_ID = GCONF.cluster_id.get_value();
     LOG_INFO("set CLUSTER_ID for rpc", "cluster_id", GCONF.cluster_id.get_value());
@@ -254,6 +261,8 @@ int ObServerReloadConfig::operator()()
   lib::g_runtime_enabled = true;
 
   common::ObKVGlobalCache::get_instance().reload_wash_interval();
+  common::ObKVGlobalCache::get_instance().reload_admission();
+  common::ObKVGlobalCache::get_instance().reload_rebalance();
   {
     int tmp_ret = OB_SUCCESS;
     int64_t data_disk_size = 0;
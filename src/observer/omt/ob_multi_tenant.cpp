@@ -945,6 +945,12 @@ int ObMultiTenant::update_tenant_config(uint64_t tenant_id)
       if (OB_SUCCESS != (tmp_ret = update_tenant_dag_scheduler_config())) {
         LOG_WARN("failed to update tenant dag scheduler config", K(tmp_ret), K(tenant_id));
       }
+      ObTenant *tenant = nullptr;
+      if (OB_SUCCESS != (tmp_ret = get_tenant(tenant_id, tenant))) {
+        LOG_WARN("failed to get tenant", K(tmp_ret), K(tenant_id));
+      } else {
+        tenant->set_numa_node(tenant_config->_numa_node_binding);
+      }
     }
   }
   LOG_INFO("update_tenant_config success", K(tenant_id));
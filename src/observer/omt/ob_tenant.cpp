@@ -18,6 +18,8 @@
 #include "lib/time/ob_time_utility.h"
 #include "lib/stat/ob_diagnose_info.h"
 #include "lib/stat/ob_session_stat.h"
+#include "lib/cpu/ob_numa.h"
+#include "lib/resource/ob_resource_mgr.h"
 #include "share/config/ob_server_config.h"
 #include "sql/engine/px/ob_px_admission.h"
 #include "share/interrupt/ob_global_interrupt_call.h"
@@ -526,6 +528,7 @@ ObTenant::ObTenant(const int64_t id,
       times_of_workers_(times_of_workers),
       unit_max_cpu_(0),
       unit_min_cpu_(0),
+      numa_node_(-1),
       slice_(0),
       slice_remain_(0),
       slice_remain_lock_(),
@@ -930,6 +933,27 @@ void ObTenant::set_unit_min_cpu(double cpu)
   }
 }
 
+void ObTenant::set_numa_node(const int64_t numa_node)
+{
+  int ret = OB_SUCCESS;
+  lib::ObTenantResourceMgrHandle resource_handle;
+  if (numa_node == ATOMIC_LOAD(&numa_node_)) {
+    // do nothing
+  } else if (OB_UNLIKELY(numa_node < -1 || numa_node >= ObNumaHelper::get_node_cnt())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("numa node not exist", K(ret), K_(id), K(numa_node),
+             "node_cnt", ObNumaHelper::get_node_cnt());
+  } else if (OB_FAIL(lib::ObResourceMgr::get_instance().get_tenant_resource_mgr(id_, resource_handle))) {
+    LOG_WARN("get tenant resource mgr failed", K(ret), K_(id));
+  } else {
+    // chunks allocated afterwards are bound to the node, and workers rebind themselves
+    // before handling the next request.
+    resource_handle.get_memory_mgr()->set_numa_node(numa_node);
+    ATOMIC_STORE(&numa_node_, numa_node);
+    LOG_INFO("set tenant numa node", K_(id), K(numa_node));
+  }
+}
+
 void ObTenant::set_token(const int64_t token)
 {
   if (token >= 0) {
@@ -432,6 +432,9 @@ public:
   double unit_max_cpu() const;
   void set_unit_min_cpu(double cpu);
   double unit_min_cpu() const;
+  // bind workers and memstore, kvcache, work area memory to the numa node, -1 to unbind
+  void set_numa_node(const int64_t numa_node);
+  int64_t get_numa_node() const { return ATOMIC_LOAD(&numa_node_); }
   void set_token(const int64_t token);
   void set_sug_token(const int64_t token);
   int64_t token_cnt() const;
@@ -583,6 +586,8 @@ protected:
   // max/min cpu read from unit
   double unit_max_cpu_;
   double unit_min_cpu_;
+  // numa node the tenant is bound to, -1 if not bound
+  int64_t numa_node_;
 
   // tenant slice, it is calculated by quota. The slice is the average
   // number of token a tenant can get in every 10ms.
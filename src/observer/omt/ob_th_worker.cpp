@@ -21,6 +21,7 @@
 #include "lib/allocator/ob_page_manager.h"
 #include "lib/rc/context.h"
 #include "lib/thread/ob_thread_name.h"
+#include "lib/cpu/ob_numa.h"
 #include "ob_tenant.h"
 #include "ob_worker_processor.h"
 #include "share/config/ob_server_config.h"
@@ -52,7 +53,7 @@ ObThWorker::ObThWorker()
       query_start_time_(0), last_check_time_(0),
       can_retry_(true), need_retry_(false),
       active_(false), waiting_active_(false),
-      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false)
+      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false), numa_node_(-1)
 {
 }
 
@@ -380,6 +381,15 @@ void ObThWorker::worker(int64_t &tenant_id, int64_t &req_recv_timestamp, int32_t
           GCTX.cgroup_ctrl_->add_thread_to_cgroup(get_tid(), tenant_->id(), get_group_id());
           has_add_to_cgroup_ = true;
         }
+        if (OB_UNLIKELY(numa_node_ != tenant_->get_numa_node())) {
+          const int64_t numa_node = tenant_->get_numa_node();
+          int tmp_ret = OB_SUCCESS;
+          if (OB_SUCCESS != (tmp_ret = ObNumaHelper::bind_thread_to_node(numa_node))) {
+            LOG_WARN("bind worker to numa node failed", K(tmp_ret), K(numa_node));
+          }
+          // don't retry on failure, avoid binding for every request
+          numa_node_ = numa_node;
+        }
         if (OB_LIKELY(pm != nullptr)) {
           if (pm->get_used() != 0) {
             LOG_ERROR("page manager's used should be 0, unexpected!!!", KP(pm));
@@ -142,6 +142,8 @@ private:
   int64_t active_inactive_ts_;
   bool lq_token_;
   bool has_add_to_cgroup_;
+  // numa node the thread is bound to, kept after reset since it's the thread's affinity
+  int64_t numa_node_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObThWorker);
@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "observer/virtual_table/ob_all_virtual_kvcache_miss_ratio_curve.h"
+namespace oceanbase
+{
+namespace observer
+{
+ObAllVirtualKVCacheMissRatioCurve::ObAllVirtualKVCacheMissRatioCurve()
+  : addr_(nullptr),
+    ipstr_(),
+    port_(0),
+    opened_(false),
+    inst_handles_(),
+    inst_idx_(0),
+    point_idx_(0)
+{
+}
+ObAllVirtualKVCacheMissRatioCurve::~ObAllVirtualKVCacheMissRatioCurve()
+{
+  reset();
+}
+void ObAllVirtualKVCacheMissRatioCurve::reset()
+{
+  ObVirtualTableScannerIterator::reset();
+  addr_ = nullptr;
+  ipstr_.reset();
+  port_ = 0;
+  opened_ = false;
+  inst_handles_.reset();
+  inst_idx_ = 0;
+  point_idx_ = 0;
+}
+int ObAllVirtualKVCacheMissRatioCurve::inner_get_next_row(ObNewRow *&row)
+{
+  INIT_SUCC(ret);
+  if (OB_FAIL(process_row())) {
+    if (OB_ITER_END != ret) {
+      SERVER_LOG(WARN, "Fail to process row", K(ret));
+    }
+  } else {
+    row = &cur_row_;
+    if (++point_idx_ >= ObKVCacheMissRatioCurve::CURVE_POINT_NUM) {
+      point_idx_ = 0;
+      ++inst_idx_;
+    }
+  }
+  return ret;
+}
+int ObAllVirtualKVCacheMissRatioCurve::set_ip()
+{
+  INIT_SUCC(ret);
+  char ipbuf[common::OB_IP_STR_BUFF];
+  if (nullptr == addr_) {
+    ret = OB_ENTRY_NOT_EXIST;
+    SERVER_LOG(WARN, "Null address", K(ret), KP(addr_));
+  } else if (!addr_->ip_to_string(ipbuf, sizeof(ipbuf))) {
+    ret = OB_ERR_UNEXPECTED;
+    SERVER_LOG(ERROR, "Fail to cast ip to string", K(ret));
+  } else {
+    ipstr_ = ObString::make_string(ipbuf);
+    port_ = addr_->get_port();
+    if (OB_FAIL(ob_write_string(*allocator_, ipstr_, ipstr_))) {
+      SERVER_LOG(WARN, "Failed to write string", K(ret));
+    }
+  }
+  return ret;
+}
+int ObAllVirtualKVCacheMissRatioCurve::inner_open()
+{
+  INIT_SUCC(ret);
+  if (OB_UNLIKELY(opened_)) {
+    ret = OB_ERR_UNEXPECTED;
+    SERVER_LOG(WARN, "Unexpected opened", K(opened_));
+  } else if (OB_FAIL(set_ip())) {
+    SERVER_LOG(WARN, "Fail to set ip", K(ret));
+  } else if (OB_FAIL(ObKVGlobalCache::get_instance().get_all_cache_info(inst_handles_))) {
+    SERVER_LOG(WARN, "Fail to get all cache info", K(ret));
+  } else {
+    opened_ = true;
+    inst_idx_ = 0;
+    point_idx_ = 0;
+  }
+  return ret;
+}
+int ObAllVirtualKVCacheMissRatioCurve::set_number_cell(const double value, common::ObObj &cell)
+{
+  INIT_SUCC(ret);
+  char buf[MAX_DOUBLE_PRINT_SIZE];
+  number::ObNumber num;
+  MEMSET(buf, 0, MAX_DOUBLE_PRINT_SIZE);
+  if (OB_UNLIKELY(0 > snprintf(buf, MAX_DOUBLE_PRINT_SIZE, "%lf", value))) {
+    ret = OB_IO_ERROR;
+    SERVER_LOG(WARN, "snprintf fail", K(ret), K(errno), KERRNOMSG(errno));
+  } else if (OB_FAIL(num.from(buf, *allocator_))) {
+    SERVER_LOG(WARN, "Fail to cast to number", K(ret), K(value));
+  } else {
+    cell.set_number(num);
+  }
+  return ret;
+}
+int ObAllVirtualKVCacheMissRatioCurve::process_row()
+{
+  INIT_SUCC(ret);
+  ObKVCacheInst *inst = nullptr;
+  ObKVCacheMissRatioCurve *mrc = nullptr;
+  if (OB_UNLIKELY(!opened_)) {
+    ret = OB_ERR_UNEXPECTED;
+    SERVER_LOG(WARN, "Unexpected error : unopened iterator", K(ret), K(opened_));
+  } else {
+    // skip cache insts without curve, i.e. rebalance is disabled or no get is sampled
+    while (OB_SUCC(ret) && nullptr == mrc) {
+      if (inst_idx_ >= inst_handles_.count()) {
+        ret = OB_ITER_END;
+      } else if (OB_ISNULL(inst = inst_handles_.at(inst_idx_).get_inst())) {
+        ret = OB_ERR_UNEXPECTED;
+        SERVER_LOG(WARN, "Unexpected null inst", K(ret), K(inst_idx_));
+      } else if (nullptr == (mrc = ATOMIC_LOAD(&inst->mrc_)) || nullptr == inst->status_.config_) {
+        mrc = nullptr;
+        point_idx_ = 0;
+        ++inst_idx_;
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    const int64_t kv_cnt = ATOMIC_LOAD(&inst->status_.kv_cnt_);
+    const int64_t store_size = ATOMIC_LOAD(&inst->status_.store_size_);
+    const int64_t avg_item_size = kv_cnt > 0 ? store_size / kv_cnt : 0;
+    cur_row_.count_ = reserved_column_cnt_;
+    for (int64_t cell_idx = 0 ; OB_SUCC(ret) && cell_idx < output_column_ids_.count() ; ++cell_idx) {
+      uint64_t col_id = output_column_ids_.at(cell_idx);
+      switch (col_id) {
+        case SVR_IP : {
+          cur_row_.cells_[cell_idx].set_varchar(ipstr_);
+          cur_row_.cells_[cell_idx].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+          break;
+        }
+        case SVR_PORT : {
+          cur_row_.cells_[cell_idx].set_int(port_);
+          break;
+        }
+        case TENANT_ID : {
+          cur_row_.cells_[cell_idx].set_int(inst->tenant_id_);
+          break;
+        }
+        case CACHE_ID : {
+          cur_row_.cells_[cell_idx].set_int(inst->cache_id_);
+          break;
+        }
+        case CACHE_NAME : {
+          cur_row_.cells_[cell_idx].set_varchar(inst->status_.config_->cache_name_);
+          cur_row_.cells_[cell_idx].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+          break;
+        }
+        case CACHE_SIZE : {
+          cur_row_.cells_[cell_idx].set_int(store_size);
+          break;
+        }
+        case REBALANCE_WEIGHT : {
+          ret = set_number_cell(inst->status_.rebalance_weight_, cur_row_.cells_[cell_idx]);
+          break;
+        }
+        case MARGINAL_UTILITY : {
+          ret = set_number_cell(inst->status_.marginal_utility_, cur_row_.cells_[cell_idx]);
+          break;
+        }
+        case POINT_ID : {
+          cur_row_.cells_[cell_idx].set_int(point_idx_);
+          break;
+        }
+        case POINT_CACHE_SIZE : {
+          // unknown before any kv is put
+          cur_row_.cells_[cell_idx].set_int(avg_item_size > 0
+              ? (point_idx_ + 1) * mrc->get_point_size(avg_item_size) : 0);
+          break;
+        }
+        case POINT_HIT_RATIO : {
+          ret = set_number_cell(mrc->get_hit_ratio(point_idx_), cur_row_.cells_[cell_idx]);
+          break;
+        }
+        default:
+          ret = OB_ERR_UNEXPECTED;
+          SERVER_LOG(WARN, "Invalid column id", K(ret), K(cell_idx), K(col_id), K(output_column_ids_));
+          break;
+      }
+    }
+  }
+  return ret;
+}
+};  // observer
+};  // oceanbase
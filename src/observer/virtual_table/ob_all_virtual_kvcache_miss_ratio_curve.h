@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OB_ALL_VIRTUAL_KVCACHE_MISS_RATIO_CURVE_H_
+#define OB_ALL_VIRTUAL_KVCACHE_MISS_RATIO_CURVE_H_
+#include "share/ob_virtual_table_scanner_iterator.h"
+#include "share/cache/ob_kv_storecache.h"
+namespace oceanbase
+{
+namespace observer
+{
+// one row per point of the miss ratio curve of each cache inst
+class ObAllVirtualKVCacheMissRatioCurve : public common::ObVirtualTableScannerIterator
+{
+public:
+  ObAllVirtualKVCacheMissRatioCurve();
+  virtual ~ObAllVirtualKVCacheMissRatioCurve();
+  virtual void reset();
+  OB_INLINE void set_addr(common::ObAddr &addr) {addr_ = &addr;}
+  virtual int inner_get_next_row(ObNewRow *&row);
+private:
+  virtual int set_ip();
+  virtual int inner_open() override;
+  int process_row();
+  int set_number_cell(const double value, common::ObObj &cell);
+private:
+  static const int64_t MAX_DOUBLE_PRINT_SIZE = 64;
+  enum CACHE_COLUMN
+  {
+    SVR_IP = common::OB_APP_MIN_COLUMN_ID,
+    SVR_PORT,
+    TENANT_ID,
+    CACHE_ID,
+    CACHE_NAME,
+    CACHE_SIZE,
+    REBALANCE_WEIGHT,
+    MARGINAL_UTILITY,
+    POINT_ID,
+    POINT_CACHE_SIZE,
+    POINT_HIT_RATIO
+  };
+  common::ObAddr *addr_;
+  common::ObString ipstr_;
+  int32_t port_;
+  bool opened_;
+  common::ObSEArray<common::ObKVCacheInstHandle, 64> inst_handles_;
+  int64_t inst_idx_;
+  int64_t point_idx_;
+  DISALLOW_COPY_AND_ASSIGN(ObAllVirtualKVCacheMissRatioCurve);
+};
+};  // observer
+};  // oceanbase
+#endif  // OB_ALL_VIRTUAL_KVCACHE_MISS_RATIO_CURVE_H_
@@ -203,6 +203,28 @@ int ObAllVirtualPalfStat::insert_log_stat_(const logservice::ObLogStat &log_stat
         cur_row_.cells_[i].set_uint64(static_cast<uint64_t>(palf_stat.max_ts_ns_));
         break;
       }
+      case OB_APP_MIN_COLUMN_ID + 18: {
+        cur_row_.cells_[i].set_int(palf_stat.group_commit_stat_.freeze_wait_us_);
+        break;
+      }
+      case OB_APP_MIN_COLUMN_ID + 19: {
+        cur_row_.cells_[i].set_int(palf_stat.group_commit_stat_.avg_flush_cost_us_);
+        break;
+      }
+      case OB_APP_MIN_COLUMN_ID + 20: {
+        (void) palf_stat.group_commit_stat_.group_size_histogram_.to_string(group_size_histogram_buf_, VARCHAR_512);
+        cur_row_.cells_[i].set_varchar(ObString::make_string(group_size_histogram_buf_));
+        cur_row_.cells_[i].set_collation_type(ObCharset::get_default_collation(
+                                              ObCharset::get_default_charset()));
+        break;
+      }
+      case OB_APP_MIN_COLUMN_ID + 21: {
+        (void) palf_stat.group_commit_stat_.group_wait_histogram_.to_string(group_wait_histogram_buf_, VARCHAR_512);
+        cur_row_.cells_[i].set_varchar(ObString::make_string(group_wait_histogram_buf_));
+        cur_row_.cells_[i].set_collation_type(ObCharset::get_default_collation(
+                                              ObCharset::get_default_charset()));
+        break;
+      }
     }
   }
   return ret;
@@ -43,11 +43,14 @@ private:
   static const int64_t VARCHAR_32 = 32;
   static const int64_t VARCHAR_64 = 64;
   static const int64_t VARCHAR_128 = 128;
+  static const int64_t VARCHAR_512 = 512;
   char role_str_[VARCHAR_32] = {'\0'};
   char access_mode_str_[VARCHAR_32] = {'\0'};
   char ip_[common::OB_IP_PORT_STR_BUFF] = {'\0'};
   char member_list_buf_[MAX_MEMBER_LIST_LENGTH] = {'\0'};
   char config_version_buf_[VARCHAR_128] = {'\0'};
+  char group_size_histogram_buf_[VARCHAR_512] = {'\0'};
+  char group_wait_histogram_buf_[VARCHAR_512] = {'\0'};
   char replica_type_str_[VARCHAR_32] = {'\0'};
   omt::ObMultiTenant *omt_;
 };
@@ -338,6 +338,10 @@ int ObAllVirtualMemstoreInfo::process_curr_tenant(ObNewRow *&row)
           cur_row_.cells_[i].set_varchar(freeze_time_dist_);
           cur_row_.cells_[i].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
           break;
+        case OB_APP_MIN_COLUMN_ID + 24:
+          // read_amplification_compact_count
+          cur_row_.cells_[i].set_int(mt->get_read_amplification_compact_cnt());
+          break;
         default:
           ret = OB_ERR_UNEXPECTED;
           SERVER_LOG(WARN, "invalid col_id", K(ret), K(col_id));
@@ -14,6 +14,9 @@
 
 #include "ob_all_virtual_sys_stat.h"
 #include "lib/ob_running_mode.h"
+#include "lib/alloc/ob_malloc_allocator.h"
+#include "lib/alloc/object_mgr.h"
+#include "lib/resource/ob_resource_mgr.h"
 #include "observer/ob_server_struct.h"
 #include "observer/ob_server.h"
 #include "observer/omt/ob_multi_tenant.h"
@@ -189,6 +192,25 @@ int ObAllVirtualSysStat::update_all_stats_(const int64_t tenant_id, ObStatEventS
         (OB_SYS_TENANT_ID == tenant_id) ? lib::AChunkMgr::instance().get_freelist_hold() : 0;
     stat_events.get(ObStatEventIds::IS_MINI_MODE - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
         (OB_SYS_TENANT_ID == tenant_id) ? (lib::is_mini_mode() ? 1 : 0) : -1;
+    stat_events.get(ObStatEventIds::MALLOC_THREAD_CACHE_SIZE - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
+        (OB_SYS_TENANT_ID == tenant_id) ? lib::ObjectThreadCache::get_cached_bytes() : 0;
+    if (NULL != lib::ObMallocAllocator::get_instance()) {
+      int64_t tc_hit_cnt = 0;
+      int64_t tc_miss_cnt = 0;
+      lib::ObMallocAllocator::get_instance()->get_tenant_thread_cache_stat(tenant_id, tc_hit_cnt, tc_miss_cnt);
+      stat_events.get(ObStatEventIds::MALLOC_THREAD_CACHE_HIT - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_
+          = tc_hit_cnt;
+      stat_events.get(ObStatEventIds::MALLOC_THREAD_CACHE_MISS - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_
+          = tc_miss_cnt;
+    }
+    // chunks are bound with MPOL_PREFERRED, the bound memory may be resident on other nodes
+    lib::ObTenantResourceMgrHandle resource_handle;
+    if (OB_SUCCESS == lib::ObResourceMgr::get_instance().get_tenant_resource_mgr(tenant_id, resource_handle)) {
+      stat_events.get(ObStatEventIds::NUMA_NODE - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_
+          = resource_handle.get_memory_mgr()->get_numa_node();
+      stat_events.get(ObStatEventIds::NUMA_BOUND_MEMORY_SIZE - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_
+          = resource_handle.get_memory_mgr()->get_numa_bound_hold();
+    }
 
     int ret_bk = ret;
     if (NULL != GCTX.omt_) {
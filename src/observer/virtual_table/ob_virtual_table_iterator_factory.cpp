@@ -185,6 +185,7 @@
 #include "observer/virtual_table/ob_tenant_virtual_privilege.h"
 #include "observer/virtual_table/ob_information_query_response_time.h"
 #include "observer/virtual_table/ob_all_virtual_kvcache_handle_leak_info.h"
+#include "observer/virtual_table/ob_all_virtual_kvcache_miss_ratio_curve.h"
 #include "observer/virtual_table/ob_all_virtual_schema_memory.h"
 #include "observer/virtual_table/ob_all_virtual_schema_slot.h"
 #include "rootserver/virtual_table/ob_all_virtual_ls_replica_task_plan.h"
@@ -1269,6 +1270,16 @@ int ObVTIterCreator::create_vt_iter(ObVTableScanParam &params,
             }
             break;
           }
+          case OB_ALL_VIRTUAL_KVCACHE_MISS_RATIO_CURVE_TID: {
+            ObAllVirtualKVCacheMissRatioCurve *miss_ratio_curve_table = nullptr;
+            if (OB_FAIL(NEW_VIRTUAL_TABLE(ObAllVirtualKVCacheMissRatioCurve, miss_ratio_curve_table))) {
+              SERVER_LOG(ERROR, "Fail to create __all_virtual_kvcache_miss_ratio_curve table", K(ret));
+            } else {
+              miss_ratio_curve_table->set_addr(addr_);
+              vt_iter = static_cast<ObVirtualTableIterator *>(miss_ratio_curve_table);
+            }
+            break;
+          }
           case OB_ALL_VIRTUAL_CONCURRENCY_OBJECT_POOL_TID: {
             ObAllConcurrencyObjectPool *object_pool = NULL;
             if (OB_SUCC(NEW_VIRTUAL_TABLE(ObAllConcurrencyObjectPool, object_pool))) {
@@ -124,6 +124,7 @@ int ObTenantArchiveRoundAttr::parse_from(common::sqlclient::ObMySQLResult &resul
 
   ObString comment;
   ObString path;
+  ObString compression;
   char status_str[OB_DEFAULT_STATUS_LENTH] = "";
 
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_TENANT_ID, key_.tenant_id_, uint64_t);
@@ -139,6 +140,7 @@ int ObTenantArchiveRoundAttr::parse_from(common::sqlclient::ObMySQLResult &resul
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_BASE_PIECE_ID, base_piece_id_, int64_t);
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_USED_PIECE_ID, used_piece_id_, int64_t);
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_PIECE_SWITCH_INTERVAL, piece_switch_interval_, int64_t);
+  EXTRACT_VARCHAR_FIELD_MYSQL(result, OB_STR_COMPRESSION, compression);
 
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_FROZEN_INPUT_BYTES, frozen_input_bytes_, int64_t);
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_FROZEN_OUTPUT_BYTES, frozen_output_bytes_, int64_t);
@@ -152,6 +154,8 @@ int ObTenantArchiveRoundAttr::parse_from(common::sqlclient::ObMySQLResult &resul
   if (OB_FAIL(ret)) {
   } else if (OB_FAIL(path_.assign(path))) {
     LOG_WARN("failed to set path", K(ret), K(path));
+  } else if (OB_FAIL(compression_.assign(compression))) {
+    LOG_WARN("failed to set compression", K(ret), K(compression));
   } else if (OB_FAIL(set_compatible_version(compatible))) {
     LOG_WARN("failed to set compatible", K(ret), K(compatible));
   } else if (OB_FAIL(set_status(status_str))) {
@@ -192,6 +196,8 @@ int ObTenantArchiveRoundAttr::fill_dml(share::ObDMLSqlSplicer &dml) const
     LOG_WARN("failed to add column", K(ret));
   } else if (OB_FAIL(dml.add_column(OB_STR_PIECE_SWITCH_INTERVAL, piece_switch_interval_))) {
     LOG_WARN("failed to add column", K(ret));
+  } else if (OB_FAIL(dml.add_column(OB_STR_COMPRESSION, compression_.ptr()))) {
+    LOG_WARN("failed to add column", K(ret));
   } else if (OB_FAIL(dml.add_column(OB_STR_FROZEN_INPUT_BYTES, frozen_input_bytes_))) {
     LOG_WARN("failed to add column", K(ret));
   } else if (OB_FAIL(dml.add_column(OB_STR_FROZEN_OUTPUT_BYTES, frozen_output_bytes_))) {
@@ -239,6 +245,7 @@ int ObTenantArchiveRoundAttr::deep_copy_from(const ObTenantArchiveRoundAttr &oth
   base_piece_id_ = other.base_piece_id_;
   used_piece_id_ = other.used_piece_id_;
   piece_switch_interval_ = other.piece_switch_interval_;
+  compression_ = other.compression_;
 
   frozen_input_bytes_ = other.frozen_input_bytes_;
   frozen_output_bytes_ = other.frozen_output_bytes_;
@@ -256,7 +263,8 @@ int ObTenantArchiveRoundAttr::deep_copy_from(const ObTenantArchiveRoundAttr &oth
 }
 
 int ObTenantArchiveRoundAttr::generate_next_round(const int64_t incarnation,
-    const int64_t dest_id, const int64_t piece_switch_interval, const ObBackupPathString &path,
+    const int64_t dest_id, const int64_t piece_switch_interval,
+    const ObArchiveCompressionString &compression, const ObBackupPathString &path,
     ObTenantArchiveRoundAttr &next_round) const
 {
   int ret = OB_SUCCESS;
@@ -269,6 +277,7 @@ int ObTenantArchiveRoundAttr::generate_next_round(const int64_t incarnation,
   next_round.base_piece_id_ = used_piece_id_ + 1;
   next_round.used_piece_id_ = used_piece_id_ + 1;
   next_round.piece_switch_interval_ = piece_switch_interval;
+  next_round.compression_ = compression;
   next_round.path_ = path;
 
   return ret;
@@ -289,6 +298,7 @@ ObTenantArchiveHisRoundAttr ObTenantArchiveRoundAttr::generate_his_round() const
   his_round.base_piece_id_ = base_piece_id_;
   his_round.used_piece_id_ = used_piece_id_;
   his_round.piece_switch_interval_ = piece_switch_interval_;
+  his_round.compression_ = compression_;
   his_round.input_bytes_ = frozen_input_bytes_ + active_input_bytes_;
   his_round.output_bytes_ = frozen_output_bytes_ + active_output_bytes_;
   his_round.deleted_input_bytes_ = deleted_input_bytes_;
@@ -300,7 +310,8 @@ ObTenantArchiveHisRoundAttr ObTenantArchiveRoundAttr::generate_his_round() const
 
 int ObTenantArchiveRoundAttr::generate_initial_round(const ObTenantArchiveRoundAttr::Key &key,
     const int64_t incarnation, const int64_t dest_id, const int64_t piece_switch_interval,
-    const ObBackupPathString &path, ObTenantArchiveRoundAttr &initial_round)
+    const ObArchiveCompressionString &compression, const ObBackupPathString &path,
+    ObTenantArchiveRoundAttr &initial_round)
 {
   int ret = OB_SUCCESS;
   initial_round.key_ = key;
@@ -312,6 +323,7 @@ int ObTenantArchiveRoundAttr::generate_initial_round(const ObTenantArchiveRoundA
   initial_round.base_piece_id_ = 1;
   initial_round.used_piece_id_ = 1;
   initial_round.piece_switch_interval_ = piece_switch_interval;
+  initial_round.compression_ = compression;
   initial_round.path_ = path;
 
   return ret;
@@ -375,6 +387,7 @@ int ObTenantArchiveHisRoundAttr::parse_from(common::sqlclient::ObMySQLResult &re
 
   ObString path;
   ObString comment;
+  ObString compression;
 
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_TENANT_ID, key_.tenant_id_, uint64_t);
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_DEST_NO, key_.dest_no_, int64_t);
@@ -388,6 +401,7 @@ int ObTenantArchiveHisRoundAttr::parse_from(common::sqlclient::ObMySQLResult &re
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_BASE_PIECE_ID, base_piece_id_, int64_t);
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_USED_PIECE_ID, used_piece_id_, int64_t);
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_PIECE_SWITCH_INTERVAL, piece_switch_interval_, int64_t);
+  EXTRACT_VARCHAR_FIELD_MYSQL(result, OB_STR_COMPRESSION, compression);
 
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_INPUT_BYTES, input_bytes_, int64_t);
   EXTRACT_INT_FIELD_MYSQL(result, OB_STR_OUTPUT_BYTES, output_bytes_, int64_t);
@@ -399,6 +413,8 @@ int ObTenantArchiveHisRoundAttr::parse_from(common::sqlclient::ObMySQLResult &re
   if (OB_FAIL(ret)) {
   } else if (OB_FAIL(path_.assign(path))) {
     LOG_WARN("failed to set path", K(ret), K(path));
+  } else if (OB_FAIL(compression_.assign(compression))) {
+    LOG_WARN("failed to set compression", K(ret), K(compression));
   } else if (OB_FAIL(set_compatible_version(compatible))) {
     LOG_WARN("failed to set compatible", K(ret), K(compatible));
   } else if (OB_FAIL(comment_.assign(comment))) {
@@ -433,6 +449,8 @@ int ObTenantArchiveHisRoundAttr::fill_dml(share::ObDMLSqlSplicer &dml) const
     LOG_WARN("failed to add column", K(ret));
   } else if (OB_FAIL(dml.add_column(OB_STR_PIECE_SWITCH_INTERVAL, piece_switch_interval_))) {
     LOG_WARN("failed to add column", K(ret));
+  } else if (OB_FAIL(dml.add_column(OB_STR_COMPRESSION, compression_.ptr()))) {
+    LOG_WARN("failed to add column", K(ret));
   } else if (OB_FAIL(dml.add_column(OB_STR_INPUT_BYTES, input_bytes_))) {
     LOG_WARN("failed to add column", K(ret));
   } else if (OB_FAIL(dml.add_column(OB_STR_OUTPUT_BYTES, output_bytes_))) {
@@ -466,6 +484,7 @@ ObTenantArchiveRoundAttr ObTenantArchiveHisRoundAttr::generate_round() const
   round.base_piece_id_ = base_piece_id_;
   round.used_piece_id_ = used_piece_id_;
   round.piece_switch_interval_ = piece_switch_interval_;
+  round.compression_ = compression_;
   round.active_input_bytes_ = 0;
   round.active_output_bytes_ = 0;
   round.frozen_input_bytes_ = input_bytes_;
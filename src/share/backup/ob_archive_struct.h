@@ -102,6 +102,9 @@ struct ObArchiveRoundState
 // current round
 struct ObTenantArchiveHisRoundAttr;
 // Define dest round table row structure.
+// compressor name of an archive round, such as lz4_1.0
+typedef common::ObFixedLengthString<common::OB_MAX_COMPRESSOR_NAME_LENGTH> ObArchiveCompressionString;
+
 struct ObTenantArchiveRoundAttr final : public ObIInnerTableRow
 {
   // Define dest round key.
@@ -162,6 +165,8 @@ struct ObTenantArchiveRoundAttr final : public ObIInnerTableRow
   int64_t base_piece_id_;
   int64_t used_piece_id_;
   int64_t piece_switch_interval_; // unit: us
+  // compressor of the round, decided when the round is generated and fixed for the whole round
+  ObArchiveCompressionString compression_;
 
   int64_t frozen_input_bytes_;
   int64_t frozen_output_bytes_;
@@ -184,6 +189,7 @@ struct ObTenantArchiveRoundAttr final : public ObIInnerTableRow
     base_piece_id_ = 0;
     used_piece_id_ = 0;
     piece_switch_interval_ = 0;
+    compression_ = "none";
 
     frozen_input_bytes_ = 0;
     frozen_output_bytes_ = 0;
@@ -250,17 +256,18 @@ struct ObTenantArchiveRoundAttr final : public ObIInnerTableRow
   int deep_copy_from(const ObTenantArchiveRoundAttr &other);
   // Generate next round content from current round, with archive state 'PREPARE'.
   int generate_next_round(const int64_t incarnation, const int64_t dest_id,
-      const int64_t piece_switch_interval, const ObBackupPathString &path,
-      ObTenantArchiveRoundAttr &next_round) const;
+      const int64_t piece_switch_interval, const ObArchiveCompressionString &compression,
+      const ObBackupPathString &path, ObTenantArchiveRoundAttr &next_round) const;
   ObTenantArchiveHisRoundAttr generate_his_round() const;
   // Generate initial round, and set status to 'PREPARE'.
   static int generate_initial_round(const Key &key, const int64_t incarnation,
-      const int64_t dest_id, const int64_t piece_switch_interval, const ObBackupPathString &path,
+      const int64_t dest_id, const int64_t piece_switch_interval,
+      const ObArchiveCompressionString &compression, const ObBackupPathString &path,
       ObTenantArchiveRoundAttr &initial_round);
 
   TO_STRING_KV(K_(key), K_(incarnation), K_(dest_id), K_(round_id), K_(state), K_(start_scn),
     K_(checkpoint_scn), K_(max_scn), K_(compatible), K_(base_piece_id), K_(used_piece_id), K_(piece_switch_interval),
-    K_(frozen_input_bytes), K_(frozen_output_bytes), K_(active_input_bytes), K_(active_output_bytes),
+    K_(compression), K_(frozen_input_bytes), K_(frozen_output_bytes), K_(active_input_bytes), K_(active_output_bytes),
     K_(deleted_input_bytes), K_(deleted_output_bytes), K_(path), K_(comment));
 };
 
@@ -327,6 +334,7 @@ struct ObTenantArchiveHisRoundAttr final : public ObIInnerTableRow
   int64_t base_piece_id_;
   int64_t used_piece_id_;
   int64_t piece_switch_interval_;
+  ObArchiveCompressionString compression_;
 
   int64_t input_bytes_;
   int64_t output_bytes_;
@@ -346,6 +354,7 @@ struct ObTenantArchiveHisRoundAttr final : public ObIInnerTableRow
     base_piece_id_ = 0;
     used_piece_id_ = 0;
     piece_switch_interval_ = 0;
+    compression_ = "none";
 
     input_bytes_ = 0;
     output_bytes_ = 0;
@@ -399,7 +408,7 @@ struct ObTenantArchiveHisRoundAttr final : public ObIInnerTableRow
 
   TO_STRING_KV(K_(key), K_(incarnation), K_(dest_id), K_(start_scn), K_(checkpoint_scn),
     K_(max_scn), K_(compatible), K_(base_piece_id), K_(used_piece_id), K_(piece_switch_interval),
-    K_(input_bytes), K_(output_bytes), K_(deleted_input_bytes), K_(deleted_output_bytes),
+    K_(compression), K_(input_bytes), K_(output_bytes), K_(deleted_input_bytes), K_(deleted_output_bytes),
     K_(path), K_(comment));
 };
 
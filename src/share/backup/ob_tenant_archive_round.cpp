@@ -21,6 +21,8 @@
 #include "share/ob_tenant_info_proxy.h"
 #include "rootserver/ob_rs_event_history_table_operator.h"
 #include "share/ls/ob_ls_i_life_manager.h"
+#include "lib/compress/ob_compressor_pool.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 using namespace oceanbase;
 using namespace share;
@@ -252,6 +254,7 @@ int ObArchiveRoundHandler::prepare_new_dest_round_(const int64_t dest_no,
   bool need_lock = true;
   int64_t dest_id = 0;
   int64_t piece_switch_interval = 0;
+  ObArchiveCompressionString compression;
   ObBackupPathString dest_str;
   ObBackupDest archive_dest;
   ObTenantArchiveRoundAttr last_round;
@@ -260,6 +263,8 @@ int ObArchiveRoundHandler::prepare_new_dest_round_(const int64_t dest_no,
     LOG_WARN("failed to get dest id", K(ret));
   } else if (OB_FAIL(archive_table_op_.get_piece_switch_interval(trans, need_lock, dest_no, piece_switch_interval))) {
     LOG_WARN("failed to get piece switch interval", K(ret));
+  } else if (OB_FAIL(get_round_compression_(compression))) {
+    LOG_WARN("failed to get round compression", K(ret));
   } else if (OB_FAIL(archive_table_op_.get_archive_dest(trans, need_lock, dest_no, dest_str))) {
     LOG_WARN("failed to get archive path", K(ret));
   } else if (OB_FAIL(archive_dest.set(dest_str))) {
@@ -272,13 +277,13 @@ int ObArchiveRoundHandler::prepare_new_dest_round_(const int64_t dest_no,
         if (OB_ENTRY_NOT_EXIST == ret) {
           // This channel has not archived before.
           ObTenantArchiveRoundAttr::Key key = { tenant_id_, dest_no };
-          if (OB_FAIL(ObTenantArchiveRoundAttr::generate_initial_round(key, OB_START_INCARNATION, dest_id, piece_switch_interval, dest_str, round))) {
+          if (OB_FAIL(ObTenantArchiveRoundAttr::generate_initial_round(key, OB_START_INCARNATION, dest_id, piece_switch_interval, compression, dest_str, round))) {
             LOG_WARN("failed to generate initial round", K(ret), K(key));
           }
         } else {
           LOG_WARN("failed to get last round", K(ret), K(dest_no));
         }
-      } else if (OB_FAIL(last_round.generate_next_round(OB_START_INCARNATION, dest_id, piece_switch_interval, dest_str, round))) {
+      } else if (OB_FAIL(last_round.generate_next_round(OB_START_INCARNATION, dest_id, piece_switch_interval, compression, dest_str, round))) {
         LOG_WARN("failed to generate next round", K(ret), K(last_round));
       }
     }
@@ -287,6 +292,25 @@ int ObArchiveRoundHandler::prepare_new_dest_round_(const int64_t dest_no,
   return ret;
 }
 
+// The compressor is taken from log_archive_compress_func when the round is generated, and
+// persisted with the round, so that all the archive files of the round use the same one.
+int ObArchiveRoundHandler::get_round_compression_(ObArchiveCompressionString &compression) const
+{
+  int ret = OB_SUCCESS;
+  ObCompressorType type = INVALID_COMPRESSOR;
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id_));
+  compression = "none";
+  if (OB_UNLIKELY(!tenant_config.is_valid())) {
+    LOG_WARN("tenant config is invalid, archive without compression", K_(tenant_id));
+  } else if (OB_SUCCESS != ObCompressorPool::get_instance().get_compressor_type(
+      tenant_config->log_archive_compress_func, type)) {
+    LOG_WARN("invalid archive compressor, archive without compression", K_(tenant_id));
+  } else if (OB_FAIL(compression.assign(tenant_config->log_archive_compress_func.str()))) {
+    LOG_WARN("failed to assign compression", K(ret), K_(tenant_id));
+  }
+  return ret;
+}
+
 int ObArchiveRoundHandler::checkpoint_to(
     const ObTenantArchiveRoundAttr &old_round, 
     const ObTenantArchiveRoundAttr &new_round,
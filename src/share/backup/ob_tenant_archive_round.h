@@ -63,6 +63,7 @@ private:
   uint64_t get_exec_tenant_id_() const;
   int start_trans_(common::ObMySQLTransaction &trans);
   int prepare_new_dest_round_(const int64_t dest_no, ObMySQLTransaction &trans, ObTenantArchiveRoundAttr &round);
+  int get_round_compression_(ObArchiveCompressionString &compression) const;
   int prepare_beginning_dest_round_(const ObTenantArchiveRoundAttr &round, ObTenantArchiveRoundAttr &new_round);
   int decide_start_scn_(ARCHIVE_SCN_TYPE &start_ts);
 
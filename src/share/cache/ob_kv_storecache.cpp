@@ -12,6 +12,7 @@
 
 #define USING_LOG_PREFIX COMMON
 
+#include <algorithm>
 #include "share/cache/ob_kv_storecache.h"
 #include "share/ob_tenant_mgr.h"
 #include "share/ob_task_define.h"
@@ -126,6 +127,8 @@ void ObKVCacheIterator::reset()
  * -------------------------------------------------------ObKVGlobalCache---------------------------------------------------------------
  */
 const double ObKVGlobalCache::MAX_RESERVED_MEMORY_RATIO = 0.3;
+const double ObKVGlobalCache::MIN_REBALANCE_WEIGHT = 0.25;
+const double ObKVGlobalCache::MAX_REBALANCE_WEIGHT = 4.0;
 //TODO bucket num level map should be system parameter
 const int64_t ObKVGlobalCache::bucket_num_array_[MAX_BUCKET_NUM_LEVEL] =
     {
@@ -150,7 +153,9 @@ ObKVGlobalCache::ObKVGlobalCache()
       map_replace_pos_(0),
       map_once_replace_num_(0),
       start_destory_(false),
-      cache_wash_interval_(0)
+      cache_wash_interval_(0),
+      enable_admission_(false),
+      enable_rebalance_(false)
 {
 }
 
@@ -267,7 +272,10 @@ void ObKVGlobalCache::destroy()
     insts_.destroy();
     for (int64_t i = 0; i < MAX_CACHE_NUM; ++i) {
       configs_[i].reset();
+      sketches_[i].destroy();
     }
+    enable_admission_ = false;
+    enable_rebalance_ = false;
     cache_num_ = 0;
     mem_limit_getter_ = nullptr;
 
@@ -282,9 +290,10 @@ int ObKVGlobalCache::put(
   const ObIKVCacheValue &value,
   const ObIKVCacheValue *&pvalue,
   ObKVMemBlockHandle *&mb_handle,
-  bool overwrite)
+  bool overwrite,
+  const bool need_admission)
 {
-  return put(store_, cache_id, key, value, pvalue, mb_handle, overwrite);
+  return put(store_, cache_id, key, value, pvalue, mb_handle, overwrite, need_admission);
 }
 
 int ObKVGlobalCache::put(
@@ -319,7 +328,8 @@ int ObKVGlobalCache::put(
     const ObIKVCacheValue &value,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle,
-    bool overwrite)
+    bool overwrite,
+    const bool need_admission)
 {
   int ret = OB_SUCCESS;
   ObKVCacheInstKey inst_key(cache_id, key.get_tenant_id());
@@ -339,6 +349,8 @@ int ObKVGlobalCache::put(
   } else if (NULL == inst_handle.get_inst()) {
     ret = OB_ERR_UNEXPECTED;
     COMMON_LOG(WARN, "The inst is NULL, ", K(ret));
+  } else if (need_admission && !admit(cache_id, key, *inst_handle.get_inst())) {
+    // rejected by admission, the kv is not cached
   } else if (!overwrite && (OB_SUCC(map_.get(cache_id, key, pvalue, mb_handle)))) {
     ret = OB_ENTRY_EXIST;
   } else if (OB_FAIL(store.store(*inst_handle.get_inst(), key, value, kvpair, mb_wrapper))) {
@@ -442,6 +454,7 @@ int ObKVGlobalCache::get(
     COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
   } else {
     revert(mb_handle);
+    record_access(cache_id, key);
     if (OB_FAIL(map_.get(cache_id, key, pvalue, mb_handle))) {
       if (OB_ENTRY_NOT_EXIST != ret) {
         COMMON_LOG(WARN, "fail to get value from map, ", K(ret));
@@ -451,6 +464,26 @@ int ObKVGlobalCache::get(
   return ret;
 }
 
+int ObKVGlobalCache::read(
+  const int64_t cache_id,
+  const ObIKVCacheKey &key,
+  ObIKVCacheValueReader &reader)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
+  } else {
+    record_access(cache_id, key);
+    if (OB_FAIL(map_.read(cache_id, key, reader))) {
+      if (OB_ENTRY_NOT_EXIST != ret) {
+        COMMON_LOG(WARN, "fail to read value from map, ", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObKVGlobalCache::erase(const int64_t cache_id, const ObIKVCacheKey &key)
 {
   int ret = OB_SUCCESS;
@@ -585,6 +618,9 @@ int ObKVGlobalCache::register_cache(
         configs_[cache_id].cache_name_[MAX_CACHE_NAME_LENGTH - 1] = '\0';
         configs_[cache_id].priority_ = priority;
         configs_[cache_id].is_valid_ = true;
+        if (ATOMIC_LOAD(&enable_admission_)) {
+          init_sketch(cache_id);
+        }
       }
     }
   }
@@ -674,6 +710,9 @@ void ObKVGlobalCache::wash()
   if (OB_LIKELY(inited_ && !start_destory_)) {
     DEBUG_SYNC(BEFORE_BACKGROUND_WASH);
     static int64_t wash_count = 0;
+    if (REACH_TIME_INTERVAL(REBALANCE_INTERVAL)) {
+      rebalance();
+    }
     if (store_.wash() || (++wash_count >= MAP_WASH_CLEAN_INTERNAL)) {
       map_.clean_garbage_node(map_clean_pos_, map_once_clean_num_);
       insts_.clean_garbage_inst();
@@ -682,6 +721,234 @@ void ObKVGlobalCache::wash()
   }
 }
 
+void ObKVGlobalCache::record_access(const int64_t cache_id, const ObIKVCacheKey &key)
+{
+  const bool enable_admission = ATOMIC_LOAD(&enable_admission_);
+  const bool enable_rebalance = ATOMIC_LOAD(&enable_rebalance_);
+  if ((enable_admission || enable_rebalance) && OB_LIKELY(cache_id >= 0 && cache_id < MAX_CACHE_NUM)) {
+    const uint64_t key_hash = key.hash();
+    if (enable_admission) {
+      sketches_[cache_id].increment(key_hash);
+    }
+    if (enable_rebalance && ObKVCacheMissRatioCurve::is_sampled(key_hash)) {
+      record_sampled_access(cache_id, key.get_tenant_id(), key_hash);
+    }
+  }
+}
+
+void ObKVGlobalCache::record_sampled_access(
+    const int64_t cache_id,
+    const uint64_t tenant_id,
+    const uint64_t key_hash)
+{
+  int ret = OB_SUCCESS;
+  ObKVCacheInstHandle inst_handle;
+  ObKVCacheInst *inst = NULL;
+  ObKVCacheMissRatioCurve *mrc = NULL;
+  const ObKVCacheInstKey inst_key(cache_id, tenant_id);
+  if (OB_FAIL(insts_.get_cache_inst(inst_key, inst_handle))) {
+    COMMON_LOG(WARN, "Fail to get cache inst, ", K(ret), K(inst_key));
+  } else if (OB_ISNULL(inst = inst_handle.get_inst())) {
+    ret = OB_ERR_UNEXPECTED;
+    COMMON_LOG(WARN, "The inst is NULL, ", K(ret), K(inst_key));
+  } else if (NULL == (mrc = ATOMIC_LOAD(&inst->mrc_))) {
+    void *buf = NULL;
+    ObMemAttr attr(OB_SERVER_TENANT_ID, "KVCacheMRC");
+    if (OB_ISNULL(buf = ob_malloc(sizeof(ObKVCacheMissRatioCurve), attr))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      COMMON_LOG(WARN, "Fail to allocate memory for miss ratio curve, ", K(ret), K(inst_key));
+    } else {
+      mrc = new (buf) ObKVCacheMissRatioCurve();
+      if (!ATOMIC_BCAS(&inst->mrc_, NULL, mrc)) {
+        // allocated by other thread
+        mrc->~ObKVCacheMissRatioCurve();
+        ob_free(mrc);
+        mrc = ATOMIC_LOAD(&inst->mrc_);
+      }
+    }
+  }
+  if (OB_SUCC(ret) && NULL != mrc) {
+    mrc->record(key_hash);
+  }
+}
+
+void ObKVGlobalCache::rebalance()
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObKVCacheInstHandle, 64> inst_handles;
+  ObSEArray<RebalanceInfo, 64> infos;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
+  } else if (!ATOMIC_LOAD(&enable_rebalance_)) {
+  } else if (OB_FAIL(insts_.get_all_cache_info(inst_handles))) {
+    COMMON_LOG(WARN, "Fail to get all cache info, ", K(ret));
+  } else {
+    // marginal utility of each cache inst, the priority is not counted here since the wash
+    // score is multiplied by both the priority and the weight
+    for (int64_t i = 0; OB_SUCC(ret) && i < inst_handles.count(); ++i) {
+      ObKVCacheInst *inst = inst_handles.at(i).get_inst();
+      RebalanceInfo info;
+      if (OB_ISNULL(inst)) {
+        ret = OB_ERR_UNEXPECTED;
+        COMMON_LOG(WARN, "The inst is NULL, ", K(ret), K(i));
+      } else {
+        ObKVCacheMissRatioCurve *mrc = ATOMIC_LOAD(&inst->mrc_);
+        const int64_t kv_cnt = ATOMIC_LOAD(&inst->status_.kv_cnt_);
+        const int64_t store_size = ATOMIC_LOAD(&inst->status_.store_size_);
+        double utility = -1;
+        if (NULL != mrc) {
+          mrc->resize(kv_cnt);
+          if (kv_cnt <= 0
+              || OB_SUCCESS != mrc->get_marginal_utility(store_size, store_size / kv_cnt, utility)) {
+            utility = -1;
+          }
+          mrc->decay();
+        }
+        inst->status_.marginal_utility_ = utility;
+        info.inst_ = inst;
+        info.utility_ = utility;
+        if (OB_FAIL(infos.push_back(info))) {
+          COMMON_LOG(WARN, "Fail to push back rebalance info, ", K(ret));
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      update_rebalance_weight(infos);
+    }
+    COMMON_LOG(INFO, "finish kvcache rebalance", K(ret), "inst_cnt", inst_handles.count());
+  }
+}
+
+void ObKVGlobalCache::update_rebalance_weight(ObIArray<RebalanceInfo> &infos)
+{
+  if (infos.count() > 0) {
+    RebalanceInfo *first = &infos.at(0);
+    std::sort(first, first + infos.count(), [](const RebalanceInfo &left, const RebalanceInfo &right) {
+      return left.inst_->tenant_id_ < right.inst_->tenant_id_;
+    });
+  }
+  // caches gaining more hits per MB than the average of the tenant get larger weight,
+  // caches without enough samples drift back to the neutral weight
+  int64_t end = 0;
+  for (int64_t begin = 0; begin < infos.count(); begin = end) {
+    const uint64_t tenant_id = infos.at(begin).inst_->tenant_id_;
+    double sum_utility = 0;
+    int64_t utility_cnt = 0;
+    for (end = begin; end < infos.count() && infos.at(end).inst_->tenant_id_ == tenant_id; ++end) {
+      if (infos.at(end).utility_ >= 0) {
+        sum_utility += infos.at(end).utility_;
+        ++utility_cnt;
+      }
+    }
+    for (int64_t i = begin; i < end; ++i) {
+      ObKVCacheInst *inst = infos.at(i).inst_;
+      double target_weight = 1.0;
+      if (utility_cnt > 1 && infos.at(i).utility_ >= 0 && sum_utility > 0) {
+        target_weight = infos.at(i).utility_ * double(utility_cnt) / sum_utility;
+        target_weight = MAX(MIN_REBALANCE_WEIGHT, MIN(MAX_REBALANCE_WEIGHT, target_weight));
+      }
+      // move half way each time to avoid oscillation
+      inst->status_.rebalance_weight_ = (inst->status_.rebalance_weight_ + target_weight) / 2;
+    }
+  }
+}
+
+void ObKVGlobalCache::reset_rebalance_weight()
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObKVCacheInstHandle, 64> inst_handles;
+  if (OB_FAIL(insts_.get_all_cache_info(inst_handles))) {
+    COMMON_LOG(WARN, "Fail to get all cache info, ", K(ret));
+  } else {
+    for (int64_t i = 0; i < inst_handles.count(); ++i) {
+      ObKVCacheInst *inst = inst_handles.at(i).get_inst();
+      if (NULL != inst) {
+        inst->status_.rebalance_weight_ = 1.0;
+        inst->status_.marginal_utility_ = -1;
+      }
+    }
+  }
+}
+
+bool ObKVGlobalCache::admit(const int64_t cache_id, const ObIKVCacheKey &key)
+{
+  int ret = OB_SUCCESS;
+  bool bool_ret = true;
+  ObKVCacheInstHandle inst_handle;
+  const ObKVCacheInstKey inst_key(cache_id, key.get_tenant_id());
+  if (!ATOMIC_LOAD(&enable_admission_)) {
+    // skip looking up the inst when admission is off
+  } else if (OB_FAIL(insts_.get_cache_inst(inst_key, inst_handle))) {
+    COMMON_LOG(WARN, "Fail to get cache inst, ", K(ret), K(inst_key));
+  } else if (OB_ISNULL(inst_handle.get_inst())) {
+    ret = OB_ERR_UNEXPECTED;
+    COMMON_LOG(WARN, "The inst is NULL, ", K(ret), K(inst_key));
+  } else {
+    bool_ret = admit(cache_id, key, *inst_handle.get_inst());
+  }
+  return bool_ret;
+}
+
+bool ObKVGlobalCache::admit(const int64_t cache_id, const ObIKVCacheKey &key, ObKVCacheInst &inst)
+{
+  bool bool_ret = true;
+  if (!ATOMIC_LOAD(&enable_admission_) || !ATOMIC_LOAD(&inst.status_.need_admission_)) {
+    // admit all kvs when there is enough memory
+  } else if (OB_UNLIKELY(cache_id < 0 || cache_id >= MAX_CACHE_NUM)
+             || !sketches_[cache_id].is_inited()) {
+  } else if (sketches_[cache_id].estimate(key.hash()) >= ADMISSION_FREQUENCY_THRESHOLD) {
+    inst.status_.total_admit_cnt_.inc();
+  } else {
+    // one-touch kvs, e.g. from a large scan, should not wash out hot kvs
+    inst.status_.total_reject_cnt_.inc();
+    bool_ret = false;
+  }
+  return bool_ret;
+}
+
+void ObKVGlobalCache::reload_admission()
+{
+  const bool enable_admission = GCONF._enable_kvcache_admission;
+  if (enable_admission != ATOMIC_LOAD(&enable_admission_)) {
+    lib::ObMutexGuard guard(mutex_);
+    if (enable_admission) {
+      // sketches are allocated when admission is enabled for the first time, and kept after
+      // it is disabled since concurrent gets may still be recording
+      for (int64_t i = 0; i < cache_num_; ++i) {
+        if (configs_[i].is_valid_) {
+          init_sketch(i);
+        }
+      }
+    }
+    ATOMIC_STORE(&enable_admission_, enable_admission);
+    COMMON_LOG(INFO, "success to reload kvcache admission", K(enable_admission));
+  }
+}
+
+void ObKVGlobalCache::init_sketch(const int64_t cache_id)
+{
+  int ret = OB_SUCCESS;
+  // kvs of this cache are always admitted if sketch is not inited
+  if (sketches_[cache_id].is_inited()) {
+  } else if (OB_FAIL(sketches_[cache_id].init(ObKVCacheFrequencySketch::DEFAULT_COUNTER_NUM,
+                                              "KVCacheSketch"))) {
+    COMMON_LOG(WARN, "Fail to init frequency sketch, ", K(ret), K(cache_id));
+  }
+}
+
+void ObKVGlobalCache::reload_rebalance()
+{
+  const bool enable_rebalance = GCONF._enable_kvcache_rebalance;
+  if (enable_rebalance != ATOMIC_LOAD(&enable_rebalance_)) {
+    ATOMIC_STORE(&enable_rebalance_, enable_rebalance);
+    if (!enable_rebalance && inited_) {
+      reset_rebalance_weight();
+    }
+    COMMON_LOG(INFO, "success to reload kvcache rebalance", K(enable_rebalance));
+  }
+}
+
 void ObKVGlobalCache::replace_map()
 {
   if (inited_ && !start_destory_) {
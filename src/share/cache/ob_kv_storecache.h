@@ -24,6 +24,7 @@
 #include "share/cache/ob_kvcache_inst_map.h"
 #include "share/cache/ob_kvcache_map.h"
 #include "share/cache/ob_working_set_mgr.h"
+#include "share/cache/ob_kvcache_admission.h"
 #include "sql/optimizer/ob_opt_default_stat.h"
 
 
@@ -51,6 +52,9 @@ public:
   virtual int alloc(const uint64_t tenant_id, const int64_t key_size, const int64_t value_size,
       ObKVCachePair *&kvpair, ObKVCacheHandle &handle, ObKVCacheInstHandle &inst_handle) = 0;
   virtual int put_kvpair(ObKVCacheInstHandle &inst_handle, ObKVCachePair *kvpair, ObKVCacheHandle &handle, bool overwrite = true);
+  // Whether the kv of key should be cached, callers of alloc/put_kvpair check it before alloc
+  // and keep the value out of cache if rejected.
+  virtual bool admit(const Key &key) { UNUSED(key); return true; }
 };
 
 template <class Key, class Value>
@@ -70,6 +74,11 @@ public:
     ObKVCacheHandle &handle,
     bool overwrite = true);
   virtual int get(const Key &key, const Value *&pvalue, ObKVCacheHandle &handle);
+  // Read the value of key in place by reader, no handle is returned, so the shared ref count
+  // of memblock is not touched. Preferred for short reads of hot kvs, the value must not be
+  // used after reader.read() returns. Callers that keep referencing the value, e.g. the row
+  // and fuse row caches whose datums are read by the iterators in place, must use get().
+  int read(const Key &key, ObIKVCacheValueReader &reader);
   int get_iterator(ObKVCacheIterator &iter);
   virtual int erase(const Key &key);
   virtual int alloc(
@@ -79,6 +88,7 @@ public:
       ObKVCachePair *&kvpair,
       ObKVCacheHandle &handle,
       ObKVCacheInstHandle &inst_handle) override;
+  virtual bool admit(const Key &key) override;
   int64_t size(const uint64_t tenant_id = OB_SYS_TENANT_ID) const;
   int64_t count(const uint64_t tenant_id = OB_SYS_TENANT_ID) const;
   int64_t get_hit_cnt(const uint64_t tenant_id = OB_SYS_TENANT_ID) const;
@@ -139,6 +149,8 @@ public:
   void destroy();
   void reload_priority();
   int reload_wash_interval();
+  void reload_admission();
+  void reload_rebalance();
   int64_t get_suitable_bucket_num();
   int get_tenant_cache_info(const uint64_t tenant_id, ObIArray<ObKVCacheInstHandle> &inst_handles);
   int get_all_cache_info(ObIArray<ObKVCacheInstHandle> &inst_handles);
@@ -179,7 +191,8 @@ private:
     const ObIKVCacheValue &value,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle,
-    bool overwrite = true);
+    bool overwrite = true,
+    const bool need_admission = false);
   int put(
     ObWorkingSet *working_set,
     const ObIKVCacheKey &key,
@@ -195,7 +208,8 @@ private:
     const ObIKVCacheValue &value,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle,
-    bool overwrite = true);
+    bool overwrite = true,
+    const bool need_admission = false);
   int alloc(
       const int64_t cache_id,
       const uint64_t tenant_id,
@@ -227,11 +241,39 @@ private:
     const ObIKVCacheKey &key,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle);
+  int read(
+    const int64_t cache_id,
+    const ObIKVCacheKey &key,
+    ObIKVCacheValueReader &reader);
   int erase(const int64_t cache_id, const ObIKVCacheKey &key);
   void revert(ObKVMemBlockHandle *mb_handle);
   void wash();
   void replace_map();
   int get_cache_id(const char *cache_name, int64_t &cache_id);
+  // TinyLFU admission, the access frequency of keys is recorded on get, and when the
+  // tenant cache is being washed, only keys accessed more than once recently are put.
+  void record_access(const int64_t cache_id, const ObIKVCacheKey &key);
+  bool admit(const int64_t cache_id, const ObIKVCacheKey &key);
+  bool admit(const int64_t cache_id, const ObIKVCacheKey &key, ObKVCacheInst &inst);
+  // must be called under mutex_
+  void init_sketch(const int64_t cache_id);
+  // Memory rebalance, the miss ratio curve of each cache instance is estimated from
+  // sampled gets, and the wash score of caches gaining more hits per MB is weighted up
+  // periodically, so memory of the tenant shifts toward them.
+  struct RebalanceInfo
+  {
+    RebalanceInfo() : inst_(NULL), utility_(-1) {}
+    TO_STRING_KV(KP_(inst), K_(utility));
+    ObKVCacheInst *inst_;
+    double utility_; // negative if the curve has no estimate
+  };
+  void rebalance();
+  // move the weight of each cache inst toward its utility relative to the other insts of
+  // the same tenant, infos are sorted by tenant
+  static void update_rebalance_weight(ObIArray<RebalanceInfo> &infos);
+  void record_sampled_access(const int64_t cache_id, const uint64_t tenant_id,
+                             const uint64_t key_hash);
+  void reset_rebalance_weight();
 private:
   static const int64_t DEFAULT_BUCKET_NUM = 10000000L;
   static const int64_t DEFAULT_MAX_CACHE_SIZE = 1024L * 1024L * 1024L * 1024L;  //1T
@@ -247,6 +289,10 @@ private:
   static const int64_t bucket_num_array_[MAX_BUCKET_NUM_LEVEL];
   static const int64_t PRINT_INTERVAL = 30 * 1000L * 1000L;
   static const int64_t MAP_WASH_CLEAN_INTERNAL = 10;
+  static const int64_t ADMISSION_FREQUENCY_THRESHOLD = 2;
+  static const int64_t REBALANCE_INTERVAL = 10 * 1000L * 1000L;
+  static const double  MIN_REBALANCE_WEIGHT;
+  static const double  MAX_REBALANCE_WEIGHT;
 private:
   class KVStoreWashTask: public ObTimerTask
   {
@@ -304,6 +350,10 @@ private:
   KVMapReplaceTask replace_task_;
   bool start_destory_;
   int64_t cache_wash_interval_;
+  // frequency sketch of each cache, used by admission
+  ObKVCacheFrequencySketch sketches_[MAX_CACHE_NUM];
+  bool enable_admission_;
+  bool enable_rebalance_;
 };
 
 
@@ -551,7 +601,7 @@ int ObKVCache<Key, Value>::put(const Key &key, const Value &value, bool overwrit
     ret = OB_NOT_INIT;
     COMMON_LOG(WARN, "The ObKVCache has not been inited, ", K(ret));
   } else if (OB_FAIL(ObKVGlobalCache::get_instance().put(cache_id_, key, value, pvalue,
-      handle.mb_handle_, overwrite))) {
+      handle.mb_handle_, overwrite, true /*need_admission*/))) {
     if (OB_ENTRY_EXIST != ret) {
       COMMON_LOG(WARN, "Fail to put kv to ObKVGlobalCache, ", K_(cache_id), K(ret));
     }
@@ -615,6 +665,21 @@ int ObKVCache<Key, Value>::get(const Key &key, const Value *&pvalue, ObKVCacheHa
   return ret;
 }
 
+template <class Key, class Value>
+int ObKVCache<Key, Value>::read(const Key &key, ObIKVCacheValueReader &reader)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCache has not been inited, ", K(ret));
+  } else if (OB_FAIL(ObKVGlobalCache::get_instance().read(cache_id_, key, reader))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      COMMON_LOG(WARN, "Fail to read value from ObKVGlobalCache, ", K(ret));
+    }
+  }
+  return ret;
+}
+
 template <class Key, class Value>
 int ObKVCache<Key, Value>::erase(const Key &key)
 {
@@ -656,6 +721,12 @@ int ObKVCache<Key, Value>::alloc(const uint64_t tenant_id, const int64_t key_siz
 }
 
 
+template <class Key, class Value>
+bool ObKVCache<Key, Value>::admit(const Key &key)
+{
+  return !inited_ || ObKVGlobalCache::get_instance().admit(cache_id_, key);
+}
+
 template <class Key, class Value>
 int64_t ObKVCache<Key, Value>::store_size(const uint64_t tenant_id) const
 {
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "share/cache/ob_kvcache_admission.h"
+#include "lib/allocator/ob_malloc.h"
+#include "lib/utility/utility.h"
+
+namespace oceanbase
+{
+namespace common
+{
+const uint64_t ObKVCacheFrequencySketch::SEEDS[DEPTH] = {
+  0xc3a5c85c97cb3127UL, 0xb492b66fbe98f273UL, 0x9ae16a3b2f90404fUL, 0xcbf29ce484222325UL };
+
+ObKVCacheFrequencySketch::ObKVCacheFrequencySketch()
+  : inited_(false),
+    table_(NULL),
+    table_size_(0),
+    sample_size_(0),
+    size_(0),
+    reset_cnt_(0)
+{
+}
+
+ObKVCacheFrequencySketch::~ObKVCacheFrequencySketch()
+{
+  destroy();
+}
+
+int ObKVCacheFrequencySketch::init(const int64_t counter_num, const lib::ObLabel &label)
+{
+  int ret = OB_SUCCESS;
+  ObMemAttr attr;
+  attr.label_ = label;
+  if (OB_UNLIKELY(inited_)) {
+    ret = OB_INIT_TWICE;
+    COMMON_LOG(WARN, "The ObKVCacheFrequencySketch has been inited, ", K(ret));
+  } else if (OB_UNLIKELY(counter_num < COUNTERS_PER_WORD) || OB_UNLIKELY(!label.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument, ", K(counter_num), K(label), K(ret));
+  } else {
+    // table size must be power of 2 to locate counters by mask
+    const int64_t table_size = next_pow2(counter_num / COUNTERS_PER_WORD);
+    if (NULL == (table_ = static_cast<uint64_t *>(ob_malloc(sizeof(uint64_t) * table_size, attr)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      COMMON_LOG(WARN, "Fail to allocate memory for frequency sketch, ", K(table_size), K(ret));
+    } else {
+      MEMSET(table_, 0, sizeof(uint64_t) * table_size);
+      table_size_ = table_size;
+      sample_size_ = table_size * SAMPLE_FACTOR;
+      size_ = 0;
+      reset_cnt_ = 0;
+      inited_ = true;
+    }
+  }
+  return ret;
+}
+
+void ObKVCacheFrequencySketch::destroy()
+{
+  if (NULL != table_) {
+    ob_free(table_);
+    table_ = NULL;
+  }
+  table_size_ = 0;
+  sample_size_ = 0;
+  size_ = 0;
+  reset_cnt_ = 0;
+  inited_ = false;
+}
+
+// hash of some cache keys is weak, mix it before locating counters
+OB_INLINE uint64_t ObKVCacheFrequencySketch::spread(const uint64_t hash)
+{
+  uint64_t h = hash;
+  h ^= (h >> 33);
+  h *= 0xff51afd7ed558ccdUL;
+  h ^= (h >> 33);
+  return h;
+}
+
+OB_INLINE int64_t ObKVCacheFrequencySketch::index_of(const uint64_t hash, const int64_t depth) const
+{
+  uint64_t h = (hash + SEEDS[depth]) * SEEDS[depth];
+  h += (h >> 32);
+  return static_cast<int64_t>(h & (table_size_ - 1));
+}
+
+void ObKVCacheFrequencySketch::increment(const uint64_t key_hash)
+{
+  if (OB_LIKELY(inited_)) {
+    bool added = false;
+    const uint64_t hash = spread(key_hash);
+    // 4 counters of one key are in 4 different words, with different offsets in word
+    const int64_t start = static_cast<int64_t>((hash >> 60) & 3) << 2;
+    for (int64_t i = 0; i < DEPTH; ++i) {
+      const int64_t idx = index_of(hash, i);
+      const int64_t shift = (start + i) << 2;
+      const uint64_t old_word = ATOMIC_LOAD(&table_[idx]);
+      if (((old_word >> shift) & 0xF) < MAX_FREQUENCY) {
+        added |= ATOMIC_BCAS(&table_[idx], old_word, old_word + (1UL << shift));
+      }
+    }
+    if (added && ATOMIC_AAF(&size_, 1) == sample_size_) {
+      reset();
+    }
+  }
+}
+
+int64_t ObKVCacheFrequencySketch::estimate(const uint64_t key_hash) const
+{
+  int64_t frequency = 0;
+  if (OB_LIKELY(inited_)) {
+    const uint64_t hash = spread(key_hash);
+    frequency = MAX_FREQUENCY;
+    const int64_t start = static_cast<int64_t>((hash >> 60) & 3) << 2;
+    for (int64_t i = 0; i < DEPTH; ++i) {
+      const int64_t idx = index_of(hash, i);
+      const int64_t shift = (start + i) << 2;
+      const int64_t count = static_cast<int64_t>((ATOMIC_LOAD(&table_[idx]) >> shift) & 0xF);
+      frequency = MIN(frequency, count);
+    }
+  }
+  return frequency;
+}
+
+// Aging, halve all counters, only the thread which makes size_ reach sample_size_ does it.
+void ObKVCacheFrequencySketch::reset()
+{
+  for (int64_t i = 0; i < table_size_; ++i) {
+    uint64_t old_word = ATOMIC_LOAD(&table_[i]);
+    while (!ATOMIC_BCAS(&table_[i], old_word, (old_word >> 1) & RESET_MASK)) {
+      old_word = ATOMIC_LOAD(&table_[i]);
+    }
+  }
+  ATOMIC_SAF(&size_, sample_size_ / 2);
+  ATOMIC_INC(&reset_cnt_);
+  COMMON_LOG(INFO, "frequency sketch reset", K(*this));
+}
+
+}//end namespace common
+}//end namespace oceanbase
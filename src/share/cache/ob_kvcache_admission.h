@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_CACHE_OB_KVCACHE_ADMISSION_H_
+#define OCEANBASE_CACHE_OB_KVCACHE_ADMISSION_H_
+
+#include "share/ob_define.h"
+#include "lib/alloc/alloc_struct.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// Count-min sketch with 4-bit counters, estimates the recent access frequency of keys.
+// All counters are halved once the number of increments reaches the sample size, so
+// the frequency of keys which are not accessed any more decays over time.
+// Counters are updated without lock, a lost increment only makes the estimate a little
+// smaller, which is acceptable for admission.
+class ObKVCacheFrequencySketch
+{
+public:
+  static const int64_t DEFAULT_COUNTER_NUM = 1L << 20;
+  static const int64_t MAX_FREQUENCY = 15;
+  ObKVCacheFrequencySketch();
+  virtual ~ObKVCacheFrequencySketch();
+  int init(const int64_t counter_num, const lib::ObLabel &label);
+  void destroy();
+  bool is_inited() const { return inited_; }
+  void increment(const uint64_t key_hash);
+  int64_t estimate(const uint64_t key_hash) const;
+  TO_STRING_KV(K_(inited), KP_(table), K_(table_size), K_(sample_size), K_(size), K_(reset_cnt));
+private:
+  static const int64_t DEPTH = 4;
+  static const int64_t COUNTERS_PER_WORD = 16;
+  static const int64_t SAMPLE_FACTOR = 10;
+  static const uint64_t SEEDS[DEPTH];
+  static const uint64_t RESET_MASK = 0x7777777777777777UL;
+  OB_INLINE static uint64_t spread(const uint64_t hash);
+  OB_INLINE int64_t index_of(const uint64_t hash, const int64_t depth) const;
+  void reset();
+private:
+  bool inited_;
+  uint64_t *table_;
+  int64_t table_size_;
+  int64_t sample_size_;
+  int64_t size_;
+  int64_t reset_cnt_;
+  DISALLOW_COPY_AND_ASSIGN(ObKVCacheFrequencySketch);
+};
+
+}//end namespace common
+}//end namespace oceanbase
+
+#endif //OCEANBASE_CACHE_OB_KVCACHE_ADMISSION_H_
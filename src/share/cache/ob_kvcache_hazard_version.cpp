@@ -247,6 +247,8 @@ int GlobalHazardVersion::acquire()
     while (ts->get_acquired_version() != ATOMIC_LOAD(&version_)) {
       ts->set_acquired_version(version_);
     }
+    // make acquired version visible before reading shared memory, see wait_quiescent()
+    MEM_BARRIER();
   } 
 
   return ret;
@@ -299,6 +301,44 @@ int GlobalHazardVersion::retire()
   return ret;
 }
 
+int GlobalHazardVersion::wait_quiescent(const int64_t timeout_us)
+{
+  int ret = OB_SUCCESS;
+  static const int64_t CHECK_TIMEOUT_INTERVAL = 1024;
+
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "This HazardVersion is not inited", K(ret), K(inited_));
+  } else if (OB_UNLIKELY(timeout_us < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument", K(ret), K(timeout_us));
+  } else {
+    // The calling thread may hold a version itself, skip it to avoid waiting for ourself.
+    const KVCacheHazardThreadStore *self = static_cast<KVCacheHazardThreadStore *>(pthread_getspecific(ts_key_));
+    // Threads acquire after this will get a bigger version, only wait for the ones before.
+    const uint64_t version = ATOMIC_FAA(&version_, 1);
+    const int64_t start = ObTimeUtility::current_time();
+    int64_t spin_cnt = 0;
+    KVCacheHazardThreadStore *ts = ATOMIC_LOAD(&thread_stores_);
+    while (OB_SUCC(ret) && nullptr != ts) {
+      if (self != ts) {
+        while (OB_SUCC(ret) && ts->get_acquired_version() <= version) {
+          PAUSE();
+          if (0 == (++spin_cnt % CHECK_TIMEOUT_INTERVAL)
+              && ObTimeUtility::current_time() - start > timeout_us) {
+            ret = OB_TIMEOUT;
+            COMMON_LOG(WARN, "Wait hazard version quiescent timeout", K(ret), K(timeout_us),
+                       K(version), "thread_id", ts->get_thread_id());
+          }
+        }
+      }
+      ts = ts->get_next();
+    }
+  }
+
+  return ret;
+}
+
 int GlobalHazardVersion::get_thread_store(KVCacheHazardThreadStore *&ts)
 {
   int ret = OB_SUCCESS;
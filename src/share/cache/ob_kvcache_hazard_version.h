@@ -48,8 +48,8 @@ public:
   OB_INLINE int64_t get_thread_id() const { return thread_id_; }
   OB_INLINE int64_t get_waiting_count() const { return ATOMIC_LOAD(&waiting_nodes_count_); }
   OB_INLINE uint64_t get_last_retire_version() const { return ATOMIC_LOAD(&last_retire_version_); }
-  OB_INLINE uint64_t get_acquired_version() const { return acquired_version_; }
-  OB_INLINE void set_acquired_version(const uint64_t version) { acquired_version_ = version; }
+  OB_INLINE uint64_t get_acquired_version() const { return ATOMIC_LOAD(&acquired_version_); }
+  OB_INLINE void set_acquired_version(const uint64_t version) { ATOMIC_STORE(&acquired_version_, version); }
   OB_INLINE KVCacheHazardThreadStore *get_next() const { return ATOMIC_LOAD(&next_); }
   OB_INLINE void set_next(KVCacheHazardThreadStore * const next) { ATOMIC_SET(&next_, next); }
   int delete_node(KVCacheHazardNode &node);  // Put node in delete_list and set its version
@@ -81,6 +81,10 @@ public:
   int acquire();  // Thread start to access shared memory, acquire version to protect this version
   void release();  // Thread finish access process, release protected version.
   int retire();  // Global retire, call retire() of every thread store
+  // Wait until every other thread releases the version acquired before this call, used to free
+  // memory which is read under the hazard version without being deleted as a hazard node.
+  // Return OB_TIMEOUT if some thread still holds such a version after timeout_us.
+  int wait_quiescent(const int64_t timeout_us = INT64_MAX);
   int get_thread_store(KVCacheHazardThreadStore *&ts);
   int print_current_status() const ;
 
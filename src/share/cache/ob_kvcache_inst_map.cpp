@@ -234,6 +234,11 @@ int ObKVCacheInstMap::init(const int64_t max_entry_cnt, const ObKVCacheConfig *c
 
 void ObKVCacheInstMap::destroy()
 {
+  for (KVCacheInstMap::iterator iter = inst_map_.begin(); iter != inst_map_.end(); ++iter) {
+    if (NULL != iter->second) {
+      iter->second->free_mrc();
+    }
+  }
   inst_map_.destroy();
   tenant_set_.destroy();
   inst_pool_.destroy();
@@ -398,7 +403,7 @@ int ObKVCacheInstMap::refresh_score()
       }
       inst->status_.last_hit_cnt_ = total_hit_cnt;
       inst->status_.base_mb_score_ = inst->status_.base_mb_score_ * CACHE_SCORE_DECAY_FACTOR
-          + avg_hit * (double) (inst->status_.config_->priority_);
+          + avg_hit * (double) (inst->status_.config_->priority_) * inst->status_.rebalance_weight_;
     }
   }
   return ret;
@@ -25,6 +25,7 @@
 #include "lib/lock/ob_drw_lock.h"
 #include "share/cache/ob_cache_utils.h"
 #include "share/cache/ob_kvcache_struct.h"
+#include "share/cache/ob_kvcache_miss_ratio_curve.h"
 #include "share/ob_i_tenant_mem_limit_getter.h"
 
 namespace oceanbase
@@ -83,13 +84,15 @@ struct ObKVCacheInst
   ObKVCacheStatus status_;
   int64_t ref_cnt_;
   ObTenantMBListHandle mb_list_handle_; // list of tenant mbs
+  ObKVCacheMissRatioCurve *mrc_; // allocated on the first sampled get when rebalance is enabled
   ObKVCacheInst()
     : cache_id_(0),
       tenant_id_(0),
       node_allocator_(),
       status_(),
       ref_cnt_(0),
-      mb_list_handle_() { MEMSET(handles_, 0, sizeof(handles_)); }
+      mb_list_handle_(),
+      mrc_(NULL) { MEMSET(handles_, 0, sizeof(handles_)); }
   bool can_destroy() {
     return 1 == ATOMIC_LOAD(&ref_cnt_)
         && 0 == ATOMIC_LOAD(&status_.kv_cnt_)
@@ -105,6 +108,14 @@ struct ObKVCacheInst
     ref_cnt_ = 0;
     mb_list_handle_.reset();
     MEMSET(handles_, 0, sizeof(handles_));
+    free_mrc();
+  }
+  void free_mrc() {
+    if (NULL != mrc_) {
+      mrc_->~ObKVCacheMissRatioCurve();
+      ob_free(mrc_);
+      mrc_ = NULL;
+    }
   }
   bool is_valid() const { return ref_cnt_ > 0; }
 
@@ -113,7 +124,7 @@ struct ObKVCacheInst
 
   common::ObDLink *get_mb_list() { return mb_list_handle_.get_head(); }
 
-  TO_STRING_KV(K_(cache_id), K_(tenant_id), K_(status), K_(ref_cnt));
+  TO_STRING_KV(K_(cache_id), K_(tenant_id), K_(status), K_(ref_cnt), KP_(mrc));
 };
 
 class ObKVCacheInstHandle
@@ -258,7 +258,6 @@ int ObKVCacheMap::get(
     hash_code += cache_id;
 
     Node *iter = NULL;
-    Node *prev = NULL;
     int64_t iter_get_cnt = 0;
     int64_t mb_get_cnt = 0;
     int64_t mb_handle_kv_cnt = 0;
@@ -300,35 +299,84 @@ int ObKVCacheMap::get(
         ret = OB_ENTRY_NOT_EXIST;
       } else {
         if (LRU == mb_policy && need_modify_cache(iter_get_cnt, mb_get_cnt, mb_handle_kv_cnt)) {
-          int tmp_ret = OB_SUCCESS;
-          ObBucketWLockGuard guard(bucket_lock_, bucket_pos);
-          if (OB_TMP_FAIL(guard.get_ret())) {
-            COMMON_LOG(WARN, "Fail to write lock bucket, ", K(tmp_ret), K(bucket_pos));
-          } else {
-            prev = NULL;
-            iter = bucket_ptr;
-            bool is_equal = false;
-            while (NULL != iter && OB_LIKELY(OB_SUCCESS == tmp_ret)) {
-              if (store_->add_handle_ref(iter->mb_handle_, iter->seq_num_)) {
-                if (hash_code == iter->hash_code_) {
-                  if (OB_TMP_FAIL(key.equal(*iter->key_, is_equal))) {
-                    COMMON_LOG(WARN, "Failed to check kvcache key equal", K(tmp_ret));
-                  } else if (is_equal) {
-                    ObKVMemBlockHandle *old_handle = iter->mb_handle_;
-                    if (OB_TMP_FAIL(internal_data_move(prev, iter, bucket_ptr, LFU))) {
-                      COMMON_LOG(WARN, "Fail to move node to LFU block, ", K(tmp_ret));
-                    }
-                    store_->de_handle_ref(old_handle);
-                    break;
-                  }
+          move_to_lfu(bucket_pos, hash_code, key);
+        }
+      }
+    }  // hazard version guard
+  }
+
+  return ret;
+}
+
+int ObKVCacheMap::read(
+    const int64_t cache_id,
+    const ObIKVCacheKey &key,
+    ObIKVCacheValueReader &reader)
+{
+  int ret = OB_SUCCESS;
+  uint64_t hash_code = 0;
+  RLOCAL(int64_t, read_cnt);
+
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCacheMap has not been inited, ", K(ret));
+  } else if (OB_FAIL(key.hash(hash_code))) {
+    COMMON_LOG(WARN, "Failed to get kvcache key hash", K(ret));
+  } else {
+    uint64_t bucket_pos = hash_code % bucket_num_;
+    hash_code += cache_id;
+
+    Node *iter = NULL;
+    bool need_move_to_lfu = false;
+    // get count of nodes and memblocks are only used to choose nodes to move and memblocks to
+    // wash, update them once every READ_STAT_SAMPLE_RATE reads to keep the hot path free of
+    // writes to shared cache lines.
+    const bool need_update_stat = 0 == (++read_cnt % READ_STAT_SAMPLE_RATE);
+
+    GlobalHazardVersionGuard hazard_guard(global_hazard_version_);
+    if (OB_FAIL(hazard_guard.get_ret())) {
+      COMMON_LOG(WARN, "Fail to acquire hazard version", K(ret));
+    } else {
+      {
+        GlobalHazardVersionGuard mb_hazard_guard(store_->get_mb_hazard_version());
+        if (OB_FAIL(mb_hazard_guard.get_ret())) {
+          COMMON_LOG(WARN, "Fail to acquire mb hazard version", K(ret));
+        } else {
+          Node *&bucket_ptr = get_bucket_node(bucket_pos);
+          iter = bucket_ptr;
+          bool is_equal = false;
+          while (NULL != iter && OB_SUCC(ret)) {
+            // memory of kv is not freed before mb_hazard_guard released if seq num still matches
+            if (hash_code == iter->hash_code_
+                && static_cast<uint32_t>(iter->seq_num_) == iter->mb_handle_->get_seq_num()) {
+              if (OB_FAIL(key.equal(*iter->key_, is_equal))) {
+                COMMON_LOG(WARN, "Failed to check kvcache key equal", K(ret));
+              } else if (is_equal) {
+                ObKVMemBlockHandle *mb_handle = iter->mb_handle_;
+                iter->inst_->status_.total_hit_cnt_.inc();
+                if (need_update_stat) {
+                  const int64_t mb_get_cnt = ATOMIC_AAF(&mb_handle->get_cnt_, READ_STAT_SAMPLE_RATE);
+                  mb_handle->recent_get_cnt_ += READ_STAT_SAMPLE_RATE;
+                  iter->get_cnt_ += READ_STAT_SAMPLE_RATE;
+                  need_move_to_lfu = LRU == mb_handle->policy_
+                      && need_modify_cache(iter->get_cnt_, mb_get_cnt, mb_handle->kv_cnt_);
                 }
-                store_->de_handle_ref(iter->mb_handle_);
+                if (OB_FAIL(reader.read(*iter->value_))) {
+                  COMMON_LOG(WARN, "Fail to read kvcache value", K(ret));
+                }
+                break;
               }
-              prev = iter;
-              iter = iter->next_;
             }
+            iter = iter->next_;
           }
         }
+      }  // mb hazard version guard
+
+      if (OB_FAIL(ret)) {
+      } else if (NULL == iter) {
+        ret = OB_ENTRY_NOT_EXIST;
+      } else if (need_move_to_lfu) {
+        move_to_lfu(bucket_pos, hash_code, key);
       }
     }  // hazard version guard
   }
@@ -336,6 +384,39 @@ int ObKVCacheMap::get(
   return ret;
 }
 
+void ObKVCacheMap::move_to_lfu(const uint64_t bucket_pos, const uint64_t hash_code, const ObIKVCacheKey &key)
+{
+  int tmp_ret = OB_SUCCESS;
+  ObBucketWLockGuard guard(bucket_lock_, bucket_pos);
+  if (OB_TMP_FAIL(guard.get_ret())) {
+    COMMON_LOG(WARN, "Fail to write lock bucket, ", K(tmp_ret), K(bucket_pos));
+  } else {
+    Node *&bucket_ptr = get_bucket_node(bucket_pos);
+    Node *prev = NULL;
+    Node *iter = bucket_ptr;
+    bool is_equal = false;
+    while (NULL != iter && OB_LIKELY(OB_SUCCESS == tmp_ret)) {
+      if (store_->add_handle_ref(iter->mb_handle_, iter->seq_num_)) {
+        if (hash_code == iter->hash_code_) {
+          if (OB_TMP_FAIL(key.equal(*iter->key_, is_equal))) {
+            COMMON_LOG(WARN, "Failed to check kvcache key equal", K(tmp_ret));
+          } else if (is_equal) {
+            ObKVMemBlockHandle *old_handle = iter->mb_handle_;
+            if (OB_TMP_FAIL(internal_data_move(prev, iter, bucket_ptr, LFU))) {
+              COMMON_LOG(WARN, "Fail to move node to LFU block, ", K(tmp_ret));
+            }
+            store_->de_handle_ref(old_handle);
+            break;
+          }
+        }
+        store_->de_handle_ref(iter->mb_handle_);
+      }
+      prev = iter;
+      iter = iter->next_;
+    }
+  }
+}
+
 int ObKVCacheMap::erase(const int64_t cache_id, const ObIKVCacheKey &key)
 {
   int ret = OB_SUCCESS;
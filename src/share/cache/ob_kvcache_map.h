@@ -29,6 +29,7 @@ class ObKVCacheMap
   static constexpr int64_t DEFAULT_BUCKET_SIZE = (16L << 20); // 16M
   static constexpr int64_t MIN_BUCKET_SIZE     = ( 4L << 10); //  4K
   static const int64_t HAZARD_VERSION_THREAD_WAITING_THRESHOLD = 512;
+  static const int64_t READ_STAT_SAMPLE_RATE = 16;
   
 public:
   ObKVCacheMap();
@@ -52,6 +53,11 @@ public:
     const ObIKVCacheKey &key,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&out_handle);
+  // Read the value of key by reader without adding handle ref, see ObKVCache::read()
+  int read(
+    const int64_t cache_id,
+    const ObIKVCacheKey &key,
+    ObIKVCacheValueReader &reader);
   int erase(const int64_t cache_id, const ObIKVCacheKey &key);
   void print_hazard_version_info();
 private:
@@ -88,6 +94,7 @@ private:
   void internal_map_erase(Node *&prev, Node *&iter, Node *&bucket_ptr);
   void internal_map_replace(Node *&prev, Node *&iter, Node *&bucket_ptr);
   int internal_data_move(Node *&prev, Node *&iter, Node *&bucket_ptr, const enum ObKVCachePolicy policy);
+  void move_to_lfu(const uint64_t bucket_pos, const uint64_t hash_code, const ObIKVCacheKey &key);
   OB_INLINE bool need_modify_cache(const int64_t iter_get_cnt, const int64_t total_get_cnt, const int64_t kv_cnt) const
   {
     bool ret = false;
@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "share/cache/ob_kvcache_miss_ratio_curve.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+ObKVCacheMissRatioCurve::ObKVCacheMissRatioCurve()
+  : sample_shift_(MIN_SAMPLE_SHIFT),
+    cur_epoch_(0),
+    access_cnt_(0),
+    cold_miss_cnt_(0),
+    record_cnt_(0),
+    skip_cnt_(0),
+    lock_()
+{
+  inner_reset();
+}
+
+ObKVCacheMissRatioCurve::~ObKVCacheMissRatioCurve()
+{
+}
+
+void ObKVCacheMissRatioCurve::reset()
+{
+  lock_.lock();
+  inner_reset();
+  ATOMIC_STORE(&sample_shift_, MIN_SAMPLE_SHIFT);
+  lock_.unlock();
+}
+
+void ObKVCacheMissRatioCurve::inner_reset()
+{
+  MEMSET(slots_, 0, sizeof(slots_));
+  MEMSET(bucket_cnts_, 0, sizeof(bucket_cnts_));
+  MEMSET(hit_cnts_, 0, sizeof(hit_cnts_));
+  // slots with epoch 0 are not alive
+  cur_epoch_ = BUCKET_NUM;
+  access_cnt_ = 0;
+  cold_miss_cnt_ = 0;
+  record_cnt_ = 0;
+  skip_cnt_ = 0;
+}
+
+// hash of some cache keys is weak, mix it before sampling
+OB_INLINE uint64_t ObKVCacheMissRatioCurve::spread(const uint64_t hash)
+{
+  uint64_t h = hash;
+  h ^= (h >> 33);
+  h *= 0xff51afd7ed558ccdUL;
+  h ^= (h >> 33);
+  return h;
+}
+
+bool ObKVCacheMissRatioCurve::is_sampled(const uint64_t key_hash)
+{
+  return 0 == (spread(key_hash) & ((1UL << MIN_SAMPLE_SHIFT) - 1));
+}
+
+void ObKVCacheMissRatioCurve::resize(const int64_t kv_cnt)
+{
+  int64_t sample_shift = MIN_SAMPLE_SHIFT;
+  while (sample_shift < MAX_SAMPLE_SHIFT
+         && (kv_cnt >> sample_shift) * COVERAGE_RATIO > MAX_DISTANCE) {
+    ++sample_shift;
+  }
+  const int64_t cur_sample_shift = ATOMIC_LOAD(&sample_shift_);
+  // the rate is lowered as soon as the cache outgrows the curve, and raised only when the
+  // cache shrinks to a quarter, so that a cache around the boundary does not restart each time
+  if (sample_shift > cur_sample_shift || sample_shift + 1 < cur_sample_shift) {
+    lock_.lock();
+    inner_reset();
+    ATOMIC_STORE(&sample_shift_, sample_shift);
+    lock_.unlock();
+  }
+}
+
+void ObKVCacheMissRatioCurve::record(const uint64_t key_hash)
+{
+  const uint64_t hash = spread(key_hash);
+  if (0 != (hash & ((1UL << ATOMIC_LOAD(&sample_shift_)) - 1))) {
+    // not sampled by the current rate
+  } else if (OB_SUCCESS != lock_.trylock()) {
+    ATOMIC_INC(&skip_cnt_);
+  } else {
+    Slot &slot = slots_[(hash >> sample_shift_) & (SLOT_NUM - 1)];
+    if (!is_alive(slot.epoch_)) {
+      ++cold_miss_cnt_;
+    } else {
+      --bucket_cnts_[slot.epoch_ % BUCKET_NUM];
+      if (slot.hash_ != hash) {
+        // another key in the same slot is dropped, take it as a cold miss
+        ++cold_miss_cnt_;
+      } else {
+        // keys accessed in the same epoch are counted as half of the bucket
+        int64_t distance = bucket_cnts_[slot.epoch_ % BUCKET_NUM] / 2;
+        for (int64_t epoch = slot.epoch_ + 1; epoch <= cur_epoch_; ++epoch) {
+          distance += bucket_cnts_[epoch % BUCKET_NUM];
+        }
+        ++hit_cnts_[MIN(distance / POINT_DISTANCE, CURVE_POINT_NUM - 1)];
+      }
+    }
+    slot.hash_ = hash;
+    slot.epoch_ = cur_epoch_;
+    ++access_cnt_;
+    ++record_cnt_;
+    if (++bucket_cnts_[cur_epoch_ % BUCKET_NUM] >= BUCKET_CAPACITY) {
+      // the oldest bucket is reused, keys in it are not tracked any more
+      ++cur_epoch_;
+      bucket_cnts_[cur_epoch_ % BUCKET_NUM] = 0;
+    }
+    lock_.unlock();
+  }
+}
+
+void ObKVCacheMissRatioCurve::decay()
+{
+  lock_.lock();
+  for (int64_t i = 0; i < CURVE_POINT_NUM; ++i) {
+    hit_cnts_[i] >>= 1;
+  }
+  access_cnt_ >>= 1;
+  cold_miss_cnt_ >>= 1;
+  lock_.unlock();
+}
+
+int64_t ObKVCacheMissRatioCurve::get_point_size(const int64_t avg_item_size) const
+{
+  return (POINT_DISTANCE << ATOMIC_LOAD(&sample_shift_)) * MAX(avg_item_size, 1);
+}
+
+double ObKVCacheMissRatioCurve::get_hit_ratio(const int64_t point_idx) const
+{
+  double hit_ratio = 0;
+  const int64_t access_cnt = ATOMIC_LOAD(&access_cnt_);
+  if (access_cnt > 0 && point_idx >= 0) {
+    int64_t hit_cnt = 0;
+    for (int64_t i = 0; i <= point_idx && i < CURVE_POINT_NUM; ++i) {
+      hit_cnt += ATOMIC_LOAD(&hit_cnts_[i]);
+    }
+    hit_ratio = MIN(double(hit_cnt) / double(access_cnt), 1.0);
+  }
+  return hit_ratio;
+}
+
+int ObKVCacheMissRatioCurve::get_marginal_utility(
+    const int64_t cache_size,
+    const int64_t avg_item_size,
+    double &utility) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t sample_shift = ATOMIC_LOAD(&sample_shift_);
+  const int64_t point_size = (POINT_DISTANCE << sample_shift) * MAX(avg_item_size, 1);
+  const int64_t point_idx = cache_size / point_size;
+  utility = 0;
+  if (OB_UNLIKELY(cache_size < 0) || OB_UNLIKELY(avg_item_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument, ", K(cache_size), K(avg_item_size), K(ret));
+  } else if (ATOMIC_LOAD(&access_cnt_) < MIN_ACCESS_CNT || point_idx >= CURVE_POINT_NUM) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else {
+    // sampled hits of the next point scaled to all keys, per MB of the point
+    const double point_mb = double(point_size) / double(1024 * 1024);
+    utility = double(ATOMIC_LOAD(&hit_cnts_[point_idx]) << sample_shift) / point_mb;
+  }
+  return ret;
+}
+
+}//end namespace common
+}//end namespace oceanbase
@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_CACHE_OB_KVCACHE_MISS_RATIO_CURVE_H_
+#define OCEANBASE_CACHE_OB_KVCACHE_MISS_RATIO_CURVE_H_
+
+#include "share/ob_define.h"
+#include "lib/lock/ob_spin_lock.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// Miss ratio curve of one cache instance, estimated from spatially sampled gets.
+// A key is sampled if its hash falls in 1 / 2^sample_shift_ of the hash space, and the
+// reuse distance of a sampled key, i.e. the number of distinct sampled keys accessed since
+// its last access, is estimated by aging buckets instead of a full LRU stack: each tracked
+// key remembers the epoch of its last access, and the keys of newer epochs are counted per
+// bucket. Tracked keys are independent of the kvs in cache, so keys which have been washed
+// out still act as ghost entries, and the curve also covers sizes larger than the cache.
+// Reuse distance d of sampled keys is a hit for any cache larger than d * 2^sample_shift_ kvs.
+// The tracked keys are bounded, so the sample rate follows the cache size, and the curve
+// always spans COVERAGE_RATIO times the kvs in cache.
+class ObKVCacheMissRatioCurve
+{
+public:
+  static const int64_t MIN_SAMPLE_SHIFT = 8;
+  static const int64_t MAX_SAMPLE_SHIFT = 24;
+  static const int64_t CURVE_POINT_NUM = 16;
+  static const int64_t MIN_ACCESS_CNT = 128;
+  static const int64_t COVERAGE_RATIO = 4;
+  ObKVCacheMissRatioCurve();
+  virtual ~ObKVCacheMissRatioCurve();
+  // sampled at the highest rate, record() drops the keys not sampled by the current rate
+  static bool is_sampled(const uint64_t key_hash);
+  void reset();
+  // adjust the sample rate to the kvs in cache, the curve restarts if the rate is changed
+  void resize(const int64_t kv_cnt);
+  // skipped if the curve is being updated by other threads, losing a few samples is fine
+  void record(const uint64_t key_hash);
+  // halve the histogram, so the curve follows the recent workload
+  void decay();
+  // cache size covered by each point of the curve, the i-th point is the hit ratio of a
+  // cache of (i + 1) * point size
+  int64_t get_point_size(const int64_t avg_item_size) const;
+  double get_hit_ratio(const int64_t point_idx) const;
+  // estimated hits per MB gained by growing the cache from cache_size, returns
+  // OB_ENTRY_NOT_EXIST if there are too few samples or cache_size is beyond the curve.
+  int get_marginal_utility(const int64_t cache_size, const int64_t avg_item_size,
+                           double &utility) const;
+  int64_t get_access_cnt() const { return ATOMIC_LOAD(&access_cnt_); }
+  int64_t get_sample_shift() const { return ATOMIC_LOAD(&sample_shift_); }
+  TO_STRING_KV(K_(sample_shift), K_(cur_epoch), K_(access_cnt), K_(cold_miss_cnt), K_(record_cnt),
+               K_(skip_cnt));
+private:
+  static const int64_t SLOT_NUM = 8192;
+  static const int64_t BUCKET_NUM = 32;
+  static const int64_t BUCKET_CAPACITY = 128;
+  // keys tracked by all buckets, i.e. the max reuse distance of the curve
+  static const int64_t MAX_DISTANCE = BUCKET_NUM * BUCKET_CAPACITY;
+  static const int64_t POINT_DISTANCE = MAX_DISTANCE / CURVE_POINT_NUM;
+  struct Slot
+  {
+    uint64_t hash_;
+    int64_t epoch_;
+  };
+  OB_INLINE static uint64_t spread(const uint64_t hash);
+  OB_INLINE bool is_alive(const int64_t epoch) const { return epoch > cur_epoch_ - BUCKET_NUM; }
+  void inner_reset();
+private:
+  int64_t sample_shift_;
+  Slot slots_[SLOT_NUM];
+  int64_t bucket_cnts_[BUCKET_NUM];
+  int64_t cur_epoch_;
+  // sampled accesses hit by each point of the curve
+  int64_t hit_cnts_[CURVE_POINT_NUM];
+  int64_t access_cnt_;
+  int64_t cold_miss_cnt_;
+  int64_t record_cnt_;
+  int64_t skip_cnt_;
+  ObSpinLock lock_;
+  DISALLOW_COPY_AND_ASSIGN(ObKVCacheMissRatioCurve);
+};
+
+}//end namespace common
+}//end namespace oceanbase
+
+#endif //OCEANBASE_CACHE_OB_KVCACHE_MISS_RATIO_CURVE_H_
@@ -31,6 +31,9 @@ ObKVCacheStore::ObKVCacheStore()
       block_payload_size_(0),
       mb_handles_(NULL),
       mb_handles_pool_(),
+      mb_hazard_version_(),
+      quiescing_lock_(),
+      quiescing_list_(),
       wash_out_lock_(),
       tenant_ids_(),
       inst_handles_(),
@@ -73,6 +76,9 @@ int ObKVCacheStore::init(ObKVCacheInstMap &insts,
     } else if (OB_FAIL(mb_handles_pool_.init(max_mb_num_,
         (char*) (buf) + sizeof(ObKVMemBlockHandle) * max_mb_num_))) {
       COMMON_LOG(WARN, "Fail to init mb_handles_pool_, ", K(ret));
+    } else if (OB_FAIL(mb_hazard_version_.init(INT64_MAX))) {
+      // no node is deleted by mb_hazard_version_, so never retire in release()
+      COMMON_LOG(WARN, "Fail to init mb hazard version, ", K(ret));
     } else {
       MEMSET(buf, 0, sizeof(ObKVMemBlockHandle) * max_mb_num_);
       block_size_ = block_size;
@@ -120,7 +126,11 @@ void ObKVCacheStore::destroy()
     mb_handles_ = NULL;
   }
 
+  if (inited_) {
+    reclaim_quiescing_mbs(true /* need_wait */);
+  }
   mb_handles_pool_.destroy();
+  mb_hazard_version_.destroy();
   block_size_ = 0;
   block_payload_size_ = 0;
   insts_ = NULL;
@@ -240,7 +250,8 @@ void ObKVCacheStore::refresh_score()
         if (NULL != mb_handles_[i].inst_) {
           priority = mb_handles_[i].inst_->status_.config_->priority_;
           score = mb_handles_[i].score_;
-          score = score * CACHE_SCORE_DECAY_FACTOR + (double) (mb_handles_[i].recent_get_cnt_ * priority);
+          score = score * CACHE_SCORE_DECAY_FACTOR + (double) (mb_handles_[i].recent_get_cnt_ * priority)
+              * mb_handles_[i].inst_->status_.rebalance_weight_;
           mb_handles_[i].score_ = score;
           ATOMIC_STORE(&mb_handles_[i].recent_get_cnt_, 0);
         }
@@ -273,6 +284,9 @@ bool ObKVCacheStore::wash()
     wash_itid_ = get_itid();
   }
   lib::ObMutexGuard guard(wash_out_lock_);
+  // memblocks whose readers did not leave in time, the wait is bounded since sync washes
+  // are blocked by wash_out_lock_ meanwhile, the rest are left to the next wash
+  reclaim_quiescing_mbs(true /* need_wait */, WASH_QUIESCENT_TIMEOUT_US);
   reuse_wash_structs();
 
   //compute the wash size of each tenant
@@ -563,6 +577,7 @@ int ObKVCacheStore::try_flush_washable_mb(
     const int64_t start = ObTimeUtility::current_time();
     int64_t size_washed = 0;
     int64_t check_idx = 0;
+    HazardList washed_list;
     HazardList retire_list;
     {
       QClockGuard guard(get_qclock());
@@ -580,24 +595,11 @@ int ObKVCacheStore::try_flush_washable_mb(
           de_handle_ref(handle);
         }
         if (can_try_wash) {
-          void *buf = nullptr;
           int64_t mb_size = 0;
-          if (try_wash_mb(handle, tenant_id, buf, mb_size)) {
-            if (nullptr == buf) {
-              ret = OB_ERR_UNDEFINED;
-              COMMON_LOG(ERROR, "Try wash memblock is null", K(ret), K(tenant_id));
-            } else {
-              size_washed += mb_size;
-              ObICacheWasher::ObCacheMemBlock *mem_block = new (buf) ObICacheWasher::ObCacheMemBlock();
-              if (nullptr == wash_blocks) {
-                wash_blocks = mem_block;
-              } else {
-                mem_block->next_ = wash_blocks;
-                wash_blocks = mem_block;
-              }
-            }
+          if (try_wash_mb(handle, tenant_id, mb_size)) {
+            size_washed += mb_size;
             dl_del(handle);
-            retire_list.push(&handle->retire_link_);
+            washed_list.push(&handle->retire_link_);
           }
         }
         handle = static_cast<ObKVMemBlockHandle *>(link_next(handle));
@@ -613,6 +615,33 @@ int ObKVCacheStore::try_flush_washable_mb(
       }
     } // qclock guard
 
+    // wait for the readers of all washed memblocks at once, out of the qclock guard
+    if (washed_list.size() > 0) {
+      int tmp_ret = OB_SUCCESS;
+      const int64_t timeout_us = (size_need_washed == INT64_MAX) ? INT64_MAX
+          : MAX(0, SYNC_WASH_MB_TIMEOUT_US - (ObTimeUtility::current_time() - start));
+      if (OB_TMP_FAIL(mb_hazard_version_.wait_quiescent(timeout_us))) {
+        COMMON_LOG(WARN, "Fail to wait mb hazard version quiescent", K(tmp_ret), K(timeout_us));
+        size_washed = 0;
+        add_quiescing_mbs(washed_list);
+        if (OB_SUCC(ret)) {
+          ret = OB_TIMEOUT == tmp_ret ? OB_SYNC_WASH_MB_TIMEOUT : tmp_ret;
+        }
+      } else {
+        ObLink *p = NULL;
+        while (NULL != (p = washed_list.pop())) {
+          ObKVMemBlockHandle *mb_handle = CONTAINER_OF(p, ObKVMemBlockHandle, retire_link_);
+          void *buf = release_washed_mb(mb_handle);
+          ObICacheWasher::ObCacheMemBlock *mem_block = new (buf) ObICacheWasher::ObCacheMemBlock();
+          mem_block->next_ = wash_blocks;
+          wash_blocks = mem_block;
+          retire_list.push(&mb_handle->retire_link_);
+        }
+        // memblocks left by the former timeout waits are quiescent too
+        reclaim_quiescing_mbs(false /* need_wait */);
+      }
+    }
+
     if (size_need_washed == INT64_MAX) {
       // flush
       ObICacheWasher::ObCacheMemBlock *wash_block = wash_blocks;
@@ -728,16 +757,19 @@ int ObKVCacheStore::free_mbhandle(ObKVMemBlockHandle *mb_handle)
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid arguments", K(ret), KP(mb_handle));
   } else {
-    void *buf = NULL;
     int64_t mb_size = 0;
-    const uint64_t tenant_id = mb_handle->inst_->tenant_id_;
-    if (OB_FAIL(do_wash_mb(mb_handle, buf, mb_size))) {
+    if (OB_FAIL(do_wash_mb(mb_handle, mb_size))) {
       COMMON_LOG(ERROR, "do_wash_mb failed", K(ret));
     } else {
-      free_mb(*mb_handle->inst_->mb_list_handle_.get_resource_handle(), tenant_id, buf);
-      if (OB_FAIL(remove_mb_handle(mb_handle))) {
-        COMMON_LOG(WARN, "remove_mb failed", K(ret));
+      {
+        QClockGuard guard(get_qclock());
+        dl_del(mb_handle);
       }
+      // called by the thread releasing the last handle ref, which must not wait for readers,
+      // the memory and the mb_handle are reclaimed with the quiescing memblocks by wash
+      HazardList washed_list;
+      washed_list.push(&mb_handle->retire_link_);
+      add_quiescing_mbs(washed_list);
     }
   }
   return ret;
@@ -1005,6 +1037,15 @@ bool ObKVCacheStore::compute_tenant_wash_size()
       }
     }
   }
+  // kvs put into tenants which need wash are filtered by admission policy
+  for (int64_t i = 0; OB_SUCC(ret) && i < inst_handles_.count(); ++i) {
+    inst = inst_handles_.at(i).get_inst();
+    if (OB_NOT_NULL(inst)) {
+      const bool need_admission = OB_SUCCESS == tenant_wash_map_.get(inst->tenant_id_, tenant_wash_info)
+          && tenant_wash_info->wash_size_ > 0;
+      ATOMIC_STORE(&inst->status_.need_admission_, need_admission);
+    }
+  }
   COMMON_LOG(INFO, "Wash compute wash size", K(is_wash_valid), K(sys_total_wash_size), K(global_cache_size),
       K(tenant_max_wash_size),K(tenant_min_wash_size), K(tenant_ids_));
   return is_wash_valid;
@@ -1053,7 +1094,7 @@ void ObKVCacheStore::wash_mbs(WashHeap &heap)
   }
 }
 
-bool ObKVCacheStore::try_wash_mb(ObKVMemBlockHandle *mb_handle, const uint64_t tenant_id, void *&buf, int64_t &mb_size)
+bool ObKVCacheStore::try_wash_mb(ObKVMemBlockHandle *mb_handle, const uint64_t tenant_id, int64_t &mb_size)
 {
   bool block_washed = false;
   if (NULL == mb_handle || OB_INVALID_ID == tenant_id) {
@@ -1063,7 +1104,7 @@ bool ObKVCacheStore::try_wash_mb(ObKVMemBlockHandle *mb_handle, const uint64_t t
       int ret = OB_SUCCESS;
       if (mb_handle->inst_->tenant_id_ == tenant_id
           && mb_handle->handle_ref_.try_inc_seq_num()) {
-        if (OB_FAIL(do_wash_mb(mb_handle, buf, mb_size))) {
+        if (OB_FAIL(do_wash_mb(mb_handle, mb_size))) {
           COMMON_LOG(ERROR, "do_wash_mb failed", K(ret));
         } else {
           block_washed = true;
@@ -1078,7 +1119,7 @@ bool ObKVCacheStore::try_wash_mb(ObKVMemBlockHandle *mb_handle, const uint64_t t
   return block_washed;
 }
 
-int ObKVCacheStore::do_wash_mb(ObKVMemBlockHandle *mb_handle, void *&buf, int64_t &mb_size)
+int ObKVCacheStore::do_wash_mb(ObKVMemBlockHandle *mb_handle, int64_t &mb_size)
 {
   int ret = OB_SUCCESS;
   if (NULL == mb_handle) {
@@ -1097,21 +1138,54 @@ int ObKVCacheStore::do_wash_mb(ObKVMemBlockHandle *mb_handle, void *&buf, int64_
         (void) ATOMIC_SAF(&mb_handle->inst_->status_.lfu_mb_cnt_, 1);
       }
     }
-    buf = mb_handle->mem_block_;
+    // seq num of mb_handle has been increased, the memory is given back by release_washed_mb()
+    // after the readers which may have checked the old seq num leave, see wait_quiescent()
     mb_size = mb_handle->mem_block_->get_align_size();
-    mb_handle->mem_block_->~ObKVStoreMemBlock();
-    mb_handle->mem_block_ = NULL;
-    /*
-    mb_handle->reset();
-    if (OB_FAIL(mb_handles_pool_.push(mb_handle))) {
-      //should not happen
-      COMMON_LOG(ERROR, "Fail to push mb_handle to mb_handles_pool_, ", K(ret));
-    }
-    */
   }
   return ret;
 }
 
+void *ObKVCacheStore::release_washed_mb(ObKVMemBlockHandle *mb_handle)
+{
+  void *buf = mb_handle->mem_block_;
+  mb_handle->mem_block_->~ObKVStoreMemBlock();
+  mb_handle->mem_block_ = NULL;
+  return buf;
+}
+
+void ObKVCacheStore::add_quiescing_mbs(HazardList &washed_list)
+{
+  lib::ObMutexGuard guard(quiescing_lock_);
+  washed_list.move_to(quiescing_list_);
+}
+
+void ObKVCacheStore::reclaim_quiescing_mbs(const bool need_wait, const int64_t timeout_us)
+{
+  int ret = OB_SUCCESS;
+  HazardList reclaim_list;
+  HazardList retire_list;
+  {
+    lib::ObMutexGuard guard(quiescing_lock_);
+    quiescing_list_.move_to(reclaim_list);
+  }
+  if (reclaim_list.size() > 0) {
+    if (need_wait && OB_FAIL(mb_hazard_version_.wait_quiescent(timeout_us))) {
+      COMMON_LOG(WARN, "Fail to wait mb hazard version quiescent", K(ret), K(timeout_us));
+      add_quiescing_mbs(reclaim_list);
+    } else {
+      ObLink *p = NULL;
+      while (NULL != (p = reclaim_list.pop())) {
+        ObKVMemBlockHandle *mb_handle = CONTAINER_OF(p, ObKVMemBlockHandle, retire_link_);
+        const uint64_t tenant_id = mb_handle->inst_->tenant_id_;
+        free_mb(*mb_handle->inst_->mb_list_handle_.get_resource_handle(), tenant_id,
+                release_washed_mb(mb_handle));
+        retire_list.push(&mb_handle->retire_link_);
+      }
+      retire_mb_handles(retire_list);
+    }
+  }
+}
+
 int ObKVCacheStore::init_wash_heap(WashHeap &heap, const int64_t heap_size)
 {
   int ret = OB_SUCCESS;
@@ -19,6 +19,7 @@
 #include "ob_kvcache_struct.h"
 #include "ob_kvcache_inst_map.h"
 #include "ob_cache_utils.h"
+#include "ob_kvcache_hazard_version.h"
 #include "share/ob_i_tenant_mem_limit_getter.h"
 
 namespace oceanbase
@@ -96,6 +97,9 @@ public:
   virtual bool add_handle_ref(ObKVMemBlockHandle *mb_handle);
   virtual void de_handle_ref(ObKVMemBlockHandle *mb_handle);
   int64_t get_handle_ref_cnt(ObKVMemBlockHandle *mb_handle);
+  // Memory of memblocks is not freed until readers holding this version leave, so kvs can be
+  // read under it without adding handle ref, as long as the seq num of memblock is checked.
+  GlobalHazardVersion &get_mb_hazard_version() { return mb_hazard_version_; }
   virtual int64_t get_block_size() const { return block_size_; }
   // implement functions of ObIMBWrapperMgr
   virtual int alloc(ObKVCacheInst &inst, const enum ObKVCachePolicy policy,
@@ -115,6 +119,7 @@ private:
 
 private:
   static const int64_t SYNC_WASH_MB_TIMEOUT_US = 100 * 1000; // 100ms
+  static const int64_t WASH_QUIESCENT_TIMEOUT_US = 10 * 1000; // 10ms
   static const int64_t RETIRE_LIMIT = 16;
   static const int64_t WASH_THREAD_RETIRE_LIMIT = 2048;
   static const int64_t SUPPLY_MB_NUM_ONCE = 128;
@@ -190,8 +195,12 @@ private:
   bool is_global_wash_valid(const int64_t total_tenant_wash_block_count, const int64_t global_cache_size);
   void wash_mb(ObKVMemBlockHandle *mb_handle);
   void wash_mbs(WashHeap &heap);
-  bool try_wash_mb(ObKVMemBlockHandle *mb_handle, const uint64_t tenant_id, void *&buf, int64_t &mb_size);
-  int do_wash_mb(ObKVMemBlockHandle *mb_handle, void *&buf, int64_t &mb_size);
+  bool try_wash_mb(ObKVMemBlockHandle *mb_handle, const uint64_t tenant_id, int64_t &mb_size);
+  int do_wash_mb(ObKVMemBlockHandle *mb_handle, int64_t &mb_size);
+  // give back the memory of a washed memblock, only after its readers leave
+  void *release_washed_mb(ObKVMemBlockHandle *mb_handle);
+  void add_quiescing_mbs(HazardList &washed_list);
+  void reclaim_quiescing_mbs(const bool need_wait, const int64_t timeout_us = INT64_MAX);
   int init_wash_heap(WashHeap &heap, const int64_t heap_size);
   int prepare_wash_structs();
   void reuse_wash_structs();
@@ -230,6 +239,10 @@ private:
   int64_t block_payload_size_;
   ObKVMemBlockHandle *mb_handles_;
   ObFixedQueue<ObKVMemBlockHandle> mb_handles_pool_;
+  GlobalHazardVersion mb_hazard_version_;
+  // washed memblocks whose readers did not leave in time, reclaimed by the wash thread
+  lib::ObMutex quiescing_lock_;
+  HazardList quiescing_list_;
 
   //data structures for wash
   lib::ObMutex wash_out_lock_;
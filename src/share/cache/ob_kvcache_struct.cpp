@@ -67,6 +67,11 @@ void ObKVCacheStatus::reset()
   base_mb_score_ = 0;
   hold_size_ = 0;
   total_miss_cnt_ = 0;
+  need_admission_ = false;
+  total_admit_cnt_.reset();
+  total_reject_cnt_.reset();
+  rebalance_weight_ = 1.0;
+  marginal_utility_ = -1;
 }
 
 /*
@@ -57,6 +57,17 @@ public:
   virtual int deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const = 0;
 };
 
+// Read a value in place without holding a ObKVCacheHandle, the value is only valid during
+// read(). Memblocks can not be washed until read() returns, so it should be short, and must
+// not access kvcache or allocate memory which may trigger sync wash of kvcache.
+class ObIKVCacheValueReader
+{
+public:
+  ObIKVCacheValueReader() {}
+  virtual ~ObIKVCacheValueReader() {}
+  virtual int read(const ObIKVCacheValue &value) = 0;
+};
+
 struct ObKVCachePair
 {
   uint32_t magic_;
@@ -188,7 +199,9 @@ public:
   inline int64_t get_hold_size() const { return ATOMIC_LOAD(&hold_size_); }
   void reset();
   TO_STRING_KV(KP_(config), K_(kv_cnt), K_(store_size), K_(map_size), K_(lru_mb_cnt),
-      K_(lfu_mb_cnt), K_(base_mb_score), K_(hold_size));
+      K_(lfu_mb_cnt), K_(base_mb_score), K_(hold_size), K_(need_admission),
+      "admit_cnt", total_admit_cnt_.value(), "reject_cnt", total_reject_cnt_.value(),
+      K_(rebalance_weight), K_(marginal_utility));
 
   const ObKVCacheConfig *config_;
   ObPCNonAtomicCounter total_put_cnt_;
@@ -203,6 +216,15 @@ public:
   double base_mb_score_;
   // guarantee at least hold_size_ memory left in cache after wash
   int64_t hold_size_;
+  // put is filtered by admission policy when the tenant cache is being washed
+  bool need_admission_;
+  ObPCNonAtomicCounter total_admit_cnt_;
+  ObPCNonAtomicCounter total_reject_cnt_;
+  // multiplied into the score of mbs, set by rebalance according to the miss ratio curves
+  // of caches in the same tenant, so caches gaining more hits per MB keep more memory
+  double rebalance_weight_;
+  // hits per MB gained by growing the cache, negative if unknown
+  double marginal_utility_;
 };
 
 struct ObKVCacheInfo
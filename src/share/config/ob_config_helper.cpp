@@ -180,6 +180,28 @@ bool ObConfigCompressFuncChecker::check(const ObConfigItem &t) const
   return is_valid;
 }
 
+bool ObConfigPerfCompressFuncChecker::check(const ObConfigItem &t) const
+{
+  bool is_valid = false;
+  for (int i = 0; i < ARRAYSIZEOF(common::perf_compress_funcs) && !is_valid; ++i) {
+    if (0 == ObString::make_string(perf_compress_funcs[i]).case_compare(t.str())) {
+      is_valid = true;
+    }
+  }
+  return is_valid;
+}
+
+bool ObConfigBatchRpcCompressFuncChecker::check(const ObConfigItem &t) const
+{
+  bool is_valid = false;
+  for (int i = 0; i < ARRAYSIZEOF(common::batch_rpc_compress_funcs) && !is_valid; ++i) {
+    if (0 == ObString::make_string(batch_rpc_compress_funcs[i]).case_compare(t.str())) {
+      is_valid = true;
+    }
+  }
+  return is_valid;
+}
+
 bool ObConfigResourceLimitSpecChecker::check(const ObConfigItem &t) const
 {
   ObResourceLimit rl;
@@ -590,6 +612,17 @@ bool ObConfigUseLargePagesChecker::check(const ObConfigItem &t) const
   return is_valid;
 }
 
+bool ObConfigHugePagePolicyChecker::check(const ObConfigItem &t) const
+{
+  bool is_valid = false;
+  for (int i = 0; i < ARRAYSIZEOF(lib::huge_page_policy_confs) && !is_valid; i++) {
+    if (0 == ObString::make_string(lib::huge_page_policy_confs[i]).case_compare(t.str())) {
+      is_valid = true;
+    }
+  }
+  return is_valid;
+}
+
 bool ObConfigAuditModeChecker::check(const ObConfigItem &t) const
 {
   ObString v_str(t.str());
@@ -598,6 +631,14 @@ bool ObConfigAuditModeChecker::check(const ObConfigItem &t) const
          0 == v_str.case_compare("MYSQL");
 }
 
+bool ObConfigIOEngineChecker::check(const ObConfigItem &t) const
+{
+  ObString v_str(t.str());
+  return 0 == v_str.case_compare("libaio") ||
+         0 == v_str.case_compare("io_uring") ||
+         0 == v_str.case_compare("io_uring_sqpoll");
+}
+
 bool ObConfigBoolParser::get(const char *str, bool &valid)
 {
   bool value = true;
@@ -215,6 +215,28 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObConfigCompressFuncChecker);
 };
 
+class ObConfigPerfCompressFuncChecker
+  : public ObConfigChecker
+{
+public:
+  ObConfigPerfCompressFuncChecker() {}
+  virtual ~ObConfigPerfCompressFuncChecker() {}
+  bool check(const ObConfigItem &t) const;
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObConfigPerfCompressFuncChecker);
+};
+
+class ObConfigBatchRpcCompressFuncChecker
+  : public ObConfigChecker
+{
+public:
+  ObConfigBatchRpcCompressFuncChecker() {}
+  virtual ~ObConfigBatchRpcCompressFuncChecker() {}
+  bool check(const ObConfigItem &t) const;
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObConfigBatchRpcCompressFuncChecker);
+};
+
 class ObConfigResourceLimitSpecChecker
   : public ObConfigChecker
 {
@@ -270,6 +292,17 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObConfigUseLargePagesChecker);
 };
 
+class ObConfigHugePagePolicyChecker
+  : public ObConfigChecker
+{
+public:
+  ObConfigHugePagePolicyChecker() {}
+  virtual ~ObConfigHugePagePolicyChecker() {}
+  bool check(const ObConfigItem &t) const;
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObConfigHugePagePolicyChecker);
+};
+
 class ObConfigLogLevelChecker
   : public ObConfigChecker
 {
@@ -427,6 +460,19 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObConfigAuditModeChecker);
 };
 
+class ObConfigIOEngineChecker
+  : public ObConfigChecker
+{
+public:
+  ObConfigIOEngineChecker() {}
+  virtual ~ObConfigIOEngineChecker() {}
+
+  bool check(const ObConfigItem &t) const;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObConfigIOEngineChecker);
+};
+
 class ObConfigOfsBlockVerifyIntervalChecker
   : public ObConfigChecker
 {
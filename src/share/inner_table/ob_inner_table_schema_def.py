@@ -6118,7 +6118,8 @@ def_table_schema(
   ('delete_row_count', 'int'),
   ('freeze_ts', 'int'),
   ('freeze_state', 'varchar:OB_MAX_CHAR_LENGTH'),
-  ('freeze_time_dist', 'varchar:OB_MAX_CHAR_LENGTH')
+  ('freeze_time_dist', 'varchar:OB_MAX_CHAR_LENGTH'),
+  ('read_amplification_compact_count', 'int')
   ],
   partition_columns = ['svr_ip', 'svr_port'],
   vtable_route_policy = 'distributed',
@@ -9799,6 +9800,10 @@ def_table_schema(
   ('end_scn', 'uint'),
   ('max_lsn', 'uint'),
   ('max_scn', 'uint'),
+  ('group_commit_wait_us', 'int'),
+  ('avg_flush_cost_us', 'int'),
+  ('group_size_histogram', 'varchar:512'),
+  ('group_wait_histogram', 'varchar:512'),
   ],
 
   partition_columns = ['svr_ip', 'svr_port'],
@@ -10081,6 +10086,9 @@ def_table_schema(
     ('unsubmitted_lsn', 'uint'),
     ('unsubmitted_log_scn', 'uint'),
     ('pending_cnt', 'int'),
+    ('replay_lag_us', 'int'),
+    ('active_queue_cnt', 'int'),
+    ('replaying_queue_cnt', 'int'),
   ],
 
   partition_columns = ['svr_ip', 'svr_port'],
@@ -10848,6 +10856,31 @@ def_table_schema(
 # 12360: __all_virtual_plan_table
 # 12361: __all_virtual_plan_real_info
 
+def_table_schema(
+  owner = 'zhaoruizhe.zrz',
+  table_name = '__all_virtual_kvcache_miss_ratio_curve',
+  table_type = 'VIRTUAL_TABLE',
+  table_id='12362',
+  gm_columns = [],
+  rowkey_columns = [
+  ],
+  normal_columns = [
+    ('svr_ip', 'varchar:MAX_IP_ADDR_LENGTH', 'false'),
+    ('svr_port', 'int'),
+    ('tenant_id', 'int'),
+    ('cache_id', 'int'),
+    ('cache_name', 'varchar:OB_MAX_KVCACHE_NAME_LENGTH'),
+    ('cache_size', 'int'),
+    ('rebalance_weight', 'number:38:3'),
+    ('marginal_utility', 'number:38:3'),
+    ('point_id', 'int'),
+    ('point_cache_size', 'int'),
+    ('point_hit_ratio', 'number:38:3'),
+  ],
+  partition_columns = ['svr_ip', 'svr_port'],
+  vtable_route_policy = 'distributed',
+)
+
 #
 # 余留位置
 #
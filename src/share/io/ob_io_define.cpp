@@ -362,6 +362,13 @@ ObIORequest::ObIORequest()
     trace_id_(),
     ret_code_(),
     retry_count_(0),
+    merge_next_(nullptr),
+    read_ahead_size_(0),
+    raw_merge_buf_(nullptr),
+    merge_buf_(nullptr),
+    merge_offset_(0),
+    merge_size_(0),
+    is_merge_buf_ready_(false),
     tenant_io_mgr_(),
     copied_callback_(nullptr),
     callback_buf_size_(0),    
@@ -426,6 +433,7 @@ void ObIORequest::destroy()
     io_info_.fd_.device_handle_->free_iocb(control_block_);
     control_block_ = nullptr;
   }
+  reset_merge();
   io_info_.reset();
   if (nullptr != raw_buf_ && nullptr != tenant_io_mgr_.get_ptr()) {
     tenant_io_mgr_.get_ptr()->io_allocator_.free(raw_buf_);
@@ -569,13 +577,16 @@ int ObIORequest::prepare()
     // delayed alloc buffer for read request here to reduce memory usage when io request enqueue
     LOG_WARN("alloc io buffer for read failed", K(ret), K(*this));
   } else if (FALSE_IT(tg.click("alloc_buf"))) {
+  } else if ((nullptr != merge_next_ || read_ahead_size_ > 0) && nullptr == raw_merge_buf_
+      && OB_FAIL(alloc_merge_buf())) {
+    LOG_WARN("alloc merge buffer failed", K(ret), K(*this));
   } else {
     if (io_info_.flag_.is_read()) {
       if (OB_FAIL(io_info_.fd_.device_handle_->io_prepare_pread(
               io_info_.fd_,
-              io_buf_,
-              io_size_,
-              io_offset_,
+              is_merged() ? merge_buf_ : io_buf_,
+              get_submit_size(),
+              is_merged() ? merge_offset_ : io_offset_,
               control_block_,
               this/*data*/))) {
         LOG_WARN("prepare io read failed", K(ret), K(*this));
@@ -600,6 +611,81 @@ int ObIORequest::prepare()
   return ret;
 }
 
+int ObIORequest::alloc_merge_buf()
+{
+  int ret = OB_SUCCESS;
+  int64_t begin_offset = io_offset_;
+  int64_t end_offset = io_offset_ + io_size_;
+  for (ObIORequest *req = merge_next_; OB_SUCC(ret) && nullptr != req; req = req->merge_next_) {
+    if (OB_ISNULL(req->io_buf_) && OB_FAIL(req->alloc_io_buf())) {
+      LOG_WARN("alloc io buffer for merged request failed", K(ret), K(*req));
+    } else {
+      begin_offset = min(begin_offset, req->io_offset_);
+      end_offset = max(end_offset, req->io_offset_ + req->io_size_);
+    }
+  }
+  if (OB_SUCC(ret) && read_ahead_size_ > 0) {
+    // bounded by the macro block when it is decided in ObIOSender::detect_sequential_read
+    end_offset += read_ahead_size_;
+  }
+  if (OB_FAIL(ret)) {
+  } else if (nullptr == merge_next_ && begin_offset == io_offset_ && end_offset == io_offset_ + io_size_) {
+    // nothing to merge or read ahead, read with its own buffer
+  } else if (OB_ISNULL(tenant_io_mgr_.get_ptr())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("tenant io manager is null", K(ret));
+  } else if (OB_ISNULL(raw_merge_buf_ = tenant_io_mgr_.get_ptr()->io_allocator_.alloc(
+          end_offset - begin_offset + DIO_READ_ALIGN_SIZE))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(begin_offset), K(end_offset));
+  } else {
+    merge_buf_ = reinterpret_cast<char *>(upper_align(reinterpret_cast<int64_t>(raw_merge_buf_), DIO_READ_ALIGN_SIZE));
+    merge_offset_ = begin_offset;
+    merge_size_ = end_offset - begin_offset;
+  }
+  return ret;
+}
+
+void ObIORequest::merge(ObIORequest &other)
+{
+  ObIORequest *tail = this;
+  while (nullptr != tail->merge_next_) {
+    tail = tail->merge_next_;
+  }
+  tail->merge_next_ = &other;
+}
+
+bool ObIORequest::is_in_merge_buf(const int64_t offset, const int64_t size) const
+{
+  return is_merged() && offset >= merge_offset_ && offset + size <= merge_offset_ + merge_size_;
+}
+
+int ObIORequest::copy_from_merge_buf(ObIORequest &req) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(req.io_buf_) || OB_UNLIKELY(!is_in_merge_buf(req.io_offset_, req.io_size_))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(req), K(*this));
+  } else {
+    MEMCPY(req.io_buf_, merge_buf_ + (req.io_offset_ - merge_offset_), req.io_size_);
+  }
+  return ret;
+}
+
+void ObIORequest::reset_merge()
+{
+  if (nullptr != raw_merge_buf_ && nullptr != tenant_io_mgr_.get_ptr()) {
+    tenant_io_mgr_.get_ptr()->io_allocator_.free(raw_merge_buf_);
+  }
+  merge_next_ = nullptr;
+  read_ahead_size_ = 0;
+  raw_merge_buf_ = nullptr;
+  merge_buf_ = nullptr;
+  merge_offset_ = 0;
+  merge_size_ = 0;
+  is_merge_buf_ready_ = false;
+}
+
 bool ObIORequest::can_callback() const
 {
   return nullptr != copied_callback_ && nullptr != io_buf_;
@@ -228,12 +228,21 @@ public:
   void dec_ref(const char *msg = nullptr);
   void inc_out_ref();
   void dec_out_ref();
+  // merged requests are read by one io into merge buffer, and copied to their own io buffer when io returns
+  void merge(ObIORequest &other);
+  bool is_merged() const { return merge_size_ > 0; }
+  int64_t get_submit_size() const { return is_merged() ? merge_size_ : io_size_; }
+  bool is_in_merge_buf(const int64_t offset, const int64_t size) const;
+  int copy_from_merge_buf(ObIORequest &req) const;
+  void reset_merge();
   VIRTUAL_TO_STRING_KV(K(is_inited_), K(is_finished_), K(is_canceled_), K(has_estimated_), K(io_info_), K(deadline_ts_),
       KP(control_block_), KP(raw_buf_), KP(io_buf_), K(io_offset_), K(io_size_), K(complete_size_),
       K(time_log_), KP(channel_), K(ref_cnt_), K(out_ref_cnt_),
-      K(trace_id_), K(ret_code_), K(retry_count_), K(callback_buf_size_), KP(copied_callback_), K(tenant_io_mgr_));
+      K(trace_id_), K(ret_code_), K(retry_count_), KP(merge_next_), K(read_ahead_size_), K(merge_offset_),
+      K(merge_size_), K(is_merge_buf_ready_), K(callback_buf_size_), KP(copied_callback_), K(tenant_io_mgr_));
 private:
   int alloc_aligned_io_buf();
+  int alloc_merge_buf();
 public:
   bool is_inited_;
   bool is_finished_;
@@ -256,6 +265,13 @@ public:
   ObCurTraceId::TraceId trace_id_;
   ObIORetCode ret_code_;
   int32_t retry_count_;
+  ObIORequest *merge_next_; // next request merged into this one
+  int64_t read_ahead_size_;
+  void *raw_merge_buf_;
+  char *merge_buf_;
+  int64_t merge_offset_;
+  int64_t merge_size_;
+  bool is_merge_buf_ready_; // data in merge buffer can be used by later requests, for read ahead
   ObRefHolder<ObTenantIOManager> tenant_io_mgr_;
   ObIOCallback *copied_callback_;
   int64_t callback_buf_size_;
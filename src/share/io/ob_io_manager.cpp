@@ -832,6 +832,14 @@ void ObTenantIOManager::print_io_status()
         need_print_io_config = true;
       }
     }
+    int64_t merged_count = 0;
+    int64_t read_ahead_count = 0;
+    int64_t read_ahead_hit_count = 0;
+    double saved_iops = 0;
+    io_usage_.get_coalesce_stat(merged_count, read_ahead_count, read_ahead_hit_count, saved_iops);
+    if (saved_iops > std::numeric_limits<double>::epsilon()) {
+      LOG_INFO("[IO STATUS]", K_(tenant_id), K(merged_count), K(read_ahead_count), K(read_ahead_hit_count), K(saved_iops));
+    }
     if (need_print_io_config) {
       ObArray<int64_t> queue_count_array;
       int ret = OB_SUCCESS;
@@ -125,6 +125,8 @@ public:
       K(io_allocator_), KPC(io_scheduler_), K(callback_mgr_));
 private:
   friend class ObIORequest;
+  friend class ObIOSender;
+  friend class ObAsyncIOChannel;
   bool is_inited_;
   bool is_working_;
   int64_t ref_cnt_;
@@ -54,6 +54,8 @@ void ObIOConfig::set_default_value()
   data_storage_error_tolerance_time_ = 300L * 1000L * 1000L; // 300s
   disk_io_thread_count_ = 8;
   data_storage_io_timeout_ms_ = 120L * 1000L; // 120s
+  enable_io_coalescing_ = false;
+  read_ahead_size_ = 0;
 }
 
 bool ObIOConfig::is_valid() const
@@ -63,7 +65,8 @@ bool ObIOConfig::is_valid() const
       && data_storage_warning_tolerance_time_ > 0
       && data_storage_error_tolerance_time_ >= data_storage_warning_tolerance_time_
       && disk_io_thread_count_ > 0 && disk_io_thread_count_ % 2 == 0 && disk_io_thread_count_ <= MAX_IO_THREAD_COUNT
-      && data_storage_io_timeout_ms_ > 0;
+      && data_storage_io_timeout_ms_ > 0
+      && read_ahead_size_ >= 0;
 }
 
 void ObIOConfig::reset()
@@ -74,6 +77,8 @@ void ObIOConfig::reset()
   data_storage_error_tolerance_time_ = 0;
   disk_io_thread_count_ = 0;
   data_storage_io_timeout_ms_ = 0;
+  enable_io_coalescing_ = false;
+  read_ahead_size_ = 0;
 }
 
 /******************             IOMemoryPool              **********************/
@@ -424,6 +429,12 @@ void ObIOStatDiff::reset()
 
 /******************             IOUsage              **********************/
 ObIOUsage::ObIOUsage()
+  : merged_count_(0),
+    read_ahead_count_(0),
+    read_ahead_hit_count_(0),
+    last_saved_io_count_(0),
+    last_calc_ts_(0),
+    avg_saved_iops_(0)
 {
   MEMSET(doing_request_count_, 0, sizeof(doing_request_count_));
 }
@@ -451,6 +462,13 @@ void ObIOUsage::calculate_io_usage()
       cur_io_estimator.diff(cur_io_stat, avg_iops_[i][j], avg_byte_[i][j], avg_rt_us_[i][j]);
     }
   }
+  const int64_t current_ts = ObTimeUtility::fast_current_time();
+  const int64_t saved_io_count = ATOMIC_LOAD(&merged_count_) + ATOMIC_LOAD(&read_ahead_hit_count_);
+  if (last_calc_ts_ > 0 && current_ts > last_calc_ts_) {
+    avg_saved_iops_ = static_cast<double>(saved_io_count - last_saved_io_count_) * 1000L * 1000L / (current_ts - last_calc_ts_);
+  }
+  last_saved_io_count_ = saved_io_count;
+  last_calc_ts_ = current_ts;
 }
 
 void ObIOUsage::get_io_usage(AvgItems &avg_iops, AvgItems &avg_bytes, AvgItems &avg_rt_us) const
@@ -475,6 +493,33 @@ bool ObIOUsage::is_request_doing(const ObIOCategory category) const
   return ATOMIC_LOAD(&doing_request_count_[static_cast<int>(category)]) > 0;
 }
 
+void ObIOUsage::record_merged_request(const int64_t merged_count)
+{
+  ATOMIC_FAA(&merged_count_, merged_count);
+}
+
+void ObIOUsage::record_read_ahead()
+{
+  ATOMIC_INC(&read_ahead_count_);
+}
+
+void ObIOUsage::record_read_ahead_hit()
+{
+  ATOMIC_INC(&read_ahead_hit_count_);
+}
+
+void ObIOUsage::get_coalesce_stat(
+    int64_t &merged_count,
+    int64_t &read_ahead_count,
+    int64_t &read_ahead_hit_count,
+    double &avg_saved_iops) const
+{
+  merged_count = ATOMIC_LOAD(&merged_count_);
+  read_ahead_count = ATOMIC_LOAD(&read_ahead_count_);
+  read_ahead_hit_count = ATOMIC_LOAD(&read_ahead_hit_count_);
+  avg_saved_iops = avg_saved_iops_;
+}
+
 int64_t ObIOUsage::to_string(char* buf, const int64_t buf_len) const
 {
   int64_t pos = 0;
@@ -489,6 +534,8 @@ int64_t ObIOUsage::to_string(char* buf, const int64_t buf_len) const
     need_comma = true;
   }
   BUF_PRINTF("]");
+  J_COMMA();
+  J_KV(K_(merged_count), K_(read_ahead_count), K_(read_ahead_hit_count), K_(avg_saved_iops));
   J_OBJ_END();
   return pos;
 }
@@ -676,7 +723,9 @@ ObIOSender::ObIOSender(ObIAllocator &allocator)
     tg_id_(-1),
     io_queue_(nullptr),
     queue_cond_(),
-    sender_req_count_(0)
+    sender_req_count_(0),
+    stream_lock_(),
+    last_release_stream_ts_(0)
 {
 
 }
@@ -757,6 +806,7 @@ void ObIOSender::destroy()
     TG_DESTROY(tg_id_);
     tg_id_ = -1;
   }
+  release_read_streams(OB_INVALID_TENANT_ID, false/*only_expired*/);
   DestroyPhyqueueMapFn destry_phyqueue_map_fn(allocator_);
   tenant_map_.foreach_refactored(destry_phyqueue_map_fn);
   tenant_map_.destroy();
@@ -975,6 +1025,9 @@ int ObIOSender::remove_phy_queue(const uint64_t tenant_id)
       }
     }
   }
+  if (is_inited_) {
+    release_read_streams(tenant_id, false/*only_expired*/);
+  }
   return ret;
 }
 
@@ -1008,6 +1061,7 @@ void ObIOSender::pop_and_submit()
   if (OB_UNLIKELY(!is_inited_)) {
     ret = OB_NOT_INIT;
     LOG_WARN("not init", K(ret));
+  } else if (FALSE_IT(release_read_streams(OB_INVALID_TENANT_ID, true/*only_expired*/))) {
   } else if (OB_FAIL(dequeue_request(req))) {
     if (OB_EAGAIN == ret || OB_ENTRY_NOT_EXIST == ret) {
       // ignore
@@ -1021,12 +1075,25 @@ void ObIOSender::pop_and_submit()
     RequestHolder req_holder(req);
     req->sender_ = this;
     bool is_retry = false;
+    bool is_read_ahead_hit = false;
     ObTraceIDGuard trace_guard(req->trace_id_);
     if (req->is_canceled_) {
       ret = OB_CANCELED;
     } else {
-      if (OB_FAIL(submit(*req))) {
+      if (can_coalesce(*req)) {
+        int tmp_ret = OB_SUCCESS;
+        if (OB_TMP_FAIL(read_from_read_ahead_buf(*req, is_read_ahead_hit))) {
+          LOG_WARN("read from read ahead buffer failed", K(tmp_ret), KPC(req));
+        } else if (!is_read_ahead_hit) {
+          merge_adjacent_requests(*req);
+          detect_sequential_read(*req);
+        }
+      }
+      if (is_read_ahead_hit) {
+        // already finished with data read ahead
+      } else if (OB_FAIL(submit(*req))) {
         if (OB_EAGAIN == ret) {
+          split_merged_requests(*req);
           req->dec_ref("phyqueue_dec"); // ref for io queue
           ObIORequest &re_req = *req;
           if (OB_FAIL(enqueue_request(re_req))) {
@@ -1041,6 +1108,8 @@ void ObIOSender::pop_and_submit()
     }
     // the request has only three result here: submitted, failed, retrying
     if (OB_FAIL(ret)) {
+      // requests merged into the failed one are scheduled again by themselves
+      split_merged_requests(*req);
       req->finish(ret);
     }
     if (OB_LIKELY(!is_retry)) {
@@ -1095,6 +1164,238 @@ int ObIOSender::submit(ObIORequest &req)
 }
 
 
+void ObIOSender::ReadStream::reset()
+{
+  fd_.reset();
+  end_offset_ = 0;
+  read_ahead_end_ = 0;
+  sequential_count_ = 0;
+  access_ts_ = 0;
+  read_ahead_req_ = nullptr;
+}
+
+bool ObIOSender::can_coalesce(const ObIORequest &req)
+{
+  return OB_IO_MANAGER.get_io_config().enable_io_coalescing_
+      && req.get_flag().is_read()
+      && !req.get_flag().is_sync()
+      && req.io_info_.fd_.is_block_file()
+      && !req.io_info_.fd_.is_super_block()
+      && nullptr == req.io_buf_
+      && !req.is_merged();
+}
+
+// Move reads of the same macro block waiting in the same phy queue into req, so they are read by one io.
+// Only requests enqueued within the merge window and not far from the merged range are merged.
+void ObIOSender::merge_adjacent_requests(ObIORequest &req)
+{
+  int ret = OB_SUCCESS;
+  ObThreadCondGuard cond_guard(queue_cond_);
+  ObIOCategoryQueues *io_category_queues = nullptr;
+  if (OB_FAIL(cond_guard.get_ret())) {
+    LOG_ERROR("guard queue condition failed", K(ret));
+  } else if (OB_FAIL(tenant_map_.get_refactored(req.io_info_.tenant_id_, io_category_queues))) {
+    LOG_WARN("get_refactored tenant_map failed", K(ret), K(req));
+  } else {
+    ObPhyQueue *phy_queue = &(io_category_queues->phy_queues_[static_cast<int>(req.get_category())]);
+    int64_t begin_offset = req.io_offset_;
+    int64_t end_offset = req.io_offset_ + req.io_size_;
+    int64_t merge_count = 0;
+    int64_t scan_count = 0;
+    ObIORequest *cur = phy_queue->req_list_.get_first();
+    while (cur != phy_queue->req_list_.get_header()
+        && scan_count < MAX_MERGE_SCAN_COUNT && merge_count < MAX_MERGE_COUNT) {
+      ObIORequest *next = cur->get_next();
+      const int64_t cur_end_offset = cur->io_offset_ + cur->io_size_;
+      ++scan_count;
+      if (cur->io_info_.fd_ == req.io_info_.fd_
+          && !cur->is_canceled_
+          && can_coalesce(*cur)
+          && cur->time_log_.enqueue_ts_ - req.time_log_.enqueue_ts_ <= MERGE_WINDOW_US
+          && cur->io_offset_ <= end_offset + MAX_MERGE_GAP
+          && cur_end_offset + MAX_MERGE_GAP >= begin_offset
+          && max(end_offset, cur_end_offset) - min(begin_offset, cur->io_offset_) <= MAX_MERGE_SIZE) {
+        phy_queue->req_list_.remove(cur);
+        ATOMIC_DEC(&sender_req_count_);
+        cur->time_log_.dequeue_ts_ = ObTimeUtility::fast_current_time();
+        cur->sender_ = this;
+        cur->inc_ref("merge_inc"); // ref for merged request
+        cur->dec_ref("phyqueue_dec"); // ref for phy_queue
+        req.merge(*cur);
+        begin_offset = min(begin_offset, cur->io_offset_);
+        end_offset = max(end_offset, cur_end_offset);
+        ++merge_count;
+      }
+      cur = next;
+    }
+    if (merge_count > 0 && phy_queue->req_list_.is_empty()) {
+      // same as the phy queue popped to empty
+      if (OB_FAIL(io_queue_->remove_from_heap(phy_queue))) {
+        LOG_WARN("remove phy queue from heap failed", K(ret));
+      } else {
+        phy_queue->reset_time_info();
+        int tmp_ret = io_queue_->push_phyqueue(phy_queue);
+        if (OB_UNLIKELY(OB_SUCCESS != tmp_ret)) {
+          LOG_WARN("re_into heap failed", K(tmp_ret));
+          abort();
+        }
+      }
+    }
+    if (merge_count > 0) {
+      LOG_DEBUG("merge adjacent io requests", K(merge_count), K(begin_offset), K(end_offset), K(req));
+    }
+  }
+}
+
+void ObIOSender::split_merged_requests(ObIORequest &req)
+{
+  int ret = OB_SUCCESS;
+  ObIORequest *cur = req.merge_next_;
+  req.reset_merge();
+  while (nullptr != cur) {
+    ObIORequest *next = cur->merge_next_;
+    cur->merge_next_ = nullptr;
+    if (OB_FAIL(enqueue_request(*cur))) {
+      LOG_WARN("push merged request to queue failed", K(ret), KPC(cur));
+      cur->finish(ret);
+    }
+    cur->dec_ref("merge_dec"); // ref for merged request
+    cur = next;
+  }
+}
+
+int ObIOSender::read_from_read_ahead_buf(ObIORequest &req, bool &is_hit)
+{
+  int ret = OB_SUCCESS;
+  ObIORequest *read_ahead_req = nullptr;
+  is_hit = false;
+  {
+    ObSpinLockGuard guard(stream_lock_);
+    for (int64_t i = 0; i < MAX_READ_STREAM_COUNT; ++i) {
+      ReadStream &stream = read_streams_[i];
+      if (stream.fd_ == req.io_info_.fd_) {
+        if (nullptr != stream.read_ahead_req_
+            && ATOMIC_LOAD(&stream.read_ahead_req_->is_merge_buf_ready_)
+            && stream.read_ahead_req_->is_in_merge_buf(req.io_offset_, req.io_size_)) {
+          read_ahead_req = stream.read_ahead_req_;
+          read_ahead_req->inc_ref("read_ahead_inc");
+          stream.end_offset_ = max(stream.end_offset_, req.io_offset_ + req.io_size_);
+          stream.access_ts_ = ObTimeUtility::fast_current_time();
+        }
+        break;
+      }
+    }
+  }
+  if (nullptr != read_ahead_req) {
+    if (OB_FAIL(req.alloc_io_buf())) {
+      LOG_WARN("alloc io buffer failed", K(ret), K(req));
+    } else if (OB_FAIL(read_ahead_req->copy_from_merge_buf(req))) {
+      LOG_WARN("copy from read ahead buffer failed", K(ret), K(req), KPC(read_ahead_req));
+    } else {
+      is_hit = true;
+      req.complete_size_ = req.io_size_;
+      req.time_log_.submit_ts_ = ObTimeUtility::fast_current_time();
+      req.time_log_.return_ts_ = req.time_log_.submit_ts_;
+      req.tenant_io_mgr_.get_ptr()->io_usage_.record_read_ahead_hit();
+      if (!req.is_canceled_ && req.can_callback()) {
+        int tmp_ret = OB_SUCCESS;
+        if (OB_TMP_FAIL(req.tenant_io_mgr_.get_ptr()->enqueue_callback(req))) {
+          LOG_WARN("push io request into callback queue failed", K(tmp_ret), K(req));
+          req.finish(tmp_ret);
+        }
+      } else {
+        req.finish(OB_SUCCESS);
+      }
+    }
+    read_ahead_req->dec_ref("read_ahead_dec");
+  }
+  return ret;
+}
+
+// Track the last read position of recently read macro blocks, if reads of a macro block keep going forward,
+// let req read ahead data after it, and keep req to serve the following reads from its merge buffer.
+void ObIOSender::detect_sequential_read(ObIORequest &req)
+{
+  const int64_t read_ahead_size = OB_IO_MANAGER.get_io_config().read_ahead_size_;
+  const int64_t macro_block_size = OB_SERVER_BLOCK_MGR.get_macro_block_size();
+  const int64_t current_ts = ObTimeUtility::fast_current_time();
+  int64_t end_offset = req.io_offset_ + req.io_size_;
+  for (ObIORequest *cur = req.merge_next_; nullptr != cur; cur = cur->merge_next_) {
+    end_offset = max(end_offset, cur->io_offset_ + cur->io_size_);
+  }
+  ObIORequest *released_req = nullptr;
+  {
+    ObSpinLockGuard guard(stream_lock_);
+    ReadStream *stream = nullptr;
+    for (int64_t i = 0; i < MAX_READ_STREAM_COUNT; ++i) {
+      ReadStream &cur_stream = read_streams_[i];
+      if (cur_stream.fd_ == req.io_info_.fd_) {
+        stream = &cur_stream;
+        break;
+      } else if (nullptr == stream || cur_stream.access_ts_ < stream->access_ts_) {
+        stream = &cur_stream; // replace the least recently used stream if not found
+      }
+    }
+    if (stream->fd_ != req.io_info_.fd_) {
+      released_req = stream->read_ahead_req_;
+      stream->reset();
+      stream->fd_ = req.io_info_.fd_;
+      stream->sequential_count_ = 1;
+    } else if (req.io_offset_ + DIO_READ_ALIGN_SIZE >= stream->end_offset_
+        && req.io_offset_ <= stream->end_offset_ + MAX_MERGE_GAP) {
+      ++stream->sequential_count_;
+    } else {
+      stream->sequential_count_ = 1;
+    }
+    stream->end_offset_ = end_offset;
+    stream->access_ts_ = current_ts;
+    if (read_ahead_size > 0
+        && stream->sequential_count_ >= SEQUENTIAL_READ_THRESHOLD
+        && end_offset >= stream->read_ahead_end_
+        && end_offset < macro_block_size) {
+      released_req = stream->read_ahead_req_;
+      // never read ahead across the macro block
+      stream->read_ahead_end_ = min(end_offset + read_ahead_size, macro_block_size);
+      req.read_ahead_size_ = stream->read_ahead_end_ - end_offset;
+      req.inc_ref("read_ahead_inc"); // ref for read stream
+      stream->read_ahead_req_ = &req;
+      req.tenant_io_mgr_.get_ptr()->io_usage_.record_read_ahead();
+    }
+  }
+  if (nullptr != released_req) {
+    released_req->dec_ref("read_ahead_dec");
+  }
+}
+
+void ObIOSender::release_read_streams(const uint64_t tenant_id, const bool only_expired)
+{
+  const int64_t current_ts = ObTimeUtility::fast_current_time();
+  if (!only_expired || current_ts - ATOMIC_LOAD(&last_release_stream_ts_) > READ_STREAM_EXPIRE_US) {
+    ObIORequest *released_reqs[MAX_READ_STREAM_COUNT];
+    int64_t released_count = 0;
+    {
+      ObSpinLockGuard guard(stream_lock_);
+      for (int64_t i = 0; i < MAX_READ_STREAM_COUNT; ++i) {
+        ReadStream &stream = read_streams_[i];
+        if (!stream.is_valid()) {
+        } else if (only_expired && current_ts - stream.access_ts_ <= READ_STREAM_EXPIRE_US) {
+        } else if (OB_INVALID_TENANT_ID != tenant_id && (nullptr == stream.read_ahead_req_
+            || tenant_id != stream.read_ahead_req_->io_info_.tenant_id_)) {
+        } else {
+          if (nullptr != stream.read_ahead_req_) {
+            released_reqs[released_count++] = stream.read_ahead_req_;
+          }
+          stream.reset();
+        }
+      }
+      ATOMIC_STORE(&last_release_stream_ts_, current_ts);
+    }
+    for (int64_t i = 0; i < released_count; ++i) {
+      released_reqs[i]->dec_ref("read_ahead_dec");
+    }
+  }
+}
+
 /******************             IOScheduler              **********************/
 
 ObIOScheduler::ObIOScheduler(const ObIOConfig &io_config, ObIAllocator &allocator)
@@ -1207,7 +1508,11 @@ int ObIOScheduler::schedule_request(ObIOClock &io_clock, ObIORequest &req)
     // push the requeust into sender queue, balance channel queue count by random twice
     const int64_t idx1 = ObRandom::rand(0, senders_.count() - 1);
     const int64_t idx2 = ObRandom::rand(0, senders_.count() - 1);
-    const int64_t sender_idx = senders_.at(idx1)->sender_req_count_ < senders_.at(idx2)->sender_req_count_ ? idx1 : idx2;
+    int64_t sender_idx = senders_.at(idx1)->sender_req_count_ < senders_.at(idx2)->sender_req_count_ ? idx1 : idx2;
+    if (ObIOSender::can_coalesce(req)) {
+      // reads of the same macro block go to the same sender, so that they can be merged
+      sender_idx = req.io_info_.fd_.hash() % senders_.count();
+    }
     ObIOSender *sender = senders_.at(sender_idx);
     if (req.io_info_.fd_.device_handle_->media_id_ != schedule_media_id_) {
       // direct submit
@@ -1447,7 +1752,7 @@ int ObAsyncIOChannel::submit(ObIORequest &req)
     LOG_DEBUG("reach max io depth", K(ret), K(device_channel_->used_io_depth_), K(device_channel_->max_io_depth_));
   } else {
     ATOMIC_INC(&submit_count_);
-    ATOMIC_FAA(&device_channel_->used_io_depth_, get_io_depth(req.io_size_));
+    ATOMIC_FAA(&device_channel_->used_io_depth_, get_io_depth(req.get_submit_size()));
     req.channel_ = this;
     req.time_log_.submit_ts_ = ObTimeUtility::fast_current_time();
     req.inc_ref("os_inc"); // ref for file system
@@ -1477,7 +1782,8 @@ void ObAsyncIOChannel::cancel(ObIORequest &req)
     } else {
       RequestHolder holder(&req);
       ATOMIC_DEC(&submit_count_);
-      ATOMIC_FAS(&device_channel_->used_io_depth_, get_io_depth(req.io_size_));
+      ATOMIC_FAS(&device_channel_->used_io_depth_, get_io_depth(req.get_submit_size()));
+      retry_merged_requests(req, false/*retry_self*/);
       req.dec_ref("os_dec"); // ref for file system
       LOG_DEBUG("The IO Request has been canceled!");
       LOG_WARN("Shouldn't go here, io cancel not supported", K(ret), K(req));
@@ -1511,10 +1817,14 @@ void ObAsyncIOChannel::get_events()
         RequestHolder holder(req);
         req->dec_ref("os_dec"); // ref for file system
         req->time_log_.return_ts_ = io_return_time;
-        ATOMIC_FAS(&device_channel_->used_io_depth_, req->io_size_);
+        ATOMIC_FAS(&device_channel_->used_io_depth_, req->get_submit_size());
         const int system_errno = io_events_->get_ith_ret_code(i);
         const int complete_size = io_events_->get_ith_ret_bytes(i);
-        if (OB_LIKELY(0 == system_errno)) { // io succ
+        if (req->is_merged()) {
+          if (OB_FAIL(on_merged_return(*req, system_errno, complete_size))) {
+            LOG_WARN("process merged io request failed", K(ret), K(system_errno), K(complete_size), K(*req));
+          }
+        } else if (OB_LIKELY(0 == system_errno)) { // io succ
           if (complete_size == req->io_size_) { // full complete
             LOG_DEBUG("Success to get io event", K(*req), K(complete_size));
             if (OB_FAIL(on_full_return(*req))) {
@@ -1645,6 +1955,99 @@ int ObAsyncIOChannel::on_failed(ObIORequest &req, const ObIORetCode &ret_code)
   return ret;
 }
 
+int ObAsyncIOChannel::on_merged_return(ObIORequest &req, const int system_errno, const int64_t complete_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_LIKELY(0 == system_errno && complete_size == req.merge_size_)) {
+    // copy data of all merged requests before any of them is called back
+    for (ObIORequest *cur = &req; OB_SUCC(ret) && nullptr != cur; cur = cur->merge_next_) {
+      if (OB_FAIL(req.copy_from_merge_buf(*cur))) {
+        LOG_WARN("copy from merge buffer failed", K(ret), K(*cur), K(req));
+      }
+    }
+  } else {
+    ret = OB_IO_ERROR;
+    LOG_WARN("merged io request not fully finished, retry separately", K(ret), K(system_errno),
+        K(complete_size), K(req));
+  }
+  if (OB_FAIL(ret)) {
+    retry_merged_requests(req, true/*retry_self*/);
+    ret = OB_SUCCESS;
+  } else {
+    int tmp_ret = OB_SUCCESS;
+    int64_t merged_count = 0;
+    ObIORequest *cur = req.merge_next_;
+    req.merge_next_ = nullptr;
+    if (req.read_ahead_size_ > 0) {
+      // keep the merge buffer for following sequential reads
+      ATOMIC_STORE(&req.is_merge_buf_ready_, true);
+    } else {
+      req.reset_merge();
+    }
+    if (OB_TMP_FAIL(on_full_return(req))) {
+      LOG_WARN("process full return io request failed", K(tmp_ret), K(req));
+    }
+    while (nullptr != cur) {
+      ObIORequest *next = cur->merge_next_;
+      cur->merge_next_ = nullptr;
+      cur->channel_ = this;
+      cur->time_log_.submit_ts_ = req.time_log_.submit_ts_;
+      cur->time_log_.return_ts_ = req.time_log_.return_ts_;
+      if (OB_TMP_FAIL(on_full_return(*cur))) {
+        LOG_WARN("process full return io request failed", K(tmp_ret), K(*cur));
+      }
+      cur->dec_ref("merge_dec"); // ref for merged request
+      ++merged_count;
+      cur = next;
+    }
+    req.tenant_io_mgr_.get_ptr()->io_usage_.record_merged_request(merged_count);
+  }
+  return ret;
+}
+
+// Submit requests merged into req by themselves, used when merged io is not fully finished.
+void ObAsyncIOChannel::retry_merged_requests(ObIORequest &req, const bool retry_self)
+{
+  ObIORequest *cur = req.merge_next_;
+  req.reset_merge();
+  if (retry_self) {
+    resubmit(req);
+  }
+  while (nullptr != cur) {
+    ObIORequest *next = cur->merge_next_;
+    cur->merge_next_ = nullptr;
+    resubmit(*cur);
+    cur->dec_ref("merge_dec"); // ref for merged request
+    cur = next;
+  }
+}
+
+void ObAsyncIOChannel::resubmit(ObIORequest &req)
+{
+  int ret = OB_SUCCESS;
+  req.complete_size_ = 0;
+  if (req.is_canceled_) {
+    ret = OB_CANCELED;
+  } else if (OB_FAIL(req.prepare())) {
+    LOG_WARN("prepare io request failed", K(ret), K(req));
+  } else if (OB_FAIL(submit(req))) {
+    if (OB_EAGAIN == ret && OB_NOT_NULL(req.sender_)) {
+      // the channel is full, wait in io queue as the requests not submitted yet
+      if (OB_FAIL(req.sender_->enqueue_request(req))) {
+        LOG_WARN("push request to queue for retry failed", K(ret), K(req));
+      }
+    } else {
+      LOG_WARN("submit io request failed", K(ret), K(req));
+    }
+  }
+  if (OB_FAIL(ret)) {
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = on_failed(req, ObIORetCode(ret)))) {
+      LOG_WARN("deal with failed request failed", K(tmp_ret), K(ret), K(req));
+    }
+  }
+}
+
 
 /******************             SyncIOChannel              **********************/
 ObSyncIOChannel::ObSyncIOChannel()
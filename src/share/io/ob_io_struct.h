@@ -45,7 +45,9 @@ public:
       K(data_storage_warning_tolerance_time_),
       K(data_storage_error_tolerance_time_),
       K(disk_io_thread_count_),
-      K(data_storage_io_timeout_ms_));
+      K(data_storage_io_timeout_ms_),
+      K(enable_io_coalescing_),
+      K(read_ahead_size_));
 
 public:
   static const int64_t MAX_IO_THREAD_COUNT = 32 * 2;
@@ -57,6 +59,9 @@ public:
   // resource related
   int64_t disk_io_thread_count_;
   int64_t data_storage_io_timeout_ms_;
+  // coalescing related
+  bool enable_io_coalescing_;
+  int64_t read_ahead_size_;
 };
 
 template<int64_t SIZE>
@@ -147,6 +152,11 @@ public:
   void record_request_start(const ObIORequest &req);
   void record_request_finish(const ObIORequest &req);
   bool is_request_doing(const ObIOCategory category) const;
+  void record_merged_request(const int64_t merged_count);
+  void record_read_ahead();
+  void record_read_ahead_hit();
+  void get_coalesce_stat(int64_t &merged_count, int64_t &read_ahead_count, int64_t &read_ahead_hit_count,
+                         double &avg_saved_iops) const;
   int64_t to_string(char* buf, const int64_t buf_len) const;
 private:
   ObIOStat io_stats_[static_cast<int>(ObIOCategory::MAX_CATEGORY)][static_cast<int>(ObIOMode::MAX_MODE)];
@@ -155,6 +165,13 @@ private:
   AvgItems avg_byte_;
   AvgItems avg_rt_us_;
   int64_t doing_request_count_[static_cast<int>(ObIOCategory::MAX_CATEGORY)];
+  // requests merged into other requests or served by read ahead buffer, each of them saves one io
+  int64_t merged_count_;
+  int64_t read_ahead_count_;
+  int64_t read_ahead_hit_count_;
+  int64_t last_saved_io_count_;
+  int64_t last_calc_ts_;
+  double avg_saved_iops_;
 };
 
 class ObCpuUsage final
@@ -225,6 +242,36 @@ public:
   void pop_and_submit();
   int64_t calc_wait_timeout(const int64_t queue_deadline);
   int submit(ObIORequest &req);
+  static bool can_coalesce(const ObIORequest &req);
+  void merge_adjacent_requests(ObIORequest &req);
+  void split_merged_requests(ObIORequest &req);
+  int read_from_read_ahead_buf(ObIORequest &req, bool &is_hit);
+  void detect_sequential_read(ObIORequest &req);
+  void release_read_streams(const uint64_t tenant_id, const bool only_expired);
+
+  // sequential read detection of one macro block
+  struct ReadStream
+  {
+    ReadStream() { reset(); }
+    void reset();
+    bool is_valid() const { return fd_.is_valid(); }
+    TO_STRING_KV(K_(fd), K_(end_offset), K_(read_ahead_end), K_(sequential_count), K_(access_ts),
+        KP_(read_ahead_req));
+    ObIOFd fd_;
+    int64_t end_offset_;
+    int64_t read_ahead_end_;
+    int64_t sequential_count_;
+    int64_t access_ts_;
+    ObIORequest *read_ahead_req_; // holds the merge buffer with read ahead data
+  };
+  static const int64_t MAX_MERGE_COUNT = 32;
+  static const int64_t MAX_MERGE_SCAN_COUNT = 64;
+  static const int64_t MAX_MERGE_SIZE = 2L * 1024L * 1024L; // 2MB
+  static const int64_t MAX_MERGE_GAP = 16L * 1024L; // 16KB
+  static const int64_t MERGE_WINDOW_US = 2L * 1000L; // 2ms
+  static const int64_t MAX_READ_STREAM_COUNT = 16;
+  static const int64_t SEQUENTIAL_READ_THRESHOLD = 3;
+  static const int64_t READ_STREAM_EXPIRE_US = 1000L * 1000L; // 1s
 
   bool is_inited_;
   ObIAllocator &allocator_;
@@ -234,6 +281,9 @@ public:
   ObThreadCond queue_cond_;
   hash::ObHashMap<uint64_t, ObIOCategoryQueues *> tenant_map_;
   int64_t sender_req_count_;
+  ObSpinLock stream_lock_;
+  ReadStream read_streams_[MAX_READ_STREAM_COUNT];
+  int64_t last_release_stream_ts_;
 };
 
 
@@ -312,6 +362,9 @@ private:
   int on_partial_retry(ObIORequest &req, const int64_t complete_size);
   int on_full_retry(ObIORequest &req);
   int on_failed(ObIORequest &req, const ObIORetCode &ret_code);
+  int on_merged_return(ObIORequest &req, const int system_errno, const int64_t complete_size);
+  void retry_merged_requests(ObIORequest &req, const bool retry_self);
+  void resubmit(ObIORequest &req);
 
 private:
   static const int32_t MAX_AIO_EVENT_CNT = 512;
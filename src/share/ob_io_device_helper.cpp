@@ -151,10 +151,11 @@ int ObIODeviceWrapper::init(
     const char *sstable_dir,
     const int64_t block_size,
     const int64_t data_disk_percentage,
-    const int64_t data_disk_size)
+    const int64_t data_disk_size,
+    const char *io_engine)
 {
   int ret = OB_SUCCESS;
-  const int64_t MAX_IOD_OPT_CNT = 5;
+  const int64_t MAX_IOD_OPT_CNT = 6;
   ObIODOpt iod_opt_array[MAX_IOD_OPT_CNT];
   ObIODOpts iod_opts;
   iod_opts.opts_ = iod_opt_array;
@@ -177,7 +178,11 @@ int ObIODeviceWrapper::init(
     iod_opt_array[2].set("block_size", block_size);
     iod_opt_array[3].set("datafile_disk_percentage", data_disk_percentage);
     iod_opt_array[4].set("datafile_size", data_disk_size);
-    iod_opts.opt_cnt_ = MAX_IOD_OPT_CNT;
+    iod_opts.opt_cnt_ = MAX_IOD_OPT_CNT - 1;
+    if (OB_NOT_NULL(io_engine)) {
+      iod_opt_array[5].set("io_engine", io_engine);
+      iod_opts.opt_cnt_ = MAX_IOD_OPT_CNT;
+    }
   }
 
   if (OB_SUCC(ret) && OB_NOT_NULL(THE_IO_DEVICE)) {
@@ -187,7 +192,7 @@ int ObIODeviceWrapper::init(
     } else {
       is_inited_ = true;
       LOG_INFO("finish to init io device", K(ret), K(data_dir), K(sstable_dir), K(block_size),
-          K(data_disk_percentage), K(data_disk_size));
+          K(data_disk_percentage), K(data_disk_size), K(io_engine));
     }
   }
 
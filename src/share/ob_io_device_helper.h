@@ -72,7 +72,8 @@ public:
       const char *sstable_dir,
       const int64_t block_size,
       const int64_t data_disk_percentage,
-      const int64_t data_disk_size);
+      const int64_t data_disk_size,
+      const char *io_engine = nullptr);
   void destroy();
 
   ObIODevice& get_local_device() {abort_unless(NULL != local_device_); return *local_device_; }
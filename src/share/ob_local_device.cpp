@@ -14,7 +14,13 @@
 #include <sys/statvfs.h>
 #include <unistd.h>
 #include <linux/falloc.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
 #include "share/ob_local_device.h"
+#include "lib/lock/ob_spin_lock.h"
 #include "share/ob_errno.h"
 #include "share/config/ob_server_config.h"
 #include "share/ob_resource_limit.h"
@@ -72,6 +78,308 @@ void *ObLocalIOEvents::get_ith_data(const int64_t i) const
   return (nullptr != io_events_ && i < complete_io_cnt_) ? io_events_[i].data : 0;
 }
 
+/**
+ * ---------------------------------------------ObLocalIOUring---------------------------------------------------
+ */
+// io_uring backend of one async io channel. The iocb is still prepared by libaio io_prep_pread/pwrite,
+// and translated to sqe when submitting, so the io channel needs not know which engine is used.
+// Sqes are filled by sender threads under submit_lock_, cqes are reaped only by the polling thread
+// of the channel, so the cq ring is lock free.
+#if defined(IORING_FEAT_EXT_ARG) && defined(__NR_io_uring_setup)
+class ObLocalIOUring
+{
+public:
+  ObLocalIOUring();
+  ~ObLocalIOUring() { destroy(); }
+  int init(const uint32_t entries, const bool use_sqpoll);
+  void destroy();
+  int submit(const struct iocb &iocb, const int block_fd);
+  int get_events(
+      const int64_t min_nr,
+      const int64_t max_nr,
+      struct io_event *events,
+      struct timespec *timeout,
+      int64_t &complete_cnt);
+private:
+  static const uint32_t SQ_THREAD_IDLE_MS = 10;
+  int enter(const uint32_t to_submit, const uint32_t min_complete, const uint32_t flags,
+      struct timespec *timeout = nullptr);
+  void register_block_fd(const int block_fd);
+  int64_t reap(const int64_t max_nr, struct io_event *events);
+private:
+  int ring_fd_;
+  bool use_sqpoll_;
+  int registered_fd_; // data file registered as fixed file 0, -1 if not registered
+  bool is_register_tried_;
+  void *ring_ptr_;
+  int64_t ring_size_;
+  struct io_uring_sqe *sqes_;
+  int64_t sqes_size_;
+  uint32_t sq_entries_;
+  uint32_t *sq_head_;
+  uint32_t *sq_tail_;
+  uint32_t *sq_mask_;
+  uint32_t *sq_flags_;
+  uint32_t *sq_array_;
+  uint32_t *cq_head_;
+  uint32_t *cq_tail_;
+  uint32_t *cq_mask_;
+  struct io_uring_cqe *cqes_;
+  common::ObSpinLock submit_lock_;
+};
+
+ObLocalIOUring::ObLocalIOUring()
+  : ring_fd_(-1),
+    use_sqpoll_(false),
+    registered_fd_(-1),
+    is_register_tried_(false),
+    ring_ptr_(MAP_FAILED),
+    ring_size_(0),
+    sqes_(reinterpret_cast<struct io_uring_sqe *>(MAP_FAILED)),
+    sqes_size_(0),
+    sq_entries_(0),
+    sq_head_(nullptr),
+    sq_tail_(nullptr),
+    sq_mask_(nullptr),
+    sq_flags_(nullptr),
+    sq_array_(nullptr),
+    cq_head_(nullptr),
+    cq_tail_(nullptr),
+    cq_mask_(nullptr),
+    cqes_(nullptr),
+    submit_lock_()
+{
+}
+
+int ObLocalIOUring::init(const uint32_t entries, const bool use_sqpoll)
+{
+  int ret = OB_SUCCESS;
+  struct io_uring_params params;
+  MEMSET(&params, 0, sizeof(params));
+  if (use_sqpoll) {
+    params.flags |= IORING_SETUP_SQPOLL;
+    params.sq_thread_idle = SQ_THREAD_IDLE_MS;
+  }
+  if (OB_UNLIKELY(ring_fd_ >= 0)) {
+    ret = OB_INIT_TWICE;
+    SHARE_LOG(WARN, "The io uring has been inited, ", K(ret), K(ring_fd_));
+  } else if ((ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params))) < 0) {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "Fail to setup io uring, ", K(ret), K(entries), K(use_sqpoll), K(errno), KERRMSG);
+  } else if (0 == (params.features & IORING_FEAT_SINGLE_MMAP)
+      || 0 == (params.features & IORING_FEAT_EXT_ARG)) {
+    // the polling thread waits cqes with timeout, which needs IORING_ENTER_EXT_ARG of linux 5.11
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "The io uring features are not supported by kernel, ", K(ret), K(params.features));
+  } else {
+    ring_size_ = MAX(params.sq_off.array + params.sq_entries * sizeof(uint32_t),
+                     params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe));
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    if (MAP_FAILED == (ring_ptr_ = ::mmap(nullptr, ring_size_, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING))) {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "Fail to mmap io uring, ", K(ret), K(ring_size_), K(errno), KERRMSG);
+    } else if (MAP_FAILED == (sqes_ = reinterpret_cast<struct io_uring_sqe *>(::mmap(nullptr, sqes_size_,
+        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES)))) {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "Fail to mmap io uring sqes, ", K(ret), K(sqes_size_), K(errno), KERRMSG);
+    } else {
+      char *ptr = static_cast<char *>(ring_ptr_);
+      sq_entries_ = params.sq_entries;
+      sq_head_ = reinterpret_cast<uint32_t *>(ptr + params.sq_off.head);
+      sq_tail_ = reinterpret_cast<uint32_t *>(ptr + params.sq_off.tail);
+      sq_mask_ = reinterpret_cast<uint32_t *>(ptr + params.sq_off.ring_mask);
+      sq_flags_ = reinterpret_cast<uint32_t *>(ptr + params.sq_off.flags);
+      sq_array_ = reinterpret_cast<uint32_t *>(ptr + params.sq_off.array);
+      cq_head_ = reinterpret_cast<uint32_t *>(ptr + params.cq_off.head);
+      cq_tail_ = reinterpret_cast<uint32_t *>(ptr + params.cq_off.tail);
+      cq_mask_ = reinterpret_cast<uint32_t *>(ptr + params.cq_off.ring_mask);
+      cqes_ = reinterpret_cast<struct io_uring_cqe *>(ptr + params.cq_off.cqes);
+      use_sqpoll_ = use_sqpoll;
+      SHARE_LOG(INFO, "succeed to setup io uring", K(ring_fd_), K(entries), K(use_sqpoll),
+          K(params.sq_entries), K(params.cq_entries), K(params.features));
+    }
+  }
+  if (OB_FAIL(ret)) {
+    destroy();
+  }
+  return ret;
+}
+
+void ObLocalIOUring::destroy()
+{
+  if (MAP_FAILED != reinterpret_cast<void *>(sqes_)) {
+    ::munmap(sqes_, sqes_size_);
+    sqes_ = reinterpret_cast<struct io_uring_sqe *>(MAP_FAILED);
+  }
+  if (MAP_FAILED != ring_ptr_) {
+    ::munmap(ring_ptr_, ring_size_);
+    ring_ptr_ = MAP_FAILED;
+  }
+  if (ring_fd_ >= 0) {
+    // registered files are released with the ring
+    ::close(ring_fd_);
+    ring_fd_ = -1;
+  }
+  ring_size_ = 0;
+  sqes_size_ = 0;
+  sq_entries_ = 0;
+  registered_fd_ = -1;
+  is_register_tried_ = false;
+  use_sqpoll_ = false;
+}
+
+int ObLocalIOUring::enter(
+    const uint32_t to_submit,
+    const uint32_t min_complete,
+    const uint32_t flags,
+    struct timespec *timeout)
+{
+  int sys_ret = 0;
+  if (nullptr == timeout) {
+    sys_ret = static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd_, to_submit, min_complete,
+        flags, nullptr, 0));
+  } else {
+    struct __kernel_timespec ts;
+    struct io_uring_getevents_arg arg;
+    MEMSET(&arg, 0, sizeof(arg));
+    ts.tv_sec = timeout->tv_sec;
+    ts.tv_nsec = timeout->tv_nsec;
+    arg.ts = reinterpret_cast<uint64_t>(&ts);
+    sys_ret = static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd_, to_submit, min_complete,
+        flags | IORING_ENTER_EXT_ARG, &arg, sizeof(arg)));
+  }
+  return sys_ret < 0 ? -errno : sys_ret;
+}
+
+// The data file is opened after io channels are created, so register it at the first submit.
+// If registering fails, the data file is accessed by normal fd.
+void ObLocalIOUring::register_block_fd(const int block_fd)
+{
+  if (!is_register_tried_ && block_fd > 0) {
+    is_register_tried_ = true;
+    int fds[1] = { block_fd };
+    if (0 != ::syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_FILES, fds, 1)) {
+      SHARE_LOG(WARN, "Fail to register data file to io uring, use normal fd",
+          K(ring_fd_), K(block_fd), K(errno), KERRMSG);
+    } else {
+      registered_fd_ = block_fd;
+    }
+  }
+}
+
+int ObLocalIOUring::submit(const struct iocb &iocb, const int block_fd)
+{
+  int ret = OB_SUCCESS;
+  ObSpinLockGuard guard(submit_lock_);
+  register_block_fd(block_fd);
+  const uint32_t tail = *sq_tail_;
+  if (OB_UNLIKELY(tail - ATOMIC_LOAD_ACQ(sq_head_) >= sq_entries_)) {
+    ret = OB_EAGAIN;
+    SHARE_LOG(WARN, "io uring submission queue is full", K(ret), K(tail), K(sq_entries_));
+  } else {
+    const uint32_t idx = tail & *sq_mask_;
+    struct io_uring_sqe *sqe = &sqes_[idx];
+    MEMSET(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IO_CMD_PWRITE == iocb.aio_lio_opcode ? IORING_OP_WRITE : IORING_OP_READ;
+    if (registered_fd_ >= 0 && iocb.aio_fildes == registered_fd_) {
+      sqe->fd = 0;
+      sqe->flags = IOSQE_FIXED_FILE;
+    } else {
+      sqe->fd = iocb.aio_fildes;
+    }
+    sqe->addr = reinterpret_cast<uint64_t>(iocb.u.c.buf);
+    sqe->len = static_cast<uint32_t>(iocb.u.c.nbytes);
+    sqe->off = static_cast<uint64_t>(iocb.u.c.offset);
+    sqe->user_data = reinterpret_cast<uint64_t>(iocb.data);
+    sq_array_[idx] = idx;
+    ATOMIC_STORE_REL(sq_tail_, tail + 1);
+    if (use_sqpoll_) {
+      // the kernel polling thread consumes sqes, only wake it up when it's idle
+      MEM_BARRIER();
+      if (0 != (ATOMIC_LOAD(sq_flags_) & IORING_SQ_NEED_WAKEUP)) {
+        int sys_ret = enter(0, 0, IORING_ENTER_SQ_WAKEUP);
+        if (sys_ret < 0) {
+          SHARE_LOG(WARN, "Fail to wake up io uring sq thread, ", K(sys_ret));
+        }
+      }
+    } else {
+      int sys_ret = 0;
+      while (-EINTR == (sys_ret = enter(1, 0, 0))); // ignore EINTR
+      if (1 != sys_ret) {
+        // without sq thread, sqes are only consumed by io_uring_enter under submit_lock_,
+        // so the unconsumed sqe can be taken back safely
+        ATOMIC_STORE_REL(sq_tail_, tail);
+        ret = OB_IO_ERROR;
+        SHARE_LOG(WARN, "Fail to submit io uring, ", K(ret), K(sys_ret));
+      }
+    }
+  }
+  return ret;
+}
+
+int64_t ObLocalIOUring::reap(const int64_t max_nr, struct io_event *events)
+{
+  int64_t cnt = 0;
+  uint32_t head = *cq_head_;
+  const uint32_t tail = ATOMIC_LOAD_ACQ(cq_tail_);
+  for (; head != tail && cnt < max_nr; ++head, ++cnt) {
+    const struct io_uring_cqe &cqe = cqes_[head & *cq_mask_];
+    events[cnt].data = reinterpret_cast<void *>(cqe.user_data);
+    events[cnt].obj = nullptr;
+    // negative res is -errno, same as libaio
+    events[cnt].res = static_cast<int64_t>(cqe.res);
+    events[cnt].res2 = 0;
+  }
+  ATOMIC_STORE_REL(cq_head_, head);
+  return cnt;
+}
+
+int ObLocalIOUring::get_events(
+    const int64_t min_nr,
+    const int64_t max_nr,
+    struct io_event *events,
+    struct timespec *timeout,
+    int64_t &complete_cnt)
+{
+  int ret = OB_SUCCESS;
+  complete_cnt = reap(max_nr, events);
+  if (complete_cnt < min_nr) {
+    const int sys_ret = enter(0, static_cast<uint32_t>(min_nr - complete_cnt),
+        IORING_ENTER_GETEVENTS, timeout);
+    if (sys_ret < 0 && -ETIME != sys_ret && -EINTR != sys_ret && 0 == complete_cnt) {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "Fail to wait io uring events, ", K(ret), K(sys_ret));
+    } else {
+      complete_cnt += reap(max_nr - complete_cnt, events + complete_cnt);
+    }
+  }
+  return ret;
+}
+#else
+class ObLocalIOUring
+{
+public:
+  int init(const uint32_t entries, const bool use_sqpoll)
+  {
+    UNUSEDx(entries, use_sqpoll);
+    return OB_NOT_SUPPORTED;
+  }
+  void destroy() {}
+  int submit(const struct iocb &iocb, const int block_fd)
+  {
+    UNUSEDx(iocb, block_fd);
+    return OB_NOT_SUPPORTED;
+  }
+  int get_events(const int64_t min_nr, const int64_t max_nr, struct io_event *events,
+      struct timespec *timeout, int64_t &complete_cnt)
+  {
+    UNUSEDx(min_nr, max_nr, events, timeout, complete_cnt);
+    return OB_NOT_SUPPORTED;
+  }
+};
+#endif
+
 
 /**
  * ---------------------------------------------ObLocalDevice---------------------------------------------------
@@ -92,7 +400,11 @@ ObLocalDevice::ObLocalDevice()
     block_bitmap_(nullptr),
     allocator_(),
     iocb_pool_(),
-    is_fs_support_punch_hole_(true)
+    is_fs_support_punch_hole_(true),
+    use_io_uring_(false),
+    use_io_uring_sqpoll_(false),
+    block_file_map_(nullptr),
+    block_file_map_size_(0)
 {
 
   MEMSET(store_dir_, 0, sizeof(store_dir_));
@@ -127,6 +439,7 @@ int ObLocalDevice::init(const common::ObIODOpts &opts)
     int64_t datafile_disk_percentage = 0;
     bool is_exist = false;
     int64_t media_id = 0;
+    const char *io_engine = nullptr;
 
     for (int64_t i = 0; OB_SUCC(ret) && i < opts.opt_cnt_; ++i) {
       if (0 == STRCMP(opts.opts_[i].key_, "data_dir")) {
@@ -141,6 +454,8 @@ int ObLocalDevice::init(const common::ObIODOpts &opts)
         datafile_size = opts.opts_[i].value_.value_int64;
       } else if (0 == STRCMP(opts.opts_[i].key_, "media_id")) {
         media_id = opts.opts_[i].value_.value_int64;
+      } else if (0 == STRCMP(opts.opts_[i].key_, "io_engine")) {
+        io_engine = opts.opts_[i].value_.value_str;
       } else {
         ret = OB_NOT_SUPPORTED;
         SHARE_LOG(WARN, "Not supported option, ", K(ret), K(i), K(opts.opts_[i].key_));
@@ -162,6 +477,10 @@ int ObLocalDevice::init(const common::ObIODOpts &opts)
         STRNCPY(store_dir_, store_dir, STRLEN(store_dir));
         STRNCPY(sstable_dir_, sstable_dir, STRLEN(sstable_dir));
         media_id_ = media_id;
+        if (OB_NOT_NULL(io_engine)) {
+          use_io_uring_ = 0 == STRCASECMP(io_engine, "io_uring") || 0 == STRCASECMP(io_engine, "io_uring_sqpoll");
+          use_io_uring_sqpoll_ = 0 == STRCASECMP(io_engine, "io_uring_sqpoll");
+        }
       }
     }
   }
@@ -268,6 +587,11 @@ void ObLocalDevice::destroy()
   free_block_push_pos_ = 0;
   block_size_ = 0;
   block_file_size_ = 0;
+  if (nullptr != block_file_map_) {
+    ::munmap(block_file_map_, block_file_map_size_);
+    block_file_map_ = nullptr;
+  }
+  block_file_map_size_ = 0;
   if (block_fd_ > 0) {
     ::close(block_fd_);
   }
@@ -275,6 +599,8 @@ void ObLocalDevice::destroy()
   is_inited_ = false;
   is_marked_ = false;
   is_fs_support_punch_hole_ = true;
+  use_io_uring_ = false;
+  use_io_uring_sqpoll_ = false;
 
   MEMSET(store_dir_, 0, sizeof(store_dir_));
   MEMSET(sstable_dir_, 0, sizeof(sstable_dir_));
@@ -1002,6 +1328,47 @@ int ObLocalDevice::write(
   return ret;
 }
 
+//mmap interfaces
+int ObLocalDevice::mmap_block(
+  const ObIOFd &block_id,
+  const int64_t offset,
+  const int64_t size,
+  const char *&buf)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(check_mmap_range(block_id, offset, size))) {
+    if (OB_NOT_SUPPORTED != ret) {
+      SHARE_LOG(WARN, "Fail to check mmap range", K(ret), K(block_id), K(offset), K(size));
+    }
+  } else {
+    buf = block_file_map_ + get_block_file_offset(block_id, offset);
+  }
+  return ret;
+}
+
+int ObLocalDevice::madvise_block(
+  const ObIOFd &block_id,
+  const int64_t offset,
+  const int64_t size,
+  const int advice)
+{
+  int ret = OB_SUCCESS;
+  static const int64_t MMAP_PAGE_SIZE = 4 * 1024;
+  if (OB_FAIL(check_mmap_range(block_id, offset, size))) {
+    if (OB_NOT_SUPPORTED != ret) {
+      SHARE_LOG(WARN, "Fail to check mmap range", K(ret), K(block_id), K(offset), K(size));
+    }
+  } else {
+    const int64_t begin = lower_align(get_block_file_offset(block_id, offset), MMAP_PAGE_SIZE);
+    const int64_t end = upper_align(get_block_file_offset(block_id, offset + size), MMAP_PAGE_SIZE);
+    if (0 != ::madvise(block_file_map_ + begin, end - begin, advice)) {
+      ret = convert_sys_errno();
+      SHARE_LOG(WARN, "Fail to madvise block", K(ret), K(block_id), K(offset), K(size), K(advice), KERRMSG);
+    }
+  }
+  return ret;
+}
+
 //async io interfaces
 int ObLocalDevice::io_setup(
     uint32_t max_events,
@@ -1020,7 +1387,26 @@ int ObLocalDevice::io_setup(
     int sys_ret = 0;
     ObLocalIOContext *local_context = nullptr;
     local_context = new (buf) ObLocalIOContext();
-    if (0 != (sys_ret = ::io_setup(max_events, &(local_context->io_context_)))) {
+    if (use_io_uring_) {
+      int tmp_ret = OB_SUCCESS;
+      void *uring_buf = nullptr;
+      if (OB_ISNULL(uring_buf = allocator_.alloc(sizeof(ObLocalIOUring)))) {
+        tmp_ret = OB_ALLOCATE_MEMORY_FAILED;
+        SHARE_LOG(WARN, "Fail to allocate memory for io uring, ", K(tmp_ret));
+      } else {
+        local_context->io_uring_ = new (uring_buf) ObLocalIOUring();
+        if (OB_TMP_FAIL(local_context->io_uring_->init(max_events, use_io_uring_sqpoll_))) {
+          SHARE_LOG(WARN, "Fail to init io uring, fallback to libaio", K(tmp_ret), K(max_events),
+              K(use_io_uring_sqpoll_));
+          local_context->io_uring_->~ObLocalIOUring();
+          allocator_.free(uring_buf);
+          local_context->io_uring_ = nullptr;
+        }
+      }
+    }
+    if (nullptr != local_context->io_uring_) {
+      io_context = local_context;
+    } else if (0 != (sys_ret = ::io_setup(max_events, &(local_context->io_context_)))) {
       ret = OB_IO_ERROR;
       SHARE_LOG(WARN, "Fail to setup io context, ", K(ret), K(sys_ret), KERRMSG);
     } else {
@@ -1050,7 +1436,12 @@ int ObLocalDevice::io_destroy(common::ObIOContext *io_context)
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
   } else {
     int sys_ret = 0;
-    if ((sys_ret = ::io_destroy(local_io_context->io_context_)) != 0) {
+    if (nullptr != local_io_context->io_uring_) {
+      local_io_context->io_uring_->~ObLocalIOUring();
+      allocator_.free(local_io_context->io_uring_);
+      local_io_context->io_uring_ = nullptr;
+      allocator_.free(io_context);
+    } else if ((sys_ret = ::io_destroy(local_io_context->io_context_)) != 0) {
       ret = OB_IO_ERROR;
       SHARE_LOG(WARN, "Fail to destroy io context, ", K(ret), K(sys_ret), KERRMSG);
     } else {
@@ -1150,6 +1541,10 @@ int ObLocalDevice::io_submit(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->io_uring_) {
+    if (OB_FAIL(local_io_context->io_uring_->submit(local_iocb->iocb_, block_fd_))) {
+      SHARE_LOG(WARN, "Fail to submit io uring, ", K(ret));
+    }
   } else {
     iocbp = &(local_iocb->iocb_);
     int submit_ret = ::io_submit(local_io_context->io_context_, 1, &iocbp);
@@ -1182,6 +1577,10 @@ int ObLocalDevice::io_cancel(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->io_uring_) {
+    // io already in io uring can not be taken back, wait for its completion
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(DEBUG, "io uring doesn't support cancel, ", K(ret));
   } else {
     int sys_ret = 0;
     if ((sys_ret = ::io_cancel(local_io_context->io_context_, &(local_iocb->iocb_), &local_event)) < 0) {
@@ -1214,6 +1613,11 @@ int ObLocalDevice::io_getevents(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->io_uring_) {
+    if (OB_FAIL(local_io_context->io_uring_->get_events(min_nr, local_io_events->max_event_cnt_,
+        local_io_events->io_events_, timeout, local_io_events->complete_io_cnt_))) {
+      SHARE_LOG(WARN, "Fail to get io uring events, ", K(ret));
+    }
   } else {
     int sys_ret = 0;
     while ((sys_ret = ::io_getevents(
@@ -1429,6 +1833,11 @@ int ObLocalDevice::open_block_file(
         free_block_cnt_ = 0;
         free_block_push_pos_ = 0;
         free_block_pop_pos_ = 0;
+        int tmp_ret = OB_SUCCESS;
+        if (OB_SUCCESS != (tmp_ret = map_block_file(sstable_dir))) {
+          // mmap read is optional, blocks are still read by io
+          SHARE_LOG(WARN, "Fail to map block file, mmap read is disabled", K(tmp_ret), K(store_path_));
+        }
       }
     }
   }
@@ -1436,6 +1845,63 @@ int ObLocalDevice::open_block_file(
   return ret;
 }
 
+int ObLocalDevice::map_block_file(const char *sstable_dir)
+{
+  int ret = OB_SUCCESS;
+  struct statvfs svfs;
+  void *map_addr = nullptr;
+  int64_t map_size = 0;
+
+  if (OB_ISNULL(sstable_dir) || OB_UNLIKELY(block_fd_ < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid argument, ", K(ret), KP(sstable_dir), K(block_fd_));
+  } else if (OB_UNLIKELY(0 != statvfs(sstable_dir, &svfs))) {
+    ret = convert_sys_errno();
+    SHARE_LOG(WARN, "Failed to get disk space ", K(ret), K(sstable_dir));
+  } else {
+    // only virtual address space is reserved, pages beyond the end of file are never touched
+    map_size = std::max(block_file_size_, (int64_t)(svfs.f_blocks * svfs.f_frsize));
+    if (MAP_FAILED == (map_addr = ::mmap(nullptr, map_size, PROT_READ,
+        MAP_SHARED | MAP_NORESERVE, block_fd_, 0))) {
+      ret = convert_sys_errno();
+      SHARE_LOG(WARN, "Fail to mmap block file, ", K(ret), K(map_size), K(block_fd_), KERRMSG);
+    } else {
+      block_file_map_ = static_cast<char *>(map_addr);
+      block_file_map_size_ = map_size;
+      SHARE_LOG(INFO, "succeed to mmap block file", KP(block_file_map_), K(block_file_map_size_),
+          K(block_file_size_));
+    }
+  }
+  return ret;
+}
+
+int ObLocalDevice::check_mmap_range(
+    const ObIOFd &block_id,
+    const int64_t offset,
+    const int64_t size) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "The ObLocalDevice has not been inited, ", K(ret));
+  } else if (OB_ISNULL(block_file_map_)) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (OB_UNLIKELY(!block_id.is_block_file() || block_id.is_super_block()
+      || block_id.second_id_ < RESERVED_BLOCK_INDEX
+      || offset < 0 || size <= 0 || offset + size > block_size_)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid argument, ", K(ret), K(block_id), K(offset), K(size));
+  } else {
+    const int64_t end_offset = block_id.second_id_ * block_size_ + offset + size;
+    if (OB_UNLIKELY(end_offset > ATOMIC_LOAD(&block_file_size_)
+        || end_offset > block_file_map_size_)) {
+      // the tail of the expanded block file may be out of the mapping
+      ret = OB_NOT_SUPPORTED;
+    }
+  }
+  return ret;
+}
+
 int ObLocalDevice::resize_block_file(const int64_t new_size)
 {
   // copy free block info to new_free_block_array
@@ -21,6 +21,7 @@ namespace oceanbase {
 namespace share {
 
 class ObLocalDevice;
+class ObLocalIOUring;
 
 class ObLocalIOCB : public common::ObIOCB
 {
@@ -35,11 +36,12 @@ private:
 class ObLocalIOContext : public common::ObIOContext
 {
 public:
-  ObLocalIOContext() : io_context_() {}
+  ObLocalIOContext() : io_context_(), io_uring_(nullptr) {}
   virtual ~ObLocalIOContext() {}
 private:
   friend class ObLocalDevice;
   io_context_t io_context_;
+  ObLocalIOUring *io_uring_; // not null if the context is backed by io_uring instead of libaio
 };
 
 class ObLocalIOEvents : public common::ObIOEvents
@@ -125,6 +127,18 @@ public:
     const int64_t size,
     int64_t &write_size) override;
 
+  //mmap interfaces
+  virtual int mmap_block(
+    const common::ObIOFd &block_id,
+    const int64_t offset,
+    const int64_t size,
+    const char *&buf) override;
+  virtual int madvise_block(
+    const common::ObIOFd &block_id,
+    const int64_t offset,
+    const int64_t size,
+    const int advice) override;
+
   //async io interfaces
   virtual int io_setup(
     uint32_t max_events,
@@ -186,6 +200,8 @@ private:
     const int64_t reserved_size,
     bool &is_exist);
   int resize_block_file(const int64_t new_size);
+  int map_block_file(const char *sstable_dir);
+  int check_mmap_range(const common::ObIOFd &block_id, const int64_t offset, const int64_t size) const;
   int64_t get_block_file_offset(const common::ObIOFd &fd, const int64_t offset);
   int try_punch_hole(const int64_t block_index);
   static int pread_impl(const int64_t fd, void *buf, const int64_t size, const int64_t offset, int64_t &read_size);
@@ -213,6 +229,12 @@ private:
   common::ObFIFOAllocator allocator_;
   ObIOCBPool<ObLocalIOCB> iocb_pool_;
   bool is_fs_support_punch_hole_;
+  bool use_io_uring_;
+  bool use_io_uring_sqpoll_;
+  // read only mapping of the whole block file, reserved up to the disk size so that it need not be
+  // remapped when the block file is expanded
+  char *block_file_map_;
+  int64_t block_file_map_size_;
 };
 
 OB_INLINE int64_t ObLocalDevice::get_block_file_offset(const common::ObIOFd &fd, const int64_t offset)
@@ -211,6 +211,10 @@ DEF_CAP(cache_wash_threshold, OB_CLUSTER_PARAMETER, "4GB", "[0B,]",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_CAP(memory_chunk_cache_size, OB_CLUSTER_PARAMETER, "0M", "[0M,]", "the maximum size of memory cached by memory chunk cache. Range: [0M,], 0 stands for adaptive",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_malloc_thread_cache, OB_CLUSTER_PARAMETER, "False",
+        "specifies whether small objects freed by a thread are cached by the thread and reused by its following allocations. "
+        "Value: True: enable; False: disable",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_TIME(autoinc_cache_refresh_interval, OB_CLUSTER_PARAMETER, "3600s", "[100ms,]",
          "auto-increment service cache refresh sync_value in this interval, "
          "with default 3600s. Range: [100ms, +∞)",
@@ -290,6 +294,10 @@ DEF_INT(_ob_max_thread_num, OB_CLUSTER_PARAMETER, "0", "[0,10000)",
 DEF_DBL(cpu_quota_concurrency, OB_TENANT_PARAMETER, "4", "[1,10]",
         "max allowed concurrency for 1 CPU quota. Range: [1,10]",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_numa_node_binding, OB_TENANT_PARAMETER, "-1", "[-1, 7]",
+        "the numa node which the tenant workers and memstore, kvcache, sql work area memory "
+        "are bound to, -1 means not bound. Range: [-1, 7]",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_DBL(token_reserved_percentage, OB_CLUSTER_PARAMETER,
         "30", "[0,100]",
         "specifies the amount of token increase allocated to a tenant based on "
@@ -505,6 +513,35 @@ DEF_INT(log_disk_percentage, OB_CLUSTER_PARAMETER, "0", "[0,99]",
 //                     "compressor used for clog transport. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
 //                     ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
+DEF_BOOL(_enable_log_transport_compress, OB_CLUSTER_PARAMETER, "False",
+         "If this option is set to true, logs pushed from leader to the replicas which support it "
+         "are compressed. The default is false(no compression)",
+         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
+DEF_STR_WITH_CHECKER(_log_transport_compress_func, OB_CLUSTER_PARAMETER, "lz4_1.0",
+                     common::ObConfigBatchRpcCompressFuncChecker,
+                     "compressor used for log transport. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8, "
+                     "stream_lz4_1.0, stream_zstd_1.0, stream_zstd_1.3.8",
+                     ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
+DEF_TIME(_log_group_commit_latency_budget, OB_CLUSTER_PARAMETER, "0ms", "[0ms, 100ms]",
+         "the latency budget of group commit of clog. A group log may wait for more logs "
+         "at most the budget minus the flush cost before being frozen, "
+         "0ms means freezing group logs without waiting. Range: [0ms, 100ms]",
+         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
+DEF_BOOL(_enable_log_mmap_read, OB_CLUSTER_PARAMETER, "False",
+         "If this option is set to true, palf iterators over committed logs read sealed log blocks "
+         "through read-only mmap instead of copying them into read buffer. "
+         "The default is false",
+         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
+DEF_INT(_log_io_flush_thread_num, OB_CLUSTER_PARAMETER, "0", "[-1, 7]",
+        "the number of threads of each tenant which flush the logs of different log streams "
+        "in parallel with the clog io worker, 0 means flushing serially, "
+        "-1 means one thread per 16 cpus. Range: [-1, 7]",
+        ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+
 // TODO(xianlin.lh): add the feature on 4.1
 //DEF_BOOL(enable_clog_persistence_compress, OB_TENANT_PARAMETER, "False",
 //         "If this option is set to true, use compression for clog persistence. "
@@ -517,6 +554,23 @@ DEF_INT(log_disk_percentage, OB_CLUSTER_PARAMETER, "0", "[0,99]",
 //                     "compressor used for clog persistence. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
 //                     ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
+DEF_BOOL(_enable_redo_log_compress, OB_TENANT_PARAMETER, "False",
+         "If this option is set to true, large mutators of redo log are compressed before being "
+         "submitted to clog. Only takes effect when the data version of tenant is not less than 4.1. "
+         "The default is false(no compression)",
+         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
+DEF_STR_WITH_CHECKER(_redo_log_compress_func, OB_TENANT_PARAMETER, "lz4_1.0",
+                     common::ObConfigPerfCompressFuncChecker,
+                     "compressor used for mutators of redo log. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
+                     ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
+DEF_STR_WITH_CHECKER(log_archive_compress_func, OB_TENANT_PARAMETER, "none",
+                     common::ObConfigPerfCompressFuncChecker,
+                     "compressor used for log archive files, takes effect from the next archive round. "
+                     "Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
+                     ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
 // TODO(shuning.tsn) : add the feature on 4.1
 //DEF_BOOL(enable_log_archive, OB_CLUSTER_PARAMETER, "False",
 //         "control if enable log archive",
@@ -741,6 +795,26 @@ DEF_STR(io_category_config, OB_TENANT_PARAMETER, "other: 100,100,100",
 DEF_INT(_large_query_io_percentage, OB_CLUSTER_PARAMETER, "0", "[0,100]",
         "the max percentage of io resource for big query. Range: [0,100] in integer. Especially, 0 means unlimited. The default value is 0.",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_io_coalescing, OB_CLUSTER_PARAMETER, "False",
+        "specifies whether adjacent read requests of the same macro block waiting in io queue are merged into one io. "
+        "Value: True: enable; False: disable",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_io_read_ahead_size, OB_CLUSTER_PARAMETER, "1M", "[0M,16M]",
+        "the size to read ahead when sequential read of a macro block is detected, "
+        "takes effect only when _enable_io_coalescing is true. 0 means disable read ahead. Range: [0M, 16M]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_sstable_mmap_read, OB_CLUSTER_PARAMETER, "False",
+        "If this option is set to true, large scans which bypass block cache read uncompressed and "
+        "unencrypted data micro blocks through read-only mmap of the data file instead of io. "
+        "The default is false",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_STR_WITH_CHECKER(_io_engine, OB_CLUSTER_PARAMETER, "libaio",
+        common::ObConfigIOEngineChecker,
+        "the async io engine of the local data file. libaio: linux native aio; "
+        "io_uring: io_uring with the data file registered as fixed file; "
+        "io_uring_sqpoll: io_uring with kernel submission polling thread. "
+        "falls back to libaio if io_uring is not supported by kernel. Values: libaio, io_uring, io_uring_sqpoll",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 
 DEF_BOOL(_enable_parallel_minor_merge, OB_TENANT_PARAMETER, "True",
          "specifies whether enable parallel minor merge. "
@@ -847,6 +921,24 @@ DEF_INT(_migrate_block_verify_level, OB_CLUSTER_PARAMETER, "1", "[0,2]",
 DEF_TIME(_cache_wash_interval, OB_CLUSTER_PARAMETER, "200ms", "[1ms, 1m]",
         "specify interval of cache background wash",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_kvcache_admission, OB_CLUSTER_PARAMETER, "False",
+        "specifies whether kvcache filters put by access frequency when tenant cache is being washed, "
+        "so that kvs only accessed once do not wash out hot kvs. Value: True: enable; False: disable",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_kvcache_rebalance, OB_CLUSTER_PARAMETER, "False",
+        "specifies whether kvcache estimates the miss ratio curve of each cache from sampled gets, "
+        "and shifts memory of the tenant toward caches gaining more hits per MB. "
+        "Value: True: enable; False: disable",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_STR(_micro_block_ssd_cache_dir, OB_CLUSTER_PARAMETER, "",
+        "the directory on local ssd for the second tier of micro block cache, "
+        "empty means the second tier cache is disabled",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_CAP(_micro_block_ssd_cache_size, OB_CLUSTER_PARAMETER, "0M", "[0M,)",
+        "the size of the second tier of micro block cache on local ssd, "
+        "takes effect only when _micro_block_ssd_cache_dir is set, "
+        "the second tier cache is disabled if it is less than 64M. Range: [0M, +∞)",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 
 // TODO bin.lb: to be remove
 DEF_CAP(dtl_buffer_size, OB_CLUSTER_PARAMETER, "64K", "[4K,2M]", "to be removed",
@@ -1085,6 +1177,21 @@ DEF_STR_WITH_CHECKER(use_large_pages, OB_CLUSTER_PARAMETER, "false",
                      "used to manage the database's use of large pages, "
                      "values: false, true, only",
                      ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_STR_WITH_CHECKER(_memstore_huge_page_policy, OB_CLUSTER_PARAMETER, "none",
+                     common::ObConfigHugePagePolicyChecker,
+                     "huge page policy of memstore memory chunks, takes effect on newly allocated chunks. "
+                     "values: none, madvise, hugetlb",
+                     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_STR_WITH_CHECKER(_kvcache_huge_page_policy, OB_CLUSTER_PARAMETER, "none",
+                     common::ObConfigHugePagePolicyChecker,
+                     "huge page policy of kvcache memory blocks, takes effect on newly allocated chunks. "
+                     "values: none, madvise, hugetlb",
+                     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_STR_WITH_CHECKER(_work_area_huge_page_policy, OB_CLUSTER_PARAMETER, "none",
+                     common::ObConfigHugePagePolicyChecker,
+                     "huge page policy of sql work area memory chunks, takes effect on newly allocated chunks. "
+                     "values: none, madvise, hugetlb",
+                     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_STR(ob_ssl_invited_common_names, OB_TENANT_PARAMETER, "NONE",
         "when server use ssl, use it to control client identity with ssl subject common name. default NONE",
@@ -14,6 +14,7 @@
 #include "lib/statistic_event/ob_stat_event.h"
 #include "lib/stat/ob_diagnose_info.h"
 #include "share/rc/ob_tenant_base.h"
+#include "share/config/ob_server_config.h"
 #include "ob_index_tree_prefetcher.h"
 #include "ob_aggregated_store.h"
 #include "storage/blocksstable/ob_storage_cache_suite.h"
@@ -287,6 +288,17 @@ int ObIndexTreePrefetcher::check_bloom_filter(const ObMicroIndexInfo &index_info
   return ret;
 }
 
+bool ObIndexTreePrefetcher::need_mmap_read(
+    const ObMicroIndexInfo &index_block_info,
+    const bool is_data) const
+{
+  return is_data
+      && GCONF._enable_sstable_mmap_read
+      && (access_ctx_->query_flag_.is_large_query() || !access_ctx_->query_flag_.is_use_block_cache())
+      && ObCompressorType::NONE_COMPRESSOR == index_block_info.row_header_->get_compressor_type()
+      && index_block_info.row_header_->get_encrypt_id() <= 0;
+}
+
 int ObIndexTreePrefetcher::prefetch_block_data(
     blocksstable::ObMicroIndexInfo &index_block_info,
     ObMicroBlockDataHandle &micro_handle,
@@ -334,6 +346,48 @@ int ObIndexTreePrefetcher::prefetch_block_data(
   if (OB_SUCC(ret)) {
     micro_handle.micro_info_.offset_ = index_block_info.get_block_offset();
     micro_handle.micro_info_.size_ = index_block_info.get_block_size();
+    if (need_submit_io
+        && ObSSTableMicroBlockState::UNKNOWN_STATE == micro_handle.block_state_
+        && need_mmap_read(index_block_info, is_data)) {
+      if (OB_SUCCESS != micro_handle.mmap_block_data(tenant_id, macro_id)) {
+        // not mapped, read by io
+      } else {
+        need_submit_io = false;
+      }
+    }
+    if (need_submit_io) {
+      // the micro block washed out of memory may still be kept in local ssd cache
+      int tmp_ret = OB_SUCCESS;
+      if (is_data) {
+        const ObTableReadInfo *data_read_info = iter_param_->get_full_read_info();
+        tmp_ret = OB_ISNULL(data_read_info) ? OB_ENTRY_NOT_EXIST
+            : data_block_cache_->load_cache_block_from_ssd(
+                tenant_id,
+                macro_id,
+                index_block_info,
+                access_ctx_->query_flag_,
+                *data_read_info,
+                iter_param_->tablet_handle_,
+                micro_handle.cache_handle_);
+      } else {
+        tmp_ret = index_block_cache_->load_cache_block_from_ssd(
+            tenant_id,
+            macro_id,
+            index_block_info,
+            access_ctx_->query_flag_,
+            *index_read_info_,
+            iter_param_->tablet_handle_,
+            micro_handle.cache_handle_);
+      }
+      if (OB_SUCCESS == tmp_ret) {
+        micro_handle.tenant_id_ = tenant_id;
+        micro_handle.macro_block_id_ = macro_id;
+        micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_CACHE;
+        need_submit_io = false;
+      } else if (OB_ENTRY_NOT_EXIST != tmp_ret) {
+        LOG_WARN("Fail to load micro block from ssd cache, read by io", K(tmp_ret), K(index_block_info));
+      }
+    }
     if (need_submit_io) {
       ObMacroBlockHandle macro_handle;
       if (is_data) {
@@ -163,6 +163,9 @@ protected:
       ObMicroBlockDataHandle &micro_handle,
       const bool is_data = true);
   int lookup_in_cache(ObSSTableReadHandle &read_handle);
+  // cold scan bypassing block cache reads uncompressed and unencrypted data micro blocks through
+  // the read only mapping of data file instead of io
+  bool need_mmap_read(const ObMicroIndexInfo &index_block_info, const bool is_data) const;
 private:
   int lookup_in_index_tree(ObSSTableReadHandle &read_handle);
   ObMicroBlockDataHandle &get_read_handle(const int64_t level)
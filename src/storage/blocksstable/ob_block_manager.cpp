@@ -354,6 +354,48 @@ int ObBlockManager::read_block(
   return ret;
 }
 
+int ObBlockManager::mmap_read_block(
+    const MacroBlockId &macro_id,
+    const int64_t offset,
+    const int64_t size,
+    const char *&buf)
+{
+  int ret = OB_SUCCESS;
+  ObIOFd io_fd(THE_IO_DEVICE, macro_id.first_id(), macro_id.second_id());
+  if (OB_UNLIKELY(!macro_id.is_valid() || offset < 0 || size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(macro_id), K(offset), K(size));
+  } else if (OB_ISNULL(THE_IO_DEVICE)) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (OB_FAIL(THE_IO_DEVICE->mmap_block(io_fd, offset, size, buf))) {
+    if (OB_NOT_SUPPORTED != ret) {
+      LOG_WARN("Fail to mmap read block", K(ret), K(macro_id), K(offset), K(size));
+    }
+  }
+  return ret;
+}
+
+int ObBlockManager::advise_block(
+    const MacroBlockId &macro_id,
+    const int64_t offset,
+    const int64_t size,
+    const int advice)
+{
+  int ret = OB_SUCCESS;
+  ObIOFd io_fd(THE_IO_DEVICE, macro_id.first_id(), macro_id.second_id());
+  if (OB_UNLIKELY(!macro_id.is_valid() || offset < 0 || size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(macro_id), K(offset), K(size));
+  } else if (OB_ISNULL(THE_IO_DEVICE)) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (OB_FAIL(THE_IO_DEVICE->madvise_block(io_fd, offset, size, advice))) {
+    if (OB_NOT_SUPPORTED != ret) {
+      LOG_WARN("Fail to advise block", K(ret), K(macro_id), K(offset), K(size), K(advice));
+    }
+  }
+  return ret;
+}
+
 int ObBlockManager::write_block(
     const ObMacroBlockWriteInfo &write_info,
     ObMacroBlockHandle &macro_handle)
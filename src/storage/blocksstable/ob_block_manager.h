@@ -182,6 +182,19 @@ public:
   static int read_block(
       const ObMacroBlockReadInfo &read_info,
       ObMacroBlockHandle &macro_handle);
+  // read sealed macro block through the read only mapping of io device, buf is valid as long as
+  // the macro block is referenced.
+  // @retval OB_NOT_SUPPORTED    io device or the block is not mapped, read it by io instead
+  static int mmap_read_block(
+      const MacroBlockId &macro_id,
+      const int64_t offset,
+      const int64_t size,
+      const char *&buf);
+  static int advise_block(
+      const MacroBlockId &macro_id,
+      const int64_t offset,
+      const int64_t size,
+      const int advice);
 
   int read_super_block(storage::ObServerSuperBlock &super_block);
   int write_super_block(const storage::ObServerSuperBlock &super_block);
@@ -18,7 +18,9 @@
 #include "encoding/ob_micro_block_decoder.h"
 #include "storage/blocksstable/ob_index_block_row_struct.h"
 #include "storage/blocksstable/ob_micro_block_cache.h"
+#include "storage/blocksstable/ob_micro_block_ssd_cache.h"
 #include "storage/blocksstable/ob_block_manager.h"
+#include "share/rc/ob_tenant_base.h"
 
 namespace oceanbase
 {
@@ -365,12 +367,24 @@ int ObIMicroBlockCache::load_block(
   return OB_NOT_IMPLEMENT;
 }
 
-int ObIMicroBlockCache::prefetch(
+int ObIMicroBlockCache::load_cache_block_from_ssd(
+    const uint64_t tenant_id,
+    const MacroBlockId &macro_id,
+    const ObMicroIndexInfo& idx_row,
+    const common::ObQueryFlag &flag,
+    const ObTableReadInfo &read_info,
+    const ObTabletHandle &tablet_handle,
+    ObMicroBlockBufferHandle &handle)
+{
+  UNUSEDx(tenant_id, macro_id, idx_row, flag, read_info, tablet_handle, handle);
+  return OB_ENTRY_NOT_EXIST;
+}
+
+int ObIMicroBlockCache::fill_callback(
     const uint64_t tenant_id,
     const MacroBlockId &macro_id,
     const ObIndexBlockRowHeader& idx_row_header,
     const common::ObQueryFlag &flag,
-    ObMacroBlockHandle &macro_handle,
     ObIMicroBlockIOCallback &callback)
 {
   int ret = OB_SUCCESS;
@@ -381,7 +395,6 @@ int ObIMicroBlockCache::prefetch(
   } else if (OB_FAIL(get_allocator(allocator))) {
     LOG_WARN("Fail to get allocator", K(ret));
   } else {
-    // fill callback
     callback.cache_ = cache;
     callback.allocator_ = allocator;
     callback.put_size_stat_ = this;
@@ -395,6 +408,64 @@ int ObIMicroBlockCache::prefetch(
     callback.block_des_meta_.master_key_id_ = idx_row_header.get_master_key_id();
     callback.block_des_meta_.encrypt_key_ = idx_row_header.get_encrypt_key();
     callback.use_block_cache_ = flag.is_use_block_cache();
+    callback.ssd_cache_ = ssd_cache_;
+  }
+  return ret;
+}
+
+int ObIMicroBlockCache::load_cache_block_from_ssd(
+    const uint64_t tenant_id,
+    const MacroBlockId &macro_id,
+    const ObIndexBlockRowHeader& idx_row_header,
+    const common::ObQueryFlag &flag,
+    ObIMicroBlockIOCallback &callback,
+    ObMicroBlockBufferHandle &handle)
+{
+  int ret = OB_SUCCESS;
+  ObArenaAllocator allocator(ObModIds::OB_SSTABLE_MICRO_BLOCK_ALLOCATOR);
+  ObMacroBlockReader *reader = nullptr;
+  const char *buf = nullptr;
+  int64_t size = 0;
+  const int64_t offset = idx_row_header.get_block_offset();
+  const ObMicroBlockCacheKey key(tenant_id, macro_id, offset, idx_row_header.get_block_size());
+  if (OB_ISNULL(ssd_cache_) || !flag.is_use_block_cache()) {
+    // the loaded micro block is returned through block cache
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (OB_FAIL(fill_callback(tenant_id, macro_id, idx_row_header, flag, callback))) {
+    LOG_WARN("Fail to fill callback", K(ret));
+  } else if (OB_FAIL(ssd_cache_->get(key, allocator, buf, size))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      LOG_WARN("Fail to get micro block from ssd cache", K(ret), K(key));
+    }
+  } else if (OB_ISNULL(reader = GET_TSI_MULT(ObMacroBlockReader, 1))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Fail to allocate ObMacroBlockReader, ", K(ret));
+  } else if (FALSE_IT(callback.ssd_cache_ = nullptr)) {
+    // already in ssd cache, no need to put it back
+  } else if (OB_FAIL(callback.process_block(
+      reader, const_cast<char *>(buf), offset, size, handle.micro_block_, handle.handle_))) {
+    LOG_WARN("Fail to process micro block from ssd cache", K(ret), K(key));
+  } else if (OB_UNLIKELY(!handle.is_valid())) {
+    ret = OB_ENTRY_NOT_EXIST;
+  }
+  if (OB_FAIL(ret)) {
+    handle.reset();
+  }
+  return ret;
+}
+
+int ObIMicroBlockCache::prefetch(
+    const uint64_t tenant_id,
+    const MacroBlockId &macro_id,
+    const ObIndexBlockRowHeader& idx_row_header,
+    const common::ObQueryFlag &flag,
+    ObMacroBlockHandle &macro_handle,
+    ObIMicroBlockIOCallback &callback)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(fill_callback(tenant_id, macro_id, idx_row_header, flag, callback))) {
+    LOG_WARN("Fail to fill callback", K(ret));
+  } else {
     // fill read info
     ObMacroBlockReadInfo read_info;
     read_info.macro_block_id_ = macro_id;
@@ -449,6 +520,7 @@ int ObIMicroBlockCache::prefetch(
     callback.offset_ = offset;
     callback.size_ = size;
     callback.use_block_cache_ = flag.is_use_block_cache();
+    callback.ssd_cache_ = ssd_cache_;
     // fill read info
     ObMacroBlockReadInfo read_info;
     read_info.macro_block_id_ = macro_id;
@@ -475,6 +547,39 @@ int ObIMicroBlockCache::add_put_size(const int64_t put_size)
   return OB_SUCCESS;
 }
 
+int ObIMicroBlockCache::read_micro_block(
+    const ObMicroBlockId &micro_block_id,
+    ObIAllocator &allocator,
+    ObMacroBlockHandle &macro_handle,
+    const char *&buf)
+{
+  int ret = OB_SUCCESS;
+  int64_t size = 0;
+  const ObMicroBlockCacheKey key(MTL_ID(), micro_block_id);
+  if (OB_NOT_NULL(ssd_cache_) && OB_SUCCESS == ssd_cache_->get(key, allocator, buf, size)) {
+    // hit in local ssd cache
+  } else {
+    ObMacroBlockReadInfo macro_read_info;
+    macro_read_info.macro_block_id_ = micro_block_id.macro_id_;
+    macro_read_info.io_desc_.set_category(ObIOCategory::USER_IO);
+    macro_read_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
+    macro_read_info.offset_ = micro_block_id.offset_;
+    macro_read_info.size_ = micro_block_id.size_;
+    if (OB_FAIL(ObBlockManager::read_block(macro_read_info, macro_handle))) {
+      LOG_WARN("Fail to sync read block", K(ret), K(macro_read_info));
+    } else {
+      buf = macro_handle.get_buffer();
+      if (OB_NOT_NULL(ssd_cache_)) {
+        int tmp_ret = OB_SUCCESS;
+        if (OB_SUCCESS != (tmp_ret = ssd_cache_->put(key, buf, micro_block_id.size_))) {
+          LOG_WARN("Fail to put micro block to ssd cache", K(tmp_ret), K(key));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 /*---------------------------------------MicroBlockIOCallback-------------------------------------*/
 ObIMicroBlockCache::ObIMicroBlockIOCallback::ObIMicroBlockIOCallback()
   : cache_(nullptr),
@@ -488,7 +593,8 @@ ObIMicroBlockCache::ObIMicroBlockIOCallback::ObIMicroBlockIOCallback()
     size_(0),
     row_store_type_(MAX_ROW_STORE),
     block_des_meta_(),
-    use_block_cache_(true)
+    use_block_cache_(true),
+    ssd_cache_(nullptr)
 {
   static_assert(sizeof(*this) <= CALLBACK_BUF_SIZE, "IOCallback buf size not enough");
 }
@@ -545,6 +651,7 @@ int ObIMicroBlockCache::ObIMicroBlockIOCallback::process_block(
   int64_t pos = 0;
   int64_t payload_size = 0;
   const char *payload_buf = nullptr;
+  bool is_cached = true;
   if (OB_UNLIKELY(NULL == reader || NULL == buffer || offset < 0 || size < 0)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid arguments", K(ret), KP(reader), KP(buffer), K(offset), K(size));
@@ -555,8 +662,17 @@ int ObIMicroBlockCache::ObIMicroBlockIOCallback::process_block(
     LOG_ERROR("Micro block data is corrupted", K(ret), K_(block_id), K(offset),
         K(size), K_(tenant_id), KP(buffer), KP(io_buffer_), KP(data_buffer_), KP(this));
   } else {
+    if (OB_NOT_NULL(ssd_cache_) && use_block_cache_) {
+      // keep the compressed block in local ssd cache, for reads after it is washed out of memory
+      int tmp_ret = OB_SUCCESS;
+      const ObMicroBlockCacheKey ssd_key(tenant_id_, block_id_, offset, size);
+      if (OB_SUCCESS != (tmp_ret = ssd_cache_->put(ssd_key, buffer, size))) {
+        LOG_WARN("Fail to put micro block to ssd cache", K(tmp_ret), K(ssd_key));
+      }
+    }
     if (OB_UNLIKELY(!use_block_cache_)) {
       // Won't put in cache
+      is_cached = false;
     } else {
       ObKVCachePair *kvpair = nullptr;
       ObKVCacheInstHandle inst_handle;
@@ -566,6 +682,10 @@ int ObIMicroBlockCache::ObIMicroBlockIOCallback::process_block(
       int64_t value_size = calc_value_size(buf_size, header.row_count_);
       if (OB_UNLIKELY(OB_SUCCESS == (ret = cache_->get(key, micro_block, handle)))) {
         // entry exist, no need to put
+      } else if (!cache_->admit(key)) {
+        // rejected by admission, the block is decompressed out of cache below
+        ret = OB_SUCCESS;
+        is_cached = false;
       } else if (OB_FAIL(cache_->alloc(
           tenant_id_,
           sizeof(ObMicroBlockCacheKey),
@@ -619,7 +739,7 @@ int ObIMicroBlockCache::ObIMicroBlockIOCallback::process_block(
     }
 
     if (OB_FAIL(ret)) {
-    } else if (use_block_cache_) {
+    } else if (is_cached) {
       // block already in cache
     } else if (OB_FAIL(read_block_and_copy(*reader, buffer, size, block_data, micro_block, handle))) {
       LOG_WARN("Fail to read micro block and copy to cache value", K(ret));
@@ -733,6 +853,7 @@ int ObIMicroBlockCache::ObIMicroBlockIOCallback::assign(const ObIMicroBlockIOCal
   row_store_type_ = other.row_store_type_;
   block_des_meta_ = other.block_des_meta_;
   use_block_cache_ = other.use_block_cache_;
+  ssd_cache_ = other.ssd_cache_;
   return ret;
 }
 
@@ -786,6 +907,38 @@ int ObDataMicroBlockCache::prefetch(
   return ret;
 }
 
+int ObDataMicroBlockCache::load_cache_block_from_ssd(
+    const uint64_t tenant_id,
+    const MacroBlockId &macro_id,
+    const ObMicroIndexInfo& idx_row,
+    const common::ObQueryFlag &flag,
+    const ObTableReadInfo &read_info,
+    const ObTabletHandle &tablet_handle,
+    ObMicroBlockBufferHandle &handle)
+{
+  int ret = OB_SUCCESS;
+  const ObIndexBlockRowHeader *idx_header = idx_row.row_header_;
+  if (OB_ISNULL(idx_header)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid null index block row header", K(ret), K(idx_row));
+  } else if (OB_ISNULL(ssd_cache_)) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else {
+    ObDataMicroBlockIOCallback callback;
+    callback.full_cols_ = &read_info.get_columns_desc();
+    callback.tablet_handle_ = tablet_handle;
+    callback.need_write_extra_buf_ = idx_header->is_data_index()
+        && ObStoreFormat::is_row_store_type_with_encoding(idx_header->get_row_store_type());
+    if (OB_FAIL(ObIMicroBlockCache::load_cache_block_from_ssd(
+        tenant_id, macro_id, *idx_header, flag, callback, handle))) {
+      if (OB_ENTRY_NOT_EXIST != ret) {
+        LOG_WARN("Fail to load data micro block from ssd cache", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObDataMicroBlockCache::prefetch(
     const uint64_t tenant_id,
     const MacroBlockId &macro_id,
@@ -819,23 +972,19 @@ int ObDataMicroBlockCache::load_block(
 {
   UNUSEDx(read_info, allocator);
   int ret = OB_SUCCESS;
-  ObMacroBlockReadInfo macro_read_info;
   ObMacroBlockHandle macro_handle;
+  ObArenaAllocator read_allocator(ObModIds::OB_SSTABLE_MICRO_BLOCK_ALLOCATOR);
+  const char *read_buf = nullptr;
   bool is_compressed = false;
   const bool need_deep_copy = true;
   if (OB_UNLIKELY(!micro_block_id.is_valid()) || OB_ISNULL(macro_reader)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid argument", K(ret), K(micro_block_id), KP(macro_reader));
   } else {
-    macro_read_info.macro_block_id_ = micro_block_id.macro_id_;
-    macro_read_info.io_desc_.set_category(ObIOCategory::USER_IO);
-    macro_read_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
-    macro_read_info.offset_ = micro_block_id.offset_;
-    macro_read_info.size_ = micro_block_id.size_;
-    if (OB_FAIL(ObBlockManager::read_block(macro_read_info, macro_handle))) {
-      LOG_WARN("Fail to sync read block", K(ret), K(macro_read_info));
+    if (OB_FAIL(read_micro_block(micro_block_id, read_allocator, macro_handle, read_buf))) {
+      LOG_WARN("Fail to read micro block", K(ret), K(micro_block_id));
     } else if (OB_FAIL(macro_reader->decrypt_and_decompress_data(
-        des_meta, macro_handle.get_buffer(), micro_block_id.size_, block_data.get_buf(),
+        des_meta, read_buf, micro_block_id.size_, block_data.get_buf(),
         block_data.get_buf_size(), is_compressed, need_deep_copy))) {
       LOG_WARN("Fail to decrypt and decompress micro block data buf", K(ret));
     } else {
@@ -1261,6 +1410,36 @@ int ObIndexMicroBlockCache::prefetch(
   return ret;
 }
 
+int ObIndexMicroBlockCache::load_cache_block_from_ssd(
+    const uint64_t tenant_id,
+    const MacroBlockId &macro_id,
+    const ObMicroIndexInfo& idx_row,
+    const common::ObQueryFlag &flag,
+    const ObTableReadInfo &read_info,
+    const ObTabletHandle &tablet_handle,
+    ObMicroBlockBufferHandle &handle)
+{
+  int ret = OB_SUCCESS;
+  const ObIndexBlockRowHeader *idx_header = idx_row.row_header_;
+  if (OB_ISNULL(idx_header)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid null index block row header", K(ret), K(idx_row));
+  } else if (OB_ISNULL(ssd_cache_)) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else {
+    ObIndexMicroBlockIOCallback callback;
+    callback.index_read_info_ = &read_info;
+    callback.tablet_handle_ = tablet_handle;
+    if (OB_FAIL(ObIMicroBlockCache::load_cache_block_from_ssd(
+        tenant_id, macro_id, *idx_header, flag, callback, handle))) {
+      if (OB_ENTRY_NOT_EXIST != ret) {
+        LOG_WARN("Fail to load index micro block from ssd cache", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObIndexMicroBlockCache::load_block(
     const ObMicroBlockId &micro_block_id,
     const ObMicroBlockDesMeta &des_meta,
@@ -1271,8 +1450,9 @@ int ObIndexMicroBlockCache::load_block(
 {
   UNUSED(macro_reader);
   int ret = OB_SUCCESS;
-  ObMacroBlockReadInfo macro_read_info;
   ObMacroBlockHandle macro_handle;
+  ObArenaAllocator read_allocator(ObModIds::OB_SSTABLE_MICRO_BLOCK_ALLOCATOR);
+  const char *read_buf = nullptr;
   // TODO: make deserialize micro block with allocator static and remove tmp inner_macro_reader
   ObMacroBlockReader inner_macro_reader;
   ObIndexBlockDataTransformer idx_transformer;
@@ -1284,15 +1464,10 @@ int ObIndexMicroBlockCache::load_block(
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid argument", K(ret), K(micro_block_id), KP(read_info), KP(allocator));
   } else {
-    macro_read_info.macro_block_id_ = micro_block_id.macro_id_;
-    macro_read_info.io_desc_.set_category(ObIOCategory::USER_IO);
-    macro_read_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
-    macro_read_info.offset_ = micro_block_id.offset_;
-    macro_read_info.size_ = micro_block_id.size_;
-    if (OB_FAIL(ObBlockManager::read_block(macro_read_info, macro_handle))) {
-      LOG_WARN("Fail to sync read block", K(ret), K(macro_read_info));
+    if (OB_FAIL(read_micro_block(micro_block_id, read_allocator, macro_handle, read_buf))) {
+      LOG_WARN("Fail to read micro block", K(ret), K(micro_block_id));
     } else if (OB_FAIL(inner_macro_reader.decrypt_and_decompress_data(
-        des_meta, macro_handle.get_buffer(), micro_block_id.size_, block_data.get_buf(),
+        des_meta, read_buf, micro_block_id.size_, block_data.get_buf(),
         block_data.get_buf_size(), is_compressed, need_deep_copy, allocator))) {
       LOG_WARN("Fail to decrypt and decompress micro block data buf", K(ret));
     } else {
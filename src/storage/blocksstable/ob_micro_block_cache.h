@@ -25,6 +25,7 @@ namespace oceanbase
 {
 namespace blocksstable
 {
+class ObMicroBlockSSDCache;
 class ObMicroBlockCacheKey : public common::ObIKVCacheKey
 {
 public:
@@ -48,6 +49,7 @@ public:
            const MacroBlockId &block_id,
            const int64_t offset,
            const int64_t size);
+  const ObMicroBlockId &get_micro_block_id() const { return block_id_; }
   TO_STRING_KV(K_(tenant_id), K_(block_id));
 private:
   uint64_t tenant_id_;
@@ -145,6 +147,8 @@ class ObIMicroBlockCache : public ObIPutSizeStat
 {
 public:
   typedef common::ObIKVCache<ObMicroBlockCacheKey, ObMicroBlockCacheValue> BaseBlockCache;
+  ObIMicroBlockCache() : ssd_cache_(nullptr) {}
+  void set_ssd_cache(ObMicroBlockSSDCache *ssd_cache) { ssd_cache_ = ssd_cache; }
   int get_cache_block(
       const uint64_t tenant_id,
       const MacroBlockId block_id,
@@ -166,6 +170,21 @@ public:
       ObMacroBlockReader *macro_reader,
       ObMicroBlockData &block_data,
       ObIAllocator *allocator);
+  // load the micro block from local ssd cache into block cache, called before prefetch
+  // to save the data file io.
+  // The micro block is read synchronously in the calling thread. The cache file is a plain
+  // local file rather than an ObIODevice with a device channel, so ObIOManager cannot
+  // schedule it; the read only happens on an index hit and is a single micro block from a
+  // local ssd, which costs far less than the data file io it replaces.
+  // @retval OB_ENTRY_NOT_EXIST    micro block is not in local ssd cache
+  virtual int load_cache_block_from_ssd(
+      const uint64_t tenant_id,
+      const MacroBlockId &macro_id,
+      const ObMicroIndexInfo& idx_row,
+      const common::ObQueryFlag &flag,
+      const ObTableReadInfo &read_info,
+      const ObTabletHandle &tablet_handle,
+      ObMicroBlockBufferHandle &handle);
   virtual void destroy() = 0;
   virtual int get_cache(BaseBlockCache *&cache) = 0;
   virtual int get_allocator(common::ObIAllocator *&allocator) = 0;
@@ -230,6 +249,7 @@ public:
     ObRowStoreType row_store_type_;
     ObMicroBlockDesMeta block_des_meta_;
     bool use_block_cache_;
+    ObMicroBlockSSDCache *ssd_cache_;
   };
 protected:
   virtual int prefetch(
@@ -246,6 +266,27 @@ protected:
       const ObQueryFlag &flag,
       ObMacroBlockHandle &macro_handle,
       ObIMicroBlockIOCallback &callback);
+  int load_cache_block_from_ssd(
+      const uint64_t tenant_id,
+      const MacroBlockId &macro_id,
+      const ObIndexBlockRowHeader& idx_row_header,
+      const common::ObQueryFlag &flag,
+      ObIMicroBlockIOCallback &callback,
+      ObMicroBlockBufferHandle &handle);
+  int fill_callback(
+      const uint64_t tenant_id,
+      const MacroBlockId &macro_id,
+      const ObIndexBlockRowHeader& idx_row_header,
+      const common::ObQueryFlag &flag,
+      ObIMicroBlockIOCallback &callback);
+  // read compressed micro block, try local ssd cache before data file
+  int read_micro_block(
+      const ObMicroBlockId &micro_block_id,
+      common::ObIAllocator &allocator,
+      ObMacroBlockHandle &macro_handle,
+      const char *&buf);
+protected:
+  ObMicroBlockSSDCache *ssd_cache_;
 };
 
 class ObDataMicroBlockCache
@@ -279,6 +320,14 @@ public:
       ObMacroBlockReader *macro_reader,
       ObMicroBlockData &block_data,
       ObIAllocator *allocator) override;
+  int load_cache_block_from_ssd(
+      const uint64_t tenant_id,
+      const MacroBlockId &macro_id,
+      const ObMicroIndexInfo& idx_row,
+      const common::ObQueryFlag &flag,
+      const ObTableReadInfo &read_info,
+      const ObTabletHandle &tablet_handle,
+      ObMicroBlockBufferHandle &handle) override;
   virtual int get_cache(BaseBlockCache *&cache) override;
   virtual int get_allocator(common::ObIAllocator *&allocator) override;
 public:
@@ -372,6 +421,14 @@ public:
       ObMacroBlockReader *macro_reader,
       ObMicroBlockData &block_data,
       ObIAllocator *allocator) override;
+  int load_cache_block_from_ssd(
+      const uint64_t tenant_id,
+      const MacroBlockId &macro_id,
+      const ObMicroIndexInfo& idx_row,
+      const common::ObQueryFlag &flag,
+      const ObTableReadInfo &read_info,
+      const ObTabletHandle &tablet_handle,
+      ObMicroBlockBufferHandle &handle) override;
   virtual int get_cache(BaseBlockCache *&cache) override;
   virtual int get_allocator(common::ObIAllocator *&allocator) override;
 public:
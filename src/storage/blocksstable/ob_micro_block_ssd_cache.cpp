@@ -0,0 +1,616 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+#include "ob_micro_block_ssd_cache.h"
+#include <sys/uio.h>
+#include <algorithm>
+#include "lib/checksum/ob_crc64.h"
+#include "lib/file/file_directory_utils.h"
+#include "lib/utility/ob_utility.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace blocksstable
+{
+/*-----------------------------------ObMicroBlockSSDCacheEntryHeader-----------------------------------*/
+void ObMicroBlockSSDCacheEntryHeader::set(
+    const ObMicroBlockCacheKey &key,
+    const int64_t data_size,
+    const int64_t data_checksum)
+{
+  const ObMicroBlockId &block_id = key.get_micro_block_id();
+  magic_ = MAGIC;
+  data_size_ = static_cast<int32_t>(data_size);
+  tenant_id_ = key.get_tenant_id();
+  first_id_ = block_id.macro_id_.first_id();
+  second_id_ = block_id.macro_id_.second_id();
+  third_id_ = block_id.macro_id_.third_id();
+  offset_ = block_id.offset_;
+  data_checksum_ = data_checksum;
+}
+
+bool ObMicroBlockSSDCacheEntryHeader::match(
+    const ObMicroBlockCacheKey &key,
+    const int64_t data_size) const
+{
+  const ObMicroBlockId &block_id = key.get_micro_block_id();
+  return MAGIC == magic_
+      && data_size == data_size_
+      && key.get_tenant_id() == tenant_id_
+      && block_id.macro_id_.first_id() == first_id_
+      && block_id.macro_id_.second_id() == second_id_
+      && block_id.macro_id_.third_id() == third_id_
+      && block_id.offset_ == offset_;
+}
+
+/*-----------------------------------ObMicroBlockSSDCacheCheckpointTask-----------------------------------*/
+void ObMicroBlockSSDCacheCheckpointTask::runTimerTask()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(cache_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("micro block ssd cache is null", K(ret));
+  } else if (OB_FAIL(cache_->checkpoint())) {
+    LOG_WARN("fail to checkpoint micro block ssd cache", K(ret));
+  }
+}
+
+/*-----------------------------------ObMicroBlockSSDCache-----------------------------------*/
+ObMicroBlockSSDCache::CheckpointFunctor::CheckpointFunctor(
+    ObMicroBlockSSDCache &cache,
+    const int fd,
+    char *buf,
+    const int64_t buf_size)
+  : cache_(cache),
+    fd_(fd),
+    buf_(buf),
+    buf_size_(buf_size),
+    buf_pos_(0),
+    file_pos_(sizeof(IndexFileHeader)),
+    entry_cnt_(0),
+    checksum_(0),
+    stale_keys_()
+{
+}
+
+int ObMicroBlockSSDCache::CheckpointFunctor::operator()(
+    hash::HashMapPair<ObMicroBlockCacheKey, ObMicroBlockSSDCacheEntry> &pair)
+{
+  int ret = OB_SUCCESS;
+  if (!cache_.is_valid_pos_(pair.second.pos_)) {
+    if (OB_FAIL(stale_keys_.push_back(pair.first))) {
+      LOG_WARN("fail to push back stale key", K(ret), K(pair.first));
+    }
+  } else if (buf_pos_ + static_cast<int64_t>(sizeof(IndexFileEntry)) > buf_size_
+      && OB_FAIL(flush())) {
+    LOG_WARN("fail to flush index entries", K(ret));
+  } else {
+    const ObMicroBlockId &block_id = pair.first.get_micro_block_id();
+    IndexFileEntry *entry = reinterpret_cast<IndexFileEntry *>(buf_ + buf_pos_);
+    entry->tenant_id_ = pair.first.get_tenant_id();
+    entry->first_id_ = block_id.macro_id_.first_id();
+    entry->second_id_ = block_id.macro_id_.second_id();
+    entry->third_id_ = block_id.macro_id_.third_id();
+    entry->offset_ = block_id.offset_;
+    entry->size_ = block_id.size_;
+    entry->entry_ = pair.second;
+    buf_pos_ += sizeof(IndexFileEntry);
+    ++entry_cnt_;
+  }
+  return ret;
+}
+
+int ObMicroBlockSSDCache::CheckpointFunctor::flush()
+{
+  int ret = OB_SUCCESS;
+  if (0 == buf_pos_) {
+  } else if (buf_pos_ != ob_pwrite(fd_, buf_, buf_pos_, file_pos_)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to write index file", K(ret), K_(buf_pos), K_(file_pos), K(errno));
+  } else {
+    checksum_ = static_cast<int64_t>(ob_crc64(static_cast<uint64_t>(checksum_), buf_, buf_pos_));
+    file_pos_ += buf_pos_;
+    buf_pos_ = 0;
+  }
+  return ret;
+}
+
+ObMicroBlockSSDCache::ObMicroBlockSSDCache()
+  : is_inited_(false),
+    fd_(-1),
+    file_size_(0),
+    write_pos_(0),
+    lock_(),
+    checkpoint_lock_(),
+    index_(),
+    write_queue_(),
+    sketch_(),
+    write_records_(),
+    record_head_(0),
+    hit_cnt_(0),
+    miss_cnt_(0),
+    put_cnt_(0),
+    pending_write_size_(0),
+    reject_cnt_(0),
+    drop_cnt_(0),
+    last_checkpoint_put_cnt_(0),
+    checkpoint_task_()
+{
+  data_file_path_[0] = '\0';
+  index_file_path_[0] = '\0';
+  tmp_index_file_path_[0] = '\0';
+}
+
+ObMicroBlockSSDCache::~ObMicroBlockSSDCache()
+{
+  destroy();
+}
+
+int ObMicroBlockSSDCache::init(const char *cache_dir, const int64_t cache_size)
+{
+  int ret = OB_SUCCESS;
+  const int64_t bucket_num = MAX(MIN_BUCKET_NUM, MIN(MAX_BUCKET_NUM, cache_size / AVG_MICRO_BLOCK_SIZE));
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("micro block ssd cache has been inited", K(ret));
+  } else if (OB_ISNULL(cache_dir) || OB_UNLIKELY(0 == STRLEN(cache_dir) || cache_size < MIN_CACHE_SIZE)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(cache_dir), K(cache_size));
+  } else if (OB_FAIL(FileDirectoryUtils::create_full_path(cache_dir))) {
+    LOG_WARN("fail to create cache dir", K(ret), K(cache_dir));
+  } else if (OB_FAIL(databuff_printf(data_file_path_, sizeof(data_file_path_), "%s/micro_block_cache", cache_dir))) {
+    LOG_WARN("fail to print data file path", K(ret), K(cache_dir));
+  } else if (OB_FAIL(databuff_printf(index_file_path_, sizeof(index_file_path_), "%s/micro_block_cache.index", cache_dir))) {
+    LOG_WARN("fail to print index file path", K(ret), K(cache_dir));
+  } else if (OB_FAIL(databuff_printf(tmp_index_file_path_, sizeof(tmp_index_file_path_), "%s/micro_block_cache.index.tmp", cache_dir))) {
+    LOG_WARN("fail to print tmp index file path", K(ret), K(cache_dir));
+  } else if (OB_FAIL(index_.create(bucket_num, "MicroSSDCache", "MicroSSDCache"))) {
+    LOG_WARN("fail to create index map", K(ret), K(bucket_num));
+  } else if (OB_FAIL(sketch_.init(bucket_num, "MicroSSDCache"))) {
+    LOG_WARN("fail to init frequency sketch", K(ret), K(bucket_num));
+  } else if (0 > (fd_ = ::open(data_file_path_, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR))) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to open cache file", K(ret), K(data_file_path_), K(errno));
+  } else if (0 != ::ftruncate(fd_, cache_size)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to truncate cache file", K(ret), K(data_file_path_), K(cache_size), K(errno));
+  } else {
+    file_size_ = cache_size;
+    write_pos_ = 0;
+    if (OB_FAIL(load_index_())) {
+      // the cache is rebuilt from empty if the index file is broken
+      LOG_WARN("fail to load index of micro block ssd cache, ignore it", K(ret), K(index_file_path_));
+      index_.clear();
+      write_records_.reset();
+      write_pos_ = 0;
+      ret = OB_SUCCESS;
+    }
+    checkpoint_task_.set_cache(this);
+    last_checkpoint_put_cnt_ = 0;
+    if (OB_FAIL(set_thread_count(1))) {
+      LOG_WARN("fail to set thread count", K(ret));
+    } else if (OB_FAIL(start())) {
+      LOG_WARN("fail to start write thread", K(ret));
+    } else {
+      is_inited_ = true;
+      LOG_INFO("micro block ssd cache inited", K(cache_dir), K(*this));
+    }
+  }
+
+  if (OB_FAIL(ret) && !is_inited_) {
+    destroy();
+  }
+  return ret;
+}
+
+void ObMicroBlockSSDCache::destroy()
+{
+  int tmp_ret = OB_SUCCESS;
+  // the queued micro blocks are dropped
+  lib::ThreadPool::stop();
+  lib::ThreadPool::wait();
+  lib::ThreadPool::destroy();
+  free_write_tasks_();
+  if (is_inited_ && OB_SUCCESS != (tmp_ret = checkpoint())) {
+    LOG_WARN("fail to checkpoint micro block ssd cache", K(tmp_ret));
+  }
+  is_inited_ = false;
+  if (0 <= fd_) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  index_.destroy();
+  sketch_.destroy();
+  write_records_.reset();
+  record_head_ = 0;
+  file_size_ = 0;
+  write_pos_ = 0;
+  hit_cnt_ = 0;
+  miss_cnt_ = 0;
+  put_cnt_ = 0;
+  pending_write_size_ = 0;
+  reject_cnt_ = 0;
+  drop_cnt_ = 0;
+  last_checkpoint_put_cnt_ = 0;
+  checkpoint_task_.set_cache(NULL);
+}
+
+int ObMicroBlockSSDCache::put(const ObMicroBlockCacheKey &key, const char *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockSSDCacheEntry entry;
+  WriteTask *task = NULL;
+  void *task_buf = NULL;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("micro block ssd cache is not inited", K(ret));
+  } else if (OB_ISNULL(buf) || OB_UNLIKELY(size <= 0 || ENTRY_HEADER_SIZE + size > file_size_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(key), KP(buf), K(size));
+  } else if (OB_SUCCESS == index_.get_refactored(key, entry) && is_valid_pos_(entry.pos_)) {
+    // already in cache
+  } else if (FALSE_IT(sketch_.increment(key.hash()))) {
+  } else if (sketch_.estimate(key.hash()) < ADMIT_FREQUENCY) {
+    // read only once, e.g. by a large scan, keep it out of cache
+    ATOMIC_INC(&reject_cnt_);
+  } else if (ATOMIC_AAF(&pending_write_size_, size) > MAX_PENDING_WRITE_SIZE) {
+    // the cache file can not keep up with reads, it is fine to lose some micro blocks
+    ATOMIC_SAF(&pending_write_size_, size);
+    ATOMIC_INC(&drop_cnt_);
+  } else if (OB_ISNULL(task_buf = ob_malloc(sizeof(WriteTask) + size, "MicroSSDCache"))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    ATOMIC_SAF(&pending_write_size_, size);
+    LOG_WARN("fail to alloc write task", K(ret), K(size));
+  } else {
+    task = new (task_buf) WriteTask(key, size);
+    MEMCPY(task->get_buf(), buf, size);
+    if (OB_FAIL(write_queue_.push(task))) {
+      LOG_WARN("fail to push write task", K(ret), K(key));
+      ATOMIC_SAF(&pending_write_size_, size);
+      task->~WriteTask();
+      ob_free(task_buf);
+    }
+  }
+  return ret;
+}
+
+void ObMicroBlockSSDCache::run1()
+{
+  int ret = OB_SUCCESS;
+  lib::set_thread_name("MicroSSDCache");
+  while (!has_set_stop()) {
+    if (OB_FAIL(do_write_tasks_())) {
+      LOG_WARN("fail to write micro blocks to ssd cache", K(ret));
+    }
+    if (write_queue_.is_empty()) {
+      ob_usleep(WRITE_IDLE_WAIT_US);
+    }
+  }
+}
+
+int ObMicroBlockSSDCache::do_write_tasks_()
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  common::QLink *link = NULL;
+  while (!has_set_stop() && OB_SUCCESS == write_queue_.pop(link)) {
+    WriteTask *task = static_cast<WriteTask *>(link);
+    const int64_t size = task->size_;
+    if (OB_SUCCESS != (tmp_ret = write_(task->key_, task->get_buf(), size))) {
+      LOG_WARN("fail to write micro block", K(tmp_ret), K(task->key_), K(size));
+      ret = tmp_ret;
+    }
+    task->~WriteTask();
+    ob_free(task);
+    ATOMIC_SAF(&pending_write_size_, size);
+  }
+  return ret;
+}
+
+void ObMicroBlockSSDCache::free_write_tasks_()
+{
+  common::QLink *link = NULL;
+  while (OB_SUCCESS == write_queue_.pop(link)) {
+    WriteTask *task = static_cast<WriteTask *>(link);
+    ATOMIC_SAF(&pending_write_size_, task->size_);
+    task->~WriteTask();
+    ob_free(task);
+  }
+}
+
+int ObMicroBlockSSDCache::write_(const ObMicroBlockCacheKey &key, const char *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockSSDCacheEntry entry;
+  ObMicroBlockSSDCacheEntryHeader header;
+  const int64_t write_len = ENTRY_HEADER_SIZE + size;
+  if (OB_SUCCESS == index_.get_refactored(key, entry) && is_valid_pos_(entry.pos_)) {
+    // already in cache
+  } else if (OB_FAIL(alloc_space_(write_len, entry.pos_))) {
+    LOG_WARN("fail to alloc space", K(ret), K(write_len));
+  } else {
+    struct iovec iov[2];
+    entry.data_size_ = size;
+    entry.data_checksum_ = static_cast<int64_t>(ob_crc64(buf, size));
+    header.set(key, size, entry.data_checksum_);
+    iov[0].iov_base = &header;
+    iov[0].iov_len = ENTRY_HEADER_SIZE;
+    iov[1].iov_base = const_cast<char *>(buf);
+    iov[1].iov_len = size;
+    // the entries to be overwritten are removed before writing
+    remove_overwritten_entries_();
+    if (write_len != ::pwritev(fd_, iov, 2, entry.pos_ % file_size_)) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("fail to write cache file", K(ret), K(key), K(entry), K(errno));
+    } else if (OB_FAIL(write_records_.push_back(WriteRecord(key, entry.pos_)))) {
+      LOG_WARN("fail to push back write record", K(ret), K(key), K(entry));
+    } else if (OB_FAIL(index_.set_refactored(key, entry, 1 /*overwrite*/))) {
+      LOG_WARN("fail to set index", K(ret), K(key), K(entry));
+      write_records_.pop_back();
+    } else {
+      ATOMIC_INC(&put_cnt_);
+    }
+  }
+  return ret;
+}
+
+void ObMicroBlockSSDCache::remove_overwritten_entries_()
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockSSDCacheEntry entry;
+  while (record_head_ < write_records_.count() && !is_valid_pos_(write_records_.at(record_head_).pos_)) {
+    const WriteRecord &record = write_records_.at(record_head_);
+    // the key may have been written again at a newer position
+    if (OB_SUCCESS == index_.get_refactored(record.key_, entry) && entry.pos_ == record.pos_) {
+      index_.erase_refactored(record.key_);
+    }
+    ++record_head_;
+  }
+  // drop the removed records once they are the majority
+  if (record_head_ >= MIN_RECORD_COMPACT_CNT && record_head_ * 2 >= write_records_.count()) {
+    ObArray<WriteRecord> records;
+    if (OB_FAIL(records.reserve(write_records_.count() - record_head_))) {
+      LOG_WARN("fail to reserve write records", K(ret));
+    }
+    for (int64_t i = record_head_; OB_SUCC(ret) && i < write_records_.count(); ++i) {
+      if (OB_FAIL(records.push_back(write_records_.at(i)))) {
+        LOG_WARN("fail to push back write record", K(ret));
+      }
+    }
+    if (OB_SUCC(ret) && OB_SUCC(write_records_.assign(records))) {
+      record_head_ = 0;
+    }
+  }
+}
+
+int ObMicroBlockSSDCache::get(
+    const ObMicroBlockCacheKey &key,
+    ObIAllocator &allocator,
+    const char *&buf,
+    int64_t &size)
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockSSDCacheEntry entry;
+  char *read_buf = NULL;
+  int64_t read_len = 0;
+  bool is_stale = false;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("micro block ssd cache is not inited", K(ret));
+  } else if (OB_FAIL(index_.get_refactored(key, entry))) {
+    if (OB_HASH_NOT_EXIST == ret) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      LOG_WARN("fail to get index", K(ret), K(key));
+    }
+  } else if (!is_valid_pos_(entry.pos_)) {
+    ret = OB_ENTRY_NOT_EXIST;
+    is_stale = true;
+  } else if (FALSE_IT(read_len = ENTRY_HEADER_SIZE + entry.data_size_)) {
+  } else if (OB_ISNULL(read_buf = static_cast<char *>(allocator.alloc(read_len)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc read buf", K(ret), K(read_len));
+  } else if (read_len != ob_pread(fd_, read_buf, read_len, entry.pos_ % file_size_)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to read cache file", K(ret), K(key), K(entry), K(errno));
+  } else {
+    const ObMicroBlockSSDCacheEntryHeader *header
+        = reinterpret_cast<const ObMicroBlockSSDCacheEntryHeader *>(read_buf);
+    // the space may be overwritten during read, or before restart
+    if (!is_valid_pos_(entry.pos_)
+        || !header->match(key, entry.data_size_)
+        || header->data_checksum_ != entry.data_checksum_
+        || entry.data_checksum_ != static_cast<int64_t>(
+            ob_crc64(read_buf + ENTRY_HEADER_SIZE, entry.data_size_))) {
+      ret = OB_ENTRY_NOT_EXIST;
+      is_stale = true;
+      LOG_DEBUG("micro block in ssd cache is overwritten", K(key), K(entry), KPC(header));
+    } else {
+      buf = read_buf + ENTRY_HEADER_SIZE;
+      size = entry.data_size_;
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    ATOMIC_INC(&hit_cnt_);
+  } else {
+    if (OB_NOT_NULL(read_buf)) {
+      allocator.free(read_buf);
+    }
+    if (OB_ENTRY_NOT_EXIST == ret) {
+      ATOMIC_INC(&miss_cnt_);
+    }
+    if (is_stale) {
+      index_.erase_refactored(key);
+    }
+  }
+  return ret;
+}
+
+int ObMicroBlockSSDCache::checkpoint()
+{
+  int ret = OB_SUCCESS;
+  int fd = -1;
+  char *buf = NULL;
+  IndexFileHeader header;
+  const int64_t header_size = sizeof(IndexFileHeader);
+  lib::ObMutexGuard guard(checkpoint_lock_);
+  const int64_t put_cnt = ATOMIC_LOAD(&put_cnt_);
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("micro block ssd cache is not inited", K(ret));
+  } else if (put_cnt == last_checkpoint_put_cnt_) {
+    // nothing changed since last checkpoint
+  } else if (OB_ISNULL(buf = static_cast<char *>(ob_malloc(CHECKPOINT_BUF_SIZE, "MicroSSDCache")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc checkpoint buf", K(ret));
+  } else if (0 > (fd = ::open(tmp_index_file_path_, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR))) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to open tmp index file", K(ret), K(tmp_index_file_path_), K(errno));
+  } else {
+    const int64_t start_ts = ObTimeUtility::current_time();
+    CheckpointFunctor functor(*this, fd, buf, CHECKPOINT_BUF_SIZE);
+    if (OB_FAIL(index_.foreach_refactored(functor))) {
+      LOG_WARN("fail to dump index entries", K(ret));
+    } else if (OB_FAIL(functor.flush())) {
+      LOG_WARN("fail to flush index entries", K(ret));
+    } else {
+      // all dumped entries are before write_pos
+      header.magic_ = IndexFileHeader::MAGIC;
+      header.file_size_ = file_size_;
+      header.write_pos_ = ATOMIC_LOAD(&write_pos_);
+      header.entry_cnt_ = functor.get_entry_cnt();
+      header.checksum_ = functor.get_checksum();
+      if (header_size != ob_pwrite(fd, reinterpret_cast<const char *>(&header), header_size, 0)) {
+        ret = OB_IO_ERROR;
+        LOG_WARN("fail to write index file header", K(ret), K(errno));
+      } else if (0 != ::fsync(fd)) {
+        ret = OB_IO_ERROR;
+        LOG_WARN("fail to fsync tmp index file", K(ret), K(errno));
+      } else if (0 != ::rename(tmp_index_file_path_, index_file_path_)) {
+        ret = OB_IO_ERROR;
+        LOG_WARN("fail to rename tmp index file", K(ret), K(tmp_index_file_path_), K(errno));
+      } else {
+        last_checkpoint_put_cnt_ = put_cnt;
+      }
+    }
+    // remove stale entries even if checkpoint fails
+    ObArray<ObMicroBlockCacheKey> &stale_keys = functor.get_stale_keys();
+    for (int64_t i = 0; i < stale_keys.count(); ++i) {
+      index_.erase_refactored(stale_keys.at(i));
+    }
+    LOG_INFO("micro block ssd cache checkpoint", K(ret), "entry_cnt", header.entry_cnt_,
+        "stale_cnt", stale_keys.count(), "cost_ts", ObTimeUtility::current_time() - start_ts, K(*this));
+  }
+
+  if (0 <= fd) {
+    ::close(fd);
+  }
+  if (OB_NOT_NULL(buf)) {
+    ob_free(buf);
+  }
+  return ret;
+}
+
+int ObMicroBlockSSDCache::load_index_()
+{
+  int ret = OB_SUCCESS;
+  int fd = -1;
+  char *buf = NULL;
+  bool is_exist = false;
+  IndexFileHeader header;
+  const int64_t header_size = sizeof(IndexFileHeader);
+  const int64_t entry_size = sizeof(IndexFileEntry);
+  if (OB_FAIL(FileDirectoryUtils::is_exists(index_file_path_, is_exist))) {
+    LOG_WARN("fail to check index file", K(ret), K(index_file_path_));
+  } else if (!is_exist) {
+    LOG_INFO("index file of micro block ssd cache does not exist", K(index_file_path_));
+  } else if (0 > (fd = ::open(index_file_path_, O_RDONLY))) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to open index file", K(ret), K(index_file_path_), K(errno));
+  } else if (header_size != ob_pread(fd, reinterpret_cast<char *>(&header), header_size, 0)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to read index file header", K(ret), K(errno));
+  } else if (IndexFileHeader::MAGIC != header.magic_ || header.file_size_ != file_size_) {
+    // cache size changed, all entries are invalid
+    LOG_INFO("discard index of micro block ssd cache", K(header.magic_), K(header.file_size_), K(file_size_));
+  } else if (OB_ISNULL(buf = static_cast<char *>(ob_malloc(CHECKPOINT_BUF_SIZE, "MicroSSDCache")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc buf", K(ret));
+  } else {
+    int64_t checksum = 0;
+    int64_t file_pos = header_size;
+    int64_t remain_cnt = header.entry_cnt_;
+    const int64_t max_read_cnt = CHECKPOINT_BUF_SIZE / entry_size;
+    while (OB_SUCC(ret) && remain_cnt > 0) {
+      const int64_t read_cnt = MIN(remain_cnt, max_read_cnt);
+      const int64_t read_len = read_cnt * entry_size;
+      if (read_len != ob_pread(fd, buf, read_len, file_pos)) {
+        ret = OB_IO_ERROR;
+        LOG_WARN("fail to read index file", K(ret), K(file_pos), K(read_len), K(errno));
+      } else {
+        checksum = static_cast<int64_t>(ob_crc64(static_cast<uint64_t>(checksum), buf, read_len));
+        for (int64_t i = 0; OB_SUCC(ret) && i < read_cnt; ++i) {
+          const IndexFileEntry *entry = reinterpret_cast<const IndexFileEntry *>(buf + i * entry_size);
+          const MacroBlockId macro_id(entry->first_id_, entry->second_id_, entry->third_id_);
+          const ObMicroBlockCacheKey key(entry->tenant_id_, macro_id, entry->offset_, entry->size_);
+          if (entry->entry_.pos_ < header.write_pos_ - file_size_) {
+            // overwritten before checkpoint
+          } else if (OB_FAIL(index_.set_refactored(key, entry->entry_, 1 /*overwrite*/))) {
+            LOG_WARN("fail to set index", K(ret), K(key));
+          } else if (OB_FAIL(write_records_.push_back(WriteRecord(key, entry->entry_.pos_)))) {
+            LOG_WARN("fail to push back write record", K(ret), K(key));
+          }
+        }
+        file_pos += read_len;
+        remain_cnt -= read_cnt;
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (checksum != header.checksum_) {
+      ret = OB_CHECKSUM_ERROR;
+      LOG_WARN("index file checksum not match", K(ret), K(checksum), K(header.checksum_));
+    } else {
+      write_pos_ = header.write_pos_;
+      record_head_ = 0;
+      std::sort(write_records_.begin(), write_records_.end());
+      LOG_INFO("load index of micro block ssd cache", K(header.entry_cnt_), K(header.write_pos_),
+          "valid_cnt", index_.size());
+    }
+  }
+
+  if (0 <= fd) {
+    ::close(fd);
+  }
+  if (OB_NOT_NULL(buf)) {
+    ob_free(buf);
+  }
+  return ret;
+}
+
+int ObMicroBlockSSDCache::alloc_space_(const int64_t len, int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  ObSpinLockGuard guard(lock_);
+  pos = write_pos_;
+  if (pos % file_size_ + len > file_size_) {
+    // an entry never crosses the end of cache file, skip the tail
+    pos = (pos / file_size_ + 1) * file_size_;
+  }
+  ATOMIC_STORE(&write_pos_, pos + len);
+  return ret;
+}
+
+} // namespace blocksstable
+} // namespace oceanbase
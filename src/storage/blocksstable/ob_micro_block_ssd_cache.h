@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_BLOCKSSTABLE_OB_MICRO_BLOCK_SSD_CACHE_H_
+#define OCEANBASE_BLOCKSSTABLE_OB_MICRO_BLOCK_SSD_CACHE_H_
+
+#include "lib/container/ob_array.h"
+#include "lib/hash/ob_hashmap.h"
+#include "lib/lock/ob_mutex.h"
+#include "lib/lock/ob_spin_lock.h"
+#include "lib/queue/ob_link_queue.h"
+#include "lib/task/ob_timer.h"
+#include "lib/thread/thread_pool.h"
+#include "share/cache/ob_kvcache_admission.h"
+#include "ob_micro_block_cache.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+class ObMicroBlockSSDCache;
+
+// Header written before each micro block in the cache file, used to check whether the
+// space has been reused by other micro blocks, especially after restart.
+struct ObMicroBlockSSDCacheEntryHeader
+{
+  static const int32_t MAGIC = 0x5344;
+  int32_t magic_;
+  int32_t data_size_;
+  uint64_t tenant_id_;
+  int64_t first_id_;
+  int64_t second_id_;
+  int64_t third_id_;
+  int64_t offset_;
+  int64_t data_checksum_;
+  void set(const ObMicroBlockCacheKey &key, const int64_t data_size, const int64_t data_checksum);
+  bool match(const ObMicroBlockCacheKey &key, const int64_t data_size) const;
+  TO_STRING_KV(K_(magic), K_(data_size), K_(tenant_id), K_(first_id), K_(second_id),
+      K_(third_id), K_(offset), K_(data_checksum));
+};
+
+struct ObMicroBlockSSDCacheEntry
+{
+  ObMicroBlockSSDCacheEntry() : pos_(0), data_size_(0), data_checksum_(0) {}
+  // logical position in the ring cache file, physical offset is pos_ % file size
+  int64_t pos_;
+  int64_t data_size_;
+  int64_t data_checksum_;
+  TO_STRING_KV(K_(pos), K_(data_size), K_(data_checksum));
+};
+
+class ObMicroBlockSSDCacheCheckpointTask : public common::ObTimerTask
+{
+public:
+  static const int64_t CHECKPOINT_INTERVAL_US = 10 * 60 * 1000 * 1000L; // 10min
+  ObMicroBlockSSDCacheCheckpointTask() : cache_(NULL) {}
+  virtual ~ObMicroBlockSSDCacheCheckpointTask() {}
+  void set_cache(ObMicroBlockSSDCache *cache) { cache_ = cache; }
+  virtual void runTimerTask() override;
+private:
+  ObMicroBlockSSDCache *cache_;
+};
+
+// Second tier of micro block cache on a local fast disk, keeps compressed micro blocks
+// as they are in the data file.
+//
+// The cache file is used as a ring, new micro blocks are appended at write_pos_ and the
+// oldest ones are overwritten when the ring is full, so no space management is needed.
+// The index is kept in memory and checkpointed to an index file periodically. Index
+// entries are removed as soon as their space is overwritten, so the index never holds
+// more entries than the ring.
+//
+// Micro blocks are written by a background thread, put only admits a micro block which
+// has been read from data file repeatedly and queues a copy of it.
+class ObMicroBlockSSDCache : public lib::ThreadPool
+{
+public:
+  static const int64_t MIN_CACHE_SIZE = 64 * 1024 * 1024L; // 64MB
+  ObMicroBlockSSDCache();
+  virtual ~ObMicroBlockSSDCache();
+  int init(const char *cache_dir, const int64_t cache_size);
+  void destroy();
+  bool is_inited() const { return is_inited_; }
+  // queue the micro block to be written by the background thread, the micro block is
+  // dropped if it is not admitted or too many bytes are waiting to be written.
+  // @param [in], buf      compressed micro block read from data file
+  int put(const ObMicroBlockCacheKey &key, const char *buf, const int64_t size);
+  // @retval OB_ENTRY_NOT_EXIST    micro block is not in cache
+  int get(
+      const ObMicroBlockCacheKey &key,
+      common::ObIAllocator &allocator,
+      const char *&buf,
+      int64_t &size);
+  // dump the valid index entries to index file
+  int checkpoint();
+  ObMicroBlockSSDCacheCheckpointTask &get_checkpoint_task() { return checkpoint_task_; }
+  virtual void run1() override;
+  TO_STRING_KV(K_(is_inited), K_(fd), K_(file_size), K_(write_pos), K_(hit_cnt), K_(miss_cnt),
+      K_(put_cnt), K_(pending_write_size), K_(reject_cnt), K_(drop_cnt), "entry_cnt", index_.size());
+private:
+  struct WriteTask : public common::QLink
+  {
+    WriteTask(const ObMicroBlockCacheKey &key, const int64_t size) : key_(key), size_(size) {}
+    char *get_buf() { return reinterpret_cast<char *>(this + 1); }
+    ObMicroBlockCacheKey key_;
+    int64_t size_;
+  };
+  // written micro blocks in the order of position, to remove index entries whose space
+  // is overwritten
+  struct WriteRecord
+  {
+    WriteRecord() : key_(), pos_(0) {}
+    WriteRecord(const ObMicroBlockCacheKey &key, const int64_t pos) : key_(key), pos_(pos) {}
+    bool operator<(const WriteRecord &other) const { return pos_ < other.pos_; }
+    TO_STRING_KV(K_(key), K_(pos));
+    ObMicroBlockCacheKey key_;
+    int64_t pos_;
+  };
+  struct IndexFileHeader
+  {
+    static const int64_t MAGIC = 0x4D42534443494458; // MBSDCIDX
+    int64_t magic_;
+    int64_t file_size_;
+    int64_t write_pos_;
+    int64_t entry_cnt_;
+    int64_t checksum_;
+  };
+  struct IndexFileEntry
+  {
+    uint64_t tenant_id_;
+    int64_t first_id_;
+    int64_t second_id_;
+    int64_t third_id_;
+    int64_t offset_;
+    int64_t size_;
+    ObMicroBlockSSDCacheEntry entry_;
+  };
+  class CheckpointFunctor
+  {
+  public:
+    CheckpointFunctor(ObMicroBlockSSDCache &cache, const int fd, char *buf, const int64_t buf_size);
+    int operator()(common::hash::HashMapPair<ObMicroBlockCacheKey, ObMicroBlockSSDCacheEntry> &pair);
+    int flush();
+    common::ObArray<ObMicroBlockCacheKey> &get_stale_keys() { return stale_keys_; }
+    int64_t get_entry_cnt() const { return entry_cnt_; }
+    int64_t get_checksum() const { return checksum_; }
+  private:
+    ObMicroBlockSSDCache &cache_;
+    int fd_;
+    char *buf_;
+    int64_t buf_size_;
+    int64_t buf_pos_;
+    int64_t file_pos_;
+    int64_t entry_cnt_;
+    int64_t checksum_;
+    common::ObArray<ObMicroBlockCacheKey> stale_keys_;
+  };
+  typedef common::hash::ObHashMap<ObMicroBlockCacheKey, ObMicroBlockSSDCacheEntry> IndexMap;
+  static const int64_t ENTRY_HEADER_SIZE = sizeof(ObMicroBlockSSDCacheEntryHeader);
+  static const int64_t AVG_MICRO_BLOCK_SIZE = 16 * 1024L;
+  static const int64_t MIN_BUCKET_NUM = 1024L;
+  static const int64_t MAX_BUCKET_NUM = 4 * 1024 * 1024L;
+  static const int64_t CHECKPOINT_BUF_SIZE = 2 * 1024 * 1024L;
+  static const int64_t MAX_PENDING_WRITE_SIZE = 64 * 1024 * 1024L; // 64MB
+  // admitted when read from data file at least twice recently
+  static const int64_t ADMIT_FREQUENCY = 2;
+  static const int64_t WRITE_IDLE_WAIT_US = 10 * 1000L; // 10ms
+  static const int64_t MIN_RECORD_COMPACT_CNT = 4096;
+  int load_index_();
+  int alloc_space_(const int64_t len, int64_t &pos);
+  // write the micro block to cache file and index it, only called by the background thread
+  int write_(const ObMicroBlockCacheKey &key, const char *buf, const int64_t size);
+  int do_write_tasks_();
+  void free_write_tasks_();
+  // remove the index entries whose space has been overwritten
+  void remove_overwritten_entries_();
+  OB_INLINE bool is_valid_pos_(const int64_t pos) const
+  {
+    return pos >= ATOMIC_LOAD(&write_pos_) - file_size_;
+  }
+private:
+  bool is_inited_;
+  int fd_;
+  int64_t file_size_;
+  int64_t write_pos_;
+  common::ObSpinLock lock_;
+  lib::ObMutex checkpoint_lock_;
+  IndexMap index_;
+  common::ObSpLinkQueue write_queue_;
+  common::ObKVCacheFrequencySketch sketch_;
+  common::ObArray<WriteRecord> write_records_;
+  int64_t record_head_;
+  char data_file_path_[common::OB_MAX_FILE_NAME_LENGTH];
+  char index_file_path_[common::OB_MAX_FILE_NAME_LENGTH];
+  char tmp_index_file_path_[common::OB_MAX_FILE_NAME_LENGTH];
+  int64_t hit_cnt_;
+  int64_t miss_cnt_;
+  int64_t put_cnt_;
+  int64_t pending_write_size_;
+  int64_t reject_cnt_;
+  int64_t drop_cnt_;
+  int64_t last_checkpoint_put_cnt_;
+  ObMicroBlockSSDCacheCheckpointTask checkpoint_task_;
+  DISALLOW_COPY_AND_ASSIGN(ObMicroBlockSSDCache);
+};
+
+} // namespace blocksstable
+} // namespace oceanbase
+
+#endif // OCEANBASE_BLOCKSSTABLE_OB_MICRO_BLOCK_SSD_CACHE_H_
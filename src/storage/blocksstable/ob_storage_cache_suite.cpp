@@ -11,6 +11,7 @@
  */
 
 #include "ob_storage_cache_suite.h"
+#include "share/ob_thread_mgr.h"
 
 using namespace oceanbase::common;
 
@@ -24,6 +25,7 @@ ObStorageCacheSuite::ObStorageCacheSuite()
     user_row_cache_(),
     bf_cache_(),
     fuse_row_cache_(),
+    ssd_cache_(),
     is_inited_(false)
 {
 }
@@ -108,8 +110,38 @@ int ObStorageCacheSuite::set_bf_cache_miss_count_threshold(const int64_t bf_cach
   return ret;
 }
 
+int ObStorageCacheSuite::init_ssd_cache(const char *cache_dir, const int64_t cache_size)
+{
+  int ret = OB_SUCCESS;
+  const bool repeat = true;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "The cache suite has not been inited, ", K(ret));
+  } else if (cache_size < ObMicroBlockSSDCache::MIN_CACHE_SIZE) {
+    // _micro_block_ssd_cache_size is left at its default, the server still starts without the tier
+    STORAGE_LOG(WARN, "ssd cache size is too small, micro block ssd cache is disabled", K(cache_dir),
+        K(cache_size), "min_cache_size", ObMicroBlockSSDCache::MIN_CACHE_SIZE);
+  } else if (OB_FAIL(ssd_cache_.init(cache_dir, cache_size))) {
+    STORAGE_LOG(WARN, "fail to init micro block ssd cache", K(ret), K(cache_dir), K(cache_size));
+  } else if (OB_FAIL(TG_SCHEDULE(lib::TGDefIDs::ServerGTimer, ssd_cache_.get_checkpoint_task(),
+      ObMicroBlockSSDCacheCheckpointTask::CHECKPOINT_INTERVAL_US, repeat))) {
+    STORAGE_LOG(WARN, "fail to schedule ssd cache checkpoint task", K(ret));
+    ssd_cache_.destroy();
+  } else {
+    index_block_cache_.set_ssd_cache(&ssd_cache_);
+    user_block_cache_.set_ssd_cache(&ssd_cache_);
+  }
+  return ret;
+}
+
 void ObStorageCacheSuite::destroy()
 {
+  index_block_cache_.set_ssd_cache(nullptr);
+  user_block_cache_.set_ssd_cache(nullptr);
+  if (ssd_cache_.is_inited()) {
+    TG_CANCEL(lib::TGDefIDs::ServerGTimer, ssd_cache_.get_checkpoint_task());
+    ssd_cache_.destroy();
+  }
   index_block_cache_.destroy();
   user_block_cache_.destroy();
   user_row_cache_.destroy();
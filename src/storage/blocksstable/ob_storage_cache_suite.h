@@ -15,6 +15,7 @@
 
 #include "share/schema/ob_table_schema.h"
 #include "ob_micro_block_cache.h"
+#include "ob_micro_block_ssd_cache.h"
 #include "ob_row_cache.h"
 #include "ob_fuse_row_cache.h"
 #include "ob_bloom_filter_cache.h"
@@ -44,11 +45,14 @@ public:
       const int64_t fuse_row_cache_priority,
       const int64_t bf_cache_priority);
   int set_bf_cache_miss_count_threshold(const int64_t bf_cache_miss_count_threshold);
+  // optional second tier of micro block caches on local ssd
+  int init_ssd_cache(const char *cache_dir, const int64_t cache_size);
   ObDataMicroBlockCache &get_block_cache() { return user_block_cache_; }
   ObIndexMicroBlockCache &get_index_block_cache() { return index_block_cache_; }
   ObRowCache &get_row_cache() { return user_row_cache_; }
   ObBloomFilterCache &get_bf_cache() { return bf_cache_; }
   ObFuseRowCache &get_fuse_row_cache() { return fuse_row_cache_; }
+  ObMicroBlockSSDCache &get_ssd_cache() { return ssd_cache_; }
   void destroy();
   inline bool is_inited() const { return is_inited_; }
   TO_STRING_KV(K(is_inited_));
@@ -60,6 +64,7 @@ private:
   ObRowCache user_row_cache_;
   ObBloomFilterCache bf_cache_;
   ObFuseRowCache fuse_row_cache_;
+  ObMicroBlockSSDCache ssd_cache_;
   bool is_inited_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObStorageCacheSuite);
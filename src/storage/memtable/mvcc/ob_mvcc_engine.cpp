@@ -79,7 +79,8 @@ void ObMvccEngine::destroy()
 }
 
 int ObMvccEngine::try_compact_row_when_mvcc_read_(const int64_t &snapshot_version,
-                                                  ObMvccRow &row)
+                                                  ObMvccRow &row,
+                                                  const bool for_read_amplification)
 {
   int ret = OB_SUCCESS;
   const int64_t latest_compact_ts = row.latest_compact_ts_;
@@ -95,7 +96,8 @@ int ObMvccEngine::try_compact_row_when_mvcc_read_(const int64_t &snapshot_versio
     if (OB_FAIL(row.row_compact(memtable_,
                                 true/*for_replay*/,
                                 snapshot_version,
-                                engine_allocator_))) {
+                                engine_allocator_,
+                                for_read_amplification))) {
       TRANS_LOG(WARN, "row compact error", K(ret), K(snapshot_version));
     }
   }
@@ -126,9 +128,19 @@ int ObMvccEngine::get(ObMvccAccessCtx &ctx,
     }
   } else if (!query_flag.is_prewarm() && value->need_compact(for_read, for_replay)) {
     int tmp_ret = OB_SUCCESS;
-    if (OB_SUCCESS != (tmp_ret = try_compact_row_when_mvcc_read_(ctx.get_snapshot_version(), *value))) {
+    if (OB_SUCCESS != (tmp_ret = try_compact_row_when_mvcc_read_(ctx.get_snapshot_version(),
+                                                                 *value,
+                                                                 false /*for_read_amplification*/))) {
       TRANS_LOG(WARN, "fail to try to compact row", K(tmp_ret));
     }
+  } else if (!query_flag.is_prewarm() && value->need_compact_for_read()) {
+    // the row is updated moderately while the readers walk a long version chain
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = try_compact_row_when_mvcc_read_(ctx.get_snapshot_version(),
+                                                                 *value,
+                                                                 true /*for_read_amplification*/))) {
+      TRANS_LOG(WARN, "fail to try to compact row for read amplification", K(tmp_ret));
+    }
   } else {
     // do nothing
   }
@@ -116,7 +116,8 @@ public:
                               storage::ObPartitionEst &part_est) const;
 private:
   int try_compact_row_when_mvcc_read_(const int64_t &snapshot_info,
-                                      ObMvccRow &row);
+                                      ObMvccRow &row,
+                                      const bool for_read_amplification);
 
   int build_tx_node_(ObIMemtableCtx &ctx,
                      const ObTxNodeArg &arg,
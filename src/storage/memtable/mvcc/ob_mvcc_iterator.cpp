@@ -85,6 +85,7 @@ int ObMvccValueIterator::lock_for_read_(const ObQueryFlag &flag)
   lock_begin(lock_start_time);
 
   while (OB_SUCC(ret) && NULL != iter && NULL == version_iter_) {
+    traversed_cnt_++;
     if (OB_FAIL(lock_for_read_inner_(flag, iter))) {
       TRANS_LOG(WARN, "lock for read failed", K(ret));
     }
@@ -312,6 +313,7 @@ int ObMvccValueIterator::get_next_node(const void *&tnode)
 void ObMvccValueIterator::move_to_next_node_()
 {
   if (OB_ISNULL(version_iter_)) {
+  } else if (FALSE_IT(traversed_cnt_++)) {
   } else if (NDT_COMPACT == version_iter_->type_) {
     if (skip_compact_) {
       version_iter_ = version_iter_->prev_;
@@ -323,6 +325,14 @@ void ObMvccValueIterator::move_to_next_node_()
   }
 }
 
+void ObMvccValueIterator::record_read_amplification_()
+{
+  if (OB_NOT_NULL(value_) && traversed_cnt_ > 0) {
+    value_->record_read_amplification(traversed_cnt_);
+  }
+  traversed_cnt_ = 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 ObMvccRowIterator::ObMvccRowIterator()
@@ -319,6 +319,7 @@ void ObMvccRow::ObMvccRowIndex::set_index_node(const int64_t index, ObMvccTransN
 void ObMvccRow::reset()
 {
   update_since_compact_ = 0;
+  read_amplification_ = 0;
   flag_ = F_INIT;
   first_dml_flag_ = ObDmlFlag::DF_NOT_EXIST;
   last_dml_flag_ = ObDmlFlag::DF_NOT_EXIST;
@@ -344,6 +345,7 @@ int64_t ObMvccRow::to_string(char *buf, const int64_t buf_len) const
                           "first_dml=%s "
                           "last_dml=%s "
                           "update_since_compact=%d "
+                          "read_amplification=%d "
                           "list_head=%p "
                           "latest_compact_node=%p "
                           "max_trans_version=%ld "
@@ -361,6 +363,7 @@ int64_t ObMvccRow::to_string(char *buf, const int64_t buf_len) const
                           get_dml_str(first_dml_flag_),
                           get_dml_str(last_dml_flag_),
                           update_since_compact_,
+                          read_amplification_,
                           list_head_,
                           latest_compact_node_,
                           max_trans_version_,
@@ -547,10 +550,30 @@ bool ObMvccRow::need_compact(const bool for_read, const bool for_replay)
   return bool_ret;
 }
 
+bool ObMvccRow::need_compact_for_read()
+{
+  bool bool_ret = false;
+  const int32_t read_amplification = ATOMIC_LOAD(&read_amplification_);
+  if (read_amplification >= READ_AMPLIFICATION_COMPACT_TRIGGER) {
+    bool_ret = ATOMIC_BCAS(&read_amplification_, read_amplification, 0);
+  }
+  return bool_ret;
+}
+
+void ObMvccRow::record_read_amplification(const int64_t traversed_cnt)
+{
+  if (traversed_cnt >= READ_AMPLIFICATION_TRACE_LENGTH
+      && ATOMIC_LOAD(&read_amplification_) < READ_AMPLIFICATION_COMPACT_TRIGGER) {
+    const int64_t delta = min(traversed_cnt, static_cast<int64_t>(READ_AMPLIFICATION_COMPACT_TRIGGER));
+    (void)ATOMIC_AAF(&read_amplification_, static_cast<int32_t>(delta));
+  }
+}
+
 int ObMvccRow::row_compact(ObMemtable *memtable,
                            const bool for_replay,
                            const int64_t snapshot_version,
-                           ObIAllocator *node_alloc)
+                           ObIAllocator *node_alloc,
+                           const bool for_read_amplification)
 {
   int ret = OB_SUCCESS;
   if (0 >= snapshot_version || NULL == node_alloc || NULL == memtable) {
@@ -561,7 +584,7 @@ int ObMvccRow::row_compact(ObMemtable *memtable,
     ObMemtableRowCompactor row_compactor;
     if (OB_FAIL(row_compactor.init(this, memtable, node_alloc, for_replay))) {
       TRANS_LOG(WARN, "row compactor init error", K(ret));
-    } else if (OB_FAIL(row_compactor.compact(snapshot_version))) {
+    } else if (OB_FAIL(row_compactor.compact(snapshot_version, for_read_amplification))) {
       TRANS_LOG(WARN, "row compact error", K(ret), K(snapshot_version));
     } else {
       // do nothing
@@ -182,10 +182,17 @@ struct ObMvccRow
   //index will be constructed and used
   static const int64_t INDEX_TRIGGER_COUNT = 500;
 
+  // reads traversing fewer tx nodes than READ_AMPLIFICATION_TRACE_LENGTH are not recorded, and the
+  // row is compacted for read once the recorded traversed nodes exceed READ_AMPLIFICATION_COMPACT_TRIGGER
+  static const int64_t READ_AMPLIFICATION_TRACE_LENGTH = 8;
+  static const int32_t READ_AMPLIFICATION_COMPACT_TRIGGER = 256;
+
   // Spin lock that protects row data.
   ObRowLatch latch_;
   // Update count since last row compact.
   int32_t update_since_compact_;
+  // Tx nodes traversed by long reads since last row compact.
+  int32_t read_amplification_;
   uint8_t flag_;
   blocksstable::ObDmlFlag first_dml_flag_;
   blocksstable::ObDmlFlag last_dml_flag_;
@@ -252,10 +259,12 @@ struct ObMvccRow
   // memtable is used to get tx_table when compact
   // snapshot_version is the version for row compact
   // node_alloc is the allocator for compact node allocation
+  // for_read_amplification means the compaction is triggered by need_compact_for_read
   int row_compact(ObMemtable *memtable,
                   const bool for_replay,
                   const int64_t snapshot_version,
-                  common::ObIAllocator *node_alloc);
+                  common::ObIAllocator *node_alloc,
+                  const bool for_read_amplification = false);
 
   int elr(const transaction::ObTransID &tx_id,
           const int64_t elr_commit_version,
@@ -289,6 +298,11 @@ struct ObMvccRow
   // ===================== ObMvccRow Getter Interface =====================
   // need_compact checks whether the compaction is necessary
   bool need_compact(const bool for_read, const bool for_replay);
+  // need_compact_for_read checks whether the readers walk too many tx nodes on the row, which may
+  // happen on the hot row which is read frequently while updated moderately
+  bool need_compact_for_read();
+  // record_read_amplification records the tx nodes traversed by one read on the row
+  void record_read_amplification(const int64_t traversed_cnt);
   // is_empty checks whether ObMvccRow has no tx node(while the row may be deleted)
   bool is_empty() const { return (NULL == ATOMIC_LOAD(&list_head_)); }
   // get_list_head gets the head tx node
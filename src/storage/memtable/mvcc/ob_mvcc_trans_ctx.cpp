@@ -981,6 +981,10 @@ int ObMvccRowCallback::trans_commit()
             } else {
               memtable_->row_compact(&value_, ctx_.is_for_replay(), INT64_MAX - 100);
             }
+          } else if (!ctx_.is_for_replay() && value_.need_compact_for_read()) {
+            // compact the hot row for the readers on commit, so that scans benefit too
+            memtable_->row_compact(&value_, false /*for_replay*/, INT64_MAX - 100,
+                                   true /*for_read_amplification*/);
           }
         }
       }
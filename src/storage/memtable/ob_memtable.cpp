@@ -1276,7 +1276,8 @@ ObDatumRange &ObMemtable::m_get_real_range(ObDatumRange &real_range, const ObDat
 
 int ObMemtable::row_compact(ObMvccRow *row,
                             const bool for_replay,
-                            const int64_t snapshot_version)
+                            const int64_t snapshot_version,
+                            const bool for_read_amplification)
 {
   int ret = OB_SUCCESS;
   ObMemtableRowCompactor row_compactor;
@@ -1285,7 +1286,7 @@ int ObMemtable::row_compact(ObMvccRow *row,
     TRANS_LOG(WARN, "row is NULL");
   } else if (OB_FAIL(row_compactor.init(row, this, &local_allocator_, for_replay))) {
     TRANS_LOG(WARN, "row compactor init error", K(ret));
-  } else if (OB_FAIL(row_compactor.compact(snapshot_version))) {
+  } else if (OB_FAIL(row_compactor.compact(snapshot_version, for_read_amplification))) {
     TRANS_LOG(WARN, "row_compact fail", K(ret), K(*row), K(snapshot_version));
   } else {
     // do nothing
@@ -1293,6 +1294,12 @@ int ObMemtable::row_compact(ObMvccRow *row,
   return ret;
 }
 
+void ObMemtable::inc_read_amplification_compact_cnt()
+{
+  (void)ATOMIC_AAF(&mt_stat_.read_amplification_compact_cnt_, 1);
+  EVENT_INC(MEMSTORE_READ_AMPLIFICATION_COMPACT_COUNT);
+}
+
 int64_t ObMemtable::get_hash_item_count() const
 {
   return query_engine_.hash_size();
@@ -57,6 +57,8 @@ struct ObMtStat
   int64_t create_flush_dag_time_;
   int64_t release_time_;
   int64_t last_print_time_;
+  // row compactions triggered by the tx nodes traversed by reads
+  int64_t read_amplification_compact_cnt_;
 };
 
 class ObMTKVBuilder
@@ -320,7 +322,10 @@ public:
   inline bool not_empty() const { return INT64_MAX != get_protection_clock(); };
   void set_max_schema_version(const int64_t schema_version);
   virtual int64_t get_max_schema_version() const override;
-  int row_compact(ObMvccRow *value, const bool for_replay, const int64_t snapshot_version);
+  int row_compact(ObMvccRow *value,
+                  const bool for_replay,
+                  const int64_t snapshot_version,
+                  const bool for_read_amplification = false);
   int64_t get_hash_item_count() const;
   int64_t get_hash_alloc_memory() const;
   int64_t get_btree_item_count() const;
@@ -361,6 +366,9 @@ public:
   common::ObIAllocator &get_allocator() {return local_allocator_;}
   bool has_hotspot_row() const { return ATOMIC_LOAD(&contain_hotspot_row_); }
   void set_contain_hotspot_row() { return ATOMIC_STORE(&contain_hotspot_row_, true); }
+  void inc_read_amplification_compact_cnt();
+  int64_t get_read_amplification_compact_cnt() const
+  { return ATOMIC_LOAD(&mt_stat_.read_amplification_compact_cnt_); }
   virtual int64_t get_upper_trans_version() const override;
   virtual int estimate_phy_size(const ObStoreRowkey* start_key, const ObStoreRowkey* end_key, int64_t& total_bytes, int64_t& total_rows) override;
   virtual int get_split_ranges(const ObStoreRowkey* start_key, const ObStoreRowkey* end_key, const int64_t part_cnt, common::ObIArray<common::ObStoreRange> &range_array) override;
@@ -455,7 +463,8 @@ public:
                        K_(logging_blocked), K_(unset_active_memtable_logging_blocked), K_(resolve_active_memtable_left_boundary),
                        K_(contain_hotspot_row), K_(max_end_log_ts), K_(rec_log_ts), K_(snapshot_version),
                        K_(is_tablet_freeze), K_(is_force_freeze), K_(contain_hotspot_row),
-                       K_(read_barrier), K_(is_flushed), K_(freeze_state));
+                       K_(read_barrier), K_(is_flushed), K_(freeze_state),
+                       "read_amplification_compact_cnt", mt_stat_.read_amplification_compact_cnt_);
 private:
   static const int64_t OB_EMPTY_MEMSTORE_MAX_SIZE = 10L << 20; // 10MB
   int mvcc_write_(storage::ObStoreCtx &ctx,
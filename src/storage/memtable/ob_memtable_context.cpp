@@ -623,7 +623,8 @@ int ObMemtableCtx::fill_redo_log(char *buf,
                                  const int64_t buf_len,
                                  int64_t &buf_pos,
                                  ObRedoLogSubmitHelper &helper,
-                                 const bool log_for_lock_node)
+                                 const bool log_for_lock_node,
+                                 const ObCompressorType compressor_type)
 {
   int ret = OB_SUCCESS;
 
@@ -637,7 +638,8 @@ int ObMemtableCtx::fill_redo_log(char *buf,
                                        buf_len,
                                        buf_pos,
                                        helper,
-                                       log_for_lock_node))) {
+                                       log_for_lock_node,
+                                       compressor_type))) {
       // When redo log data is greater than or equal to 1.875M, or participant has
       // no redo log data at all, this branch would be reached. Don't print log here
     }
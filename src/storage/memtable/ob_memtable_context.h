@@ -373,7 +373,9 @@ public:
                             const int64_t buf_len,
                             int64_t &buf_pos,
                             ObRedoLogSubmitHelper &helper,
-                            const bool log_for_lock_node = true);
+                            const bool log_for_lock_node = true,
+                            const common::ObCompressorType compressor_type
+                              = common::ObCompressorType::NONE_COMPRESSOR);
   int calc_checksum_before_log_ts(const int64_t log_ts,
                                   uint64_t &checksum,
                                   int64_t &checksum_log_ts);
@@ -88,7 +88,9 @@ public:
                             const int64_t buf_len,
                             int64_t &buf_pos,
                             ObRedoLogSubmitHelper &helper,
-                            const bool log_for_lock_node = true) = 0;
+                            const bool log_for_lock_node = true,
+                            const common::ObCompressorType compressor_type
+                              = common::ObCompressorType::NONE_COMPRESSOR) = 0;
   virtual int audit_partition(const enum transaction::ObPartitionAuditOperator op,
                               const int64_t count) = 0;
   common::ActiveResource resource_link_;
@@ -16,6 +16,8 @@
 #include "lib/utility/serialization.h"
 #include "lib/checksum/ob_crc64.h"
 #include "lib/utility/ob_tracepoint.h"
+#include "lib/compress/ob_compressor_pool.h"
+#include "lib/stat/ob_diagnose_info.h"
 
 #include "storage/memtable/ob_memtable_context.h"     // ObTransRowFlag
 #include "storage/tx/ob_clog_encrypter.h"
@@ -33,14 +35,17 @@ namespace memtable
 ObMemtableMutatorMeta::ObMemtableMutatorMeta():
     magic_(MMB_MAGIC),
     meta_crc_(0),
-    meta_size_(sizeof(*this)),
+    meta_size_(MIN_META_SIZE),
     version_(0),
     flags_(ObTransRowFlag::NORMAL_ROW),
     data_crc_(0),
     data_size_(0),
     row_count_(0),
-    unused_(0)
+    unused_(0),
+    orig_data_size_(0),
+    compressor_type_(ObCompressorType::INVALID_COMPRESSOR)
 {
+  MEMSET(reserved_, 0, sizeof(reserved_));
 }
 
 ObMemtableMutatorMeta::~ObMemtableMutatorMeta()
@@ -95,9 +100,10 @@ int64_t ObMemtableMutatorMeta::get_row_count() const
   return row_count_;
 }
 
+// the compress info is serialized only if the mutator is compressed
 int64_t ObMemtableMutatorMeta::get_serialize_size() const
 {
-  return sizeof(*this);
+  return meta_size_;
 }
 
 int ObMemtableMutatorMeta::serialize(char *buf, const int64_t buf_len, int64_t &pos)
@@ -129,16 +135,20 @@ int ObMemtableMutatorMeta::deserialize(const char *buf, const int64_t data_len,
     ret = OB_INVALID_ARGUMENT;
     TRANS_LOG(WARN, "invalid param", K(ret), KP(buf), K(data_len), K(pos));
   } else {
+    // the meta written by old version has no compress info
+    orig_data_size_ = 0;
+    compressor_type_ = ObCompressorType::INVALID_COMPRESSOR;
     MEMCPY(this, buf + pos, min_meta_size);
     if (!check_magic()) {
       ret = OB_INVALID_LOG;
       TRANS_LOG(WARN, "invalid log: check_magic fail", K(*this));
-    } else if (calc_meta_crc(buf + pos) != meta_crc_) {
-      ret = OB_INVALID_LOG;
-      TRANS_LOG(WARN, "invalid log: check_meta_crc fail", K(*this));
     } else if (pos + meta_size_ > data_len) {
+      // check the size before meta crc, which covers the compress info of the meta
       ret = OB_BUF_NOT_ENOUGH;
       TRANS_LOG(WARN, "buf not enough", K(pos), K(meta_size_), K(data_len));
+    } else if (calc_meta_crc(buf + pos) != meta_crc_) {
+      ret = OB_INVALID_LOG;
+      TRANS_LOG(WARN, "invalid log: check_meta_crc fail", K(*this));
     } else {
       MEMCPY(this, buf + pos, min(sizeof(*this), static_cast<uint64_t>(meta_size_)));
       pos += meta_size_;
@@ -159,8 +169,10 @@ int64_t ObMemtableMutatorMeta::to_string(char *buffer, const int64_t length) con
 {
   int64_t pos = 0;
   common::databuff_printf(buffer, length, pos,
-                          "%p data_crc=%x meta_size=%d data_size=%d row_count=%d",
-                          this, data_crc_, meta_size_, data_size_, row_count_);
+                          "%p data_crc=%x meta_size=%d data_size=%d row_count=%d "
+                          "compressor_type=%d orig_data_size=%d",
+                          this, data_crc_, meta_size_, data_size_, row_count_,
+                          compressor_type_, orig_data_size_);
   return pos;
 }
 
@@ -199,6 +211,36 @@ void ObMemtableMutatorMeta::remove_encrypt_flag()
   ObTransRowFlag::remove_encrypt_flag(flags_);
 }
 
+void ObMemtableMutatorMeta::set_compress_info(const ObCompressorType compressor_type,
+                                              const int64_t orig_data_size)
+{
+  compressor_type_ = static_cast<uint8_t>(compressor_type);
+  orig_data_size_ = static_cast<uint32_t>(orig_data_size);
+  meta_size_ = static_cast<int16_t>(sizeof(*this));
+}
+
+int ObMemtableMutatorMeta::decompress_data(const char *data, char *buf, const int64_t buf_len) const
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = NULL;
+  int64_t decompress_size = 0;
+  if (OB_ISNULL(data) || OB_ISNULL(buf) || buf_len < orig_data_size_) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument", K(ret), KP(data), KP(buf), K(buf_len), K(*this));
+  } else if (!is_compressed()) {
+    ret = OB_STATE_NOT_MATCH;
+    TRANS_LOG(WARN, "mutator is not compressed", K(ret), K(*this));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(get_compressor_type(), compressor))) {
+    TRANS_LOG(WARN, "get compressor failed", K(ret), K(*this));
+  } else if (OB_FAIL(compressor->decompress(data, data_size_, buf, buf_len, decompress_size))) {
+    TRANS_LOG(WARN, "decompress mutator failed", K(ret), K(*this));
+  } else if (OB_UNLIKELY(decompress_size != orig_data_size_)) {
+    ret = OB_INVALID_DATA;
+    TRANS_LOG(WARN, "decompressed size mismatch", K(ret), K(decompress_size), K(*this));
+  }
+  return ret;
+}
+
 ObEncryptRowBuf::ObEncryptRowBuf() : ptr_(nullptr)
 {}
 
@@ -1033,10 +1075,54 @@ int ObMutatorWriter::append_table_lock_kv(
   return ret;
 }
 
-int ObMutatorWriter::serialize(const uint8_t row_flag, int64_t &res_len)
+int ObMutatorWriter::compress_data_(const ObCompressorType compressor_type)
 {
   int ret = OB_SUCCESS;
   const int64_t meta_size = meta_.get_serialize_size();
+  const int64_t data_size = buf_.get_position() - meta_size;
+  ObCompressor *compressor = NULL;
+  int64_t max_overflow_size = 0;
+  int64_t compress_buf_len = 0;
+  int64_t compressed_size = 0;
+  char *compress_buf = NULL;
+  if (ObCompressorType::NONE_COMPRESSOR >= compressor_type
+      || data_size < MIN_COMPRESS_DATA_SIZE) {
+    // no need to compress
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compressor_type, compressor))) {
+    TRANS_LOG(WARN, "get compressor failed", K(ret), K(compressor_type));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(data_size, max_overflow_size))) {
+    TRANS_LOG(WARN, "get max overflow size failed", K(ret), K(data_size));
+  } else if (FALSE_IT(compress_buf_len = data_size + max_overflow_size)) {
+  } else if (OB_ISNULL(compress_buf = static_cast<char *>(ob_malloc(compress_buf_len, "MutatorCompress")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    TRANS_LOG(WARN, "alloc compress buf failed", K(ret), K(compress_buf_len));
+  } else if (OB_FAIL(compressor->compress(buf_.get_data() + meta_size, data_size,
+                                          compress_buf, compress_buf_len, compressed_size))) {
+    TRANS_LOG(WARN, "compress mutator failed", K(ret), K(data_size), K(compress_buf_len));
+  } else if (compressed_size + COMPRESS_META_EXTRA_SIZE >= data_size) {
+    // not compressible, keep the original rows
+  } else {
+    // the meta grows by the compress info, and the compressed rows follow it
+    meta_.set_compress_info(compressor_type, data_size);
+    const int64_t compressed_meta_size = meta_.get_serialize_size();
+    MEMCPY(buf_.get_data() + compressed_meta_size, compress_buf, compressed_size);
+    buf_.get_position() = compressed_meta_size + compressed_size;
+    EVENT_ADD(TRANS_REDO_COMPRESS_ORIGINAL_SIZE, data_size);
+    EVENT_ADD(TRANS_REDO_COMPRESS_COMPRESSED_SIZE, compressed_size);
+  }
+  if (OB_NOT_NULL(compress_buf)) {
+    ob_free(compress_buf);
+    compress_buf = NULL;
+  }
+  return ret;
+}
+
+int ObMutatorWriter::serialize(const uint8_t row_flag,
+                               int64_t &res_len,
+                               const ObCompressorType compressor_type)
+{
+  int ret = OB_SUCCESS;
+  int64_t meta_size = 0;
   int64_t meta_pos = 0;
   if (OB_ISNULL(buf_.get_data())) {
     ret = OB_NOT_INIT;
@@ -1049,6 +1135,9 @@ int ObMutatorWriter::serialize(const uint8_t row_flag, int64_t &res_len)
     ret = OB_INVALID_ARGUMENT;
   } else if (OB_FAIL(meta_.set_flags(row_flag))) {
     TRANS_LOG(WARN, "set flags error", K(ret), K(row_flag));
+  } else if (OB_FAIL(compress_data_(compressor_type))) {
+    TRANS_LOG(WARN, "compress mutator rows failed", K(ret), K(compressor_type));
+  } else if (FALSE_IT(meta_size = meta_.get_serialize_size())) {
   } else if (OB_FAIL(meta_.fill_header(buf_.get_data() + meta_size,
                                        buf_.get_position() - meta_size))) {
   } else if (OB_FAIL(meta_.serialize(buf_.get_data(), meta_size, meta_pos))) {
@@ -1071,6 +1160,8 @@ int64_t ObMutatorWriter::get_serialize_size() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 ObMemtableMutatorIterator::ObMemtableMutatorIterator()
+  : decompress_buf_(NULL),
+    decompress_buf_len_(0)
 {
   // big_row_ = false;
   reset();
@@ -1079,6 +1170,11 @@ ObMemtableMutatorIterator::ObMemtableMutatorIterator()
 ObMemtableMutatorIterator::~ObMemtableMutatorIterator()
 {
   reset();
+  if (OB_NOT_NULL(decompress_buf_)) {
+    ob_free(decompress_buf_);
+    decompress_buf_ = NULL;
+    decompress_buf_len_ = 0;
+  }
 }
 
 // If leader switch happened before the last log entry of lob row is successfully written,
@@ -1107,6 +1203,12 @@ int ObMemtableMutatorIterator::deserialize(const char *buf, const int64_t data_l
   } else if (OB_FAIL(meta_.deserialize(buf, data_len, data_pos))) {
     TRANS_LOG(WARN, "decode meta fail", K(ret), KP(buf), K(data_len), K(data_pos));
     ret = (OB_SUCCESS == ret) ? OB_INVALID_DATA : ret;
+  } else if (meta_.is_compressed()) {
+    if (OB_FAIL(decompress_data_(buf + data_pos))) {
+      TRANS_LOG(WARN, "decompress mutator fail", K(ret), K(meta_));
+    } else {
+      pos += meta_.get_total_size();
+    }
   } else if (!buf_.set_data(const_cast<char *>(buf + pos), meta_.get_total_size())) {
     TRANS_LOG(WARN, "set_data fail", KP(buf), K(pos), K(meta_.get_total_size()));
   } else {
@@ -1120,6 +1222,36 @@ int ObMemtableMutatorIterator::deserialize(const char *buf, const int64_t data_l
   return ret;
 }
 
+int ObMemtableMutatorIterator::decompress_data_(const char *data)
+{
+  int ret = OB_SUCCESS;
+  const int64_t orig_data_size = meta_.get_uncompressed_data_size();
+  if (decompress_buf_len_ < orig_data_size) {
+    if (OB_NOT_NULL(decompress_buf_)) {
+      ob_free(decompress_buf_);
+      decompress_buf_ = NULL;
+      decompress_buf_len_ = 0;
+    }
+    if (OB_ISNULL(decompress_buf_ = static_cast<char *>(ob_malloc(orig_data_size, "MutatorDecomp")))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      TRANS_LOG(WARN, "alloc decompress buf failed", K(ret), K(orig_data_size));
+    } else {
+      decompress_buf_len_ = orig_data_size;
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(meta_.decompress_data(data, decompress_buf_, decompress_buf_len_))) {
+    TRANS_LOG(WARN, "decompress data failed", K(ret), K(meta_));
+  } else if (!buf_.set_data(decompress_buf_, orig_data_size)) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(WARN, "set_data fail", K(ret), KP(decompress_buf_), K(orig_data_size));
+  } else {
+    buf_.get_limit() = orig_data_size;
+    buf_.get_position() = 0;
+  }
+  return ret;
+}
+
 int ObMemtableMutatorIterator::iterate_next_row()
 {
   int ret = OB_SUCCESS;
@@ -14,6 +14,7 @@
 #define OCEANBASE_MEMTABLE_OB_MEMTABLE_MUTATOR_
 
 #include "share/ob_define.h"
+#include "lib/compress/ob_compress_util.h"
 
 #include "common/rowkey/ob_rowkey.h"
 #include "common/ob_tablet_id.h"
@@ -48,6 +49,7 @@ struct TableLockRedoDataNode;
 class ObMemtableMutatorMeta
 {
   static const uint64_t MMB_MAGIC = 0x6174756d; // #muta
+public:
   static const int64_t MIN_META_SIZE = 28; // sizeof(MutatorMetaV1)
 public:
   ObMemtableMutatorMeta();
@@ -65,6 +67,18 @@ public:
   int64_t get_total_size() const { return meta_size_ + data_size_; }
   int64_t get_meta_size() const { return meta_size_; }
   int64_t get_data_size() const { return data_size_; }
+  // the size of mutator rows before compression, equals to data size if not compressed
+  int64_t get_uncompressed_data_size() const { return is_compressed() ? orig_data_size_ : data_size_; }
+  bool is_compressed() const
+  {
+    return common::ObCompressorType::NONE_COMPRESSOR < compressor_type_
+        && common::ObCompressorType::MAX_COMPRESSOR > compressor_type_;
+  }
+  common::ObCompressorType get_compressor_type() const
+  { return static_cast<common::ObCompressorType>(compressor_type_); }
+  void set_compress_info(const common::ObCompressorType compressor_type, const int64_t orig_data_size);
+  // decompress the mutator rows which follows the meta into buf
+  int decompress_data(const char *data, char *buf, const int64_t buf_len) const;
   bool is_row_start() const;
 
 public:
@@ -86,6 +100,11 @@ private:
   uint32_t data_size_;
   uint32_t row_count_;
   uint32_t unused_;
+  // fields below are appended after MIN_META_SIZE and serialized only if the mutator is
+  // compressed, so the meta of uncompressed mutator keeps the format of old version
+  uint32_t orig_data_size_;
+  uint8_t compressor_type_;
+  uint8_t reserved_[3];
 
   DISALLOW_COPY_AND_ASSIGN(ObMemtableMutatorMeta);
 };
@@ -317,9 +336,19 @@ public:
       const bool is_big_row = false,
       const bool is_with_head = false);
   int append_row_buf(const char *buf, const int64_t buf_len);
-  int serialize(const uint8_t row_flag, int64_t &res_len);
+  // the mutator rows are compressed by compressor_type if they are large enough and compressible
+  int serialize(const uint8_t row_flag,
+                int64_t &res_len,
+                const common::ObCompressorType compressor_type = common::ObCompressorType::NONE_COMPRESSOR);
   ObMemtableMutatorMeta& get_meta() { return meta_; }
   int64_t get_serialize_size() const;
+public:
+  static const int64_t MIN_COMPRESS_DATA_SIZE = 4 * 1024; // 4KB
+private:
+  // the meta of compressed mutator carries the compress info
+  static const int64_t COMPRESS_META_EXTRA_SIZE = sizeof(ObMemtableMutatorMeta) - ObMemtableMutatorMeta::MIN_META_SIZE;
+private:
+  int compress_data_(const common::ObCompressorType compressor_type);
 private:
   ObMemtableMutatorMeta meta_;
   common::ObDataBuffer buf_;
@@ -348,10 +377,14 @@ public:
 
   TO_STRING_KV(K_(meta),K(buf_.get_position()),K(buf_.get_limit()));
 private:
+  int decompress_data_(const char *data);
 
 private:
   ObMemtableMutatorMeta meta_;
   common::ObDataBuffer buf_;
+  // holds the decompressed mutator rows, reused among deserialize
+  char *decompress_buf_;
+  int64_t decompress_buf_len_;
   ObMutatorRowHeader row_header_;
   ObMemtableMutatorRow row_;
   ObMutatorTableLock table_lock_;
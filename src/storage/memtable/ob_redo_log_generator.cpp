@@ -62,7 +62,8 @@ int ObRedoLogGenerator::fill_redo_log(char *buf,
                                       const int64_t buf_len,
                                       int64_t &buf_pos,
                                       ObRedoLogSubmitHelper &helper,
-                                      const bool log_for_lock_node)
+                                      const bool log_for_lock_node,
+                                      const ObCompressorType compressor_type)
 {
   int ret = OB_SUCCESS;
 
@@ -141,7 +142,7 @@ int ObRedoLogGenerator::fill_redo_log(char *buf,
 
       if (OB_LIKELY(OB_ERR_TOO_BIG_ROWSIZE != ret)) {
         int64_t res_len = 0;
-        if (OB_SUCCESS != (tmp_ret = mmw.serialize(ObTransRowFlag::NORMAL_ROW, res_len))) {
+        if (OB_SUCCESS != (tmp_ret = mmw.serialize(ObTransRowFlag::NORMAL_ROW, res_len, compressor_type))) {
           if (OB_ENTRY_NOT_EXIST != tmp_ret) {
             TRANS_LOG(ERROR, "mmw.serialize fail", K(ret), K(tmp_ret));
             ret = tmp_ret;
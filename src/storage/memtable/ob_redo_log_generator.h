@@ -71,7 +71,9 @@ public:
                     const int64_t buf_len,
                     int64_t &buf_pos,
                     ObRedoLogSubmitHelper &helper,
-                    const bool log_for_lock_node);
+                    const bool log_for_lock_node,
+                    const common::ObCompressorType compressor_type
+                      = common::ObCompressorType::NONE_COMPRESSOR);
   int search_unsubmitted_dup_tablet_redo();
   int log_submitted(const ObCallbackScope &callbacks);
   int sync_log_succ(const int64_t log_ts, const ObCallbackScope &callbacks);
@@ -272,7 +272,8 @@ int ObMemtableRowCompactor::init(ObMvccRow *row,
 // So modification is guaranteed to be safety with another modification,
 // while we need pay attention to the concurrency between lock_for_read
 // and modification(such as compact)
-int ObMemtableRowCompactor::compact(const int64_t snapshot_version)
+int ObMemtableRowCompactor::compact(const int64_t snapshot_version,
+                                    const bool for_read_amplification)
 {
   int ret = OB_SUCCESS;
 
@@ -296,6 +297,9 @@ int ObMemtableRowCompactor::compact(const int64_t snapshot_version)
 
     if (OB_NOT_NULL(compact_node)) {
       insert_compact_node_(compact_node, start);
+      if (for_read_amplification) {
+        memtable_->inc_read_amplification_compact_cnt();
+      }
     }
     tg.click();
   }
@@ -584,6 +588,7 @@ void ObMemtableRowCompactor::insert_compact_node_(ObMvccTransNode *tx_node,
   ATOMIC_STORE(&(row_->latest_compact_ts_), end_ts);
   ATOMIC_STORE(&(row_->last_compact_cnt_), tx_node->modify_count_);
   ATOMIC_STORE(&(row_->update_since_compact_), 0);
+  ATOMIC_STORE(&(row_->read_amplification_), 0);
 }
 
 }
@@ -116,8 +116,9 @@ public:
            ObMemtable *mt,
            common::ObIAllocator *node_alloc,
            const bool for_replay);
-  // compact and refresh the update counter by snapshot version
-  int compact(const int64_t snapshot_version);
+  // compact and refresh the update counter by snapshot version, for_read_amplification
+  // counts the compaction into the memtable stat if a compact node is inserted
+  int compact(const int64_t snapshot_version, const bool for_read_amplification = false);
 private:
   void find_start_pos_(const int64_t snapshot_version,
                        ObMvccTransNode *&save);
@@ -13,6 +13,9 @@
 #define USING_LOG_PREFIX STORAGE
 #include "blocksstable/ob_micro_block_info.h"
 #include "blocksstable/ob_storage_cache_suite.h"
+#include <sys/mman.h>
+#include "lib/signal/ob_signal_utils.h"
+#include "lib/stat/ob_diagnose_info.h"
 #include "ob_micro_block_handle_mgr.h"
 
 
@@ -34,6 +37,7 @@ ObMicroBlockDataHandle::ObMicroBlockDataHandle()
     encrypt_key_(),
     cache_handle_(),
     io_handle_(),
+    mmap_buf_(nullptr),
     allocator_(nullptr),
     loaded_index_block_data_(),
     is_loaded_index_block_(false)
@@ -55,6 +59,7 @@ void ObMicroBlockDataHandle::reset()
   micro_info_.reset();
   cache_handle_.reset();
   io_handle_.reset();
+  mmap_buf_ = nullptr;
   try_release_loaded_index_block();
   allocator_ = nullptr;
 }
@@ -64,7 +69,12 @@ int ObMicroBlockDataHandle::get_data_block_data(
     ObMicroBlockData &block_data)
 {
   int ret = OB_SUCCESS;
-  if (OB_FAIL(get_loaded_block_data(block_data))) {
+  if (ObSSTableMicroBlockState::IN_BLOCK_MMAP == block_state_) {
+    ret = get_mmap_block_data(block_reader, block_data);
+  } else {
+    ret = get_loaded_block_data(block_data);
+  }
+  if (OB_FAIL(ret)) {
     //try sync io
     ObMicroBlockId micro_block_id;
     micro_block_id.macro_id_ = macro_block_id_;
@@ -83,6 +93,36 @@ int ObMicroBlockDataHandle::get_data_block_data(
   return ret;
 }
 
+int ObMicroBlockDataHandle::mmap_block_data(
+    const uint64_t tenant_id,
+    const MacroBlockId &macro_id)
+{
+  int ret = OB_SUCCESS;
+  const char *mmap_buf = nullptr;
+  const int64_t offset = micro_info_.offset_;
+  const int64_t size = micro_info_.size_;
+  if (OB_UNLIKELY(ObSSTableMicroBlockState::UNKNOWN_STATE != block_state_
+      || io_handle_.get_macro_id().is_valid())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected micro block handle to mmap", K(ret), K(macro_id), KPC(this));
+  } else if (OB_FAIL(io_handle_.set_macro_block_id(macro_id))) {
+    LOG_WARN("Fail to reference macro block", K(ret), K(macro_id));
+  } else if (OB_FAIL(ObBlockManager::mmap_read_block(macro_id, offset, size, mmap_buf))) {
+    if (OB_NOT_SUPPORTED != ret) {
+      LOG_WARN("Fail to mmap micro block", K(ret), K(macro_id), K_(micro_info));
+    }
+    io_handle_.reset();
+  } else {
+    // page in ahead of decoding, the micro block is decoded from page cache directly
+    (void)ObBlockManager::advise_block(macro_id, offset, size, MADV_WILLNEED);
+    tenant_id_ = tenant_id;
+    macro_block_id_ = macro_id;
+    block_state_ = ObSSTableMicroBlockState::IN_BLOCK_MMAP;
+    mmap_buf_ = mmap_buf;
+  }
+  return ret;
+}
+
 int ObMicroBlockDataHandle::get_index_block_data(
     const ObTableReadInfo &read_info,
     ObMicroBlockData &index_block)
@@ -159,6 +199,44 @@ int ObMicroBlockDataHandle::get_loaded_block_data(ObMicroBlockData &block_data)
   return ret;
 }
 
+int ObMicroBlockDataHandle::get_mmap_block_data(
+    ObMacroBlockReader &block_reader,
+    ObMicroBlockData &block_data)
+{
+  int ret = OB_SUCCESS;
+  const char *payload_buf = nullptr;
+  int64_t payload_size = 0;
+  bool is_compressed = false;
+  const bool need_deep_copy = false;
+  bool has_crash = false;
+  if (OB_ISNULL(mmap_buf_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null mmap buf", K(ret), K_(macro_block_id), K_(micro_info));
+  } else {
+    // the payload checksum reads every page of the micro block, so a media error raises SIGBUS
+    // here instead of in the decoder, and is turned into an io error
+    do_with_crash_restore([&]() {
+      ret = ObMicroBlockHeader::deserialize_and_check_record(
+          mmap_buf_, micro_info_.size_, MICRO_BLOCK_HEADER_MAGIC, payload_buf, payload_size);
+    }, has_crash);
+    if (OB_UNLIKELY(has_crash)) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("Fail to read mapped micro block, media error", K(ret), K_(macro_block_id), K_(micro_info));
+    } else if (OB_FAIL(ret)) {
+      LOG_ERROR("Micro block data is corrupted", K(ret), K_(macro_block_id), K_(micro_info));
+    } else if (OB_FAIL(block_reader.decrypt_and_decompress_data(
+        des_meta_, mmap_buf_, micro_info_.size_, block_data.get_buf(),
+        block_data.get_buf_size(), is_compressed, need_deep_copy))) {
+      LOG_WARN("Fail to decrypt and decompress micro block data buf", K(ret), K_(micro_info));
+    } else {
+      block_data.type_ = ObMicroBlockData::DATA_BLOCK;
+      EVENT_INC(ObStatEventIds::IO_READ_MMAP_MICRO_COUNT);
+      EVENT_ADD(ObStatEventIds::IO_READ_MMAP_MICRO_BYTES, micro_info_.size_);
+    }
+  }
+  return ret;
+}
+
 void ObMicroBlockDataHandle::try_release_loaded_index_block()
 {
   if (is_loaded_index_block_ && nullptr != allocator_ && loaded_index_block_data_.is_valid()) {
@@ -28,7 +28,8 @@ struct ObSSTableMicroBlockState {
   enum ObSSTableMicroBlockStateEnum {
     UNKNOWN_STATE = 0,
     IN_BLOCK_CACHE,
-    IN_BLOCK_IO
+    IN_BLOCK_IO,
+    IN_BLOCK_MMAP
   };
 };
 
@@ -44,8 +45,12 @@ struct ObMicroBlockDataHandle {
   int get_index_block_data(
       const ObTableReadInfo &read_info,
       blocksstable::ObMicroBlockData &index_block);
+  // map the micro block of micro_info_ instead of reading it by io, the macro block is referenced
+  // by io_handle_ until reset, so that it can not be freed and reused while the mapping is read.
+  // @retval OB_NOT_SUPPORTED    the block is not mapped, read it by io instead
+  int mmap_block_data(const uint64_t tenant_id, const blocksstable::MacroBlockId &macro_id);
   TO_STRING_KV(K_(tenant_id), K_(macro_block_id), K_(micro_info),
-               K_(block_state), K_(block_index), K_(cache_handle), K_(io_handle));
+               K_(block_state), K_(block_index), K_(cache_handle), K_(io_handle), KP_(mmap_buf));
   uint64_t tenant_id_;
   blocksstable::MacroBlockId macro_block_id_;
   int32_t block_state_;
@@ -54,13 +59,21 @@ struct ObMicroBlockDataHandle {
   blocksstable::ObMicroBlockDesMeta des_meta_;
   char encrypt_key_[share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH];
   blocksstable::ObMicroBlockBufferHandle cache_handle_;
+  // io handle of IN_BLOCK_IO, or the macro block reference of IN_BLOCK_MMAP
   blocksstable::ObMacroBlockHandle io_handle_;
+  // micro block in the read only mapping of data file, for IN_BLOCK_MMAP
+  const char *mmap_buf_;
   ObIAllocator *allocator_;
   blocksstable::ObMicroBlockData loaded_index_block_data_;
   bool is_loaded_index_block_;
 
 private:
   int get_loaded_block_data(blocksstable::ObMicroBlockData &block_data);
+  // uncompressed and unencrypted micro block is decoded in place of the mapped page cache,
+  // media error met by the record check returns OB_IO_ERROR
+  int get_mmap_block_data(
+      blocksstable::ObMacroBlockReader &block_reader,
+      blocksstable::ObMicroBlockData &block_data);
   void try_release_loaded_index_block();
 };
 
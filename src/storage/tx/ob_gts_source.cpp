@@ -41,6 +41,7 @@ void ObGtsStatistics::reset()
   try_get_gts_with_stc_cnt_ = 0;
   wait_gts_elapse_cnt_ = 0;
   try_wait_gts_elapse_cnt_ = 0;
+  gts_rpc_pipelined_cnt_ = 0;
 }
 
 int ObGtsStatistics::init(const uint64_t tenant_id)
@@ -67,7 +68,8 @@ void ObGtsStatistics::statistics()
                       "try_get_gts_cache_cnt", ATOMIC_LOAD(&try_get_gts_cache_cnt_),
                       "try_get_gts_with_stc_cnt", ATOMIC_LOAD(&try_get_gts_with_stc_cnt_),
                       "wait_gts_elapse_cnt", ATOMIC_LOAD(&wait_gts_elapse_cnt_),
-                      "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_));
+                      "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_),
+                      "gts_rpc_pipelined_cnt", ATOMIC_LOAD(&gts_rpc_pipelined_cnt_));
       ATOMIC_STORE(&gts_rpc_cnt_, 0);
       ATOMIC_STORE(&get_gts_cache_cnt_, 0);
       ATOMIC_STORE(&get_gts_with_stc_cnt_, 0);
@@ -75,6 +77,7 @@ void ObGtsStatistics::statistics()
       ATOMIC_STORE(&try_get_gts_with_stc_cnt_, 0);
       ATOMIC_STORE(&wait_gts_elapse_cnt_, 0);
       ATOMIC_STORE(&try_wait_gts_elapse_cnt_, 0);
+      ATOMIC_STORE(&gts_rpc_pipelined_cnt_, 0);
     }
   }
 
@@ -93,6 +96,7 @@ void ObGtsSource::reset()
     queue_[i].reset();
   }
   gts_cache_leader_.reset();
+  has_pending_query_ = false;
 }
 
 
@@ -245,7 +249,7 @@ int ObGtsSource::get_gts(const MonotonicTs stc,
     } else {
       // If not in local, refresh gts
       if (need_send_rpc) {
-        if (OB_SUCCESS != (tmp_ret = query_gts_(leader))) {
+        if (OB_SUCCESS != (tmp_ret = query_gts_or_pipeline_(leader))) {
           TRANS_LOG(WARN, "query gts fail", K(tmp_ret), K(leader));
         }
       }
@@ -612,6 +616,49 @@ int ObGtsSource::query_gts_(const ObAddr &leader)
   return ret;
 }
 
+int ObGtsSource::query_gts_or_pipeline_(const ObAddr &leader)
+{
+  int ret = OB_SUCCESS;
+  const int64_t now = MonotonicTs::current_time().mts_;
+  const int64_t srr = gts_local_cache_.get_srr().mts_;
+  const int64_t latest_srr = gts_local_cache_.get_latest_srr().mts_;
+  if (latest_srr > srr && now - latest_srr < GTS_RPC_PIPELINE_WINDOW_US) {
+    // a gts rpc is in flight, wait for its response and send the next one then
+    ATOMIC_STORE(&has_pending_query_, true);
+    gts_statistics_.inc_gts_rpc_pipelined_cnt();
+    ObTransStatistic::get_instance().add_gts_rpc_pipelined_count(tenant_id_, 1);
+    // the response may have arrived before the flag was set
+    if (gts_local_cache_.get_srr().mts_ >= latest_srr) {
+      ret = query_pending_gts_();
+    }
+  } else {
+    ret = query_gts_(leader);
+  }
+  return ret;
+}
+
+int ObGtsSource::query_pending_gts_()
+{
+  int ret = OB_SUCCESS;
+  ObAddr leader;
+  if (!ATOMIC_BCAS(&has_pending_query_, true, false)) {
+    // the pending requests have been served by other threads
+  } else {
+    if (OB_FAIL(get_gts_leader_(leader))) {
+      TRANS_LOG(WARN, "get gts leader failed", KR(ret), K_(tenant_id));
+      (void)refresh_gts_location_();
+    } else if (OB_FAIL(query_gts_(leader))) {
+      TRANS_LOG(WARN, "query pending gts failed", KR(ret), K(leader));
+    }
+    if (OB_FAIL(ret)) {
+      // no rpc is sent for the pending requests, keep them pending so that they are
+      // served by the next gts response or by the refresh rpc of ObTsMgr
+      ATOMIC_STORE(&has_pending_query_, true);
+    }
+  }
+  return ret;
+}
+
 int ObGtsSource::refresh_gts_location_()
 {
   int ret = OB_SUCCESS;
@@ -638,8 +685,9 @@ int ObGtsSource::refresh_gts_(const bool need_refresh)
       TRANS_LOG(WARN, "get gts leader failed", KR(ret), K_(tenant_id));
     }
     need_refresh_gts_location = true;
-  } else {
-    ret = query_gts_(leader);
+  } else if (OB_SUCC(query_gts_(leader))) {
+    // the pending requests arrived before this rpc, so they are served by its response
+    ATOMIC_STORE(&has_pending_query_, false);
   }
   if (need_refresh_gts_location) {
     (void)refresh_gts_location_();
@@ -671,6 +719,10 @@ int ObGtsSource::update_gts(const MonotonicTs srr,
               K(receive_gts_ts), K(update));
   } else {
     TRANS_LOG(DEBUG, "gts local cache update success", K(srr), K(gts));
+    // the requests that arrived while the rpc was in flight share the next rpc
+    if (ATOMIC_LOAD(&has_pending_query_)) {
+      (void)query_pending_gts_();
+    }
   }
 
   return ret;
@@ -51,6 +51,7 @@ public:
   void inc_try_get_gts_with_stc_cnt() { ATOMIC_INC(&try_get_gts_with_stc_cnt_); }
   void inc_wait_gts_elapse_cnt() { ATOMIC_INC(&wait_gts_elapse_cnt_); }
   void inc_try_wait_gts_elapse_cnt() { ATOMIC_INC(&try_wait_gts_elapse_cnt_); }
+  void inc_gts_rpc_pipelined_cnt() { ATOMIC_INC(&gts_rpc_pipelined_cnt_); }
   void statistics();
 private:
   uint64_t tenant_id_;
@@ -64,6 +65,8 @@ private:
 
   int64_t wait_gts_elapse_cnt_;
   int64_t try_wait_gts_elapse_cnt_;
+
+  int64_t gts_rpc_pipelined_cnt_;
 };
 
 class ObGtsSource : public ObITsSource
@@ -100,6 +103,8 @@ private:
   int refresh_gts_location_();
   int refresh_gts_(const bool need_refresh);
   int query_gts_(const common::ObAddr &leader);
+  int query_gts_or_pipeline_(const common::ObAddr &leader);
+  int query_pending_gts_();
   void statistics_();
   int get_gts_from_local_timestamp_service_(common::ObAddr &leader,
                                             int64_t &gts,
@@ -111,6 +116,11 @@ public:
   static const int64_t WAIT_GTS_QUEUE_COUNT = 1;
   static const int64_t WAIT_GTS_QUEUE_START_INDEX = GET_GTS_QUEUE_COUNT;
   static const int64_t TOTAL_GTS_QUEUE_COUNT = GET_GTS_QUEUE_COUNT + WAIT_GTS_QUEUE_COUNT;
+  // A gts request arriving while a gts rpc younger than this window is still in
+  // flight does not send its own rpc. It is served by the rpc which is sent as
+  // soon as the in-flight one returns, so at most one rpc is outstanding in a
+  // burst. An rpc older than the window is regarded as lost.
+  static const int64_t GTS_RPC_PIPELINE_WINDOW_US = 10 * 1000;
 private:
   bool is_inited_;
   int64_t tenant_id_;
@@ -124,6 +134,8 @@ private:
   common::ObTimeInterval log_interval_;
   common::ObAddr gts_cache_leader_;
   common::ObTimeInterval refresh_location_interval_;
+  // some gts requests are waiting for the response of the next gts rpc
+  bool has_pending_query_;
 };
 
 } // transaction
@@ -66,6 +66,10 @@ int ObGTSTaskQueue::foreach_task(const MonotonicTs srr,
     TRANS_LOG(WARN, "invalid argument", KR(ret), K(srr), K(gts));
   } else {
     int64_t last_tenant_id = OB_INVALID_TENANT_ID;
+    // all the tasks woken up by one gts response are accounted in one batch,
+    // the statistics is flushed when the tenant changes or the batch ends
+    int64_t batch_wait_time = 0;
+    int64_t batch_task_cnt = 0;
     MAKE_TENANT_SWITCH_SCOPE_GUARD(ts_guard);
     while (OB_SUCCESS == ret) {
       common::ObLink *data = NULL;
@@ -75,8 +79,9 @@ int ObGTSTaskQueue::foreach_task(const MonotonicTs srr,
         break;
       } else {
         const uint64_t tenant_id = task->get_tenant_id();
-        const int64_t request_ts = 0/*task->get_request_ts()*/;
+        const int64_t request_ts = task->get_request_ts();
         if (tenant_id != last_tenant_id) {
+          flush_statistics_(last_tenant_id, batch_wait_time, batch_task_cnt);
           if (OB_FAIL(ts_guard.switch_to(tenant_id))) {
             TRANS_LOG(ERROR, "switch tenant failed", K(ret), K(tenant_id));
           } else {
@@ -113,26 +118,39 @@ int ObGTSTaskQueue::foreach_task(const MonotonicTs srr,
               TRANS_LOG(DEBUG, "push back gts task", KP(task));
               break;
             }
-          } else {
-            if (GET_GTS == task_type_) {
-              const int64_t total_used = ObTimeUtility::current_time() - request_ts;
-              ObTransStatistic::get_instance().add_gts_acquire_total_time(tenant_id, total_used);
-              ObTransStatistic::get_instance().add_gts_acquire_total_wait_count(tenant_id, 1);
-            } else if (WAIT_GTS_ELAPSING == task_type_) {
-              const int64_t total_used = ObTimeUtility::current_time() - request_ts;
-              ObTransStatistic::get_instance().add_gts_wait_elapse_total_time(tenant_id, total_used);
-              ObTransStatistic::get_instance().add_gts_wait_elapse_total_wait_count(tenant_id, 1);
-            } else {
-              // do nothing
-            }
+          } else if (request_ts > 0) {
+            // the task may be released by the callback, so only the request ts
+            // read before the callback can be used here
+            batch_wait_time += ObTimeUtility::current_time() - request_ts;
+            batch_task_cnt++;
           }
         }
       }
     }
+    flush_statistics_(last_tenant_id, batch_wait_time, batch_task_cnt);
   }
   return ret;
 }
 
+void ObGTSTaskQueue::flush_statistics_(const uint64_t tenant_id,
+                                       int64_t &total_wait_time,
+                                       int64_t &task_cnt)
+{
+  if (task_cnt > 0 && is_valid_tenant_id(tenant_id)) {
+    if (GET_GTS == task_type_) {
+      ObTransStatistic::get_instance().add_gts_acquire_total_time(tenant_id, total_wait_time);
+      ObTransStatistic::get_instance().add_gts_acquire_total_wait_count(tenant_id, task_cnt);
+    } else if (WAIT_GTS_ELAPSING == task_type_) {
+      ObTransStatistic::get_instance().add_gts_wait_elapse_total_time(tenant_id, total_wait_time);
+      ObTransStatistic::get_instance().add_gts_wait_elapse_total_wait_count(tenant_id, task_cnt);
+    } else {
+      // do nothing
+    }
+  }
+  total_wait_time = 0;
+  task_cnt = 0;
+}
+
 int ObGTSTaskQueue::push(ObTsCbTask *task)
 {
   int ret = OB_SUCCESS;
@@ -142,6 +160,7 @@ int ObGTSTaskQueue::push(ObTsCbTask *task)
   } else if (NULL == task) {
     ret = OB_INVALID_ARGUMENT;
     TRANS_LOG(WARN, "invalid argument", KR(ret), KP(task));
+  } else if (FALSE_IT(task->set_request_ts(ObTimeUtility::current_time()))) {
   } else if (OB_FAIL(queue_.push(task))) {
     TRANS_LOG(ERROR, "push gts task failed", K(ret), KP(task));
   } else {
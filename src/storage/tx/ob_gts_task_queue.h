@@ -39,6 +39,8 @@ public:
   int push(ObTsCbTask *task);
   int64_t get_task_count() const { return queue_.size(); }
   int gts_callback_interrupted(const int errcode);
+private:
+  void flush_statistics_(const uint64_t tenant_id, int64_t &total_wait_time, int64_t &task_cnt);
 private:
   static const int64_t TOTAL_WAIT_TASK_NUM = 500 * 1000;
 private:
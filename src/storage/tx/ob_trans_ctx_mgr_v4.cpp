@@ -215,7 +215,7 @@ void ObLSTxCtxMgr::reset()
   ls_id_.reset();
   tx_table_ = NULL;
   lock_table_ = NULL;
-  total_tx_ctx_count_ = 0;
+  total_tx_ctx_count_.reset();
   leader_takeover_ts_.reset();
   max_replay_commit_version_ = 0;
   aggre_rec_log_ts_ = OB_INVALID_TIMESTAMP;
@@ -407,7 +407,7 @@ int ObLSTxCtxMgr::create_tx_ctx_(const ObTxCreateArg &arg,
                           arg.can_elr_,
                           this,
                           arg.for_replay_))) {
-    } else if (FALSE_IT(inc_total_tx_ctx_count())) {
+    } else if (FALSE_IT(inc_total_tx_ctx_count(arg.tx_id_))) {
     } else if (FALSE_IT(tmp_ctx->get_ctx_guard(ctx_lock_guard))) {
     } else if (OB_FAIL(ls_tx_ctx_map_.insert_and_get(arg.tx_id_, tmp_ctx, &exist_ctx))) {
       if (OB_ENTRY_EXIST == ret) {
@@ -972,7 +972,7 @@ int ObLSTxCtxMgr::get_ls_min_uncommit_tx_prepare_version(int64_t &min_prepare_ve
 {
   int ret = OB_SUCCESS;
 
-  if (ATOMIC_LOAD(&total_tx_ctx_count_) > 0 || ls_tx_ctx_map_.count() > 0) {
+  if (get_tx_ctx_count_() > 0 || ls_tx_ctx_map_.count() > 0) {
     IterateMinPrepareVersionFunctor fn;
     if (OB_FAIL(ls_tx_ctx_map_.for_each(fn))) {
       TRANS_LOG(WARN, "for each transaction context error", KR(ret), "manager", *this);
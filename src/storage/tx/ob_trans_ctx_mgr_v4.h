@@ -321,10 +321,10 @@ public:
 
 public:
   // Increase this ObLSTxCtxMgr's total_tx_ctx_count
-  void inc_total_tx_ctx_count() { (void)ATOMIC_AAF(&total_tx_ctx_count_, 1); }
+  void inc_total_tx_ctx_count(const ObTransID &tx_id) { total_tx_ctx_count_.inc(tx_id.hash()); }
 
   // Decrease this ObLSTxCtxMgr's total_tx_ctx_count
-  void dec_total_tx_ctx_count() { (void)ATOMIC_AAF(&total_tx_ctx_count_, -1); }
+  void dec_total_tx_ctx_count(const ObTransID &tx_id) { total_tx_ctx_count_.dec(tx_id.hash()); }
 
   // Get all tx obj lock information in this ObLSTxCtxMgr
   // @param [out] iter: all tx obj lock op information
@@ -496,11 +496,13 @@ private:
   static const int64_t OB_PARTITION_AUDIT_LOCAL_STORAGE_COUNT = 4;
   static const int64_t TRY_THRESOLD_US = 1 * 1000 *1000;
   static const int64_t RETRY_INTERVAL_US = 10 *1000;
+  // slots of total_tx_ctx_count_, see ObTransShardedCounter
+  static const int64_t TX_CTX_CNT_SHARD_NUM = 32;
 
 private:
   int process_callback_(ObIArray<ObTxCommitCallback> &cb_array) const;
   void print_all_tx_ctx_(const int64_t max_print, const bool verbose);
-  int64_t get_tx_ctx_count_() const { return ATOMIC_LOAD(&total_tx_ctx_count_); }
+  int64_t get_tx_ctx_count_() const { return total_tx_ctx_count_.value(); }
   int create_tx_ctx_(const ObTxCreateArg &arg,
                      bool &existed,
                      ObPartTransCtx *&ctx);
@@ -686,8 +688,8 @@ private:
   //                     rwlock_ -> minor_merge_lock_
   mutable RWLock minor_merge_lock_;
 
-  // Total TxCtx count in this ObLSTxCtxMgr
-  int64_t total_tx_ctx_count_;
+  // Total TxCtx count in this ObLSTxCtxMgr, sharded by tx id
+  ObTransShardedCounter<TX_CTX_CNT_SHARD_NUM> total_tx_ctx_count_;
 
   // It is used to record the time point of leader takeover
   // gts must be refreshed to the newest before the leader provides services
@@ -471,6 +471,11 @@ void ObTransStatistic::add_gts_rpc_count(const uint64_t tenant_id, const int64_t
   common::ObTenantStatEstGuard guard(tenant_id);
   EVENT_ADD(GTS_RPC_COUNT, value);
 }
+void ObTransStatistic::add_gts_rpc_pipelined_count(const uint64_t tenant_id, const int64_t value)
+{
+  common::ObTenantStatEstGuard guard(tenant_id);
+  EVENT_ADD(GTS_RPC_PIPELINED_COUNT, value);
+}
 
 void ObTransStatistic::add_gts_try_acquire_total_count(const uint64_t tenant_id, const int64_t value)
 {
@@ -188,6 +188,8 @@ public:
   void add_gts_wait_elapse_total_wait_count(const uint64_t tenant_id, const int64_t value);
   // Count the number of rpc requests initiated by the gts client
   void add_gts_rpc_count(const uint64_t tenant_id, const int64_t value);
+  // Count the number of gts requests which share the next rpc instead of sending their own
+  void add_gts_rpc_pipelined_count(const uint64_t tenant_id, const int64_t value);
   // Count the total number of obtaining gts synchronously
   void add_gts_try_acquire_total_count(const uint64_t tenant_id, const int64_t value);
   // count the total number of synchronously waitting gts
@@ -484,7 +484,7 @@ public:
                                         ls_tx_ctx_mgr->is_stopped_(mgr_state),
                                         mgr_state,
                                         ObLSTxCtxMgr::State::state_str(mgr_state),
-                                        ls_tx_ctx_mgr->total_tx_ctx_count_,
+                                        ls_tx_ctx_mgr->get_tx_ctx_count_(),
                                         (int64_t)(&(*ls_tx_ctx_mgr)));
       if (OB_SUCCESS != tmp_ret) {
         TRANS_LOG(WARN, "ObLSTxCtxMgrStat init error", K_(addr), "ls_tx_ctx_mgr", *ls_tx_ctx_mgr);
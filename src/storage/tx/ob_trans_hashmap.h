@@ -100,17 +100,63 @@ public:
   Value *next_;
 };
 
+// A counter split into cache line aligned slots. The updater chooses the slot by the hash of
+// its key, so that the transactions started and ended concurrently do not bounce the same cache
+// line. Reading the value sums all slots and is only exact when no concurrent update exists.
+template<int64_t SLOT_CNT>
+class ObTransShardedCounter
+{
+public:
+  ObTransShardedCounter() { reset(); }
+  ~ObTransShardedCounter() {}
+  void reset()
+  {
+    for (int64_t i = 0; i < SLOT_CNT; ++i) {
+      ATOMIC_STORE(&slots_[i].cnt_, 0);
+    }
+  }
+  void inc(const uint64_t hash) { (void)ATOMIC_AAF(&slots_[hash % SLOT_CNT].cnt_, 1); }
+  void dec(const uint64_t hash) { (void)ATOMIC_AAF(&slots_[hash % SLOT_CNT].cnt_, -1); }
+  int64_t value() const
+  {
+    int64_t cnt = 0;
+    for (int64_t i = 0; i < SLOT_CNT; ++i) {
+      cnt += ATOMIC_LOAD(&slots_[i].cnt_);
+    }
+    return cnt;
+  }
+  int64_t slot_value(const int64_t slot_idx) const
+  {
+    return (slot_idx < 0 || slot_idx >= SLOT_CNT) ? 0 : ATOMIC_LOAD(&slots_[slot_idx].cnt_);
+  }
+  static int64_t get_slot_cnt() { return SLOT_CNT; }
+  int64_t to_string(char *buf, const int64_t buf_len) const
+  {
+    int64_t pos = 0;
+    common::databuff_printf(buf, buf_len, pos, "%ld", value());
+    return pos;
+  }
+private:
+  struct Slot
+  {
+    int64_t cnt_ CACHE_ALIGNED;
+  };
+  Slot slots_[SLOT_CNT];
+};
+
 template<typename Key, typename Value, typename AllocHandle, typename LockType, int64_t BUCKETS_CNT = 64>
 class ObTransHashMap
 {
  typedef common::ObSEArray<Value *, 32> ValueArray;
 public:
-  ObTransHashMap() : is_inited_(false), total_cnt_(0)
+  ObTransHashMap() : is_inited_(false), total_cnt_()
   {
     OB_ASSERT(BUCKETS_CNT > 0);
   }
   ~ObTransHashMap() { destroy(); }
-  int64_t count() const { return ATOMIC_LOAD(&total_cnt_); }
+  int64_t count() const { return total_cnt_.value(); }
+  // the value count of the buckets belonging to the shard, see CNT_SHARD_NUM
+  int64_t shard_count(const int64_t shard_idx) const { return total_cnt_.slot_value(shard_idx); }
   int64_t alloc_cnt() const { return alloc_handle_.get_alloc_cnt(); }
   void reset()
   {
@@ -134,7 +180,7 @@ public:
         // reset bucket
         buckets_[i].reset();
       }
-      total_cnt_ = 0;
+      total_cnt_.reset();
       is_inited_ = false;
     }
   }
@@ -200,7 +246,7 @@ public:
         value->next_ = buckets_[pos].next_;
         value->prev_ = NULL;
         buckets_[pos].next_ = value;
-        ATOMIC_INC(&total_cnt_);
+        total_cnt_.inc(pos);
       } else {
         ret = OB_ENTRY_EXIST;
         if (old_value) {
@@ -253,7 +299,7 @@ public:
     }
     curr->prev_ = NULL;
     curr->next_ = NULL;
-    ATOMIC_DEC(&total_cnt_);
+    total_cnt_.dec(pos);
   }
 
   int get(const Key &key, Value *&value)
@@ -407,12 +453,16 @@ public:
   }
 
   int64_t get_total_cnt() {
-    return ATOMIC_LOAD(&total_cnt_);
+    return total_cnt_.value();
   }
 
   static int64_t get_buckets_cnt() {
     return BUCKETS_CNT;
   }
+public:
+  // the value count is sharded by bucket, so that inserting and deleting values of different
+  // buckets do not contend on one counter
+  static const int64_t CNT_SHARD_NUM = 32;
 private:
   struct ObTransHashHeader
   {
@@ -524,7 +574,7 @@ private:
   // sizeof(QsyncLock) = 4K;
   bool is_inited_;
   ObTransHashHeader buckets_[BUCKETS_CNT];
-  int64_t total_cnt_;
+  ObTransShardedCounter<CNT_SHARD_NUM> total_cnt_;
   AllocHandle alloc_handle_;
 };
 
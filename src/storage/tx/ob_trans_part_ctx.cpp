@@ -207,7 +207,7 @@ void ObPartTransCtx::destroy()
       TRANS_LOG(ERROR, "ls_tx_ctx_mgr_ is null, unexpected error", KP(ls_tx_ctx_mgr_), "context",
                 *this);
     } else {
-      ls_tx_ctx_mgr_->dec_total_tx_ctx_count();
+      ls_tx_ctx_mgr_->dec_total_tx_ctx_count(trans_id_);
     }
     // Defensive Check 3 : missing to callback scheduler
     if (!is_follower_() && need_callback_scheduler_()) {
@@ -2220,12 +2220,14 @@ int ObPartTransCtx::fill_redo_log_(char *buf,
   int ret = OB_SUCCESS;
   const bool log_for_lock_node = true;
       // !(is_local_tx_() && (part_trans_action_ == ObPartTransAction::COMMIT));
+  const ObCompressorType compressor_type =
+    trans_service_->get_tx_log_compress_util().get_redo_compressor_type();
 
   if (OB_UNLIKELY(NULL == buf || buf_len < 0 || pos < 0 || buf_len < pos)) {
     ret = OB_INVALID_ARGUMENT;
     TRANS_LOG(WARN, "invalid argument", KR(ret), KP(buf), K(buf_len), K(pos), K(*this));
   } else if (OB_SUCCESS
-             != (ret = mt_ctx_.fill_redo_log(buf, buf_len, pos, helper, log_for_lock_node))) {
+             != (ret = mt_ctx_.fill_redo_log(buf, buf_len, pos, helper, log_for_lock_node, compressor_type))) {
     if (OB_EAGAIN != ret && OB_ENTRY_NOT_EXIST != ret) {
       TRANS_LOG(WARN, "fill redo log failed", KR(ret), K(*this));
     }
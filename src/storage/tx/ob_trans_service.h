@@ -40,6 +40,7 @@
 #include "observer/ob_server_struct.h"
 #include "common/storage/ob_sequence.h"
 #include "ob_tx_elr_util.h"
+#include "ob_tx_log_compress_util.h"
 
 namespace oceanbase
 {
@@ -198,6 +199,7 @@ public:
                        const char *buf,
                        const int64_t buf_len);
   ObTxELRUtil &get_tx_elr_util() { return elr_util_; }
+  ObTxLogCompressUtil &get_tx_log_compress_util() { return log_compress_util_; }
 #ifdef ENABLE_DEBUG_LOG
   transaction::ObDefensiveCheckMgr *get_defensive_check_mgr() { return defensive_check_mgr_; }
 #endif
@@ -277,6 +279,7 @@ private:
 
   obrpc::ObSrvRpcProxy *rpc_proxy_;
   ObTxELRUtil elr_util_;
+  ObTxLogCompressUtil log_compress_util_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObTransService);
 };
@@ -63,7 +63,7 @@ class ObIGlobalTimestampService;
 class ObTsCbTask : public common::ObLink
 {
 public:
-  ObTsCbTask() {}
+  ObTsCbTask() : request_ts_(0) {}
   virtual ~ObTsCbTask() {}
   virtual int gts_callback_interrupted(const int errcode) = 0;
   virtual int get_gts_callback(const MonotonicTs srr, const int64_t ts, const MonotonicTs receive_gts_ts) = 0;
@@ -71,7 +71,13 @@ public:
   virtual MonotonicTs get_stc() const = 0;
   virtual uint64_t hash() const = 0;
   virtual uint64_t get_tenant_id() const = 0;
+  // the time when the task was pushed into the gts task queue, used to
+  // account the gts wait time of each callback
+  void set_request_ts(const int64_t request_ts) { request_ts_ = request_ts; }
+  int64_t get_request_ts() const { return request_ts_; }
   VIRTUAL_TO_STRING_KV("", "");
+private:
+  int64_t request_ts_;
 };
 
 class ObITsMgr
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_tx_log_compress_util.h"
+#include "common/ob_clock_generator.h"
+#include "lib/compress/ob_compressor_pool.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
+#include "share/rc/ob_tenant_base.h"
+#include "share/ob_cluster_version.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace transaction
+{
+
+ObCompressorType ObTxLogCompressUtil::get_redo_compressor_type()
+{
+  refresh_compress_tenant_config_();
+  return ATOMIC_LOAD(&compressor_type_);
+}
+
+void ObTxLogCompressUtil::refresh_compress_tenant_config_()
+{
+  const int64_t last_refresh_ts = ATOMIC_LOAD(&last_refresh_ts_);
+  const int64_t now = ObClockGenerator::getClock();
+  bool need_refresh = now - last_refresh_ts > REFRESH_INTERVAL;
+
+  if (OB_UNLIKELY(need_refresh) && ATOMIC_BCAS(&last_refresh_ts_, last_refresh_ts, now)) {
+    int ret = OB_SUCCESS;
+    uint64_t data_version = 0;
+    ObCompressorType compressor_type = ObCompressorType::NONE_COMPRESSOR;
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    if (OB_UNLIKELY(!tenant_config.is_valid()) || !tenant_config->_enable_redo_log_compress) {
+      // compression is disabled
+    } else if (OB_FAIL(GET_MIN_DATA_VERSION(MTL_ID(), data_version))) {
+      TRANS_LOG(WARN, "get data version failed", K(ret), "tenant_id", MTL_ID());
+    } else if (data_version < DATA_VERSION_4_1_0_0) {
+      // replicas of old version can not parse compressed mutators
+    } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor_type(
+            tenant_config->_redo_log_compress_func, compressor_type))) {
+      TRANS_LOG(WARN, "get compressor type failed", K(ret), "tenant_id", MTL_ID());
+      compressor_type = ObCompressorType::NONE_COMPRESSOR;
+    }
+    ATOMIC_STORE(&compressor_type_, compressor_type);
+    if (REACH_TIME_INTERVAL(10000000 /* 10s */)) {
+      TRANS_LOG(INFO, "refresh tenant config success", "tenant_id", MTL_ID(), K(*this));
+    }
+  }
+}
+
+} //transaction
+
+} //oceanbase
@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_TX_LOG_COMPRESS_UTIL_
+#define OCEANBASE_TX_LOG_COMPRESS_UTIL_
+
+#include "lib/compress/ob_compress_util.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+
+namespace transaction
+{
+
+// Cache the tenant config of redo compression, which is read by every redo log filling
+class ObTxLogCompressUtil
+{
+public:
+  ObTxLogCompressUtil() : last_refresh_ts_(0),
+                          compressor_type_(common::ObCompressorType::NONE_COMPRESSOR) {}
+  // @return NONE_COMPRESSOR if the redo compression is disabled
+  common::ObCompressorType get_redo_compressor_type();
+  void reset()
+  {
+    last_refresh_ts_ = 0;
+    compressor_type_ = common::ObCompressorType::NONE_COMPRESSOR;
+  }
+  TO_STRING_KV(K_(last_refresh_ts), K_(compressor_type));
+private:
+  void refresh_compress_tenant_config_();
+private:
+  static const int64_t REFRESH_INTERVAL = 5000000;
+private:
+  int64_t last_refresh_ts_;
+  common::ObCompressorType compressor_type_;
+};
+
+} // transaction
+} // oceanbase
+
+#endif
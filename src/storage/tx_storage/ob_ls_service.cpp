@@ -670,15 +670,33 @@ int ObLSService::gc_ls_after_replay_slog()
   return ret;
 }
 
+// the sys ls is enabled first, the other services of the tenant wait for it to replay.
 int ObLSService::enable_replay()
 {
   int ret = OB_SUCCESS;
-  int tmp_ret = OB_SUCCESS;
-  ObInnerLSStatus ls_status;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  int64_t sys_ls_cost_us = 0;
+  int64_t ls_cnt = 0;
   common::ObSharedGuard<ObLSIterator> ls_iter;
+  ObLSHandle sys_ls_handle;
   ObLS *ls = nullptr;
-  share::ObLSRestoreStatus restore_status;
-  if (OB_FAIL(get_ls_iter(ls_iter, ObLSGetMod::TXSTORAGE_MOD))) {
+  if (OB_FAIL(get_ls(SYS_LS, sys_ls_handle, ObLSGetMod::TXSTORAGE_MOD))) {
+    if (OB_LS_NOT_EXIST == ret) {
+      ret = OB_SUCCESS;
+    } else {
+      LOG_WARN("failed to get sys ls", K(ret));
+    }
+  } else if (OB_ISNULL(ls = sys_ls_handle.get_ls())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_ERROR("ls is null", K(ret));
+  } else if (OB_FAIL(enable_replay_(*ls, ls_cnt))) {
+    LOG_ERROR("fail to enable replay of sys ls", K(ret));
+  } else {
+    sys_ls_cost_us = ObTimeUtility::current_time() - start_ts;
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(get_ls_iter(ls_iter, ObLSGetMod::TXSTORAGE_MOD))) {
     LOG_WARN("failed to get ls iter", K(ret));
   } else {
     while (OB_SUCC(ret)) {
@@ -689,13 +707,9 @@ int ObLSService::enable_replay()
       } else if (nullptr == ls) {
         ret = OB_ERR_UNEXPECTED;
         LOG_ERROR("ls is null", K(ret));
-      } else if (ls->is_need_gc()) {
-        // this ls will be gc later, should not enable replay
-      } else if (OB_FAIL(ls->get_restore_status(restore_status))) {
-        LOG_WARN("fail to get ls restore status", K(ret));
-      } else if (!restore_status.can_replay_log()) {
-        // while downtime, if ls's restore status is in [restore_start, wait_restore_tablet_meta], clog can't replay
-      } else if (OB_FAIL(ls->enable_replay())) {
+      } else if (ls->get_ls_id().is_sys_ls()) {
+        // already enabled
+      } else if (OB_FAIL(enable_replay_(*ls, ls_cnt))) {
         LOG_ERROR("fail to enable replay", K(ret));
       }
     }
@@ -703,7 +717,27 @@ int ObLSService::enable_replay()
       ret = OB_SUCCESS;
     }
   }
+  LOG_INFO("enable replay of all ls finished", K(ret), K(ls_cnt), K(sys_ls_cost_us),
+           "total_cost_us", ObTimeUtility::current_time() - start_ts);
+
+  return ret;
+}
 
+int ObLSService::enable_replay_(ObLS &ls, int64_t &ls_cnt)
+{
+  int ret = OB_SUCCESS;
+  share::ObLSRestoreStatus restore_status;
+  if (ls.is_need_gc()) {
+    // this ls will be gc later, should not enable replay
+  } else if (OB_FAIL(ls.get_restore_status(restore_status))) {
+    LOG_WARN("fail to get ls restore status", K(ret), K(ls.get_ls_id()));
+  } else if (!restore_status.can_replay_log()) {
+    // while downtime, if ls's restore status is in [restore_start, wait_restore_tablet_meta], clog can't replay
+  } else if (OB_FAIL(ls.enable_replay())) {
+    LOG_ERROR("fail to enable replay", K(ret), K(ls.get_ls_id()));
+  } else {
+    ++ls_cnt;
+  }
   return ret;
 }
 
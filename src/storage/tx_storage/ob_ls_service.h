@@ -170,6 +170,7 @@ private:
   int remove_ls_from_map_(const share::ObLSID &ls_id);
   void remove_ls_(ObLS *ls, const bool remove_from_disk = true);
   int replay_update_ls_(const ObLSMeta &ls_meta);
+  int enable_replay_(ObLS &ls, int64_t &ls_cnt);
   int restore_update_ls_(const ObLSMetaPackage &meta_package);
   int replay_remove_ls_(const share::ObLSID &ls_id);
   int replay_create_ls_(const ObLSMeta &ls_meta);
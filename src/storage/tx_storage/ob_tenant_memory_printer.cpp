@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX STORAGE
 
 #include "lib/utility/ob_print_utils.h"
+#include "lib/cpu/ob_numa.h"
 #include "observer/omt/ob_multi_tenant.h"                  // ObMultiTenant
 #include "share/ob_tenant_mgr.h"                           // get_virtual_memory_used
 #include "share/allocator/ob_memstore_allocator_mgr.h"     // ObMemstoreAllocatorMgr
@@ -132,6 +133,26 @@ int ObTenantMemoryPrinter::print_tenant_usage()
         memory_used - CHUNK_MGR.get_shadow_hold(), memory_used
 #endif
         );
+    // huge page usage of the chunks in use, MADV_HUGEPAGE is only an advice, the memory
+    // actually backed by transparent huge pages is from smaps.
+    int64_t thp_advised_hold = 0;
+    for (int hp_ctx = 0; hp_ctx < lib::ObHugePageHelper::MAX_CTX; ++hp_ctx) {
+      thp_advised_hold += CHUNK_MGR.get_hp_ctx_thp_advised_hold(hp_ctx);
+      _STORAGE_LOG(INFO, "[CHUNK_MGR] huge page ctx=%s policy=%d hold=%'15ld hugetlb_hold=%'15ld thp_advised_hold=%'15ld",
+          lib::ObHugePageHelper::get_ctx_name(hp_ctx),
+          lib::ObHugePageHelper::get_policy(hp_ctx),
+          CHUNK_MGR.get_hp_ctx_hold(hp_ctx),
+          CHUNK_MGR.get_hp_ctx_hugetlb_hold(hp_ctx),
+          CHUNK_MGR.get_hp_ctx_thp_advised_hold(hp_ctx));
+    }
+    _STORAGE_LOG(INFO, "[CHUNK_MGR] huge page thp_advised_hold=%'15ld thp_backed=%'15ld",
+        thp_advised_hold,
+        lib::ObHugePageHelper::get_anon_huge_pages());
+    // memory of the chunks bound to numa nodes
+    for (int64_t node = 0; node < common::ObNumaHelper::get_node_cnt(); ++node) {
+      _STORAGE_LOG(INFO, "[CHUNK_MGR] numa node=%ld bound_hold=%'15ld",
+          node, CHUNK_MGR.get_numa_bound_hold(node));
+    }
     print_mutex_.unlock();
   }
 
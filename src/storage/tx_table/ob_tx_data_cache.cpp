@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "storage/tx_table/ob_tx_data_cache.h"
+#include "lib/hash_func/murmur_hash.h"
+#include "lib/thread_local/ob_tsi_factory.h"
+
+namespace oceanbase
+{
+using namespace common;
+
+namespace storage
+{
+
+uint64_t ObTxDataCacheKey::hash() const
+{
+  uint64_t hash_val = murmurhash(&tx_id_, sizeof(tx_id_), 0);
+  hash_val = murmurhash(&tx_table_, sizeof(tx_table_), hash_val);
+  return hash_val;
+}
+
+ObTxDataThreadCache *ObTxDataThreadCache::instance()
+{
+  return GET_TSI_MULT(ObTxDataThreadCache, 1);
+}
+
+bool ObTxDataThreadCache::can_cache(const ObTxData &tx_data)
+{
+  bool bool_ret = false;
+  if (ObTxData::COMMIT != tx_data.state_ && ObTxData::ABORT != tx_data.state_) {
+    // the state of running txn may still change
+  } else if (OB_ISNULL(tx_data.undo_status_list_.head_)) {
+    bool_ret = true;
+  } else {
+    bool_ret = OB_ISNULL(tx_data.undo_status_list_.head_->next_);
+  }
+  return bool_ret;
+}
+
+bool ObTxDataThreadCache::get(const ObTxDataCacheKey &key,
+                              ObTxData &tx_data,
+                              ObUndoStatusNode &undo_node)
+{
+  bool bool_ret = false;
+  if (OB_LIKELY(key.is_valid())) {
+    Entry *set = entries_[key.hash() % SET_CNT];
+    for (int64_t i = 0; !bool_ret && i < WAY_CNT; i++) {
+      Entry &entry = set[i];
+      if (entry.key_ == key) {
+        tx_data = entry.commit_data_;
+        if (entry.undo_node_.size_ > 0) {
+          undo_node = entry.undo_node_;
+          undo_node.next_ = nullptr;
+          tx_data.undo_status_list_.head_ = &undo_node;
+          tx_data.undo_status_list_.undo_node_cnt_ = 1;
+        }
+        entry.last_access_ = ++access_clock_;
+        bool_ret = true;
+      }
+    }
+  }
+  return bool_ret;
+}
+
+void ObTxDataThreadCache::put(const ObTxDataCacheKey &key, const ObTxData &tx_data)
+{
+  if (OB_LIKELY(key.is_valid()) && can_cache(tx_data)) {
+    Entry *set = entries_[key.hash() % SET_CNT];
+    Entry *victim = &set[0];
+    for (int64_t i = 0; i < WAY_CNT; i++) {
+      if (set[i].key_ == key) {
+        victim = &set[i];
+        break;
+      } else if (set[i].last_access_ < victim->last_access_) {
+        victim = &set[i];
+      }
+    }
+
+    victim->reset();
+    victim->commit_data_.tx_id_ = tx_data.tx_id_;
+    victim->commit_data_.state_ = tx_data.state_;
+    victim->commit_data_.is_in_tx_data_table_ = tx_data.is_in_tx_data_table_;
+    victim->commit_data_.commit_version_ = tx_data.commit_version_;
+    victim->commit_data_.start_log_ts_ = tx_data.start_log_ts_;
+    victim->commit_data_.end_log_ts_ = tx_data.end_log_ts_;
+    const ObUndoStatusNode *undo_node = tx_data.undo_status_list_.head_;
+    if (OB_NOT_NULL(undo_node)) {
+      victim->undo_node_.size_ = undo_node->size_;
+      for (int64_t i = 0; i < undo_node->size_; i++) {
+        victim->undo_node_.undo_actions_[i] = undo_node->undo_actions_[i];
+      }
+    }
+    victim->key_ = key;
+    victim->last_access_ = ++access_clock_;
+  }
+}
+
+void ObTxDataThreadCache::reset()
+{
+  for (int64_t i = 0; i < SET_CNT; i++) {
+    for (int64_t j = 0; j < WAY_CNT; j++) {
+      entries_[i][j].reset();
+    }
+  }
+  access_clock_ = 0;
+}
+
+int ObTxDataCacheFillFunctor::operator()(const ObTxData &tx_data, ObTxCCCtx *tx_cc_ctx)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(fn_(tx_data, tx_cc_ctx))) {
+    // the caller will handle the error
+  } else if (OB_NOT_NULL(cache_)) {
+    SpinRLockGuard guard(tx_data.undo_status_list_.lock_);
+    cache_->put(key_, tx_data);
+  }
+  return ret;
+}
+
+}  // namespace storage
+}  // namespace oceanbase
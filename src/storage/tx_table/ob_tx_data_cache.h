@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_TX_TABLE_OB_TX_DATA_CACHE_
+#define OCEANBASE_STORAGE_TX_TABLE_OB_TX_DATA_CACHE_
+
+#include "lib/ob_define.h"
+#include "lib/utility/ob_print_utils.h"
+#include "storage/tx/ob_tx_data_define.h"
+#include "storage/tx_table/ob_tx_table_define.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+
+// Identify one resolved transaction state. The tx table address and its read epoch are part of
+// the key so that an offline/online of the tx table makes all the cached states unreachable.
+struct ObTxDataCacheKey
+{
+public:
+  ObTxDataCacheKey() : tenant_id_(OB_INVALID_TENANT_ID), tx_table_(nullptr), epoch_(-1), tx_id_(0) {}
+  ObTxDataCacheKey(const uint64_t tenant_id,
+                   const void *tx_table,
+                   const int64_t epoch,
+                   const transaction::ObTransID &tx_id)
+    : tenant_id_(tenant_id), tx_table_(tx_table), epoch_(epoch), tx_id_(tx_id.get_id()) {}
+  ~ObTxDataCacheKey() {}
+
+  bool is_valid() const { return nullptr != tx_table_ && tx_id_ > 0; }
+  void reset() { tenant_id_ = OB_INVALID_TENANT_ID; tx_table_ = nullptr; epoch_ = -1; tx_id_ = 0; }
+  uint64_t hash() const;
+  bool operator==(const ObTxDataCacheKey &other) const
+  {
+    return tx_id_ == other.tx_id_
+        && tx_table_ == other.tx_table_
+        && epoch_ == other.epoch_
+        && tenant_id_ == other.tenant_id_;
+  }
+
+  TO_STRING_KV(K_(tenant_id), KP_(tx_table), K_(epoch), K_(tx_id));
+
+public:
+  uint64_t tenant_id_;
+  const void *tx_table_;
+  int64_t epoch_;
+  int64_t tx_id_;
+};
+
+// A small thread local cache of decided transaction states sitting in front of the tx data table.
+//
+// Readers meeting uncommitted or delayed-cleanout rows resolve the writer's state through
+// ObTxTable::check_with_tx_data, which costs a hash lookup in tx data memtables and sometimes a
+// read of tx data sstables per row. Only COMMIT and ABORT states are cached, because they never
+// change once written into the tx data table, and only if all the undo actions fit into one
+// ObUndoStatusNode, so the cached copy is a complete replica of the tx data.
+//
+// The cache is 2-way set associative with LRU replacement inside a set. It is owned by exactly one
+// thread, so neither get nor put need any synchronization.
+class ObTxDataThreadCache
+{
+public:
+  static const int64_t SET_CNT = 128;
+  static const int64_t WAY_CNT = 2;
+
+  struct Entry
+  {
+    Entry() : key_(), commit_data_(), undo_node_(), last_access_(0) {}
+    void reset()
+    {
+      key_.reset();
+      commit_data_.reset();
+      undo_node_.size_ = 0;
+      undo_node_.next_ = nullptr;
+      last_access_ = 0;
+    }
+    ObTxDataCacheKey key_;
+    ObTxCommitData commit_data_;
+    ObUndoStatusNode undo_node_;
+    int64_t last_access_;
+  };
+
+public:
+  ObTxDataThreadCache() : access_clock_(0) {}
+  ~ObTxDataThreadCache() {}
+
+  static ObTxDataThreadCache *instance();
+
+  // @return true and fill the tx data if the key is found in the cache
+  //
+  // @param [in] key
+  // @param [out] tx_data, the commit data and undo status copied from the cache. Its undo status
+  // list points to the caller provided undo_node, so it must not outlive undo_node.
+  // @param [out] undo_node, the memory used to hold the cached undo actions
+  bool get(const ObTxDataCacheKey &key, ObTxData &tx_data, ObUndoStatusNode &undo_node);
+
+  // cache the tx data if it is decided and its undo status is small enough, otherwise ignore it
+  void put(const ObTxDataCacheKey &key, const ObTxData &tx_data);
+
+  void reset();
+
+  static bool can_cache(const ObTxData &tx_data);
+
+  TO_STRING_KV(K_(access_clock));
+
+private:
+  Entry entries_[SET_CNT][WAY_CNT];
+  int64_t access_clock_;
+
+  DISALLOW_COPY_AND_ASSIGN(ObTxDataThreadCache);
+};
+
+// Wraps the check functor of the caller and fills the thread local cache with the tx data which is
+// read from the tx data table. The tx data is pinned by the tx data table while operator() runs,
+// so it is safe to copy its undo status here.
+class ObTxDataCacheFillFunctor : public ObITxDataCheckFunctor
+{
+public:
+  ObTxDataCacheFillFunctor(ObITxDataCheckFunctor &fn,
+                           ObTxDataThreadCache *cache,
+                           const ObTxDataCacheKey &key)
+    : fn_(fn), cache_(cache), key_(key) {}
+  virtual ~ObTxDataCacheFillFunctor() {}
+  virtual int operator()(const ObTxData &tx_data, ObTxCCCtx *tx_cc_ctx = nullptr) override;
+  virtual bool recheck() override { return fn_.recheck(); }
+  TO_STRING_KV(K_(fn), KP_(cache), K_(key));
+
+private:
+  ObITxDataCheckFunctor &fn_;
+  ObTxDataThreadCache *cache_;
+  ObTxDataCacheKey key_;
+};
+
+}  // namespace storage
+}  // namespace oceanbase
+
+#endif  // OCEANBASE_STORAGE_TX_TABLE_OB_TX_DATA_CACHE_
@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX STORAGE
 #include "storage/tx_table/ob_tx_table.h"
 
+#include "lib/stat/ob_diagnose_info.h"
 #include "share/ob_ls_id.h"
 #include "share/schema/ob_table_schema.h"
 #include "storage/ls/ob_ls.h"
@@ -25,6 +26,7 @@
 #include "storage/tx_storage/ob_ls_map.h"
 #include "storage/tx_storage/ob_ls_service.h"
 #include "storage/tx/ob_tx_data_functor.h"
+#include "storage/tx_table/ob_tx_data_cache.h"
 #include "storage/tx_table/ob_tx_table_define.h"
 #include "storage/tx_table/ob_tx_table_iterator.h"
 #include "storage/tablet/ob_tablet.h"
@@ -834,17 +836,34 @@ int ObTxTable::check_with_tx_data(const transaction::ObTransID tx_id,
                                   const int64_t read_epoch)
 {
   int ret = OB_SUCCESS;
+  ObTxDataThreadCache *tx_data_cache = ObTxDataThreadCache::instance();
+  const ObTxDataCacheKey cache_key(MTL_ID(), this, read_epoch, tx_id);
+  ObTxData cached_tx_data;
+  ObUndoStatusNode cached_undo_node;
 
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
     LOG_WARN("tx table is not init.", KR(ret), K(tx_id));
+  } else if (OB_NOT_NULL(tx_data_cache)
+             && tx_data_cache->get(cache_key, cached_tx_data, cached_undo_node)) {
+    // the txn has been decided and its state is cached by this thread
+    EVENT_INC(TX_DATA_CACHE_HIT_COUNT);
+    if (OB_FAIL(fn(cached_tx_data))) {
+      LOG_WARN("check with cached tx data fail.", KR(ret), K(tx_id), K(cached_tx_data));
+    }
   } else if (OB_SUCC(tx_ctx_table_.check_with_tx_data(tx_id, fn))) {
+    // answered by the running txn ctx, which is never cached, so it is neither a hit nor a miss
     TRANS_LOG(DEBUG, "tx ctx table check with tx data succeed", K(tx_id), K(fn));
-  } else if (OB_TRANS_CTX_NOT_EXIST == ret && OB_FAIL(tx_data_table_.check_with_tx_data(tx_id, fn))) {
-    if (OB_ITER_END == ret) {
-      ret = OB_TRANS_CTX_NOT_EXIST;
+  } else if (OB_TRANS_CTX_NOT_EXIST == ret) {
+    // the txn ctx has been released, read the tx data table and remember the decided state
+    ObTxDataCacheFillFunctor fill_fn(fn, tx_data_cache, cache_key);
+    EVENT_INC(TX_DATA_CACHE_MISS_COUNT);
+    if (OB_FAIL(tx_data_table_.check_with_tx_data(tx_id, fill_fn))) {
+      if (OB_ITER_END == ret) {
+        ret = OB_TRANS_CTX_NOT_EXIST;
+      }
+      LOG_WARN("check_with_tx_data in tx data table fail.", KR(ret), "ls_id", ls_->get_ls_id(), K(tx_id));
     }
-    LOG_WARN("check_with_tx_data in tx data table fail.", KR(ret), "ls_id", ls_->get_ls_id(), K(tx_id));
   }
 
   check_state_and_epoch_(tx_id, read_epoch, true/*need_log_error*/, ret);
@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#define private public
+#include "ob_log_part_trans_task.h"
+#include "ob_log_binlog_record.h"
+#undef private
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+using namespace common;
+
+static const int64_t THREAD_NUM = 8;
+static const int64_t ALLOC_COUNT = 10000;
+static const int64_t ALLOC_SIZE = 64;
+
+TEST(ObLogEntryAllocator, serial_alloc)
+{
+  ObLogEntryAllocator allocator;
+  EXPECT_FALSE(allocator.is_parallel());
+  for (int64_t i = 0; i < ALLOC_COUNT; i++) {
+    char *ptr = static_cast<char *>(allocator.alloc(ALLOC_SIZE));
+    ASSERT_TRUE(NULL != ptr);
+    ptr[ALLOC_SIZE - 1] = 'a';
+  }
+  // only the first arena is used by a serially formatted log entry
+  EXPECT_EQ(allocator.used(), allocator.arenas_[0].allocator_.used());
+  EXPECT_GE(allocator.used(), ALLOC_COUNT * ALLOC_SIZE);
+  allocator.clear();
+  EXPECT_EQ(0, allocator.used());
+}
+
+TEST(ObLogEntryAllocator, parallel_alloc)
+{
+  ObLogEntryAllocator allocator;
+  allocator.enable_parallel();
+  EXPECT_TRUE(allocator.is_parallel());
+
+  std::vector<std::thread> threads;
+  for (int64_t t = 0; t < THREAD_NUM; t++) {
+    threads.push_back(std::thread([&allocator, t]() {
+      std::vector<char *> ptrs;
+      for (int64_t i = 0; i < ALLOC_COUNT; i++) {
+        char *ptr = static_cast<char *>(allocator.alloc(ALLOC_SIZE));
+        ASSERT_TRUE(NULL != ptr);
+        MEMSET(ptr, static_cast<int>(t), ALLOC_SIZE);
+        ptrs.push_back(ptr);
+      }
+      // no memory is handed out to two threads
+      for (int64_t i = 0; i < ALLOC_COUNT; i++) {
+        for (int64_t j = 0; j < ALLOC_SIZE; j++) {
+          ASSERT_EQ(static_cast<char>(t), ptrs[i][j]);
+        }
+      }
+    }));
+  }
+  for (int64_t t = 0; t < THREAD_NUM; t++) {
+    threads[t].join();
+  }
+  EXPECT_GE(allocator.used(), THREAD_NUM * ALLOC_COUNT * ALLOC_SIZE);
+
+  // clear releases all the arenas and falls back to serial allocation
+  allocator.clear();
+  EXPECT_FALSE(allocator.is_parallel());
+  EXPECT_EQ(0, allocator.used());
+}
+
+TEST(ObLogEntryTask, enable_parallel_alloc)
+{
+  ObLogEntryTask task;
+  task.enable_parallel_alloc();
+  EXPECT_TRUE(task.arena_allocator_.is_parallel());
+  EXPECT_TRUE(NULL != task.alloc(ALLOC_SIZE));
+  task.reset();
+  EXPECT_FALSE(task.arena_allocator_.is_parallel());
+  EXPECT_EQ(0, task.get_allocator().used());
+}
+
+TEST(ObLogBR, column_array_reuse)
+{
+  const int64_t max_reused_bytes = ObLogBR::MAX_REUSED_COLUMN_ARRAY_BYTES;
+  const int64_t small_column_num = max_reused_bytes / static_cast<int64_t>(sizeof(binlogBuf)) / 2;
+  const int64_t large_column_num = small_column_num + 1;
+  const int64_t base_bytes = ObLogBR::get_total_column_array_bytes();
+  binlogBuf *new_cols = NULL;
+  binlogBuf *old_cols = NULL;
+  ObLogBR br;
+
+  // a narrow column array is kept after recycle and reused by the next row
+  EXPECT_EQ(OB_SUCCESS, br.get_column_array(small_column_num, new_cols, old_cols));
+  EXPECT_EQ(new_cols + small_column_num, old_cols);
+  EXPECT_EQ(base_bytes + max_reused_bytes, ObLogBR::get_total_column_array_bytes());
+  binlogBuf *column_array = br.column_array_;
+  br.reset();
+  EXPECT_EQ(column_array, br.column_array_);
+  EXPECT_EQ(OB_SUCCESS, br.get_column_array(small_column_num - 1, new_cols, old_cols));
+  EXPECT_EQ(column_array, new_cols);
+
+  // a wide column array is freed on recycle
+  EXPECT_EQ(OB_SUCCESS, br.get_column_array(large_column_num, new_cols, old_cols));
+  EXPECT_EQ(large_column_num, br.column_array_size_);
+  EXPECT_LT(base_bytes + max_reused_bytes, ObLogBR::get_total_column_array_bytes());
+  br.reset();
+  EXPECT_TRUE(NULL == br.column_array_);
+  EXPECT_EQ(0, br.column_array_size_);
+  EXPECT_EQ(base_bytes, ObLogBR::get_total_column_array_bytes());
+
+  EXPECT_EQ(OB_INVALID_ARGUMENT, br.get_column_array(0, new_cols, old_cols));
+}
+
+TEST(ObLogBR, column_array_total_bound)
+{
+  const int64_t max_reused_bytes = ObLogBR::MAX_REUSED_COLUMN_ARRAY_BYTES;
+  const int64_t max_total_bytes = ObLogBR::MAX_TOTAL_COLUMN_ARRAY_BYTES;
+  const int64_t column_num = max_reused_bytes / static_cast<int64_t>(sizeof(binlogBuf)) / 2;
+  const int64_t br_num = max_total_bytes / max_reused_bytes + 16;
+  const int64_t base_bytes = ObLogBR::get_total_column_array_bytes();
+  binlogBuf *new_cols = NULL;
+  binlogBuf *old_cols = NULL;
+  ObLogBR *brs = new ObLogBR[br_num];
+
+  for (int64_t i = 0; i < br_num; i++) {
+    ASSERT_EQ(OB_SUCCESS, brs[i].get_column_array(column_num, new_cols, old_cols));
+  }
+  for (int64_t i = 0; i < br_num; i++) {
+    brs[i].reset();
+  }
+  // the recycled binlog records retain no more than the total bound
+  EXPECT_LE(ObLogBR::get_total_column_array_bytes(), base_bytes + max_total_bytes);
+  delete [] brs;
+  EXPECT_EQ(base_bytes, ObLogBR::get_total_column_array_bytes());
+}
+
+} // namespace libobcdc
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_ob_log_entry_task.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
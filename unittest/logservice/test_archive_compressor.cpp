@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/ob_errno.h"
+#include "lib/random/ob_random.h"
+#include "logservice/archiveservice/ob_archive_define.h"
+#include "logservice/archiveservice/ob_archive_compressor.h"
+#include "logservice/restoreservice/ob_remote_data_generator.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace archive;
+
+class TestArchiveCompressor : public ::testing::Test
+{
+public:
+  static const int64_t UNIT_SIZE = 16 * 1024L;
+  static const int64_t BUF_SIZE = 1024 * 1024L;
+  virtual void SetUp()
+  {
+    src_ = new char[BUF_SIZE];
+    dst_ = new char[BUF_SIZE];
+    out_ = new char[BUF_SIZE];
+  }
+  virtual void TearDown()
+  {
+    delete []src_;
+    delete []dst_;
+    delete []out_;
+  }
+protected:
+  char *src_;
+  char *dst_;
+  char *out_;
+};
+
+TEST_F(TestArchiveCompressor, test_compress_unit)
+{
+  // compressible unit followed by an incompressible unit
+  for (int64_t i = 0; i < UNIT_SIZE; i++) {
+    src_[i] = static_cast<char>(i % 7);
+  }
+  for (int64_t i = UNIT_SIZE; i < 2 * UNIT_SIZE; i++) {
+    src_[i] = static_cast<char>(ObRandom::rand(0, 255));
+  }
+  const ObCompressorType types[] = {LZ4_COMPRESSOR, ZSTD_COMPRESSOR, ZSTD_1_3_8_COMPRESSOR};
+  for (int64_t t = 0; t < 3; t++) {
+    int64_t pos = 0;
+    int64_t max_size = 0;
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressor::get_max_compress_size(types[t], UNIT_SIZE, max_size));
+    EXPECT_LT(UNIT_SIZE, max_size);
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressor::compress(types[t], src_, UNIT_SIZE, dst_, BUF_SIZE, pos));
+    const int64_t first_unit_size = pos;
+    EXPECT_GT(UNIT_SIZE, first_unit_size);
+    ObArchiveCompressUnitHeader unit_header;
+    int64_t header_pos = 0;
+    EXPECT_EQ(OB_SUCCESS, unit_header.deserialize(dst_, pos, header_pos));
+    EXPECT_TRUE(unit_header.is_valid());
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressor::compress(types[t], src_ + UNIT_SIZE, UNIT_SIZE, dst_, BUF_SIZE, pos));
+    // incompressible data is stored as is
+    EXPECT_EQ(ObArchiveCompressUnitHeader::HEADER_SIZE + UNIT_SIZE, pos - first_unit_size);
+
+    int64_t orig_len = 0;
+    int64_t consumed_len = 0;
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressor::get_decompress_size(dst_, pos, orig_len, consumed_len));
+    EXPECT_EQ(2 * UNIT_SIZE, orig_len);
+    EXPECT_EQ(pos, consumed_len);
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressor::decompress(dst_, pos, out_, BUF_SIZE, orig_len, consumed_len));
+    EXPECT_EQ(2 * UNIT_SIZE, orig_len);
+    EXPECT_EQ(0, MEMCMP(src_, out_, orig_len));
+
+    // the incomplete unit at the end is left for the next read
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressor::decompress(dst_, pos - 1, out_, BUF_SIZE, orig_len, consumed_len));
+    EXPECT_EQ(UNIT_SIZE, orig_len);
+    EXPECT_EQ(first_unit_size, consumed_len);
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressor::decompress(dst_, 10, out_, BUF_SIZE, orig_len, consumed_len));
+    EXPECT_EQ(0, orig_len);
+    EXPECT_EQ(0, consumed_len);
+
+    // output buffer is not enough
+    EXPECT_EQ(OB_BUF_NOT_ENOUGH, ObArchiveCompressor::decompress(dst_, pos, out_, UNIT_SIZE, orig_len, consumed_len));
+
+    // corrupted data
+    dst_[first_unit_size - 1] = static_cast<char>(dst_[first_unit_size - 1] + 1);
+    EXPECT_EQ(OB_INVALID_DATA, ObArchiveCompressor::decompress(dst_, pos, out_, BUF_SIZE, orig_len, consumed_len));
+
+    // data of a compressed file is made up of compress units only
+    EXPECT_EQ(OB_INVALID_DATA, ObArchiveCompressor::decompress(src_, UNIT_SIZE, out_, BUF_SIZE, orig_len, consumed_len));
+  }
+}
+
+class TestDataGenerator : public logservice::RemoteDataGenerator
+{
+public:
+  TestDataGenerator() : RemoteDataGenerator(1001, share::ObLSID(1001), palf::LSN(0), palf::LSN(1024), 1) {}
+  int next_buffer(logservice::RemoteDataBuffer &buffer) { UNUSED(buffer); return OB_NOT_SUPPORTED; }
+  int process(char *origin_buf, const int64_t origin_buf_size, const bool is_compressed,
+      char *&buf, int64_t &buf_size, int64_t &consumed_size)
+  {
+    return process_origin_data_(origin_buf, origin_buf_size, is_compressed, buf, buf_size, consumed_size);
+  }
+};
+
+TEST_F(TestArchiveCompressor, test_restore_compressed_file)
+{
+  TestDataGenerator generator;
+  char *buf = NULL;
+  int64_t buf_size = 0;
+  int64_t consumed_size = 0;
+  int64_t pos = 0;
+  for (int64_t i = 0; i < 4 * UNIT_SIZE; i++) {
+    src_[i] = static_cast<char>(i % 13);
+  }
+  for (int64_t i = 0; i < 4; i++) {
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressor::compress(ZSTD_COMPRESSOR, src_ + i * UNIT_SIZE, UNIT_SIZE,
+          dst_, BUF_SIZE, pos));
+  }
+
+  // the file header flag, not the data, decides whether to decompress
+  EXPECT_EQ(OB_SUCCESS, generator.process(dst_, pos, false, buf, buf_size, consumed_size));
+  EXPECT_EQ(dst_, buf);
+  EXPECT_EQ(pos, buf_size);
+  EXPECT_EQ(pos, consumed_size);
+
+  EXPECT_EQ(OB_SUCCESS, generator.process(dst_, pos, true, buf, buf_size, consumed_size));
+  EXPECT_EQ(4 * UNIT_SIZE, buf_size);
+  EXPECT_EQ(pos, consumed_size);
+  EXPECT_EQ(0, MEMCMP(src_, buf, buf_size));
+
+  // the incomplete unit at the end is read again next time
+  EXPECT_EQ(OB_SUCCESS, generator.process(dst_, pos - 1, true, buf, buf_size, consumed_size));
+  EXPECT_EQ(3 * UNIT_SIZE, buf_size);
+  EXPECT_GT(pos - 1, consumed_size);
+  EXPECT_EQ(0, MEMCMP(src_, buf, buf_size));
+  EXPECT_EQ(OB_ITER_END, generator.process(dst_, 10, true, buf, buf_size, consumed_size));
+
+  // uncompressed data in a file flagged compressed is invalid
+  EXPECT_EQ(OB_INVALID_DATA, generator.process(src_, UNIT_SIZE, true, buf, buf_size, consumed_size));
+}
+
+TEST_F(TestArchiveCompressor, test_file_header)
+{
+  ObArchiveFileHeader header;
+  char buf[ARCHIVE_FILE_HEADER_SIZE];
+  int64_t pos = 0;
+  EXPECT_EQ(OB_SUCCESS, header.generate_header(palf::LSN(1024), ARCHIVE_FILE_FLAG_COMPRESS));
+  EXPECT_TRUE(header.is_valid());
+  EXPECT_TRUE(header.is_compressed());
+  EXPECT_EQ(OB_SUCCESS, header.serialize(buf, ARCHIVE_FILE_HEADER_SIZE, pos));
+  ObArchiveFileHeader header2;
+  pos = 0;
+  EXPECT_EQ(OB_SUCCESS, header2.deserialize(buf, ARCHIVE_FILE_HEADER_SIZE, pos));
+  EXPECT_TRUE(header2.is_valid());
+  EXPECT_TRUE(header2.is_compressed());
+  EXPECT_EQ(OB_SUCCESS, header.generate_header(palf::LSN(1024)));
+  EXPECT_TRUE(header.is_valid());
+  EXPECT_FALSE(header.is_compressed());
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_archive_compressor.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ARCHIVE_LOG(INFO, "begin unittest::test_archive_compressor");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,236 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/ob_errno.h"
+#include "share/rc/ob_tenant_base.h"
+#define private public
+#define protected public
+#include "logservice/archiveservice/ob_archive_sender.h"
+#include "logservice/archiveservice/ob_archive_task_queue.h"
+#include "logservice/archiveservice/ob_archive_compressor.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace archive;
+using namespace palf;
+
+class FakeArchiveWorker : public ObArchiveWorker
+{
+public:
+  int push_task_status(ObArchiveTaskStatus *task_status) { UNUSED(task_status); return OB_SUCCESS; }
+  int handle_task_list(void *data) { UNUSED(data); return OB_SUCCESS; }
+};
+
+class TestArchiveSender : public ::testing::Test
+{
+public:
+  // same as ObArchiveSender::MAX_BATCH_TASK_NUM
+  static const int64_t MAX_BATCH_TASK_NUM = 16;
+  static const int64_t TASK_NUM = 24;
+  static const int64_t TASK_BUF_SIZE = 64 * 1024L;
+  TestArchiveSender() : id_(1001), task_status_(id_) {}
+  virtual void SetUp()
+  {
+    station_ = ArchiveWorkStation(ArchiveKey(1, 1, 1), ObArchiveLease(1, 1, 2));
+    ASSERT_EQ(OB_SUCCESS, piece_.set(1, 3600 * 1000 * 1000L, 1, 1));
+    ASSERT_TRUE(station_.is_valid());
+    ASSERT_TRUE(piece_.is_valid());
+    task_status_.inc_ref();
+    buf_ = new char[TASK_NUM * TASK_BUF_SIZE];
+    task_buf_ = new char[TASK_NUM * TASK_BUF_SIZE];
+    for (int64_t i = 0; i < TASK_NUM * TASK_BUF_SIZE; i++) {
+      buf_[i] = static_cast<char>(i % 251);
+    }
+  }
+  virtual void TearDown()
+  {
+    delete []buf_;
+    delete []task_buf_;
+  }
+  // the i-th task covers [start_lsn + i * TASK_BUF_SIZE, start_lsn + (i + 1) * TASK_BUF_SIZE)
+  // tasks from compress_idx on are flagged as compressed
+  void push_tasks(const int64_t start_lsn,
+                  const int64_t task_num,
+                  const int64_t gap_idx = -1,
+                  const int64_t compress_idx = -1)
+  {
+    for (int64_t i = 0; i < task_num; i++) {
+      const int64_t begin = start_lsn + i * TASK_BUF_SIZE + (gap_idx >= 0 && i >= gap_idx ? TASK_BUF_SIZE : 0);
+      const bool is_compressed = compress_idx >= 0 && i >= compress_idx;
+      // the task owns its buffer, as allocated by ObArchiveAllocator
+      ASSERT_EQ(OB_SUCCESS, tasks_[i].set_buffer(task_buf_ + i * TASK_BUF_SIZE, TASK_BUF_SIZE));
+      ASSERT_EQ(OB_SUCCESS, tasks_[i].init(1001, id_, station_, piece_, LSN(begin),
+            LSN(begin + TASK_BUF_SIZE), 1, is_compressed, buf_ + i * TASK_BUF_SIZE, TASK_BUF_SIZE));
+      ASSERT_EQ(OB_SUCCESS, task_status_.push(&tasks_[i], worker_));
+    }
+  }
+  void check_queue(const int64_t task_num)
+  {
+    // batching keeps the tasks in the queue until they are consumed
+    EXPECT_EQ(task_num, task_status_.count());
+    EXPECT_EQ(OB_SUCCESS, task_status_.pop_front(task_num));
+    EXPECT_EQ(0, task_status_.count());
+  }
+protected:
+  ObLSID id_;
+  ArchiveWorkStation station_;
+  ObArchivePiece piece_;
+  FakeArchiveWorker worker_;
+  ObArchiveTaskStatus task_status_;
+  ObArchiveSendTask tasks_[TASK_NUM];
+  char *buf_;
+  char *task_buf_;
+  ObArchiveSender sender_;
+};
+
+TEST_F(TestArchiveSender, batch_continuous_tasks)
+{
+  ObArchiveSendTask *tasks[MAX_BATCH_TASK_NUM] = {NULL};
+  int64_t task_num = 0;
+  int64_t buf_size = 0;
+  const int64_t max_batch_task_num = MAX_BATCH_TASK_NUM;
+  push_tasks(0, TASK_NUM);
+  EXPECT_EQ(OB_SUCCESS, sender_.get_batch_tasks_(tasks_[0], 0, task_status_, tasks, task_num, buf_size));
+  // at most MAX_BATCH_TASK_NUM tasks in one write
+  EXPECT_EQ(max_batch_task_num, task_num);
+  EXPECT_EQ(max_batch_task_num * TASK_BUF_SIZE, buf_size);
+  for (int64_t i = 0; i < task_num; i++) {
+    EXPECT_EQ(&tasks_[i], tasks[i]);
+  }
+
+  // the batch is written as one buffer with the file header
+  char *filled_data = NULL;
+  int64_t filled_data_len = 0;
+  ObArchiveFileHeader header;
+  int64_t pos = 0;
+  EXPECT_EQ(OB_SUCCESS, sender_.fill_send_buffer_(true, tasks, task_num, buf_size, filled_data, filled_data_len));
+  EXPECT_EQ(ARCHIVE_FILE_HEADER_SIZE + buf_size, filled_data_len);
+  EXPECT_EQ(OB_SUCCESS, header.deserialize(filled_data, filled_data_len, pos));
+  EXPECT_TRUE(header.is_valid());
+  EXPECT_FALSE(header.is_compressed());
+  EXPECT_EQ(LSN(0), header.start_lsn_);
+  EXPECT_EQ(0, MEMCMP(filled_data + ARCHIVE_FILE_HEADER_SIZE, buf_, buf_size));
+  share::mtl_free(filled_data);
+
+  // no header when appending to an existing file
+  EXPECT_EQ(OB_SUCCESS, sender_.fill_send_buffer_(false, tasks, task_num, buf_size, filled_data, filled_data_len));
+  EXPECT_EQ(buf_size, filled_data_len);
+  EXPECT_EQ(0, MEMCMP(filled_data, buf_, buf_size));
+  share::mtl_free(filled_data);
+  check_queue(TASK_NUM);
+}
+
+TEST_F(TestArchiveSender, batch_stop_at_gap)
+{
+  ObArchiveSendTask *tasks[MAX_BATCH_TASK_NUM] = {NULL};
+  int64_t task_num = 0;
+  int64_t buf_size = 0;
+  push_tasks(0, 8, 5);
+  EXPECT_EQ(OB_SUCCESS, sender_.get_batch_tasks_(tasks_[0], 0, task_status_, tasks, task_num, buf_size));
+  EXPECT_EQ(5, task_num);
+  EXPECT_EQ(5 * TASK_BUF_SIZE, buf_size);
+  check_queue(8);
+}
+
+TEST_F(TestArchiveSender, batch_stop_at_file_end)
+{
+  ObArchiveSendTask *tasks[MAX_BATCH_TASK_NUM] = {NULL};
+  int64_t task_num = 0;
+  int64_t buf_size = 0;
+  // the 4th task belongs to the next archive file
+  push_tasks(MAX_ARCHIVE_FILE_SIZE - 3 * TASK_BUF_SIZE, 8);
+  EXPECT_EQ(OB_SUCCESS, sender_.get_batch_tasks_(tasks_[0], 0, task_status_, tasks, task_num, buf_size));
+  EXPECT_EQ(3, task_num);
+  check_queue(8);
+}
+
+TEST_F(TestArchiveSender, batch_stop_at_compress_flag)
+{
+  ObArchiveSendTask *tasks[MAX_BATCH_TASK_NUM] = {NULL};
+  int64_t task_num = 0;
+  int64_t buf_size = 0;
+  // the file header is decided by the first task, so raw and compressed data are never batched together
+  push_tasks(0, 8, -1, 6);
+  EXPECT_EQ(OB_SUCCESS, sender_.get_batch_tasks_(tasks_[0], 0, task_status_, tasks, task_num, buf_size));
+  EXPECT_EQ(6, task_num);
+  check_queue(8);
+}
+
+TEST_F(TestArchiveSender, batch_limit_buf_size)
+{
+  ObArchiveSendTask *tasks[MAX_BATCH_TASK_NUM] = {NULL};
+  ObArchiveSendTask big_tasks[3];
+  const int64_t big_buf_size = 3 * 1024 * 1024L;
+  char *big_buf = new char[big_buf_size];
+  char *big_task_buf = new char[3 * big_buf_size];
+  int64_t task_num = 0;
+  int64_t buf_size = 0;
+  for (int64_t i = 0; i < 3; i++) {
+    ASSERT_EQ(OB_SUCCESS, big_tasks[i].set_buffer(big_task_buf + i * big_buf_size, big_buf_size));
+    ASSERT_EQ(OB_SUCCESS, big_tasks[i].init(1001, id_, station_, piece_, LSN(i * big_buf_size),
+          LSN((i + 1) * big_buf_size), 1, false, big_buf, big_buf_size));
+    ASSERT_EQ(OB_SUCCESS, task_status_.push(&big_tasks[i], worker_));
+  }
+  // 3 * 3M exceeds MAX_BATCH_BUF_SIZE
+  EXPECT_EQ(OB_SUCCESS, sender_.get_batch_tasks_(big_tasks[0], 0, task_status_, tasks, task_num, buf_size));
+  EXPECT_EQ(2, task_num);
+  EXPECT_EQ(2 * big_buf_size, buf_size);
+  // the task to send must be the top of the queue
+  EXPECT_EQ(OB_ERR_UNEXPECTED, sender_.get_batch_tasks_(big_tasks[1], 0, task_status_, tasks, task_num, buf_size));
+  check_queue(3);
+  delete []big_buf;
+  delete []big_task_buf;
+}
+
+TEST_F(TestArchiveSender, compressed_file_header)
+{
+  ObArchiveSendTask *tasks[MAX_BATCH_TASK_NUM] = {NULL};
+  const int64_t compress_buf_size = 2 * TASK_BUF_SIZE;
+  char *compress_buf = new char[compress_buf_size];
+  char *task_buf = new char[compress_buf_size];
+  int64_t compress_len = 0;
+  char *filled_data = NULL;
+  int64_t filled_data_len = 0;
+  ObArchiveFileHeader header;
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, ObArchiveCompressor::compress(LZ4_COMPRESSOR, buf_, TASK_BUF_SIZE,
+        compress_buf, compress_buf_size, compress_len));
+  ASSERT_EQ(OB_SUCCESS, tasks_[0].set_buffer(task_buf, compress_buf_size));
+  ASSERT_EQ(OB_SUCCESS, tasks_[0].init(1001, id_, station_, piece_, LSN(0),
+        LSN(TASK_BUF_SIZE), 1, true, compress_buf, compress_len));
+  tasks[0] = &tasks_[0];
+  // the file written with compressed tasks is flagged for restore
+  EXPECT_EQ(OB_SUCCESS, sender_.fill_send_buffer_(true, tasks, 1, compress_len, filled_data, filled_data_len));
+  EXPECT_EQ(OB_SUCCESS, header.deserialize(filled_data, filled_data_len, pos));
+  EXPECT_TRUE(header.is_compressed());
+  share::mtl_free(filled_data);
+  delete []compress_buf;
+  delete []task_buf;
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_archive_sender.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ARCHIVE_LOG(INFO, "begin unittest::test_archive_sender");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
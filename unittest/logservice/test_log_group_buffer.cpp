@@ -258,6 +258,44 @@ TEST_F(TestLogGroupBuffer, test_to_follower)
   EXPECT_EQ(OB_SUCCESS, log_group_buffer_.to_follower());
 }
 
+TEST_F(TestLogGroupBuffer, test_read_data)
+{
+  char data[1024];
+  char read_buf[1024];
+  const int64_t len = 1024;
+  LSN start_lsn(100);
+  EXPECT_EQ(OB_NOT_INIT, log_group_buffer_.read_data(start_lsn, len, read_buf));
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.init(start_lsn));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, log_group_buffer_.read_data(start_lsn, 0, read_buf));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, log_group_buffer_.read_data(start_lsn, len, NULL));
+  // not flushed
+  memset(data, 'a', len);
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.fill(start_lsn, data, len));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, log_group_buffer_.read_data(start_lsn, len, read_buf));
+  // flushed
+  LSN lsn = start_lsn + len;
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.inc_update_reuse_lsn(lsn));
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.read_data(start_lsn, len, read_buf));
+  EXPECT_EQ(0, memcmp(data, read_buf, len));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, log_group_buffer_.read_data(start_lsn - 1, len, read_buf));
+  // overwritten by the logs after one round of the buffer
+  const int64_t reserved_buf_size = log_group_buffer_.get_reserved_buffer_size();
+  memset(data, 'b', len);
+  while (lsn + len <= start_lsn + reserved_buf_size) {
+    EXPECT_EQ(OB_SUCCESS, log_group_buffer_.fill(lsn, data, len));
+    lsn = lsn + len;
+    EXPECT_EQ(OB_SUCCESS, log_group_buffer_.inc_update_reuse_lsn(lsn));
+  }
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.read_data(start_lsn, len, read_buf));
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.fill(lsn, data, len));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, log_group_buffer_.read_data(start_lsn, len, read_buf));
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.read_data(lsn - len, len, read_buf));
+  EXPECT_EQ(0, memcmp(data, read_buf, len));
+  // the logs before truncate point can not be read after truncate
+  EXPECT_EQ(OB_SUCCESS, log_group_buffer_.set_reuse_lsn(lsn));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, log_group_buffer_.read_data(lsn - len, len, read_buf));
+}
+
 } // END of unittest
 } // end of oceanbase
 
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "logservice/palf/log_define.h"
+#define private public
+#include "logservice/palf/log_group_commit_ctrl.h"
+#undef private
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace palf;
+
+TEST(TestLogGroupCommitCtrl, test_histogram)
+{
+  LogGroupCommitHistogram histogram(4096);
+  histogram.record(0);
+  histogram.record(4095);
+  histogram.record(4096);
+  histogram.record(16383);
+  histogram.record(16384);
+  histogram.record(INT64_MAX);
+  EXPECT_EQ(2, histogram.get_bucket_cnt(0));
+  EXPECT_EQ(2, histogram.get_bucket_cnt(1));
+  EXPECT_EQ(1, histogram.get_bucket_cnt(2));
+  EXPECT_EQ(1, histogram.get_bucket_cnt(LogGroupCommitHistogram::BUCKET_CNT - 1));
+  EXPECT_EQ(0, histogram.get_bucket_cnt(LogGroupCommitHistogram::BUCKET_CNT));
+  EXPECT_EQ(4096, histogram.get_upper_bound(0));
+  EXPECT_EQ(16384, histogram.get_upper_bound(1));
+  EXPECT_EQ(INT64_MAX, histogram.get_upper_bound(LogGroupCommitHistogram::BUCKET_CNT - 1));
+  char buf[512] = {'\0'};
+  EXPECT_LT(0, histogram.to_string(buf, sizeof(buf)));
+  EXPECT_EQ(0, strncmp(buf, "<4096:2,<16384:2,<65536:1,", strlen("<4096:2,<16384:2,<65536:1,")));
+  PALF_LOG(INFO, "histogram", K(histogram));
+  histogram.reset();
+  EXPECT_EQ(0, histogram.get_bucket_cnt(0));
+}
+
+TEST(TestLogGroupCommitCtrl, test_freeze_wait_us)
+{
+  LogGroupCommitCtrl ctrl;
+  const int64_t interval_us = 1000 * 1000;
+  const int64_t budget_us = 1000;
+  // no flush cost and no log
+  ctrl.update_freeze_wait_us(0, 0, interval_us, budget_us);
+  EXPECT_EQ(0, ctrl.get_freeze_wait_us());
+  // exponential moving average of flush cost
+  ctrl.record_flush_cost(200);
+  EXPECT_EQ(200, ctrl.stat_.avg_flush_cost_us_);
+  ctrl.record_flush_cost(1000);
+  EXPECT_EQ(300, ctrl.stat_.avg_flush_cost_us_);
+  ctrl.record_flush_cost(-1);
+  EXPECT_EQ(300, ctrl.stat_.avg_flush_cost_us_);
+  // one log per 100us, 10MB/s, wait for the whole budget
+  ctrl.update_freeze_wait_us(10000, 10 * 1024 * 1024, interval_us, budget_us);
+  EXPECT_EQ(budget_us - 300, ctrl.get_freeze_wait_us());
+  EXPECT_EQ(100, ctrl.stat_.append_interval_us_);
+  // 1GB/s, wait until TARGET_GROUP_LOG_SIZE logs are accumulated
+  ctrl.update_freeze_wait_us(10000, 1024 * 1024 * 1024, interval_us, budget_us);
+  EXPECT_EQ(LogGroupCommitCtrl::TARGET_GROUP_LOG_SIZE * interval_us / (1024 * 1024 * 1024),
+      ctrl.get_freeze_wait_us());
+  // one log per 10ms, freeze immediately
+  ctrl.update_freeze_wait_us(100, 100 * 1024, interval_us, budget_us);
+  EXPECT_EQ(0, ctrl.get_freeze_wait_us());
+  // budget is less than flush cost
+  ctrl.update_freeze_wait_us(10000, 10 * 1024 * 1024, interval_us, 200);
+  EXPECT_EQ(0, ctrl.get_freeze_wait_us());
+  // group commit window is disabled
+  ctrl.update_freeze_wait_us(10000, 10 * 1024 * 1024, interval_us, 0);
+  EXPECT_EQ(0, ctrl.get_freeze_wait_us());
+  // wait time is limited by MAX_FREEZE_WAIT_US
+  ctrl.update_freeze_wait_us(10000, 10 * 1024 * 1024, interval_us, 100 * 1000);
+  EXPECT_EQ(LogGroupCommitCtrl::MAX_FREEZE_WAIT_US, ctrl.get_freeze_wait_us());
+
+  ctrl.record_group_log(8 * 1024, 100);
+  LogGroupCommitStat stat;
+  ctrl.get_stat(stat);
+  EXPECT_EQ(LogGroupCommitCtrl::MAX_FREEZE_WAIT_US, stat.freeze_wait_us_);
+  EXPECT_EQ(1, stat.group_size_histogram_.get_bucket_cnt(1));
+  EXPECT_EQ(1, stat.group_wait_histogram_.get_bucket_cnt(1));
+  PALF_LOG(INFO, "group commit stat", K(stat));
+  ctrl.reset();
+  EXPECT_EQ(0, ctrl.get_freeze_wait_us());
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_log_group_commit_ctrl.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_group_commit_ctrl");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/allocator/page_arena.h"
+#include "lib/container/ob_se_array.h"
+#define private public
+#include "logservice/palf/log_io_worker.h"
+#undef private
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace palf;
+
+class TestLogIOParallelFlusher : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    ObIAllocator *allocator = &allocator_;
+    for (int64_t i = 0; i < BATCH_WIDTH; i++) {
+      BatchLogIOFlushLogTask *io_task = OB_NEWx(BatchLogIOFlushLogTask, allocator);
+      ASSERT_NE(nullptr, io_task);
+      ASSERT_EQ(OB_SUCCESS, io_task->init(BATCH_DEPTH, allocator));
+      ASSERT_EQ(OB_SUCCESS, tasks_.push_back(io_task));
+    }
+  }
+  virtual void TearDown()
+  {
+    for (int64_t i = 0; i < tasks_.count(); i++) {
+      tasks_.at(i)->~BatchLogIOFlushLogTask();
+    }
+    tasks_.reset();
+    allocator_.reset();
+  }
+  // an empty BatchLogIOFlushLogTask fails without touching PalfEnvImpl, each
+  // round checks that all the tasks have been flushed exactly once.
+  void flush_rounds(const int64_t thread_num)
+  {
+    LogIOParallelFlusher flusher;
+    PalfEnvImpl *palf_env_impl = reinterpret_cast<PalfEnvImpl *>(&allocator_);
+    ASSERT_EQ(OB_SUCCESS, flusher.init(thread_num, 1, palf_env_impl));
+    ASSERT_EQ(OB_SUCCESS, flusher.start());
+    for (int64_t round = 1; round <= ROUND_COUNT; round++) {
+      const int64_t count = round % BATCH_WIDTH + 1;
+      const int64_t write_count = ATOMIC_LOAD(&flusher.write_count_);
+      EXPECT_EQ(OB_ERR_UNEXPECTED, flusher.flush(tasks_, count));
+      EXPECT_EQ(write_count + count, ATOMIC_LOAD(&flusher.write_count_));
+      EXPECT_EQ(count, flusher.finished_count_);
+      EXPECT_EQ(0, flusher.running_count_);
+      EXPECT_TRUE(NULL == flusher.tasks_);
+    }
+    const int64_t round_count = ROUND_COUNT;
+    EXPECT_EQ(round_count, flusher.round_count_);
+    EXPECT_EQ(OB_INVALID_ARGUMENT, flusher.flush(tasks_, 0));
+    EXPECT_EQ(OB_INVALID_ARGUMENT, flusher.flush(tasks_, BATCH_WIDTH + 1));
+    flusher.destroy();
+  }
+public:
+  static const int64_t BATCH_WIDTH = 8;
+  static const int64_t BATCH_DEPTH = 4;
+  static const int64_t ROUND_COUNT = 1000;
+  ObArenaAllocator allocator_;
+  ObSEArray<BatchLogIOFlushLogTask *, 8> tasks_;
+};
+
+TEST_F(TestLogIOParallelFlusher, calc_thread_num)
+{
+  EXPECT_EQ(0, LogIOParallelFlusher::calc_thread_num(0, 64, 8));
+  EXPECT_EQ(3, LogIOParallelFlusher::calc_thread_num(3, 64, 8));
+  // at most batch_width - 1 helper threads
+  EXPECT_EQ(7, LogIOParallelFlusher::calc_thread_num(7, 64, 8));
+  EXPECT_EQ(3, LogIOParallelFlusher::calc_thread_num(7, 64, 4));
+  EXPECT_EQ(0, LogIOParallelFlusher::calc_thread_num(7, 64, 1));
+  // derived from the cpu count
+  EXPECT_EQ(1, LogIOParallelFlusher::calc_thread_num(-1, 1, 8));
+  EXPECT_EQ(1, LogIOParallelFlusher::calc_thread_num(-1, 16, 8));
+  EXPECT_EQ(4, LogIOParallelFlusher::calc_thread_num(-1, 64, 8));
+  EXPECT_EQ(7, LogIOParallelFlusher::calc_thread_num(-1, 256, 8));
+}
+
+TEST_F(TestLogIOParallelFlusher, flush_serially)
+{
+  flush_rounds(0);
+}
+
+TEST_F(TestLogIOParallelFlusher, flush_in_parallel)
+{
+  flush_rounds(3);
+  flush_rounds(BATCH_WIDTH - 1);
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_log_io_parallel_flusher.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_io_parallel_flusher");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define private public
+#include "logservice/palf/log_iterator_storage.h"
+#include "logservice/palf/log_reader.h"
+#include "logservice/palf/log_define.h"
+#undef private
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace palf;
+
+const char *TEST_DIR = "test_log_mmap_read_dir";
+
+// reads the blocks of 'dir_' with plain pread, and maps them with LogReader,
+// the blocks below 'min_block_id_' have been recycled.
+class TestMmapLogStorage : public ILogStorage
+{
+public:
+  TestMmapLogStorage() : min_block_id_(0) {}
+  int init(const char *dir)
+  {
+    snprintf(dir_, OB_MAX_FILE_NAME_LENGTH, "%s", dir);
+    return reader_.init(dir_, PALF_PHY_BLOCK_SIZE);
+  }
+  int pread(const LSN &lsn, const int64_t in_read_size, ReadBuf &read_buf, int64_t &out_read_size)
+  {
+    int ret = OB_SUCCESS;
+    const block_id_t block_id = lsn_2_block(lsn, PALF_BLOCK_SIZE);
+    char path[OB_MAX_FILE_NAME_LENGTH] = {'\0'};
+    int fd = -1;
+    if (true == check_read_out_of_lower_bound(block_id)) {
+      ret = OB_ERR_OUT_OF_LOWER_BOUND;
+    } else if (OB_FAIL(convert_to_normal_block(dir_, block_id, path, OB_MAX_FILE_NAME_LENGTH))) {
+    } else if (-1 == (fd = ::open(path, O_RDONLY))) {
+      ret = OB_IO_ERROR;
+    } else {
+      const int64_t read_size = MIN(in_read_size, PALF_BLOCK_SIZE - lsn_2_offset(lsn, PALF_BLOCK_SIZE));
+      out_read_size = ::pread(fd, read_buf.buf_, read_size, lsn_2_offset(lsn, PALF_BLOCK_SIZE) + MAX_INFO_BLOCK_SIZE);
+      ret = out_read_size == read_size ? OB_SUCCESS : OB_IO_ERROR;
+      ::close(fd);
+    }
+    return ret;
+  }
+  int mmap_block(const int64_t block_id, char *&addr, int64_t &len)
+  {
+    return true == check_read_out_of_lower_bound(block_id) ? OB_ERR_OUT_OF_LOWER_BOUND
+        : reader_.mmap(block_id, addr, len);
+  }
+  int munmap_block(char *addr, const int64_t len)
+  {
+    return reader_.munmap(addr, len);
+  }
+  bool check_read_out_of_lower_bound(const int64_t block_id) const
+  {
+    return block_id < min_block_id_;
+  }
+public:
+  char dir_[OB_MAX_FILE_NAME_LENGTH];
+  LogReader reader_;
+  int64_t min_block_id_;
+};
+
+class TestLogMmapRead : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    (void) system("rm -rf test_log_mmap_read_dir");
+    ASSERT_EQ(0, ::mkdir(TEST_DIR, 0777));
+    ASSERT_NE(-1, dir_fd_ = ::open(TEST_DIR, O_DIRECTORY | O_RDONLY));
+    for (block_id_t block_id = 0; block_id < BLOCK_NUM; block_id++) {
+      write_block_(block_id);
+    }
+    ASSERT_EQ(OB_SUCCESS, log_storage_.init(TEST_DIR));
+    GetFileEndLSN get_file_end_lsn = [](){ return LSN(BLOCK_NUM * PALF_BLOCK_SIZE); };
+    ASSERT_EQ(OB_SUCCESS, iterator_storage_.init(LSN(0), PALF_BLOCK_SIZE, get_file_end_lsn, &log_storage_));
+    iterator_storage_.enable_mmap_read();
+  }
+  virtual void TearDown()
+  {
+    iterator_storage_.destroy();
+    ::close(dir_fd_);
+    (void) system("rm -rf test_log_mmap_read_dir");
+  }
+  // zero and reuse the block in place, as LogBlockMgr::do_delete_block_ does
+  void recycle_block_(const block_id_t block_id)
+  {
+    char path[OB_MAX_FILE_NAME_LENGTH] = {'\0'};
+    ASSERT_EQ(OB_SUCCESS, block_id_to_string(block_id, path, OB_MAX_FILE_NAME_LENGTH));
+    ASSERT_EQ(OB_SUCCESS, reuse_block_at(dir_fd_, path));
+  }
+  void write_block_(const block_id_t block_id)
+  {
+    char path[OB_MAX_FILE_NAME_LENGTH] = {'\0'};
+    char buf[READ_SIZE];
+    int fd = -1;
+    MEMSET(buf, 'a' + block_id, READ_SIZE);
+    ASSERT_EQ(OB_SUCCESS, convert_to_normal_block(TEST_DIR, block_id, path, OB_MAX_FILE_NAME_LENGTH));
+    ASSERT_NE(-1, fd = ::open(path, O_RDWR | O_CREAT, 0644));
+    ASSERT_EQ(0, ::ftruncate(fd, PALF_PHY_BLOCK_SIZE));
+    ASSERT_EQ(READ_SIZE, ::pwrite(fd, buf, READ_SIZE, MAX_INFO_BLOCK_SIZE));
+    ::close(fd);
+  }
+  bool check_data_(const char *buf, const char c)
+  {
+    bool bool_ret = true;
+    for (int64_t i = 0; bool_ret && i < READ_SIZE; i++) {
+      bool_ret = (c == buf[i]);
+    }
+    return bool_ret;
+  }
+public:
+  static const int64_t BLOCK_NUM = 2;
+  static const int64_t READ_SIZE = 4096;
+  int dir_fd_;
+  TestMmapLogStorage log_storage_;
+  DiskIteratorStorage iterator_storage_;
+};
+
+TEST_F(TestLogMmapRead, recycle_mapped_block)
+{
+  char *buf = NULL;
+  int64_t out_read_size = 0;
+  const int64_t read_size = READ_SIZE;
+  ASSERT_EQ(OB_SUCCESS, iterator_storage_.pread(0, read_size, buf, out_read_size));
+  EXPECT_TRUE(iterator_storage_.is_last_read_from_mmap_);
+  EXPECT_EQ(0, iterator_storage_.mmap_block_id_);
+  EXPECT_TRUE(check_data_(buf, 'a'));
+  EXPECT_EQ(OB_SUCCESS, iterator_storage_.check_read_data_valid());
+
+  // the mapping observes the zeroed block, the data read must be discarded
+  recycle_block_(0);
+  log_storage_.min_block_id_ = 1;
+  EXPECT_TRUE(check_data_(buf, '\0'));
+  EXPECT_EQ(OB_ERR_OUT_OF_LOWER_BOUND, iterator_storage_.check_read_data_valid());
+  EXPECT_FALSE(iterator_storage_.is_last_read_from_mmap_);
+  EXPECT_TRUE(NULL == iterator_storage_.mmap_addr_);
+  EXPECT_EQ(OB_ERR_OUT_OF_LOWER_BOUND, iterator_storage_.fallback_to_disk_read());
+  iterator_storage_.reuse(LSN(0));
+  EXPECT_EQ(OB_ERR_OUT_OF_LOWER_BOUND, iterator_storage_.pread(0, read_size, buf, out_read_size));
+
+  // the next block is still readable through mmap
+  iterator_storage_.reuse(LSN(PALF_BLOCK_SIZE));
+  ASSERT_EQ(OB_SUCCESS, iterator_storage_.pread(0, read_size, buf, out_read_size));
+  EXPECT_TRUE(iterator_storage_.is_last_read_from_mmap_);
+  EXPECT_EQ(1, iterator_storage_.mmap_block_id_);
+  EXPECT_TRUE(check_data_(buf, 'b'));
+  EXPECT_EQ(OB_SUCCESS, iterator_storage_.check_read_data_valid());
+}
+
+TEST_F(TestLogMmapRead, fallback_before_lower_bound_advanced)
+{
+  char *buf = NULL;
+  int64_t out_read_size = 0;
+  const int64_t read_size = READ_SIZE;
+  ASSERT_EQ(OB_SUCCESS, iterator_storage_.pread(0, read_size, buf, out_read_size));
+  EXPECT_TRUE(check_data_(buf, 'a'));
+
+  // the block has been zeroed, but the lower bound has not been advanced yet,
+  // the iterator fails to parse and falls back to pread
+  recycle_block_(0);
+  EXPECT_EQ(OB_SUCCESS, iterator_storage_.check_read_data_valid());
+  EXPECT_EQ(OB_SUCCESS, iterator_storage_.fallback_to_disk_read());
+  EXPECT_EQ(0, iterator_storage_.fallback_block_id_);
+  EXPECT_TRUE(NULL == iterator_storage_.mmap_addr_);
+  EXPECT_EQ(OB_NOT_SUPPORTED, iterator_storage_.fallback_to_disk_read());
+
+  iterator_storage_.reuse(LSN(0));
+  ASSERT_EQ(OB_SUCCESS, iterator_storage_.pread(0, read_size, buf, out_read_size));
+  EXPECT_FALSE(iterator_storage_.is_last_read_from_mmap_);
+  EXPECT_EQ(read_size, out_read_size);
+  EXPECT_TRUE(check_data_(buf, '\0'));
+
+  // the lower bound is advanced, pread reports the recycled block
+  log_storage_.min_block_id_ = 1;
+  iterator_storage_.reuse(LSN(0));
+  EXPECT_EQ(OB_ERR_OUT_OF_LOWER_BOUND, iterator_storage_.pread(0, read_size, buf, out_read_size));
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_log_mmap_read.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_mmap_read");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,376 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/utility/ob_unify_serialize.h"
+#include "lib/random/ob_random.h"
+#include "logservice/palf/log_define.h"
+#define private public
+#include "logservice/palf/log_req.h"
+#include "logservice/palf/log_rpc.h"
+#include "logservice/palf/log_net_service.h"
+#include "logservice/palf/log_request_handler.h"
+#undef private
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace palf;
+
+// the requests sent and received by the replicas of old version, which know
+// nothing about compression.
+struct OldLogPushReq {
+  OB_UNIS_VERSION(1);
+public:
+  int16_t push_log_type_;
+  int64_t msg_proposal_id_;
+  int64_t prev_log_proposal_id_;
+  LSN prev_lsn_;
+  LSN curr_lsn_;
+  LogWriteBuf write_buf_;
+};
+
+OB_DEF_SERIALIZE(OldLogPushReq)
+{
+  int ret = OB_SUCCESS;
+  int64_t new_pos = pos;
+  if (NULL == buf || pos < 0 || pos > buf_len) {
+    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_FAIL(serialization::encode_i16(buf, buf_len, new_pos, push_log_type_))
+             || OB_FAIL(serialization::encode_i64(buf, buf_len, new_pos, msg_proposal_id_))
+             || OB_FAIL(serialization::encode_i64(buf, buf_len, new_pos, prev_log_proposal_id_))
+             || OB_FAIL(prev_lsn_.serialize(buf, buf_len, new_pos))
+             || OB_FAIL(curr_lsn_.serialize(buf, buf_len, new_pos))
+             || OB_FAIL(write_buf_.serialize(buf, buf_len, new_pos))) {
+  } else {
+    pos = new_pos;
+  }
+  return ret;
+}
+
+OB_DEF_DESERIALIZE(OldLogPushReq)
+{
+  int ret = OB_SUCCESS;
+  int64_t new_pos = pos;
+  if (NULL == buf || pos < 0 || pos > data_len) {
+    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_FAIL(serialization::decode_i16(buf, data_len, new_pos, &push_log_type_))
+             || OB_FAIL(serialization::decode_i64(buf, data_len, new_pos, &msg_proposal_id_))
+             || OB_FAIL(serialization::decode_i64(buf, data_len, new_pos, &prev_log_proposal_id_))
+             || OB_FAIL(prev_lsn_.deserialize(buf, data_len, new_pos))
+             || OB_FAIL(curr_lsn_.deserialize(buf, data_len, new_pos))
+             || OB_FAIL(write_buf_.deserialize(buf, data_len, new_pos))) {
+  } else {
+    pos = new_pos;
+  }
+  return ret;
+}
+
+OB_DEF_SERIALIZE_SIZE(OldLogPushReq)
+{
+  int64_t size = 0;
+  size += serialization::encoded_length_i16(push_log_type_);
+  size += serialization::encoded_length_i64(msg_proposal_id_);
+  size += serialization::encoded_length_i64(prev_log_proposal_id_);
+  size += prev_lsn_.get_serialize_size();
+  size += curr_lsn_.get_serialize_size();
+  size += write_buf_.get_serialize_size();
+  return size;
+}
+
+struct OldLogPushResp {
+  OB_UNIS_VERSION(1);
+public:
+  OldLogPushResp() : msg_proposal_id_(INVALID_PROPOSAL_ID), lsn_() {}
+  int64_t msg_proposal_id_;
+  LSN lsn_;
+};
+OB_SERIALIZE_MEMBER(OldLogPushResp, msg_proposal_id_, lsn_);
+
+struct OldLogFetchReq {
+  OB_UNIS_VERSION(1);
+public:
+  OldLogFetchReq() : fetch_type_(0), msg_proposal_id_(INVALID_PROPOSAL_ID), prev_lsn_(), lsn_(),
+      fetch_log_size_(0), fetch_log_count_(0), accepted_mode_pid_(INVALID_PROPOSAL_ID) {}
+  int16_t fetch_type_;
+  int64_t msg_proposal_id_;
+  LSN prev_lsn_;
+  LSN lsn_;
+  int64_t fetch_log_size_;
+  int64_t fetch_log_count_;
+  int64_t accepted_mode_pid_;
+};
+OB_SERIALIZE_MEMBER(OldLogFetchReq, fetch_type_, msg_proposal_id_, prev_lsn_, lsn_, fetch_log_size_,
+    fetch_log_count_, accepted_mode_pid_);
+
+template <class SrcType, class DstType>
+int serialize_and_deserialize(const SrcType &src, char *buf, const int64_t buf_len, DstType &dst)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  const int64_t size = src.get_serialize_size();
+  if (OB_FAIL(src.serialize(buf, buf_len, pos))) {
+  } else if (pos != size) {
+    ret = OB_ERR_UNEXPECTED;
+  } else if (FALSE_IT(pos = 0)) {
+  } else if (OB_FAIL(dst.deserialize(buf, size, pos))) {
+  } else if (pos != size) {
+    ret = OB_ERR_UNEXPECTED;
+  }
+  return ret;
+}
+
+class TestLogTransportCompress : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    // compressible logs
+    for (int64_t i = 0; i < LOG_SIZE; i++) {
+      log_buf_[i] = 'a' + (i / 64) % 8;
+    }
+    ser_buf_ = static_cast<char *>(ob_malloc(SER_BUF_SIZE, "TestLogCompress"));
+    ASSERT_NE(nullptr, ser_buf_);
+  }
+  virtual void TearDown()
+  {
+    ob_free(ser_buf_);
+    ser_buf_ = NULL;
+  }
+  // the logs of a LogPushReq are split into two segments when they cross
+  // the tail of group buffer
+  void make_push_req(const int64_t log_size, LogPushReq &req)
+  {
+    const int64_t first_size = log_size / 3;
+    req.push_log_type_ = PUSH_LOG;
+    req.msg_proposal_id_ = 2;
+    req.prev_log_proposal_id_ = 1;
+    req.prev_lsn_ = LSN(100);
+    req.curr_lsn_ = LSN(200);
+    ASSERT_EQ(OB_SUCCESS, req.write_buf_.push_back(log_buf_, first_size));
+    ASSERT_EQ(OB_SUCCESS, req.write_buf_.push_back(log_buf_ + first_size, log_size - first_size));
+  }
+public:
+  static const int64_t LOG_SIZE = 64 * 1024;
+  static const int64_t SER_BUF_SIZE = 2 * LOG_SIZE;
+  char log_buf_[LOG_SIZE];
+  char *ser_buf_;
+};
+
+TEST_F(TestLogTransportCompress, push_req_compat)
+{
+  const int64_t log_size = LOG_SIZE;
+  LogPushReq req;
+  make_push_req(log_size, req);
+  // new -> old, the old replica ignores the compression info
+  OldLogPushReq old_req;
+  EXPECT_EQ(OB_SUCCESS, serialize_and_deserialize(req, ser_buf_, SER_BUF_SIZE, old_req));
+  EXPECT_EQ(req.push_log_type_, old_req.push_log_type_);
+  EXPECT_EQ(req.msg_proposal_id_, old_req.msg_proposal_id_);
+  EXPECT_EQ(req.prev_log_proposal_id_, old_req.prev_log_proposal_id_);
+  EXPECT_EQ(req.prev_lsn_, old_req.prev_lsn_);
+  EXPECT_EQ(req.curr_lsn_, old_req.curr_lsn_);
+  EXPECT_EQ(log_size, old_req.write_buf_.get_total_size());
+  EXPECT_EQ(0, MEMCMP(log_buf_, old_req.write_buf_.write_buf_[0].buf_, log_size));
+
+  // old -> new, the logs are taken as uncompressed
+  OldLogPushReq old_sent_req;
+  old_sent_req.push_log_type_ = req.push_log_type_;
+  old_sent_req.msg_proposal_id_ = req.msg_proposal_id_;
+  old_sent_req.prev_log_proposal_id_ = req.prev_log_proposal_id_;
+  old_sent_req.prev_lsn_ = req.prev_lsn_;
+  old_sent_req.curr_lsn_ = req.curr_lsn_;
+  EXPECT_EQ(OB_SUCCESS, old_sent_req.write_buf_.push_back(log_buf_, log_size));
+  LogPushReq new_req;
+  EXPECT_EQ(OB_SUCCESS, serialize_and_deserialize(old_sent_req, ser_buf_, SER_BUF_SIZE, new_req));
+  EXPECT_FALSE(new_req.is_compressed());
+  EXPECT_EQ(0, new_req.orig_data_len_);
+  EXPECT_EQ(req.push_log_type_, new_req.push_log_type_);
+  EXPECT_EQ(req.msg_proposal_id_, new_req.msg_proposal_id_);
+  EXPECT_EQ(req.prev_log_proposal_id_, new_req.prev_log_proposal_id_);
+  EXPECT_EQ(req.prev_lsn_, new_req.prev_lsn_);
+  EXPECT_EQ(req.curr_lsn_, new_req.curr_lsn_);
+  EXPECT_EQ(log_size, new_req.write_buf_.get_total_size());
+  EXPECT_EQ(0, MEMCMP(log_buf_, new_req.write_buf_.write_buf_[0].buf_, log_size));
+}
+
+TEST_F(TestLogTransportCompress, push_resp_compat)
+{
+  LogPushResp resp(2, LSN(300));
+  EXPECT_TRUE(resp.is_compress_supported_);
+  // new -> old
+  OldLogPushResp old_resp;
+  EXPECT_EQ(OB_SUCCESS, serialize_and_deserialize(resp, ser_buf_, SER_BUF_SIZE, old_resp));
+  EXPECT_EQ(resp.msg_proposal_id_, old_resp.msg_proposal_id_);
+  EXPECT_EQ(resp.lsn_, old_resp.lsn_);
+  // old -> new, the old replica doesn't support compression
+  LogPushResp new_resp;
+  EXPECT_EQ(OB_SUCCESS, serialize_and_deserialize(old_resp, ser_buf_, SER_BUF_SIZE, new_resp));
+  EXPECT_EQ(resp.msg_proposal_id_, new_resp.msg_proposal_id_);
+  EXPECT_EQ(resp.lsn_, new_resp.lsn_);
+  EXPECT_FALSE(new_resp.is_compress_supported_);
+}
+
+TEST_F(TestLogTransportCompress, fetch_req_compat)
+{
+  LogFetchReq req(FETCH_LOG_FOLLOWER, 2, LSN(100), LSN(200), 1024, 10, 3);
+  EXPECT_TRUE(req.is_compress_supported_);
+  // new -> old
+  OldLogFetchReq old_req;
+  EXPECT_EQ(OB_SUCCESS, serialize_and_deserialize(req, ser_buf_, SER_BUF_SIZE, old_req));
+  EXPECT_EQ(req.fetch_type_, old_req.fetch_type_);
+  EXPECT_EQ(req.msg_proposal_id_, old_req.msg_proposal_id_);
+  EXPECT_EQ(req.prev_lsn_, old_req.prev_lsn_);
+  EXPECT_EQ(req.lsn_, old_req.lsn_);
+  EXPECT_EQ(req.fetch_log_size_, old_req.fetch_log_size_);
+  EXPECT_EQ(req.fetch_log_count_, old_req.fetch_log_count_);
+  EXPECT_EQ(req.accepted_mode_pid_, old_req.accepted_mode_pid_);
+  // old -> new, the old replica doesn't support compression
+  LogFetchReq new_req;
+  EXPECT_EQ(OB_SUCCESS, serialize_and_deserialize(old_req, ser_buf_, SER_BUF_SIZE, new_req));
+  EXPECT_EQ(req.fetch_type_, new_req.fetch_type_);
+  EXPECT_EQ(req.msg_proposal_id_, new_req.msg_proposal_id_);
+  EXPECT_EQ(req.prev_lsn_, new_req.prev_lsn_);
+  EXPECT_EQ(req.lsn_, new_req.lsn_);
+  EXPECT_EQ(req.fetch_log_size_, new_req.fetch_log_size_);
+  EXPECT_EQ(req.fetch_log_count_, new_req.fetch_log_count_);
+  EXPECT_EQ(req.accepted_mode_pid_, new_req.accepted_mode_pid_);
+  EXPECT_FALSE(new_req.is_compress_supported_);
+}
+
+TEST_F(TestLogTransportCompress, compress_round_trip)
+{
+  LogRpc log_rpc;
+  LogNetService net_service;
+  LogRequestHandler handler(NULL);
+  net_service.palf_id_ = 1;
+  net_service.log_rpc_ = &log_rpc;
+  // don't refresh the compressor from config
+  log_rpc.last_refresh_config_ts_ = INT64_MAX;
+  const ObCompressorType compressor_types[] = {LZ4_COMPRESSOR, ZSTD_COMPRESSOR, ZSTD_1_3_8_COMPRESSOR};
+  for (int64_t i = 0; i < ARRAYSIZEOF(compressor_types); i++) {
+    const int64_t log_size = LOG_SIZE;
+    log_rpc.transport_compressor_type_ = compressor_types[i];
+    LogPushReq req;
+    LogPushReq compressed_req;
+    char *compress_buf = NULL;
+    make_push_req(log_size, req);
+    EXPECT_EQ(OB_SUCCESS, net_service.compress_push_log_req_(req, compressed_req, compress_buf));
+    EXPECT_TRUE(compressed_req.is_compressed());
+    EXPECT_EQ(compressor_types[i], compressed_req.compressor_type_);
+    EXPECT_EQ(log_size, compressed_req.orig_data_len_);
+    EXPECT_GT(log_size, compressed_req.write_buf_.get_total_size());
+    EXPECT_EQ(req.curr_lsn_, compressed_req.curr_lsn_);
+
+    // the receiver decompresses the logs before receive_log
+    LogPushReq received_req;
+    EXPECT_EQ(OB_SUCCESS, serialize_and_deserialize(compressed_req, ser_buf_, SER_BUF_SIZE, received_req));
+    EXPECT_TRUE(received_req.is_compressed());
+    const char *buf = received_req.write_buf_.write_buf_[0].buf_;
+    int64_t buf_len = received_req.write_buf_.write_buf_[0].buf_len_;
+    char *decompress_buf = NULL;
+    EXPECT_EQ(OB_SUCCESS, handler.decompress_log_if_needed_(received_req, buf, buf_len, decompress_buf));
+    EXPECT_NE(nullptr, decompress_buf);
+    EXPECT_EQ(log_size, buf_len);
+    EXPECT_EQ(0, MEMCMP(log_buf_, buf, log_size));
+    share::mtl_free(decompress_buf);
+    net_service.free_compress_buf_(compress_buf);
+
+    // broken compressed logs are rejected
+    received_req.orig_data_len_ = log_size - 1;
+    buf = received_req.write_buf_.write_buf_[0].buf_;
+    buf_len = received_req.write_buf_.write_buf_[0].buf_len_;
+    EXPECT_NE(OB_SUCCESS, handler.decompress_log_if_needed_(received_req, buf, buf_len, decompress_buf));
+    EXPECT_EQ(nullptr, decompress_buf);
+  }
+}
+
+TEST_F(TestLogTransportCompress, skip_useless_compression)
+{
+  LogRpc log_rpc;
+  LogNetService net_service;
+  net_service.palf_id_ = 1;
+  net_service.log_rpc_ = &log_rpc;
+  log_rpc.last_refresh_config_ts_ = INT64_MAX;
+  log_rpc.transport_compressor_type_ = LZ4_COMPRESSOR;
+  // small logs
+  {
+    LogPushReq req;
+    LogPushReq compressed_req;
+    char *compress_buf = NULL;
+    make_push_req(LogNetService::MIN_COMPRESS_LOG_SIZE - 1, req);
+    EXPECT_EQ(OB_SUCCESS, net_service.compress_push_log_req_(req, compressed_req, compress_buf));
+    EXPECT_FALSE(compressed_req.is_compressed());
+    EXPECT_EQ(nullptr, compress_buf);
+  }
+  // incompressible logs
+  {
+    for (int64_t i = 0; i < LOG_SIZE; i++) {
+      log_buf_[i] = static_cast<char>(ObRandom::rand(0, 255));
+    }
+    LogPushReq req;
+    LogPushReq compressed_req;
+    char *compress_buf = NULL;
+    make_push_req(LOG_SIZE, req);
+    EXPECT_EQ(OB_SUCCESS, net_service.compress_push_log_req_(req, compressed_req, compress_buf));
+    EXPECT_FALSE(compressed_req.is_compressed());
+    EXPECT_EQ(nullptr, compress_buf);
+  }
+  // uncompressed logs are passed to receive_log as they are
+  {
+    LogRequestHandler handler(NULL);
+    LogPushReq req;
+    make_push_req(LOG_SIZE, req);
+    const char *buf = log_buf_;
+    int64_t buf_len = LOG_SIZE;
+    char *decompress_buf = NULL;
+    EXPECT_EQ(OB_SUCCESS, handler.decompress_log_if_needed_(req, buf, buf_len, decompress_buf));
+    EXPECT_EQ(nullptr, decompress_buf);
+    EXPECT_EQ(log_buf_, buf);
+  }
+}
+
+TEST_F(TestLogTransportCompress, peer_stats_bounded)
+{
+  LogRpc log_rpc;
+  const int64_t max_peer_count = LogRpc::MAX_PEER_COUNT;
+  for (int64_t i = 0; i < max_peer_count + 10; i++) {
+    ObAddr server(ObAddr::IPV4, "127.0.0.1", static_cast<int32_t>(1000 + i));
+    log_rpc.set_compress_supported(server);
+    EXPECT_TRUE(log_rpc.is_compress_supported(server));
+  }
+  EXPECT_EQ(max_peer_count, log_rpc.peer_stats_.count());
+
+  // idle servers are forgot
+  ObAddr active_server(ObAddr::IPV4, "127.0.0.1", 999);
+  for (int64_t i = 0; i < log_rpc.peer_stats_.count(); i++) {
+    log_rpc.peer_stats_[i].last_active_ts_ -= LogRpc::PEER_EXPIRE_INTERVAL + 1;
+  }
+  log_rpc.last_purge_peer_ts_ = OB_INVALID_TIMESTAMP;
+  log_rpc.set_compress_supported(active_server);
+  EXPECT_EQ(1, log_rpc.peer_stats_.count());
+  EXPECT_TRUE(log_rpc.is_compress_supported(active_server));
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_log_transport_compress.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_transport_compress");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include "lib/container/ob_se_array.h"
+#include "lib/file/file_directory_utils.h"
+#define private public
+#include "logservice/palf/palf_env_impl.h"
+#undef private
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace palf;
+
+TEST(TestPalfEnvReload, sort_palf_ids)
+{
+  ObSEArray<int64_t, 16> palf_ids;
+  PalfEnvImpl::sort_palf_ids_for_reload_(palf_ids);
+  EXPECT_EQ(0, palf_ids.count());
+
+  const int64_t ids[] = {1003, 1001, 1, 1002, 1004};
+  for (int64_t i = 0; i < 5; i++) {
+    EXPECT_EQ(OB_SUCCESS, palf_ids.push_back(ids[i]));
+  }
+  PalfEnvImpl::sort_palf_ids_for_reload_(palf_ids);
+  // the sys log stream is reloaded first, then the others in ascending order
+  const int64_t expected_ids[] = {1, 1001, 1002, 1003, 1004};
+  for (int64_t i = 0; i < 5; i++) {
+    EXPECT_EQ(expected_ids[i], palf_ids.at(i));
+  }
+
+  palf_ids.reset();
+  EXPECT_EQ(OB_SUCCESS, palf_ids.push_back(1002));
+  EXPECT_EQ(OB_SUCCESS, palf_ids.push_back(1001));
+  PalfEnvImpl::sort_palf_ids_for_reload_(palf_ids);
+  EXPECT_EQ(1001, palf_ids.at(0));
+  EXPECT_EQ(1002, palf_ids.at(1));
+}
+
+TEST(TestPalfEnvReload, collect_palf_ids)
+{
+  char path[MAX_PATH_SIZE] = {'\0'};
+  const char *log_dir = "test_palf_env_reload_dir";
+  PalfEnvImpl *palf_env_impl = OB_NEW(PalfEnvImpl, "TestPalfEnv");
+  ASSERT_TRUE(NULL != palf_env_impl);
+  FileDirectoryUtils::delete_directory_rec(log_dir);
+  ASSERT_EQ(OB_SUCCESS, FileDirectoryUtils::create_directory(log_dir));
+  strncpy(palf_env_impl->log_dir_, log_dir, MAX_PATH_SIZE - 1);
+
+  const int64_t ids[] = {1002, 1, 1001};
+  for (int64_t i = 0; i < 3; i++) {
+    snprintf(path, MAX_PATH_SIZE, "%s/%ld", log_dir, ids[i]);
+    ASSERT_EQ(OB_SUCCESS, FileDirectoryUtils::create_directory(path));
+  }
+  // neither a tmp directory nor a regular file is a palf instance
+  snprintf(path, MAX_PATH_SIZE, "%s/%s", log_dir, "1003.tmp");
+  ASSERT_EQ(OB_SUCCESS, FileDirectoryUtils::create_directory(path));
+  snprintf(path, MAX_PATH_SIZE, "%s/%s", log_dir, "1004");
+  const int fd = ::open(path, O_CREAT | O_RDWR, 0644);
+  ASSERT_LE(0, fd);
+  ::close(fd);
+
+  ObSEArray<int64_t, 16> palf_ids;
+  PalfEnvImpl::ReloadPalfHandleImplFunctor functor(palf_env_impl, palf_ids);
+  EXPECT_EQ(OB_SUCCESS, scan_dir(log_dir, functor));
+  EXPECT_EQ(3, palf_ids.count());
+  PalfEnvImpl::sort_palf_ids_for_reload_(palf_ids);
+  EXPECT_EQ(1, palf_ids.at(0));
+  EXPECT_EQ(1001, palf_ids.at(1));
+  EXPECT_EQ(1002, palf_ids.at(2));
+
+  FileDirectoryUtils::delete_directory_rec(log_dir);
+  OB_DELETE(PalfEnvImpl, "TestPalfEnv", palf_env_impl);
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_palf_env_reload.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_palf_env_reload");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
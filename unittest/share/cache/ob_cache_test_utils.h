@@ -579,6 +579,77 @@ private:
   ObKVCache<TestKey, TestValue> cache_;
 };
 
+template<int64_t V_SIZE>
+class TestKVCacheValueReader : public ObIKVCacheValueReader
+{
+public:
+  typedef TestKVCacheValue<V_SIZE> TestValue;
+  TestKVCacheValueReader() : v_(0) {}
+  virtual int read(const ObIKVCacheValue &value)
+  {
+    v_ = static_cast<const TestValue &>(value).v_;
+    return OB_SUCCESS;
+  }
+  uint64_t v_;
+};
+
+// all threads get the same key, by get() with handle or by read() without handle
+template<int64_t K_SIZE, int64_t V_SIZE>
+class ObCacheHotKeyGetStress : public share::ObThreadPool
+{
+public:
+  typedef TestKVCacheKey<K_SIZE> TestKey;
+  typedef TestKVCacheValue<V_SIZE> TestValue;
+
+  ObCacheHotKeyGetStress()
+    : cache_(NULL), use_read_(false), get_cnt_(0), fail_cnt_(0)
+  {
+  }
+
+  int init(ObKVCache<TestKey, TestValue> &cache, const TestKey &key, const bool use_read)
+  {
+    cache_ = &cache;
+    key_ = key;
+    use_read_ = use_read;
+    get_cnt_ = 0;
+    fail_cnt_ = 0;
+    return OB_SUCCESS;
+  }
+
+  virtual void run1()
+  {
+    int ret = OB_SUCCESS;
+    int64_t get_cnt = 0;
+    const TestValue *pvalue = NULL;
+    ObKVCacheHandle handle;
+    TestKVCacheValueReader<V_SIZE> reader;
+    while (!has_set_stop()) {
+      for (int64_t i = 0; i < 1024; ++i) {
+        if (use_read_) {
+          ret = cache_->read(key_, reader);
+        } else {
+          ret = cache_->get(key_, pvalue, handle);
+        }
+        if (OB_FAIL(ret)) {
+          ATOMIC_INC(&fail_cnt_);
+        }
+      }
+      get_cnt += 1024;
+    }
+    handle.reset();
+    ATOMIC_AAF(&get_cnt_, get_cnt);
+  }
+
+  int64_t get_get_count() const { return ATOMIC_LOAD(&get_cnt_); }
+  int64_t get_fail_count() const { return ATOMIC_LOAD(&fail_cnt_); }
+private:
+  ObKVCache<TestKey, TestValue> *cache_;
+  TestKey key_;
+  bool use_read_;
+  int64_t get_cnt_;
+  int64_t fail_cnt_;
+};
+
 template<int64_t K_SIZE, int64_t V_SIZE>
 class ObWorkingSetStress : public share::ObThreadPool
 {
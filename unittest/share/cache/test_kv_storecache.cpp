@@ -174,6 +174,133 @@ TEST(ObKVGlobalCache, normal)
   ObKVGlobalCache::get_instance().destroy();
 }
 
+TEST(ObKVCacheFrequencySketch, normal)
+{
+  ObKVCacheFrequencySketch sketch;
+  ASSERT_EQ(0, sketch.estimate(100));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, sketch.init(1, "TestSketch"));
+  ASSERT_EQ(OB_SUCCESS, sketch.init(1024, "TestSketch"));
+  ASSERT_EQ(OB_INIT_TWICE, sketch.init(1024, "TestSketch"));
+
+  for (int64_t i = 0; i < 20; ++i) {
+    sketch.increment(100);
+  }
+  ASSERT_EQ(ObKVCacheFrequencySketch::MAX_FREQUENCY, sketch.estimate(100));
+  sketch.increment(200);
+  ASSERT_LE(1, sketch.estimate(200));
+
+  // aging, all counters are halved when increments reach sample size
+  const int64_t reset_cnt = sketch.reset_cnt_;
+  for (uint64_t key = 1000; key < 100000 && reset_cnt == sketch.reset_cnt_; ++key) {
+    sketch.increment(key);
+  }
+  ASSERT_EQ(reset_cnt + 1, sketch.reset_cnt_);
+  ASSERT_EQ(ObKVCacheFrequencySketch::MAX_FREQUENCY / 2, sketch.estimate(100));
+
+  sketch.destroy();
+  ASSERT_EQ(0, sketch.estimate(100));
+}
+
+TEST(ObKVCacheMissRatioCurve, normal)
+{
+  ObKVCacheMissRatioCurve *mrc = new ObKVCacheMissRatioCurve();
+  const int64_t avg_item_size = 100;
+  const int64_t point_size = mrc->get_point_size(avg_item_size);
+  double utility = 0;
+  ASSERT_EQ(0, mrc->get_hit_ratio(0));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, mrc->get_marginal_utility(0, avg_item_size, utility));
+
+  // loop over 400 sampled keys, the reuse distance of all keys is about 400 after the first round
+  ObArray<uint64_t> keys;
+  for (uint64_t hash = 1; keys.count() < 400; ++hash) {
+    if (ObKVCacheMissRatioCurve::is_sampled(hash)) {
+      ASSERT_EQ(OB_SUCCESS, keys.push_back(hash));
+    }
+  }
+  for (int64_t round = 0; round < 10; ++round) {
+    for (int64_t i = 0; i < keys.count(); ++i) {
+      mrc->record(keys.at(i));
+    }
+  }
+  ASSERT_EQ(4000, mrc->get_access_cnt());
+  ASSERT_GT(0.1, mrc->get_hit_ratio(0));
+  ASSERT_LT(0.7, mrc->get_hit_ratio(1));
+  ASSERT_EQ(mrc->get_hit_ratio(1), mrc->get_hit_ratio(ObKVCacheMissRatioCurve::CURVE_POINT_NUM - 1));
+
+  // growing the cache from the first point gains most hits, and nothing after the second point
+  double next_utility = 0;
+  ASSERT_EQ(OB_SUCCESS, mrc->get_marginal_utility(0, avg_item_size, utility));
+  ASSERT_EQ(OB_SUCCESS, mrc->get_marginal_utility(point_size, avg_item_size, next_utility));
+  ASSERT_LT(utility * 10, next_utility);
+  ASSERT_EQ(OB_SUCCESS, mrc->get_marginal_utility(2 * point_size, avg_item_size, utility));
+  ASSERT_EQ(0, utility);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, mrc->get_marginal_utility(
+      ObKVCacheMissRatioCurve::CURVE_POINT_NUM * point_size, avg_item_size, utility));
+
+  mrc->decay();
+  ASSERT_EQ(2000, mrc->get_access_cnt());
+
+  // the curve spans 4 times the kvs in cache, at a lower sample rate for a larger cache
+  mrc->resize(100000);
+  ASSERT_EQ(ObKVCacheMissRatioCurve::MIN_SAMPLE_SHIFT, mrc->get_sample_shift());
+  ASSERT_EQ(2000, mrc->get_access_cnt());
+  mrc->resize(10000000);
+  ASSERT_EQ(ObKVCacheMissRatioCurve::MIN_SAMPLE_SHIFT + 6, mrc->get_sample_shift());
+  ASSERT_EQ(0, mrc->get_access_cnt());
+  ASSERT_LE(4 * 10000000 * avg_item_size,
+      ObKVCacheMissRatioCurve::CURVE_POINT_NUM * mrc->get_point_size(avg_item_size));
+  // keys not sampled by the current rate are dropped
+  for (int64_t i = 0; i < keys.count(); ++i) {
+    mrc->record(keys.at(i));
+  }
+  ASSERT_GT(keys.count() / 4, mrc->get_access_cnt());
+  // shrinking to half keeps the rate, shrinking to a quarter raises it
+  mrc->resize(5000000);
+  ASSERT_EQ(ObKVCacheMissRatioCurve::MIN_SAMPLE_SHIFT + 6, mrc->get_sample_shift());
+  mrc->resize(2500000);
+  ASSERT_EQ(ObKVCacheMissRatioCurve::MIN_SAMPLE_SHIFT + 4, mrc->get_sample_shift());
+  delete mrc;
+}
+
+TEST(ObKVGlobalCache, rebalance_weight)
+{
+  // tenant 1001 has a hot cache and four cold caches, tenant 1002 has a cache without estimate
+  // and a single cache with estimate
+  ObKVCacheInst insts[7];
+  const double utilities[7] = {0, 0, 1000, 0, 0, -1, 500};
+  for (int64_t i = 0; i < 7; ++i) {
+    insts[i].tenant_id_ = i < 5 ? 1001 : 1002;
+  }
+  insts[5].status_.rebalance_weight_ = 2.0;
+  ObArray<ObKVGlobalCache::RebalanceInfo> infos;
+  for (int64_t i = 6; i >= 0; --i) {
+    ObKVGlobalCache::RebalanceInfo info;
+    info.inst_ = &insts[i];
+    info.utility_ = utilities[i];
+    ASSERT_EQ(OB_SUCCESS, infos.push_back(info));
+  }
+
+  // the weight moves half way toward its target
+  ObKVGlobalCache::update_rebalance_weight(infos);
+  ASSERT_DOUBLE_EQ(2.5, insts[2].status_.rebalance_weight_);
+  ASSERT_DOUBLE_EQ(0.625, insts[0].status_.rebalance_weight_);
+  ASSERT_DOUBLE_EQ(1.5, insts[5].status_.rebalance_weight_);
+  ASSERT_DOUBLE_EQ(1.0, insts[6].status_.rebalance_weight_);
+
+  // the target is clamped, the hot cache would be 5 times the average
+  for (int64_t round = 0; round < 64; ++round) {
+    ObKVGlobalCache::update_rebalance_weight(infos);
+  }
+  ASSERT_DOUBLE_EQ(ObKVGlobalCache::MAX_REBALANCE_WEIGHT, insts[2].status_.rebalance_weight_);
+  for (int64_t i = 0; i < 5; ++i) {
+    if (2 != i) {
+      ASSERT_DOUBLE_EQ(ObKVGlobalCache::MIN_REBALANCE_WEIGHT, insts[i].status_.rebalance_weight_);
+    }
+  }
+  ASSERT_DOUBLE_EQ(1.0, insts[5].status_.rebalance_weight_);
+  ASSERT_DOUBLE_EQ(1.0, insts[6].status_.rebalance_weight_);
+}
+
 /*
 TEST(TestKVCacheValue, wash_stress)
 {
@@ -277,6 +404,95 @@ TEST_F(TestKVCache, test_hazard_version)
   }
 }
 
+TEST_F(TestKVCache, test_read)
+{
+  static const int64_t K_SIZE = 16;
+  static const int64_t V_SIZE = 64;
+  typedef TestKVCacheKey<K_SIZE> TestKey;
+  typedef TestKVCacheValue<V_SIZE> TestValue;
+
+  ObKVCache<TestKey, TestValue> cache;
+  TestKey key;
+  TestValue value;
+  TestKVCacheValueReader<V_SIZE> reader;
+  ASSERT_EQ(OB_SUCCESS, cache.init("test_read"));
+
+  key.v_ = 1234;
+  key.tenant_id_ = tenant_id_;
+  value.v_ = 4321;
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.read(key, reader));
+  ASSERT_EQ(OB_SUCCESS, cache.put(key, value));
+  ASSERT_EQ(OB_SUCCESS, cache.read(key, reader));
+  ASSERT_EQ(4321, reader.v_);
+
+  // ref count of memblock is not changed by read
+  ObKVCacheHandle handle;
+  const TestValue *pvalue = NULL;
+  ASSERT_EQ(OB_SUCCESS, cache.get(key, pvalue, handle));
+  const int64_t ref_cnt = handle.mb_handle_->get_ref_cnt();
+  for (int64_t i = 0; i < 100; ++i) {
+    ASSERT_EQ(OB_SUCCESS, cache.read(key, reader));
+  }
+  ASSERT_EQ(ref_cnt, handle.mb_handle_->get_ref_cnt());
+  handle.reset();
+
+  ASSERT_EQ(OB_SUCCESS, cache.erase(key));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.read(key, reader));
+  cache.destroy();
+}
+
+TEST_F(TestKVCache, test_hot_key_read_scalability)
+{
+  static const int64_t K_SIZE = 16;
+  static const int64_t V_SIZE = 64;
+  typedef TestKVCacheKey<K_SIZE> TestKey;
+  typedef TestKVCacheValue<V_SIZE> TestValue;
+  static const int64_t MAX_THREAD_CNT = 16;
+  static const int64_t MIN_THREAD_CNT_TO_CHECK = 4;
+  static const int64_t RUN_TIME_US = 1000 * 1000;
+
+  ObKVCache<TestKey, TestValue> cache;
+  TestKey key;
+  TestValue value;
+  ASSERT_EQ(OB_SUCCESS, cache.init("test_hot_key"));
+  key.v_ = 1;
+  key.tenant_id_ = tenant_id_;
+  ASSERT_EQ(OB_SUCCESS, cache.put(key, value));
+
+  // throughput of get and read with a single thread and with one thread per cpu
+  const int64_t thread_cnts[2] = {1, MIN(MAX_THREAD_CNT, get_cpu_num())};
+  int64_t get_qps[2] = {0, 0};
+  int64_t read_qps[2] = {0, 0};
+  for (int64_t i = 0; i < 2; ++i) {
+    for (int64_t use_read = 0; use_read < 2; ++use_read) {
+      ObCacheHotKeyGetStress<K_SIZE, V_SIZE> stress;
+      ASSERT_EQ(OB_SUCCESS, stress.init(cache, key, use_read));
+      stress.set_thread_count(thread_cnts[i]);
+      const int64_t start = ObTimeUtility::current_time();
+      ASSERT_EQ(OB_SUCCESS, stress.start());
+      usleep(RUN_TIME_US);
+      stress.stop();
+      stress.wait();
+      const int64_t cost = ObTimeUtility::current_time() - start;
+      ASSERT_EQ(0, stress.get_fail_count());
+      if (use_read) {
+        read_qps[i] = stress.get_get_count() * 1000000 / cost;
+      } else {
+        get_qps[i] = stress.get_get_count() * 1000000 / cost;
+      }
+    }
+    COMMON_LOG(INFO, "hot key get throughput", "thread_cnt", thread_cnts[i],
+               "get_qps", get_qps[i], "read_qps", read_qps[i]);
+  }
+  if (thread_cnts[1] >= MIN_THREAD_CNT_TO_CHECK) {
+    // read does not touch the ref count of memblock, so it scales with threads, and at least
+    // as well as get, whose ref count bounces between cores
+    ASSERT_GT(read_qps[1], read_qps[0]);
+    ASSERT_GE(read_qps[1] * get_qps[0], get_qps[1] * read_qps[0]);
+  }
+  cache.destroy();
+}
+
 TEST_F(TestKVCache, test_func)
 {
   static const int64_t K_SIZE = 16;
@@ -401,6 +617,53 @@ TEST_F(TestKVCache, test_func)
   ASSERT_NE(OB_SUCCESS, ret);
 }
 
+TEST_F(TestKVCache, test_admission)
+{
+  typedef TestKVCacheKey<16> TestKey;
+  typedef TestKVCacheValue<64> TestValue;
+  ObKVCache<TestKey, TestValue> cache;
+  ObKVGlobalCache &global_cache = ObKVGlobalCache::get_instance();
+  ObKVCacheInst inst;
+  TestKey key;
+  key.v_ = 1234;
+  key.tenant_id_ = tenant_id_;
+  ASSERT_EQ(OB_SUCCESS, cache.init("test_admission"));
+  const int64_t cache_id = cache.cache_id_;
+  // no sketch is allocated until admission is enabled
+  ASSERT_FALSE(global_cache.sketches_[cache_id].is_inited());
+  {
+    lib::ObMutexGuard guard(global_cache.mutex_);
+    global_cache.init_sketch(cache_id);
+  }
+  ASSERT_TRUE(global_cache.sketches_[cache_id].is_inited());
+
+  // admission is disabled
+  global_cache.enable_admission_ = false;
+  inst.status_.need_admission_ = true;
+  ASSERT_TRUE(global_cache.admit(cache_id, key, inst));
+  ASSERT_TRUE(cache.admit(key));
+  global_cache.record_access(cache_id, key);
+  ASSERT_EQ(0, global_cache.sketches_[cache_id].estimate(key.hash()));
+
+  // tenant cache is not being washed
+  global_cache.enable_admission_ = true;
+  inst.status_.need_admission_ = false;
+  ASSERT_TRUE(global_cache.admit(cache_id, key, inst));
+
+  // only keys accessed more than once are admitted
+  inst.status_.need_admission_ = true;
+  ASSERT_FALSE(global_cache.admit(cache_id, key, inst));
+  global_cache.record_access(cache_id, key);
+  ASSERT_FALSE(global_cache.admit(cache_id, key, inst));
+  global_cache.record_access(cache_id, key);
+  ASSERT_TRUE(global_cache.admit(cache_id, key, inst));
+  ASSERT_EQ(1, inst.status_.total_admit_cnt_.value());
+  ASSERT_EQ(2, inst.status_.total_reject_cnt_.value());
+
+  global_cache.enable_admission_ = false;
+  cache.destroy();
+}
+
 TEST_F(TestKVCache, test_large_kv)
 {
   static const int64_t K_SIZE = 16;
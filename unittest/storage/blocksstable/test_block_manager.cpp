@@ -12,6 +12,8 @@
 
 #include <sys/vfs.h>
 #include <sys/statvfs.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <gtest/gtest.h>
 #include <algorithm>
 
@@ -22,6 +24,10 @@
 
 #include "storage/blocksstable/ob_data_file_prepare.h"
 #include "storage/blocksstable/ob_tmp_file.h"
+#include "storage/blocksstable/ob_micro_block_writer.h"
+#include "storage/blocksstable/ob_micro_block_reader.h"
+#include "storage/ob_micro_block_handle_mgr.h"
+#include "lib/signal/ob_signal_struct.h"
 #include "share/ob_simple_mem_limit_getter.h"
 #include "observer/omt/ob_worker_processor.h"
 #include "observer/ob_srv_network_frame.h"
@@ -45,7 +51,13 @@ public:
   virtual void TearDown() override;
 private:
   int init_multi_tenant();
+  // a micro block of ROW_CNT int rows, without compression and encryption
+  void build_micro_block(ObIAllocator &allocator, char *&buf, int64_t &size);
+  void check_micro_block(ObIAllocator &allocator, const ObMicroBlockData &block_data);
 private:
+  static const int64_t COLUMN_CNT = 3;
+  static const int64_t ROWKEY_COL_CNT = 1;
+  static const int64_t ROW_CNT = 100;
   common::ObAddr addr_;
   omt::ObMultiTenant multi_tenant_;
 };
@@ -82,6 +94,67 @@ void TestBlockManager::TearDown()
   TestDataFilePrepare::TearDown();
 }
 
+void TestBlockManager::build_micro_block(ObIAllocator &allocator, char *&buf, int64_t &size)
+{
+  ObMicroBlockWriter writer;
+  ASSERT_EQ(OB_SUCCESS, writer.init(OB_DEFAULT_MACRO_BLOCK_SIZE, ROWKEY_COL_CNT, COLUMN_CNT));
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator, COLUMN_CNT));
+  ObObj obj;
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    for (int64_t j = 0; j < COLUMN_CNT; ++j) {
+      obj.set_int(i * COLUMN_CNT + j);
+      ASSERT_EQ(OB_SUCCESS, row.storage_datums_[j].from_obj_enhance(obj));
+    }
+    row.row_flag_.set_flag(ObDmlFlag::DF_INSERT);
+    row.count_ = COLUMN_CNT;
+    ASSERT_EQ(OB_SUCCESS, writer.append_row(row));
+  }
+  ObMicroBlockDesc micro_desc;
+  ASSERT_EQ(OB_SUCCESS, writer.build_micro_block_desc(micro_desc));
+  ObMicroBlockHeader *header = const_cast<ObMicroBlockHeader *>(micro_desc.header_);
+  ASSERT_NE(nullptr, header);
+  header->data_length_ = micro_desc.buf_size_;
+  header->data_zlength_ = micro_desc.buf_size_;
+  header->data_checksum_ = ob_crc64_sse42(0, micro_desc.buf_, micro_desc.buf_size_);
+  header->original_length_ = micro_desc.buf_size_;
+  header->set_header_checksum();
+
+  size = header->header_size_ + micro_desc.buf_size_;
+  buf = static_cast<char *>(allocator.alloc(size));
+  ASSERT_NE(nullptr, buf);
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, header->serialize(buf, size, pos));
+  MEMCPY(buf + pos, micro_desc.buf_, micro_desc.buf_size_);
+}
+
+void TestBlockManager::check_micro_block(ObIAllocator &allocator, const ObMicroBlockData &block_data)
+{
+  common::ObSEArray<share::schema::ObColDesc, COLUMN_CNT> columns;
+  for (int64_t i = 0; i < COLUMN_CNT; ++i) {
+    share::schema::ObColDesc desc;
+    desc.col_id_ = OB_APP_MIN_COLUMN_ID + i;
+    desc.col_type_.set_int();
+    desc.col_order_ = ObOrderType::ASC;
+    ASSERT_EQ(OB_SUCCESS, columns.push_back(desc));
+  }
+  ObTableReadInfo read_info;
+  ASSERT_EQ(OB_SUCCESS, read_info.init(allocator, COLUMN_CNT, ROWKEY_COL_CNT, lib::is_oracle_mode(), columns));
+  ObMicroBlockReader reader;
+  ASSERT_EQ(OB_SUCCESS, reader.init(block_data, read_info));
+  int64_t row_count = 0;
+  ASSERT_EQ(OB_SUCCESS, reader.get_row_count(row_count));
+  ASSERT_EQ(ROW_CNT, row_count);
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator, COLUMN_CNT));
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, reader.get_row(i, row));
+    for (int64_t j = 0; j < COLUMN_CNT; ++j) {
+      ASSERT_EQ(i * COLUMN_CNT + j, row.storage_datums_[j].get_int());
+    }
+  }
+}
+
 TEST_F(TestBlockManager, test_inc_and_dec_ref_cnt)
 {
   int ret = OB_SUCCESS;
@@ -380,6 +453,91 @@ TEST_F(TestBlockManager, macor_block_seq)
   ASSERT_EQ(2, blk_seq);
 }
 
+TEST_F(TestBlockManager, test_mmap_micro_block_data)
+{
+  ObArenaAllocator allocator;
+  char *micro_buf = nullptr;
+  int64_t micro_size = 0;
+  build_micro_block(allocator, micro_buf, micro_size);
+  const int64_t micro_offset = DIO_READ_ALIGN_SIZE + 100;
+  char *io_buf = static_cast<char *>(allocator.alloc(OB_DEFAULT_MACRO_BLOCK_SIZE));
+  ASSERT_NE(nullptr, io_buf);
+  MEMSET(io_buf, 0, OB_DEFAULT_MACRO_BLOCK_SIZE);
+  MEMCPY(io_buf + micro_offset, micro_buf, micro_size);
+  ObMacroBlockWriteInfo write_info;
+  ObMacroBlockHandle write_handle;
+  write_info.io_desc_.set_category(ObIOCategory::SYS_IO);
+  write_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_COMPACT_WRITE);
+  write_info.buffer_ = io_buf;
+  write_info.size_ = OB_DEFAULT_MACRO_BLOCK_SIZE;
+  ASSERT_EQ(OB_SUCCESS, ObBlockManager::write_block(write_info, write_handle));
+  const MacroBlockId macro_id = write_handle.get_macro_id();
+
+  // as the prefetcher does on block cache miss
+  ObMicroBlockDataHandle micro_handle;
+  micro_handle.des_meta_.compressor_type_ = ObCompressorType::NONE_COMPRESSOR;
+  micro_handle.des_meta_.encrypt_id_ = ObAesOpMode::ob_invalid_mode;
+  micro_handle.micro_info_.set(static_cast<int32_t>(micro_offset), static_cast<int32_t>(micro_size));
+  ASSERT_EQ(OB_SUCCESS, micro_handle.mmap_block_data(OB_SERVER_TENANT_ID, macro_id));
+  ASSERT_EQ(ObSSTableMicroBlockState::IN_BLOCK_MMAP, micro_handle.block_state_);
+  ASSERT_EQ(macro_id, micro_handle.macro_block_id_);
+  ObBlockManager::BlockInfo block_info;
+  ASSERT_EQ(OB_SUCCESS, OB_SERVER_BLOCK_MGR.block_map_.get(macro_id, block_info));
+  ASSERT_EQ(2, block_info.mem_ref_cnt_);
+
+  // the handle keeps the macro block referenced while the mapping is decoded
+  write_handle.reset();
+  ASSERT_EQ(OB_SUCCESS, OB_SERVER_BLOCK_MGR.block_map_.get(macro_id, block_info));
+  ASSERT_EQ(1, block_info.mem_ref_cnt_);
+  ObMacroBlockReader block_reader;
+  ObMicroBlockData block_data;
+  ASSERT_EQ(OB_SUCCESS, micro_handle.get_data_block_data(block_reader, block_data));
+  ASSERT_EQ(micro_handle.mmap_buf_, block_data.get_buf());
+  ASSERT_EQ(micro_size, block_data.get_buf_size());
+  check_micro_block(allocator, block_data);
+
+  micro_handle.reset();
+  ASSERT_EQ(OB_SUCCESS, OB_SERVER_BLOCK_MGR.block_map_.get(macro_id, block_info));
+  ASSERT_EQ(0, block_info.mem_ref_cnt_);
+  ASSERT_EQ(ObSSTableMicroBlockState::UNKNOWN_STATE, micro_handle.block_state_);
+}
+
+TEST_F(TestBlockManager, test_mmap_micro_block_media_error)
+{
+  ObArenaAllocator allocator;
+  char *micro_buf = nullptr;
+  int64_t micro_size = 0;
+  build_micro_block(allocator, micro_buf, micro_size);
+  const char *file_name = "test_block_manager_mmap_file";
+  const int64_t file_size = upper_align(micro_size, DIO_READ_ALIGN_SIZE);
+  int fd = ::open(file_name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  ASSERT_NE(-1, fd);
+  ASSERT_EQ(0, ::ftruncate(fd, file_size));
+  ASSERT_EQ(micro_size, ::pwrite(fd, micro_buf, micro_size, 0));
+  void *map_addr = ::mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+  ASSERT_NE(MAP_FAILED, map_addr);
+
+  ObMicroBlockDataHandle micro_handle;
+  micro_handle.des_meta_.compressor_type_ = ObCompressorType::NONE_COMPRESSOR;
+  micro_handle.des_meta_.encrypt_id_ = ObAesOpMode::ob_invalid_mode;
+  micro_handle.micro_info_.set(0, static_cast<int32_t>(micro_size));
+  micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_MMAP;
+  micro_handle.mmap_buf_ = static_cast<const char *>(map_addr);
+  ObMacroBlockReader block_reader;
+  ObMicroBlockData block_data;
+  ASSERT_EQ(OB_SUCCESS, micro_handle.get_mmap_block_data(block_reader, block_data));
+  check_micro_block(allocator, block_data);
+
+  // pages that can not be read back raise SIGBUS, as a media error does
+  ASSERT_EQ(0, ::ftruncate(fd, 0));
+  ASSERT_EQ(OB_IO_ERROR, micro_handle.get_mmap_block_data(block_reader, block_data));
+
+  micro_handle.reset();
+  ::munmap(map_addr, file_size);
+  ::close(fd);
+  ::unlink(file_name);
+}
+
 TEST_F(TestBlockManager, test_multi_thread)
 {
   int ret = OB_SUCCESS;
@@ -402,6 +560,7 @@ int main(int argc, char **argv)
   system("rm -f test_block_manager.log*");
   OB_LOGGER.set_file_name("test_block_manager.log", true);
   OB_LOGGER.set_log_level("INFO");
+  oceanbase::common::install_ob_signal_handler();
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
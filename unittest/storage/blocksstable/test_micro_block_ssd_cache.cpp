@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "storage/blocksstable/ob_micro_block_ssd_cache.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+
+namespace unittest
+{
+static const int64_t CACHE_SIZE = 64 * 1024 * 1024L;
+static const int64_t BLOCK_SIZE = 16 * 1024L;
+
+class TestMicroBlockSSDCache : public ::testing::Test
+{
+public:
+  TestMicroBlockSSDCache() : allocator_(ObModIds::TEST) {}
+  void SetUp()
+  {
+    system("rm -rf ./test_micro_block_ssd_cache_dir");
+    for (int64_t i = 0; i < BLOCK_SIZE; ++i) {
+      buf_[i] = static_cast<char>(i % 251);
+    }
+  }
+  void TearDown()
+  {
+    system("rm -rf ./test_micro_block_ssd_cache_dir");
+  }
+  ObMicroBlockCacheKey make_key(const int64_t block_index, const int64_t offset)
+  {
+    MacroBlockId macro_id(0, block_index, 0);
+    return ObMicroBlockCacheKey(1, macro_id, offset, BLOCK_SIZE);
+  }
+protected:
+  const char *dir_ = "./test_micro_block_ssd_cache_dir";
+  char buf_[BLOCK_SIZE];
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestMicroBlockSSDCache, put_and_get)
+{
+  ObMicroBlockSSDCache cache;
+  const char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache.init(dir_, CACHE_SIZE - 1));
+  ASSERT_EQ(OB_SUCCESS, cache.init(dir_, CACHE_SIZE));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(make_key(1, 100), allocator_, buf, size));
+  ASSERT_EQ(OB_SUCCESS, cache.write_(make_key(1, 100), buf_, BLOCK_SIZE));
+  ASSERT_EQ(OB_SUCCESS, cache.get(make_key(1, 100), allocator_, buf, size));
+  ASSERT_EQ(BLOCK_SIZE, size);
+  ASSERT_EQ(0, MEMCMP(buf_, buf, size));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(make_key(1, 200), allocator_, buf, size));
+
+  // the oldest blocks are overwritten after the ring is full
+  const int64_t block_cnt = CACHE_SIZE / BLOCK_SIZE + 1;
+  for (int64_t i = 0; i < block_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, cache.write_(make_key(2, i + 1), buf_, BLOCK_SIZE));
+  }
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(make_key(1, 100), allocator_, buf, size));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(make_key(2, 1), allocator_, buf, size));
+  ASSERT_EQ(OB_SUCCESS, cache.get(make_key(2, block_cnt), allocator_, buf, size));
+  ASSERT_EQ(0, MEMCMP(buf_, buf, size));
+  cache.destroy();
+}
+
+TEST_F(TestMicroBlockSSDCache, async_put_with_admission)
+{
+  ObMicroBlockSSDCache cache;
+  const char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, cache.init(dir_, CACHE_SIZE));
+  // the micro block read only once is not admitted
+  ASSERT_EQ(OB_SUCCESS, cache.put(make_key(1, 100), buf_, BLOCK_SIZE));
+  ASSERT_EQ(1, cache.reject_cnt_);
+  ASSERT_EQ(0, cache.pending_write_size_);
+  // the second read admits it, and it is written in background
+  ASSERT_EQ(OB_SUCCESS, cache.put(make_key(1, 100), buf_, BLOCK_SIZE));
+  ASSERT_EQ(1, cache.reject_cnt_);
+  int ret = OB_ENTRY_NOT_EXIST;
+  for (int64_t i = 0; OB_ENTRY_NOT_EXIST == ret && i < 1000; ++i) {
+    if (OB_ENTRY_NOT_EXIST == (ret = cache.get(make_key(1, 100), allocator_, buf, size))) {
+      ob_usleep(10 * 1000);
+    }
+  }
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(BLOCK_SIZE, size);
+  ASSERT_EQ(0, MEMCMP(buf_, buf, size));
+  ASSERT_EQ(0, cache.pending_write_size_);
+  ASSERT_EQ(1, cache.put_cnt_);
+  // already in cache, not written again
+  ASSERT_EQ(OB_SUCCESS, cache.put(make_key(1, 100), buf_, BLOCK_SIZE));
+  ASSERT_EQ(0, cache.pending_write_size_);
+  cache.destroy();
+}
+
+TEST_F(TestMicroBlockSSDCache, bounded_index)
+{
+  ObMicroBlockSSDCache cache;
+  ASSERT_EQ(OB_SUCCESS, cache.init(dir_, CACHE_SIZE));
+  // each block takes a bit more than BLOCK_SIZE with its entry header
+  const int64_t capacity = CACHE_SIZE / BLOCK_SIZE;
+  for (int64_t i = 0; i < 4 * capacity; ++i) {
+    ASSERT_EQ(OB_SUCCESS, cache.write_(make_key(3, i + 1), buf_, BLOCK_SIZE));
+    ASSERT_GE(capacity, cache.index_.size());
+  }
+  // the overwritten entries are removed from index, instead of being left behind as stale
+  ASSERT_LE(capacity / 2, cache.index_.size());
+  ASSERT_GE(capacity, cache.write_records_.count() - cache.record_head_);
+  cache.destroy();
+}
+
+TEST_F(TestMicroBlockSSDCache, restart)
+{
+  const char *buf = NULL;
+  int64_t size = 0;
+  {
+    ObMicroBlockSSDCache cache;
+    ASSERT_EQ(OB_SUCCESS, cache.init(dir_, CACHE_SIZE));
+    for (int64_t i = 0; i < 10; ++i) {
+      ASSERT_EQ(OB_SUCCESS, cache.write_(make_key(1, i + 1), buf_, BLOCK_SIZE));
+    }
+    ASSERT_EQ(OB_SUCCESS, cache.checkpoint());
+    ASSERT_EQ(OB_SUCCESS, cache.write_(make_key(1, 11), buf_, BLOCK_SIZE));
+    ASSERT_EQ(OB_SUCCESS, cache.checkpoint());
+    // put after checkpoint is lost after restart
+    ASSERT_EQ(OB_SUCCESS, cache.write_(make_key(1, 12), buf_, BLOCK_SIZE));
+    cache.is_inited_ = false; // simulate crash, skip the checkpoint in destroy
+    cache.destroy();
+  }
+  ObMicroBlockSSDCache cache;
+  ASSERT_EQ(OB_SUCCESS, cache.init(dir_, CACHE_SIZE));
+  ASSERT_EQ(11, cache.index_.size());
+  for (int64_t i = 0; i < 11; ++i) {
+    ASSERT_EQ(OB_SUCCESS, cache.get(make_key(1, i + 1), allocator_, buf, size));
+    ASSERT_EQ(0, MEMCMP(buf_, buf, size));
+  }
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(make_key(1, 12), allocator_, buf, size));
+  cache.destroy();
+
+  // index is discarded when cache size changes
+  ObMicroBlockSSDCache cache2;
+  ASSERT_EQ(OB_SUCCESS, cache2.init(dir_, 2 * CACHE_SIZE));
+  ASSERT_EQ(0, cache2.index_.size());
+  cache2.destroy();
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_micro_block_ssd_cache.log*");
+  OB_LOGGER.set_file_name("test_micro_block_ssd_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  STORAGE_LOG(INFO, "begin unittest: test_micro_block_ssd_cache");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -28,6 +28,9 @@
 #include "storage/tx/ob_multi_data_source.h"
 #include "storage/tx/ob_trans_define_v4.h"
 #include "storage/memtable/mvcc/ob_mvcc_row.h"
+#include "storage/memtable/ob_memtable_mutator.h"
+#include "storage/tx/ob_clog_encrypt_info.h"
+#include "lib/random/ob_random.h"
 
 namespace oceanbase
 {
@@ -412,6 +415,154 @@ TEST_F(TestMemtable, multi_key)
   print(mvcc_row2);
 }
 
+TEST_F(TestMemtable, read_amplification_compact)
+{
+  ObMemtable mt;
+  EXPECT_EQ(OB_SUCCESS, init_memtable(mt));
+
+  RunCtxGuard rg;
+  EXPECT_EQ(OB_SUCCESS, rg.init(1, this));
+
+  ObMvccRow *mvcc_row = nullptr;
+  EXPECT_EQ(OB_SUCCESS, rg.write(1, 2, mt, mvcc_row, 1000));
+  EXPECT_EQ(OB_SUCCESS, rg.write(1, 3, mt, 1000));
+
+  // short reads are not recorded
+  mvcc_row->record_read_amplification(ObMvccRow::READ_AMPLIFICATION_TRACE_LENGTH - 1);
+  EXPECT_EQ(0, mvcc_row->read_amplification_);
+  EXPECT_FALSE(mvcc_row->need_compact_for_read());
+
+  // long reads are recorded until the trigger, and only one thread gets the compaction
+  const int64_t read_cnt = ObMvccRow::READ_AMPLIFICATION_COMPACT_TRIGGER / ObMvccRow::READ_AMPLIFICATION_TRACE_LENGTH;
+  for (int64_t i = 0; i < read_cnt - 1; i++) {
+    mvcc_row->record_read_amplification(ObMvccRow::READ_AMPLIFICATION_TRACE_LENGTH);
+  }
+  EXPECT_FALSE(mvcc_row->need_compact_for_read());
+  mvcc_row->record_read_amplification(ObMvccRow::READ_AMPLIFICATION_TRACE_LENGTH);
+  EXPECT_TRUE(mvcc_row->need_compact_for_read());
+  EXPECT_FALSE(mvcc_row->need_compact_for_read());
+  EXPECT_EQ(0, mvcc_row->read_amplification_);
+
+  // one read is capped by the trigger
+  const int32_t trigger = ObMvccRow::READ_AMPLIFICATION_COMPACT_TRIGGER;
+  mvcc_row->record_read_amplification(INT32_MAX + 1L);
+  EXPECT_EQ(trigger, mvcc_row->read_amplification_);
+  EXPECT_TRUE(mvcc_row->need_compact_for_read());
+
+  // no committed tx node to compact, so the compaction is not counted
+  EXPECT_EQ(0, mt.get_read_amplification_compact_cnt());
+  mt.row_compact(mvcc_row, false /*for_replay*/, 1000, true /*for_read_amplification*/);
+  EXPECT_TRUE(nullptr == mvcc_row->latest_compact_node_);
+  EXPECT_EQ(0, mt.get_read_amplification_compact_cnt());
+
+  EXPECT_EQ(OB_SUCCESS, rg.mem_ctx_.do_trans_end(true, 900, 900, 0));
+  print(mvcc_row);
+}
+
+TEST(TestMemtableMutator, compress_round_trip)
+{
+  static const int64_t BUFFER_SIZE = 1L<<16;
+  static const int64_t ROW_SIZE = 16 * 1024;
+
+  ObMutatorWriter mmw;
+  ObMemtableMutatorIterator mmi;
+  ObMemtableMutatorMeta meta;
+  transaction::ObCLogEncryptInfo encrypt_info;
+
+  char *buffer = new char[BUFFER_SIZE];
+  char *row_buf = new char[ROW_SIZE];
+  char *decompress_buf = new char[ROW_SIZE];
+  for (int64_t i = 0; i < ROW_SIZE; ++i) {
+    row_buf[i] = static_cast<char>('a' + i % 7);
+  }
+
+  EXPECT_EQ(OB_SUCCESS, mmw.set_buffer(buffer, BUFFER_SIZE));
+  EXPECT_EQ(OB_SUCCESS, mmw.append_row_buf(row_buf, ROW_SIZE));
+  int64_t res_len = 0;
+  EXPECT_EQ(OB_SUCCESS, mmw.serialize(ObTransRowFlag::NORMAL_ROW, res_len, common::ObCompressorType::LZ4_COMPRESSOR));
+  EXPECT_LT(res_len, ROW_SIZE);
+
+  int64_t pos = 0;
+  EXPECT_EQ(OB_SUCCESS, meta.deserialize(buffer, res_len, pos));
+  EXPECT_TRUE(meta.is_compressed());
+  EXPECT_EQ(common::ObCompressorType::LZ4_COMPRESSOR, meta.get_compressor_type());
+  EXPECT_LT(ObMemtableMutatorMeta::MIN_META_SIZE, meta.get_meta_size());
+  EXPECT_EQ(meta.get_meta_size(), pos);
+  EXPECT_EQ(res_len, meta.get_total_size());
+  EXPECT_EQ(ROW_SIZE, meta.get_uncompressed_data_size());
+  EXPECT_EQ(OB_SUCCESS, meta.check_data_integrity(buffer + pos, meta.get_data_size()));
+  EXPECT_EQ(OB_SUCCESS, meta.decompress_data(buffer + pos, decompress_buf, ROW_SIZE));
+  EXPECT_EQ(0, MEMCMP(row_buf, decompress_buf, ROW_SIZE));
+  // buf smaller than the original rows
+  EXPECT_EQ(OB_INVALID_ARGUMENT, meta.decompress_data(buffer + pos, decompress_buf, ROW_SIZE - 1));
+
+  pos = 0;
+  EXPECT_EQ(OB_SUCCESS, mmi.deserialize(buffer, res_len, pos, encrypt_info));
+  EXPECT_EQ(res_len, pos);
+  EXPECT_TRUE(mmi.get_meta().is_compressed());
+  EXPECT_FALSE(mmi.is_iter_end());
+
+  delete[] decompress_buf;
+  delete[] row_buf;
+  delete[] buffer;
+}
+
+TEST(TestMemtableMutator, uncompressed_old_format)
+{
+  static const int64_t BUFFER_SIZE = 1L<<16;
+  static const int64_t ROW_SIZE = 16 * 1024;
+
+  transaction::ObCLogEncryptInfo encrypt_info;
+  char *buffer = new char[BUFFER_SIZE];
+  char *row_buf = new char[ROW_SIZE];
+  for (int64_t i = 0; i < ROW_SIZE; ++i) {
+    row_buf[i] = static_cast<char>('a' + i % 7);
+  }
+
+  // compression is off, small rows and incompressible rows are all kept in the old format
+  for (int64_t round = 0; round < 3; ++round) {
+    ObMutatorWriter mmw;
+    ObMemtableMutatorIterator mmi;
+    ObMemtableMutatorMeta meta;
+    int64_t row_size = ROW_SIZE;
+    common::ObCompressorType compressor_type = common::ObCompressorType::LZ4_COMPRESSOR;
+    if (0 == round) {
+      compressor_type = common::ObCompressorType::NONE_COMPRESSOR;
+    } else if (1 == round) {
+      row_size = ObMutatorWriter::MIN_COMPRESS_DATA_SIZE - 1;
+    } else {
+      for (int64_t i = 0; i < ROW_SIZE; ++i) {
+        row_buf[i] = static_cast<char>(common::ObRandom::rand(0, 255));
+      }
+    }
+    EXPECT_EQ(OB_SUCCESS, mmw.set_buffer(buffer, BUFFER_SIZE));
+    EXPECT_EQ(OB_SUCCESS, mmw.append_row_buf(row_buf, row_size));
+    int64_t res_len = 0;
+    EXPECT_EQ(OB_SUCCESS, mmw.serialize(ObTransRowFlag::NORMAL_ROW, res_len, compressor_type));
+    EXPECT_EQ(ObMemtableMutatorMeta::MIN_META_SIZE + row_size, res_len);
+
+    int64_t pos = 0;
+    EXPECT_EQ(OB_SUCCESS, meta.deserialize(buffer, res_len, pos));
+    EXPECT_FALSE(meta.is_compressed());
+    EXPECT_EQ(ObMemtableMutatorMeta::MIN_META_SIZE, pos);
+    EXPECT_EQ(row_size, meta.get_data_size());
+    EXPECT_EQ(row_size, meta.get_uncompressed_data_size());
+    EXPECT_EQ(0, MEMCMP(row_buf, buffer + pos, row_size));
+    EXPECT_EQ(OB_STATE_NOT_MATCH, meta.decompress_data(buffer + pos, row_buf, ROW_SIZE));
+
+    // the meta is truncated
+    pos = 0;
+    EXPECT_NE(OB_SUCCESS, meta.deserialize(buffer, ObMemtableMutatorMeta::MIN_META_SIZE - 1, pos));
+
+    pos = 0;
+    EXPECT_EQ(OB_SUCCESS, mmi.deserialize(buffer, res_len, pos, encrypt_info));
+    EXPECT_EQ(res_len, pos);
+    EXPECT_FALSE(mmi.get_meta().is_compressed());
+  }
+
+  delete[] row_buf;
+  delete[] buffer;
+}
 
 }// end of oceanbase
 
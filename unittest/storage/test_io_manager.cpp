@@ -14,12 +14,14 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <sys/mman.h>
 #define private public
 #include "share/io/ob_io_manager.h"
 #include "share/io/ob_io_calibration.h"
 #include "share/io/io_schedule/ob_io_mclock.h"
-#undef private
 #include "share/ob_local_device.h"
+#include "storage/blocksstable/ob_block_manager.h"
+#undef private
 #include "lib/thread/thread_pool.h"
 #include "lib/file/file_directory_utils.h"
 
@@ -336,6 +338,139 @@ TEST_F(TestIOStruct, IORequest)
   ASSERT_NE(req.ret_code_.io_ret_, OB_IO_ERROR); // finish only once
 }
 
+TEST_F(TestIOStruct, IORequestMerge)
+{
+  ObTenantIOManager tenant_io_mgr;
+  tenant_io_mgr.inc_ref();
+  ASSERT_SUCC(tenant_io_mgr.io_allocator_.init(TEST_TENANT_ID, IO_MEMORY_LIMIT));
+  ObRefHolder<ObTenantIOManager> holder(&tenant_io_mgr);
+  ObIOFd fd;
+  fd.first_id_ = 0;
+  fd.second_id_ = 1;
+  ObIOInfo read_info;
+  read_info.tenant_id_ = OB_SERVER_TENANT_ID;
+  read_info.fd_ = fd;
+  read_info.flag_.set_mode(ObIOMode::READ);
+  read_info.flag_.set_category(ObIOCategory::USER_IO);
+  read_info.flag_.set_wait_event(1);
+
+  // page 1, page 3 and page 0
+  ObIORequest req1, req2, req3;
+  req1.tenant_io_mgr_.hold(&tenant_io_mgr);
+  req2.tenant_io_mgr_.hold(&tenant_io_mgr);
+  req3.tenant_io_mgr_.hold(&tenant_io_mgr);
+  read_info.offset_ = DIO_READ_ALIGN_SIZE;
+  read_info.size_ = DIO_READ_ALIGN_SIZE;
+  ASSERT_SUCC(req1.init(read_info));
+  read_info.offset_ = DIO_READ_ALIGN_SIZE * 3 + 10;
+  read_info.size_ = 100;
+  ASSERT_SUCC(req2.init(read_info));
+  read_info.offset_ = 0;
+  read_info.size_ = 1;
+  ASSERT_SUCC(req3.init(read_info));
+
+  // merged requests are read together
+  req1.merge(req2);
+  req1.merge(req3);
+  ASSERT_SUCC(req1.prepare());
+  ASSERT_TRUE(req1.is_merged());
+  ASSERT_EQ(0, req1.merge_offset_);
+  ASSERT_EQ(DIO_READ_ALIGN_SIZE * 4, req1.get_submit_size());
+  ASSERT_NE(nullptr, req2.io_buf_);
+  ASSERT_NE(nullptr, req3.io_buf_);
+  for (int64_t i = 0; i < 4; ++i) {
+    memset(req1.merge_buf_ + i * DIO_READ_ALIGN_SIZE, 'a' + i, DIO_READ_ALIGN_SIZE);
+  }
+  ASSERT_SUCC(req1.copy_from_merge_buf(req1));
+  ASSERT_SUCC(req1.copy_from_merge_buf(req2));
+  ASSERT_SUCC(req1.copy_from_merge_buf(req3));
+  ASSERT_EQ('b', req1.get_data()[0]);
+  ASSERT_EQ('d', req2.get_data()[0]);
+  ASSERT_EQ('a', req3.get_data()[0]);
+  ASSERT_TRUE(req1.is_in_merge_buf(DIO_READ_ALIGN_SIZE * 2, DIO_READ_ALIGN_SIZE));
+  ASSERT_FALSE(req1.is_in_merge_buf(DIO_READ_ALIGN_SIZE * 4, 1));
+  req1.reset_merge();
+  ASSERT_FALSE(req1.is_merged());
+  ASSERT_EQ(DIO_READ_ALIGN_SIZE, req1.get_submit_size());
+
+  // read ahead size is already bounded by the macro block when it is set
+  req1.read_ahead_size_ = OB_DEFAULT_MACRO_BLOCK_SIZE - 2 * DIO_READ_ALIGN_SIZE;
+  ASSERT_SUCC(req1.prepare());
+  ASSERT_EQ(DIO_READ_ALIGN_SIZE, req1.merge_offset_);
+  ASSERT_EQ(OB_DEFAULT_MACRO_BLOCK_SIZE - DIO_READ_ALIGN_SIZE, req1.get_submit_size());
+  req1.reset_merge();
+}
+
+TEST_F(TestIOStruct, IOUring)
+{
+  ObLocalDevice &device = *static_cast<ObLocalDevice *>(THE_IO_DEVICE);
+  ObIOFd fd;
+  ASSERT_SUCC(device.alloc_block(nullptr, fd));
+  char *write_buf = static_cast<char *>(ob_malloc_align(DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, "IOUring"));
+  char *read_buf = static_cast<char *>(ob_malloc_align(DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, "IOUring"));
+  ASSERT_NE(nullptr, write_buf);
+  ASSERT_NE(nullptr, read_buf);
+  MEMSET(write_buf, 'a', DIO_READ_ALIGN_SIZE);
+  MEMSET(read_buf, 0, DIO_READ_ALIGN_SIZE);
+  int64_t write_size = 0;
+  ASSERT_SUCC(device.pwrite(fd, DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, write_buf, write_size));
+
+  // fallback to libaio if io uring is not supported by kernel
+  device.use_io_uring_ = true;
+  ObIOContext *io_context = nullptr;
+  ASSERT_SUCC(device.io_setup(16, io_context));
+  device.use_io_uring_ = false;
+  ObIOEvents *io_events = device.alloc_io_events(16);
+  ObIOCB *iocb = device.alloc_iocb();
+  ASSERT_NE(nullptr, io_events);
+  ASSERT_NE(nullptr, iocb);
+  void *data = reinterpret_cast<void *>(0x1234);
+  ASSERT_SUCC(device.io_prepare_pread(fd, read_buf, DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, iocb, data));
+  ASSERT_SUCC(device.io_submit(io_context, iocb));
+  struct timespec timeout = {1, 0};
+  ASSERT_SUCC(device.io_getevents(io_context, 1, io_events, &timeout));
+  ASSERT_EQ(1, io_events->get_complete_cnt());
+  ASSERT_EQ(0, io_events->get_ith_ret_code(0));
+  ASSERT_EQ(DIO_READ_ALIGN_SIZE, io_events->get_ith_ret_bytes(0));
+  ASSERT_EQ(data, io_events->get_ith_data(0));
+  ASSERT_EQ(0, MEMCMP(write_buf, read_buf, DIO_READ_ALIGN_SIZE));
+
+  device.free_iocb(iocb);
+  device.free_io_events(io_events);
+  ASSERT_SUCC(device.io_destroy(io_context));
+  device.free_block(fd);
+  ob_free_align(write_buf);
+  ob_free_align(read_buf);
+}
+
+TEST_F(TestIOStruct, BlockMmap)
+{
+  ObLocalDevice &device = *static_cast<ObLocalDevice *>(THE_IO_DEVICE);
+  ObIOFd fd;
+  ASSERT_SUCC(device.alloc_block(nullptr, fd));
+  char *write_buf = static_cast<char *>(ob_malloc_align(DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, "BlockMmap"));
+  ASSERT_NE(nullptr, write_buf);
+  MEMSET(write_buf, 'b', DIO_READ_ALIGN_SIZE);
+  int64_t write_size = 0;
+  ASSERT_SUCC(device.pwrite(fd, DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, write_buf, write_size));
+
+  // direct io write is visible through the mapping
+  const char *buf = nullptr;
+  ASSERT_SUCC(device.mmap_block(fd, DIO_READ_ALIGN_SIZE + 100, 200, buf));
+  ASSERT_NE(nullptr, buf);
+  ASSERT_EQ(0, MEMCMP(write_buf, buf, 200));
+  ASSERT_SUCC(device.madvise_block(fd, DIO_READ_ALIGN_SIZE + 100, 200, MADV_WILLNEED));
+
+  // out of block range
+  ObIOFd super_block_fd(THE_IO_DEVICE, 0, 0);
+  ASSERT_EQ(OB_INVALID_ARGUMENT, device.mmap_block(fd, device.block_size_ - 100, 200, buf));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, device.mmap_block(fd, -1, 200, buf));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, device.mmap_block(super_block_fd, 0, 200, buf));
+
+  device.free_block(fd);
+  ob_free_align(write_buf);
+}
+
 TEST_F(TestIOStruct, IOAbility)
 {
   ObIOBenchResult item, item2;
@@ -796,6 +931,246 @@ TEST_F(TestIOManager, simple)
 }
 
 
+class TestIOCoalesce : public TestIOManager
+{
+public:
+  TestIOCoalesce() : allocator_(), sender_(allocator_), tenant_holder_() {}
+  virtual void SetUp()
+  {
+    TestIOManager::SetUp();
+    OB_IO_MANAGER.io_config_.enable_io_coalescing_ = true;
+    OB_IO_MANAGER.io_config_.read_ahead_size_ = READ_AHEAD_SIZE;
+    // read ahead is bounded by the macro block size of the device
+    OB_SERVER_BLOCK_MGR.super_block_.body_.macro_block_size_ = OB_DEFAULT_MACRO_BLOCK_SIZE;
+    ASSERT_SUCC(OB_IO_MANAGER.get_tenant_io_manager(TENANT_ID, tenant_holder_));
+    // the sender is not started, requests are popped and submitted by the test
+    ASSERT_SUCC(sender_.init(1024));
+    ObIAllocator *allocator = &allocator_;
+    ObIOCategoryQueues *io_category_queues = OB_NEWx(ObIOCategoryQueues, allocator);
+    ASSERT_NE(nullptr, io_category_queues);
+    ASSERT_SUCC(io_category_queues->init());
+    for (int64_t i = 0; i < static_cast<int>(ObIOCategory::MAX_CATEGORY) + 1; ++i) {
+      ASSERT_SUCC(sender_.enqueue_phy_queue(io_category_queues->phy_queues_[i]));
+    }
+    ASSERT_SUCC(sender_.tenant_map_.set_refactored(TENANT_ID, io_category_queues));
+
+    // the 2nd macro block, each page is filled with its own character
+    fd_.first_id_ = 0;
+    fd_.second_id_ = 1;
+    fd_.device_handle_ = THE_IO_DEVICE;
+    ObIOInfo io_info;
+    io_info.tenant_id_ = TENANT_ID;
+    io_info.fd_ = fd_;
+    io_info.flag_.set_write();
+    io_info.flag_.set_category(ObIOCategory::USER_IO);
+    io_info.flag_.set_wait_event(100);
+    io_info.offset_ = 0;
+    io_info.size_ = DATA_SIZE;
+    char *buf = static_cast<char *>(allocator_.alloc(DATA_SIZE));
+    ASSERT_NE(nullptr, buf);
+    for (int64_t i = 0; i < DATA_SIZE; ++i) {
+      buf[i] = page_char(i);
+    }
+    io_info.buf_ = buf;
+    ASSERT_SUCC(OB_IO_MANAGER.write(io_info, IO_TIMEOUT_MS));
+  }
+  virtual void TearDown()
+  {
+    sender_.destroy();
+    tenant_holder_.reset();
+    OB_IO_MANAGER.io_config_ = ObIOConfig::default_config();
+    TestIOManager::TearDown();
+  }
+  static char page_char(const int64_t offset)
+  {
+    return static_cast<char>('a' + (offset / DIO_READ_ALIGN_SIZE) % 26);
+  }
+  // same as ObTenantIOManager::inner_aio, but the request is put into the test sender
+  int aio_read(const int64_t offset, const int64_t size, ObIOHandle &handle)
+  {
+    int ret = OB_SUCCESS;
+    ObTenantIOManager *tenant_io_mgr = tenant_holder_.get_ptr();
+    ObIORequest *req = nullptr;
+    ObIOInfo io_info;
+    io_info.tenant_id_ = TENANT_ID;
+    io_info.fd_ = fd_;
+    io_info.flag_.set_read();
+    io_info.flag_.set_category(ObIOCategory::USER_IO);
+    io_info.flag_.set_wait_event(100);
+    io_info.offset_ = offset;
+    io_info.size_ = size;
+    handle.reset();
+    if (OB_FAIL(tenant_io_mgr->alloc_io_request(tenant_io_mgr->io_allocator_, 0, req))) {
+    } else if (FALSE_IT(req->tenant_io_mgr_.hold(tenant_io_mgr))) {
+    } else if (OB_FAIL(handle.set_request(*req))) {
+    } else if (OB_FAIL(req->init(io_info))) {
+    } else if (OB_FAIL(sender_.enqueue_request(*req))) {
+    }
+    return ret;
+  }
+  void pop_all()
+  {
+    for (int64_t i = 0; i < 1000 && sender_.get_queue_count() > 0; ++i) {
+      sender_.pop_and_submit();
+    }
+    ASSERT_EQ(0, sender_.get_queue_count());
+  }
+  // pop a request and merge the others into it, as ObIOSender::pop_and_submit does
+  void pop_and_merge(ObIORequest *&req)
+  {
+    ASSERT_SUCC(sender_.dequeue_request(req));
+    ASSERT_NE(nullptr, req);
+    req->sender_ = &sender_;
+    sender_.merge_adjacent_requests(*req);
+    ASSERT_TRUE(nullptr != req->merge_next_);
+    ASSERT_SUCC(req->prepare());
+  }
+  void check_read(ObIOHandle &handle, const int64_t offset, const int64_t size)
+  {
+    ASSERT_SUCC(handle.wait(IO_TIMEOUT_MS));
+    ASSERT_EQ(size, handle.get_data_size());
+    for (int64_t i = 0; i < size; ++i) {
+      ASSERT_EQ(page_char(offset + i), handle.get_buffer()[i]);
+    }
+  }
+  ObDeviceChannel *get_device_channel()
+  {
+    ObDeviceChannel *device_channel = nullptr;
+    EXPECT_EQ(OB_SUCCESS, OB_IO_MANAGER.get_device_channel(THE_IO_DEVICE, device_channel));
+    return device_channel;
+  }
+public:
+  static const uint64_t TENANT_ID = 500;
+  static const int64_t DATA_SIZE = 256L * 1024L;
+  static const int64_t READ_AHEAD_SIZE = 64L * 1024L;
+  static const int64_t IO_TIMEOUT_MS = 5000L;
+  ObArenaAllocator allocator_;
+  ObIOSender sender_;
+  ObRefHolder<ObTenantIOManager> tenant_holder_;
+  ObIOFd fd_;
+};
+
+TEST_F(TestIOCoalesce, sender_merge)
+{
+  ObIOHandle handle1, handle2, handle3;
+  ASSERT_SUCC(aio_read(DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, handle1));
+  ASSERT_SUCC(aio_read(DIO_READ_ALIGN_SIZE * 3 + 10, 100, handle2));
+  ASSERT_SUCC(aio_read(0, 10, handle3));
+  ASSERT_EQ(3, sender_.get_queue_count());
+  // one pop submits all of them by one io
+  sender_.pop_and_submit();
+  ASSERT_EQ(0, sender_.get_queue_count());
+  check_read(handle1, DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE);
+  check_read(handle2, DIO_READ_ALIGN_SIZE * 3 + 10, 100);
+  check_read(handle3, 0, 10);
+  const ObIOUsage &io_usage = tenant_holder_.get_ptr()->get_io_usage();
+  for (int64_t i = 0; i < 100 && 2 != ATOMIC_LOAD(&io_usage.merged_count_); ++i) {
+    usleep(10L * 1000L); // the stat is recorded after the requests finish
+  }
+  ASSERT_EQ(2, ATOMIC_LOAD(&io_usage.merged_count_));
+
+  // a far away read is not merged
+  ASSERT_SUCC(aio_read(0, DIO_READ_ALIGN_SIZE, handle1));
+  ASSERT_SUCC(aio_read(DATA_SIZE - DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, handle2));
+  sender_.pop_and_submit();
+  ASSERT_EQ(1, sender_.get_queue_count());
+  pop_all();
+  check_read(handle1, 0, DIO_READ_ALIGN_SIZE);
+  check_read(handle2, DATA_SIZE - DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE);
+}
+
+TEST_F(TestIOCoalesce, split_on_partial_return)
+{
+  ObIOHandle handle1, handle2;
+  ObIORequest *req = nullptr;
+  ASSERT_SUCC(aio_read(0, DIO_READ_ALIGN_SIZE, handle1));
+  ASSERT_SUCC(aio_read(DIO_READ_ALIGN_SIZE * 2, DIO_READ_ALIGN_SIZE, handle2));
+  pop_and_merge(req);
+  // the merged io returns only the first page, each request is read again by itself
+  ObAsyncIOChannel *channel = static_cast<ObAsyncIOChannel *>(get_device_channel()->async_channels_.at(0));
+  ASSERT_SUCC(channel->on_merged_return(*req, 0, DIO_READ_ALIGN_SIZE));
+  ASSERT_FALSE(req->is_merged());
+  req->dec_ref("phyqueue_dec"); // ref for io queue
+  check_read(handle1, 0, DIO_READ_ALIGN_SIZE);
+  check_read(handle2, DIO_READ_ALIGN_SIZE * 2, DIO_READ_ALIGN_SIZE);
+  ASSERT_EQ(0, ATOMIC_LOAD(&tenant_holder_.get_ptr()->get_io_usage().merged_count_));
+}
+
+TEST_F(TestIOCoalesce, merged_retry_on_eagain)
+{
+  ObIOHandle handle1, handle2;
+  ObIORequest *req = nullptr;
+  ASSERT_SUCC(aio_read(0, DIO_READ_ALIGN_SIZE, handle1));
+  ASSERT_SUCC(aio_read(DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, handle2));
+  pop_and_merge(req);
+  // the channel is full when the split requests are submitted again, they go back to io queue
+  ObDeviceChannel *device_channel = get_device_channel();
+  ObAsyncIOChannel *channel = static_cast<ObAsyncIOChannel *>(device_channel->async_channels_.at(0));
+  ATOMIC_STORE(&device_channel->used_io_depth_, device_channel->max_io_depth_ + 1);
+  ASSERT_SUCC(channel->on_merged_return(*req, EIO, 0));
+  req->dec_ref("phyqueue_dec"); // ref for io queue
+  ASSERT_EQ(2, sender_.get_queue_count());
+  ASSERT_FALSE(handle1.req_->is_finished_);
+  ASSERT_FALSE(handle2.req_->is_finished_);
+  ATOMIC_STORE(&device_channel->used_io_depth_, 0);
+  pop_all();
+  check_read(handle1, 0, DIO_READ_ALIGN_SIZE);
+  check_read(handle2, DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE);
+}
+
+TEST_F(TestIOCoalesce, read_ahead_hit)
+{
+  ObIOHandle handle;
+  const ObIOUsage &io_usage = tenant_holder_.get_ptr()->get_io_usage();
+  // the third sequential read reads ahead
+  for (int64_t i = 0; i < ObIOSender::SEQUENTIAL_READ_THRESHOLD; ++i) {
+    ASSERT_SUCC(aio_read(i * DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, handle));
+    pop_all();
+    check_read(handle, i * DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE);
+  }
+  ASSERT_EQ(1, ATOMIC_LOAD(&io_usage.read_ahead_count_));
+  ASSERT_EQ(0, ATOMIC_LOAD(&io_usage.read_ahead_hit_count_));
+
+  // the following reads are served from read ahead buffer without io
+  const int64_t offset = ObIOSender::SEQUENTIAL_READ_THRESHOLD * DIO_READ_ALIGN_SIZE;
+  ASSERT_SUCC(aio_read(offset, DIO_READ_ALIGN_SIZE * 2, handle));
+  pop_all();
+  check_read(handle, offset, DIO_READ_ALIGN_SIZE * 2);
+  ASSERT_EQ(1, ATOMIC_LOAD(&io_usage.read_ahead_hit_count_));
+  ASSERT_SUCC(aio_read(offset + 100, 1000, handle));
+  pop_all();
+  check_read(handle, offset + 100, 1000);
+  ASSERT_EQ(2, ATOMIC_LOAD(&io_usage.read_ahead_hit_count_));
+
+  // out of read ahead buffer, read by io
+  ASSERT_SUCC(aio_read(DATA_SIZE - DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, handle));
+  pop_all();
+  check_read(handle, DATA_SIZE - DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE);
+  ASSERT_EQ(2, ATOMIC_LOAD(&io_usage.read_ahead_hit_count_));
+}
+
+TEST_F(TestIOCoalesce, read_ahead_within_macro_block)
+{
+  ObIOHandle handle;
+  // read ahead stops at the end of the macro block, whatever the read ahead size is
+  const int64_t macro_block_size = (ObIOSender::SEQUENTIAL_READ_THRESHOLD + 1) * DIO_READ_ALIGN_SIZE;
+  OB_SERVER_BLOCK_MGR.super_block_.body_.macro_block_size_ = macro_block_size;
+  for (int64_t i = 0; i < ObIOSender::SEQUENTIAL_READ_THRESHOLD; ++i) {
+    ASSERT_SUCC(aio_read(i * DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE, handle));
+    pop_all();
+    check_read(handle, i * DIO_READ_ALIGN_SIZE, DIO_READ_ALIGN_SIZE);
+  }
+  const ObIOSender::ReadStream *stream = nullptr;
+  for (int64_t i = 0; i < ObIOSender::MAX_READ_STREAM_COUNT; ++i) {
+    if (sender_.read_streams_[i].fd_ == fd_) {
+      stream = &sender_.read_streams_[i];
+    }
+  }
+  ASSERT_NE(nullptr, stream);
+  ASSERT_EQ(macro_block_size, stream->read_ahead_end_);
+}
+
+
 struct IOPerfDevice
 {
   IOPerfDevice() : device_id_(0), media_id_(0), async_channel_count_(0), sync_channel_count_(0), max_io_depth_(0),
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/net/ob_addr.h"
+#include "storage/tx/ob_gts_source.h"
+#include "storage/tx/ob_gts_rpc.h"
+#include "storage/tx/ob_location_adapter.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace transaction;
+namespace unittest
+{
+
+class MyRequestRpc : public ObIGtsRequestRpc
+{
+public:
+  MyRequestRpc() : post_ret_(OB_SUCCESS), post_cnt_(0) {}
+  ~MyRequestRpc() {}
+  int start() { return OB_SUCCESS; }
+  int stop() { return OB_SUCCESS; }
+  int wait() { return OB_SUCCESS; }
+  void destroy() {}
+  int post(const uint64_t tenant_id, const ObAddr &server, const ObGtsRequest &msg)
+  {
+    UNUSED(tenant_id);
+    UNUSED(server);
+    UNUSED(msg);
+    if (OB_SUCCESS == post_ret_) {
+      ++post_cnt_;
+    }
+    return post_ret_;
+  }
+public:
+  int post_ret_;
+  int64_t post_cnt_;
+};
+
+class MyLocationAdapter : public ObILocationAdapter
+{
+public:
+  MyLocationAdapter() {}
+  ~MyLocationAdapter() {}
+  int init(share::schema::ObMultiVersionSchemaService *schema_service,
+      share::ObLocationService *location_service)
+  {
+    UNUSED(schema_service);
+    UNUSED(location_service);
+    return OB_SUCCESS;
+  }
+  void destroy() {}
+  int nonblock_get_leader(const int64_t cluster_id, const int64_t tenant_id, const share::ObLSID &ls_id,
+      ObAddr &leader)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    leader = leader_;
+    return OB_SUCCESS;
+  }
+  int nonblock_renew(const int64_t cluster_id, const int64_t tenant_id, const share::ObLSID &ls_id)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    return OB_SUCCESS;
+  }
+  int nonblock_get(const int64_t cluster_id, const int64_t tenant_id, const share::ObLSID &ls_id,
+      share::ObLSLocation &location)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    UNUSED(location);
+    return OB_NOT_SUPPORTED;
+  }
+public:
+  ObAddr leader_;
+};
+
+class TestObGtsSource : public ::testing::Test
+{
+public :
+  virtual void SetUp()
+  {
+    server_ = ObAddr(ObAddr::IPV4, "10.0.0.1", 10000);
+    location_adapter_.leader_ = ObAddr(ObAddr::IPV4, "10.0.0.2", 10000);
+    EXPECT_EQ(OB_SUCCESS, gts_source_.init(TENANT_ID, server_, &request_rpc_, &location_adapter_));
+  }
+  virtual void TearDown()
+  {
+    gts_source_.destroy();
+  }
+public:
+  static const uint64_t TENANT_ID = 1001;
+  ObAddr server_;
+  MyRequestRpc request_rpc_;
+  MyLocationAdapter location_adapter_;
+  ObGtsSource gts_source_;
+};
+
+TEST_F(TestObGtsSource, pending_query_kept_on_rpc_failure)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+  // the in-flight rpc is lost, and the pipelined requests wait for its response
+  gts_source_.has_pending_query_ = true;
+  request_rpc_.post_ret_ = OB_TIMEOUT;
+  EXPECT_EQ(OB_TIMEOUT, gts_source_.query_pending_gts_());
+  EXPECT_EQ(0, request_rpc_.post_cnt_);
+  // the pending requests are not dropped
+  EXPECT_TRUE(gts_source_.has_pending_query_);
+
+  // the next gts response sends the rpc for them
+  request_rpc_.post_ret_ = OB_SUCCESS;
+  bool update = false;
+  const MonotonicTs now = MonotonicTs::current_time();
+  EXPECT_EQ(OB_SUCCESS, gts_source_.update_gts(now, ObTimeUtility::current_time_ns(), now, update));
+  EXPECT_EQ(1, request_rpc_.post_cnt_);
+  EXPECT_FALSE(gts_source_.has_pending_query_);
+
+  // nothing is pending, no more rpc
+  EXPECT_EQ(OB_SUCCESS, gts_source_.query_pending_gts_());
+  EXPECT_EQ(1, request_rpc_.post_cnt_);
+}
+
+TEST_F(TestObGtsSource, pending_query_served_by_refresh)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+  gts_source_.has_pending_query_ = true;
+  request_rpc_.post_ret_ = OB_TIMEOUT;
+  EXPECT_EQ(OB_TIMEOUT, gts_source_.refresh_gts(false));
+  EXPECT_TRUE(gts_source_.has_pending_query_);
+
+  // the refresh rpc of ObTsMgr is sent after the pending requests, so it serves them
+  request_rpc_.post_ret_ = OB_SUCCESS;
+  EXPECT_EQ(OB_SUCCESS, gts_source_.refresh_gts(false));
+  EXPECT_EQ(1, request_rpc_.post_cnt_);
+  EXPECT_FALSE(gts_source_.has_pending_query_);
+}
+
+}//end of unittest
+}//end of oceanbase
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_gts_source.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}
@@ -166,6 +166,43 @@ TEST_F(TestObTrans, hashmap_init_invalid)
   EXPECT_EQ(0, map.count());
 }
 
+TEST_F(TestObTrans, hashmap_sharded_count)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+
+  TestHashMap map;
+  map.init(lib::ObMemAttr(OB_SERVER_TENANT_ID, "TestObTrans"));
+  const int64_t VALUE_CNT = 1000;
+  ObTransTestValue *v = NULL;
+  for (int64_t i = 1; i <= VALUE_CNT; ++i) {
+    ObTransTestValue *val = NULL;
+    EXPECT_EQ(OB_SUCCESS, map.alloc_value(val));
+    EXPECT_EQ(OB_SUCCESS, val->init(ObTransID(i)));
+    EXPECT_EQ(OB_SUCCESS, map.insert_and_get(ObTransID(i), val, &v));
+    map.revert(val);
+  }
+  EXPECT_EQ(VALUE_CNT, map.count());
+
+  int64_t shard_total = 0;
+  int64_t non_empty_shard = 0;
+  for (int64_t i = 0; i < TestHashMap::CNT_SHARD_NUM; ++i) {
+    shard_total += map.shard_count(i);
+    if (map.shard_count(i) > 0) {
+      non_empty_shard++;
+    }
+  }
+  EXPECT_EQ(VALUE_CNT, shard_total);
+  EXPECT_EQ(TestHashMap::CNT_SHARD_NUM, non_empty_shard);
+  EXPECT_EQ(0, map.shard_count(TestHashMap::CNT_SHARD_NUM));
+
+  RemoveFunctor remove_if_fn;
+  map.remove_if(remove_if_fn);
+  EXPECT_EQ(0, map.count());
+  for (int64_t i = 0; i < TestHashMap::CNT_SHARD_NUM; ++i) {
+    EXPECT_EQ(0, map.shard_count(i));
+  }
+}
+
 }//end of unittest
 }//end of oceanbase
 
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define protected public
+#define private public
+
+#include "storage/tx_table/ob_tx_data_cache.h"
+
+namespace oceanbase
+{
+using namespace ::testing;
+using namespace transaction;
+using namespace storage;
+
+namespace unittest
+{
+
+class TestTxDataCache : public ::testing::Test
+{
+public:
+  TestTxDataCache() : cache_(nullptr) {}
+  virtual void SetUp() override
+  {
+    cache_ = new ObTxDataThreadCache();
+  }
+  virtual void TearDown() override
+  {
+    delete cache_;
+    cache_ = nullptr;
+  }
+
+  void make_tx_data(const int64_t tx_id, const int32_t state, const int64_t commit_version, ObTxData &tx_data)
+  {
+    tx_data.reset();
+    tx_data.tx_id_ = ObTransID(tx_id);
+    tx_data.state_ = state;
+    tx_data.commit_version_ = commit_version;
+    tx_data.start_log_ts_ = 100;
+    tx_data.end_log_ts_ = 200;
+  }
+
+  ObTxDataCacheKey make_key(const int64_t tx_id, const int64_t epoch = 1)
+  {
+    return ObTxDataCacheKey(1001, &fake_tx_table_, epoch, ObTransID(tx_id));
+  }
+
+public:
+  ObTxDataThreadCache *cache_;
+  int64_t fake_tx_table_;
+};
+
+TEST_F(TestTxDataCache, decided_tx_only)
+{
+  ObTxData tx_data;
+  ObTxData cached;
+  ObUndoStatusNode undo_node;
+
+  make_tx_data(1, ObTxData::RUNNING, INT64_MAX, tx_data);
+  cache_->put(make_key(1), tx_data);
+  ASSERT_FALSE(cache_->get(make_key(1), cached, undo_node));
+
+  make_tx_data(2, ObTxData::COMMIT, 150, tx_data);
+  cache_->put(make_key(2), tx_data);
+  ASSERT_TRUE(cache_->get(make_key(2), cached, undo_node));
+  ASSERT_EQ(ObTxData::COMMIT, cached.state_);
+  ASSERT_EQ(150, cached.commit_version_);
+  ASSERT_EQ(200, cached.end_log_ts_);
+  ASSERT_EQ(nullptr, cached.undo_status_list_.head_);
+
+  make_tx_data(3, ObTxData::ABORT, 0, tx_data);
+  cache_->put(make_key(3), tx_data);
+  ASSERT_TRUE(cache_->get(make_key(3), cached, undo_node));
+  ASSERT_EQ(ObTxData::ABORT, cached.state_);
+}
+
+TEST_F(TestTxDataCache, epoch_change)
+{
+  ObTxData tx_data;
+  ObTxData cached;
+  ObUndoStatusNode undo_node;
+
+  make_tx_data(10, ObTxData::COMMIT, 150, tx_data);
+  cache_->put(make_key(10, 1), tx_data);
+  ASSERT_TRUE(cache_->get(make_key(10, 1), cached, undo_node));
+  // the tx table has been offline and online again
+  ASSERT_FALSE(cache_->get(make_key(10, 2), cached, undo_node));
+}
+
+TEST_F(TestTxDataCache, undo_status)
+{
+  ObTxData tx_data;
+  ObTxData cached;
+  ObUndoStatusNode undo_node;
+  ObUndoStatusNode first_node;
+  ObUndoStatusNode second_node;
+
+  make_tx_data(20, ObTxData::COMMIT, 150, tx_data);
+  first_node.size_ = 1;
+  first_node.undo_actions_[0] = ObUndoAction(10, 5);
+  tx_data.undo_status_list_.head_ = &first_node;
+  tx_data.undo_status_list_.undo_node_cnt_ = 1;
+  cache_->put(make_key(20), tx_data);
+  ASSERT_TRUE(cache_->get(make_key(20), cached, undo_node));
+  ASSERT_EQ(&undo_node, cached.undo_status_list_.head_);
+  ASSERT_TRUE(cached.undo_status_list_.is_contain(7));
+  ASSERT_FALSE(cached.undo_status_list_.is_contain(3));
+
+  // too many undo actions to be replicated
+  make_tx_data(21, ObTxData::COMMIT, 150, tx_data);
+  first_node.next_ = &second_node;
+  tx_data.undo_status_list_.head_ = &first_node;
+  tx_data.undo_status_list_.undo_node_cnt_ = 2;
+  cache_->put(make_key(21), tx_data);
+  ASSERT_FALSE(cache_->get(make_key(21), cached, undo_node));
+  tx_data.undo_status_list_.reset();
+}
+
+TEST_F(TestTxDataCache, lru_in_set)
+{
+  ObTxData tx_data;
+  ObTxData cached;
+  ObUndoStatusNode undo_node;
+  int64_t same_set_ids[ObTxDataThreadCache::WAY_CNT + 1];
+  int64_t cnt = 0;
+  const uint64_t target_set = make_key(1).hash() % ObTxDataThreadCache::SET_CNT;
+  for (int64_t tx_id = 1; cnt < ObTxDataThreadCache::WAY_CNT + 1; tx_id++) {
+    if (make_key(tx_id).hash() % ObTxDataThreadCache::SET_CNT == target_set) {
+      same_set_ids[cnt++] = tx_id;
+    }
+  }
+
+  for (int64_t i = 0; i < ObTxDataThreadCache::WAY_CNT; i++) {
+    make_tx_data(same_set_ids[i], ObTxData::COMMIT, 100 + i, tx_data);
+    cache_->put(make_key(same_set_ids[i]), tx_data);
+  }
+  // touch the oldest one, so the second one becomes the victim
+  ASSERT_TRUE(cache_->get(make_key(same_set_ids[0]), cached, undo_node));
+  make_tx_data(same_set_ids[2], ObTxData::COMMIT, 200, tx_data);
+  cache_->put(make_key(same_set_ids[2]), tx_data);
+
+  ASSERT_TRUE(cache_->get(make_key(same_set_ids[0]), cached, undo_node));
+  ASSERT_FALSE(cache_->get(make_key(same_set_ids[1]), cached, undo_node));
+  ASSERT_TRUE(cache_->get(make_key(same_set_ids[2]), cached, undo_node));
+  ASSERT_EQ(200, cached.commit_version_);
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_tx_data_cache.log*");
+  OB_LOGGER.set_file_name("test_tx_data_cache.log");
+  OB_LOGGER.set_log_level("INFO");
+  STORAGE_LOG(INFO, "begin unittest: test tx data cache");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}